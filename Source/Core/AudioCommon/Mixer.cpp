@@ -9,10 +9,12 @@
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/EventTracer.h"
 #include "Common/Logging/Log.h"
 #include "Common/MathUtil.h"
 #include "Common/Swap.h"
 #include "Core/ConfigManager.h"
+#include "Core/Core.h"
 
 Mixer::Mixer(unsigned int BackendSampleRate)
     : m_sampleRate(BackendSampleRate), m_stretcher(BackendSampleRate),
@@ -76,6 +78,26 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
+  if (ratio == 0x10000 && m_frac == 0)
+  {
+    // The input and output rates match (common when the backend runs at the
+    // title's streaming rate), so no interpolation is needed: just byteswap,
+    // apply volume and accumulate.
+    for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2;
+         currentSample += 2)
+    {
+      int sampleL = (Common::swap16(m_buffer[indexR & INDEX_MASK]) * lvolume) >> 8;
+      sampleL += samples[currentSample + 1];
+      samples[currentSample + 1] = MathUtil::Clamp(sampleL, -32767, 32767);
+
+      int sampleR = (Common::swap16(m_buffer[(indexR + 1) & INDEX_MASK]) * rvolume) >> 8;
+      sampleR += samples[currentSample];
+      samples[currentSample] = MathUtil::Clamp(sampleR, -32767, 32767);
+
+      indexR += 2;
+    }
+  }
+
   // TODO: consider a higher-quality resampling algorithm.
   for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
   {
@@ -126,17 +148,27 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
 
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
+  TRACE_EVENT_ZONE("Mixer::Mix");
+
   if (!samples)
     return 0;
 
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
-  if (SConfig::GetInstance().m_audio_stretch)
+  // When running unthrottled there is far more input audio than the backend can play,
+  // and time-stretching it is both expensive and inaudible garble. Fall back to plain
+  // mixing (which skips the excess input) until normal speed is restored.
+  const bool unthrottled =
+      SConfig::GetInstance().m_EmulationSpeed <= 0.0f || Core::GetIsThrottlerTempDisabled();
+
+  if (SConfig::GetInstance().m_audio_stretch && !unthrottled)
   {
     unsigned int available_samples =
         std::min(m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples());
 
-    m_scratch_buffer.fill(0);
+    // Only the frames the Mix() calls below fill in are handed to the
+    // stretcher, so don't clear the whole scratch buffer every callback.
+    memset(m_scratch_buffer.data(), 0, available_samples * 2 * sizeof(short));
 
     m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false);
     m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false);
@@ -59,7 +59,9 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
     // Decode
     const float* dpl2_fs = m_fsdecoder->decode(m_float_conversion_buffer.data());
 
-    // Add to ring buffer and fix channel mapping
+    // Fix channel mapping, then add the whole block to the ring buffer.
+    // The decoded block is reordered into m_float_conversion_buffer, whose
+    // contents have already been consumed by the decode above.
     // Maybe modify FreeSurround to output the correct mapping?
     // FreeSurround:
     // FL | FC | FR | BL | BR | LFE
@@ -67,13 +69,16 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
     // FL | FR | FC | LFE | BL | BR
     for (size_t i = 0; i < m_frame_block_size; ++i)
     {
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 0]);  // LEFTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 2]);  // RIGHTFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 1]);  // CENTREFRONT
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 5]);  // sub/lfe
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 3]);  // LEFTREAR
-      m_decoded_fifo.push(dpl2_fs[i * SURROUND_CHANNELS + 4]);  // RIGHTREAR
+      float* reordered = &m_float_conversion_buffer[i * SURROUND_CHANNELS];
+      reordered[0] = dpl2_fs[i * SURROUND_CHANNELS + 0];  // LEFTFRONT
+      reordered[1] = dpl2_fs[i * SURROUND_CHANNELS + 2];  // RIGHTFRONT
+      reordered[2] = dpl2_fs[i * SURROUND_CHANNELS + 1];  // CENTREFRONT
+      reordered[3] = dpl2_fs[i * SURROUND_CHANNELS + 5];  // sub/lfe
+      reordered[4] = dpl2_fs[i * SURROUND_CHANNELS + 3];  // LEFTREAR
+      reordered[5] = dpl2_fs[i * SURROUND_CHANNELS + 4];  // RIGHTREAR
     }
+    m_decoded_fifo.push_array(m_float_conversion_buffer.data(),
+                              m_frame_block_size * SURROUND_CHANNELS);
 
     remaining_frames = remaining_frames - static_cast<int>(m_frame_block_size);
     frame_index = frame_index + m_frame_block_size;
@@ -83,11 +88,7 @@ void SurroundDecoder::PutFrames(const short* in, const size_t num_frames_in)
 void SurroundDecoder::ReceiveFrames(float* out, const size_t num_frames_out)
 {
   // Copy to output array with desired num_frames_out
-  for (size_t i = 0, num_samples_output = num_frames_out * SURROUND_CHANNELS;
-       i < num_samples_output; ++i)
-  {
-    out[i] = m_decoded_fifo.pop_front();
-  }
+  m_decoded_fifo.pop_array(out, num_frames_out * SURROUND_CHANNELS);
 }
 
 }  // namespace AudioCommon
@@ -437,10 +437,22 @@ void WASAPIStream::SoundLoop()
     m_audio_renderer->GetBuffer(m_frames_in_buffer, &data);
     GetMixer()->Mix(reinterpret_cast<s16*>(data), m_frames_in_buffer);
 
-    float volume = SConfig::GetInstance().m_IsMuted ? 0 : SConfig::GetInstance().m_Volume / 100.;
+    // The mixer still has to run while muted so its FIFOs keep draining,
+    // but the engine can skip a silent buffer entirely.
+    if (SConfig::GetInstance().m_IsMuted)
+    {
+      m_audio_renderer->ReleaseBuffer(m_frames_in_buffer, AUDCLNT_BUFFERFLAGS_SILENT);
+      continue;
+    }
 
-    for (u32 i = 0; i < m_frames_in_buffer * 2; i++)
-      reinterpret_cast<s16*>(data)[i] = static_cast<s16>(reinterpret_cast<s16*>(data)[i] * volume);
+    const float volume = SConfig::GetInstance().m_Volume / 100.f;
+
+    if (volume != 1.0f)
+    {
+      for (u32 i = 0; i < m_frames_in_buffer * 2; i++)
+        reinterpret_cast<s16*>(data)[i] =
+            static_cast<s16>(reinterpret_cast<s16*>(data)[i] * volume);
+    }
 
     m_audio_renderer->ReleaseBuffer(m_frames_in_buffer, 0);
   }
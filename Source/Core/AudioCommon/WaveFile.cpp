@@ -129,7 +129,10 @@ void WaveFileWriter::AddStereoSamplesBE(const short* sample_data, u32 count, int
     for (u32 i = 0; i < count * 2; i++)
     {
       if (sample_data[i])
+      {
         all_zero = false;
+        break;
+      }
     }
 
     if (all_zero)
@@ -2086,6 +2086,41 @@ void ARM64XEmitter::MOVI2R(ARM64Reg Rd, u64 imm, bool optimize)
     }
   }
 
+  // Starting with MOVN sets every other part to 0xFFFF for free, so it needs
+  // one instruction per part that isn't all ones. Prefer it over building up
+  // from zero for mostly-ones values, e.g. small negative 64-bit constants,
+  // which would otherwise take a full MOVZ+MOVK chain.
+  if (optimize)
+  {
+    BitSet32 upload_part_negated(0);
+    for (unsigned int i = 0; i < parts; ++i)
+    {
+      if (((imm >> (i * 16)) & 0xFFFF) != 0xFFFF)
+        upload_part_negated[i] = 1;
+    }
+
+    if (upload_part_negated.Count() < upload_part.Count())
+    {
+      bool use_movn = true;
+      for (unsigned int i = 0; i < parts; ++i)
+      {
+        if (!upload_part_negated[i])
+          continue;
+
+        if (use_movn)
+        {
+          MOVN(Rd, (~imm >> (i * 16)) & 0xFFFF, (ShiftAmount)i);
+          use_movn = false;
+        }
+        else
+        {
+          MOVK(Rd, (imm >> (i * 16)) & 0xFFFF, (ShiftAmount)i);
+        }
+      }
+      return;
+    }
+  }
+
   for (unsigned i = 0; i < parts; ++i)
   {
     if (use_movz && upload_part[i])
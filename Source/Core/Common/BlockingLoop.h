@@ -62,10 +62,11 @@ public:
     // but for the first thread for free
     std::lock_guard<std::mutex> lk(m_wait_lock);
 
-    // Wait for the worker thread to finish.
+    // Wait for the worker thread to finish. The worker is usually already
+    // executing our request, so spin briefly before paying for a kernel sleep.
     while (!IsDone())
     {
-      m_done_event.Wait();
+      m_done_event.WaitWithSpin();
     }
 
     // As we wanted to wait for the other thread, there is likely no work remaining.
@@ -182,7 +183,9 @@ public:
         }
         else
         {
-          m_new_work_event.Wait();
+          // New work tends to arrive right after we decided to sleep, so spin
+          // briefly first and save both sides the wakeup syscall.
+          m_new_work_event.WaitWithSpin();
         }
         break;
       }
@@ -0,0 +1,88 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <initializer_list>
+
+#include "Common/CPUDetect.h"
+
+// Runtime CPU-feature function multi-versioning.
+//
+// Hot loops with SIMD variants (the texture decoder, the hash functions, ...)
+// each used to hand-roll their cpu_info checks. Register the variants of a
+// kernel once instead and resolve them into a plain function pointer, so every
+// call is a single direct indirection with no per-call feature test:
+//
+//   static const auto s_decode = Common::SelectVariant<DecodeFunction>({
+//       {Common::DispatchLevel::Scalar, DecodeScalar},
+//       {Common::DispatchLevel::SSE4, DecodeSSE4},
+//       {Common::DispatchLevel::AVX2, DecodeAVX2},
+//   });
+//
+// Variants whose level the host (or the target architecture) does not support
+// are skipped, and later entries win among the supported ones, so list them
+// from most portable to most specialized. A Scalar variant should always be
+// present. Resolve at first use or from an init function, not from a global
+// initializer, as cpu_info may not have been constructed yet.
+
+namespace Common
+{
+enum class DispatchLevel
+{
+  Scalar,  // Always supported.
+
+  // x86/x64
+  SSSE3,
+  SSE4,  // SSE4.1 and SSE4.2
+  AVX2,
+
+  // AArch64
+  NEON,      // ASIMD
+  ArmCRC32,  // CRC32 instructions
+};
+
+inline bool IsDispatchLevelSupported(DispatchLevel level)
+{
+  switch (level)
+  {
+  case DispatchLevel::Scalar:
+    return true;
+#if defined(_M_X86_64) || defined(_M_X86)
+  case DispatchLevel::SSSE3:
+    return cpu_info.bSSSE3;
+  case DispatchLevel::SSE4:
+    return cpu_info.bSSE4_1 && cpu_info.bSSE4_2;
+  case DispatchLevel::AVX2:
+    return cpu_info.bAVX2;
+#elif defined(_M_ARM_64)
+  case DispatchLevel::NEON:
+    return cpu_info.bASIMD;
+  case DispatchLevel::ArmCRC32:
+    return cpu_info.bCRC32;
+#endif
+  default:
+    return false;
+  }
+}
+
+template <typename Func>
+struct KernelVariant
+{
+  DispatchLevel level;
+  Func function;
+};
+
+template <typename Func>
+Func SelectVariant(std::initializer_list<KernelVariant<Func>> variants)
+{
+  Func best = nullptr;
+  for (const KernelVariant<Func>& variant : variants)
+  {
+    if (IsDispatchLevelSupported(variant.level))
+      best = variant.function;
+  }
+  return best;
+}
+}  // namespace Common
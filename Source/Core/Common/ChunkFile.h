@@ -43,9 +43,10 @@ public:
   enum Mode
   {
     MODE_READ = 1,  // load
-    MODE_WRITE,     // save
+    MODE_WRITE,     // save to a preallocated buffer
     MODE_MEASURE,   // calculate size
     MODE_VERIFY,    // compare
+    MODE_APPEND,    // save, appending to a growable buffer
   };
 
   u8** ptr;
@@ -53,6 +54,12 @@ public:
 
 public:
   PointerWrap(u8** ptr_, Mode mode_) : ptr(ptr_), mode(mode_) {}
+  // Single-pass save: everything is appended to the vector, which grows as
+  // needed, so no measuring dry run is required to size a buffer up front.
+  explicit PointerWrap(std::vector<u8>* buffer)
+      : ptr(&m_append_ptr), mode(MODE_APPEND), m_append_buffer(buffer)
+  {
+  }
   void SetMode(Mode mode_) { mode = mode_; }
   Mode GetMode() const { return mode; }
   template <typename K, class V>
@@ -76,6 +83,7 @@ public:
     case MODE_WRITE:
     case MODE_MEASURE:
     case MODE_VERIFY:
+    case MODE_APPEND:
       for (auto& elem : x)
       {
         Do(elem.first);
@@ -105,6 +113,7 @@ public:
     case MODE_WRITE:
     case MODE_MEASURE:
     case MODE_VERIFY:
+    case MODE_APPEND:
       for (const V& val : x)
       {
         Do(val);
@@ -255,6 +264,9 @@ public:
   }
 
 private:
+  std::vector<u8>* m_append_buffer = nullptr;
+  u8* m_append_ptr = nullptr;
+
   template <typename T>
   void DoContiguousContainer(T& container)
   {
@@ -287,6 +299,11 @@ private:
     case MODE_MEASURE:
       break;
 
+    case MODE_APPEND:
+      m_append_buffer->insert(m_append_buffer->end(), static_cast<const u8*>(data),
+                              static_cast<const u8*>(data) + size);
+      break;
+
     case MODE_VERIFY:
       DEBUG_ASSERT_MSG(COMMON, !memcmp(data, *ptr, size),
                        "Savestate verification failure: buf %p != %p (size %u).\n", data, *ptr,
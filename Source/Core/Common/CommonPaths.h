@@ -98,6 +98,7 @@
 // Files in the directory returned by GetUserPath(D_MEMORYWATCHER_IDX)
 #define MEMORYWATCHER_LOCATIONS "Locations.txt"
 #define MEMORYWATCHER_SOCKET "MemoryWatcher"
+#define MEMORYWATCHER_SHM "SharedMemory"
 
 // Sys files
 #define TOTALDB "totaldb.dsy"
@@ -126,3 +127,4 @@
 // Subdirs in Sys
 #define GC_SYS_DIR "GC"
 #define WII_SYS_DIR "Wii"
+#define PIPELINE_UID_CACHES_DIR "PipelineUIDCaches"
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <map>
 
@@ -13,6 +14,33 @@ namespace Config
 static Layers s_layers;
 static std::list<ConfigChangedCallback> s_callbacks;
 static u32 s_callback_guards = 0;
+// Starts at 1 so that a ConfigInfo's initial cached_version of 0 always
+// counts as out of date.
+static std::atomic<u64> s_config_version{1};
+// Per-system change counters, so subscribers that only care about one system
+// (e.g. VideoConfig about GFX) can cheaply skip unrelated changes.
+static std::array<std::atomic<u64>, 8> s_system_versions{};
+
+static std::atomic<u64>& SystemVersion(System system)
+{
+  return s_system_versions[static_cast<size_t>(system)];
+}
+
+// The common tail of the InvokeConfigChangedCallbacks overloads; the version
+// bumps happen in the callers so a deferred (guarded) invocation doesn't
+// re-dirty systems that didn't change.
+static void OnConfigChanged()
+{
+  // Invalidate the cached values even while callbacks are deferred, so
+  // reads between the changes and the guard's release aren't stale.
+  s_config_version.fetch_add(1, std::memory_order_release);
+
+  if (s_callback_guards)
+    return;
+
+  for (const auto& callback : s_callbacks)
+    callback();
+}
 
 Layers* GetLayers()
 {
@@ -54,11 +82,22 @@ void AddConfigChangedCallback(ConfigChangedCallback func)
 
 void InvokeConfigChangedCallbacks()
 {
-  if (s_callback_guards)
-    return;
+  // No information about what changed - assume everything did.
+  for (auto& version : s_system_versions)
+    version.fetch_add(1, std::memory_order_release);
 
-  for (const auto& callback : s_callbacks)
-    callback();
+  OnConfigChanged();
+}
+
+void InvokeConfigChangedCallbacks(System system)
+{
+  SystemVersion(system).fetch_add(1, std::memory_order_release);
+  OnConfigChanged();
+}
+
+u64 GetConfigVersion(System system)
+{
+  return SystemVersion(system).load(std::memory_order_acquire);
 }
 
 // Explicit load and save of layers
@@ -86,11 +125,18 @@ void Shutdown()
 {
   s_layers.clear();
   s_callbacks.clear();
+  s_config_version.fetch_add(1, std::memory_order_release);
 }
 
 void ClearCurrentRunLayer()
 {
   s_layers[LayerType::CurrentRun] = std::make_unique<Layer>(LayerType::CurrentRun);
+  s_config_version.fetch_add(1, std::memory_order_release);
+}
+
+u64 GetConfigVersion()
+{
+  return s_config_version.load(std::memory_order_acquire);
 }
 
 static const std::map<System, std::string> system_to_name = {
@@ -152,7 +198,9 @@ ConfigChangeCallbackGuard::~ConfigChangeCallbackGuard()
   if (--s_callback_guards)
     return;
 
-  InvokeConfigChangedCallbacks();
+  // The deferred changes already bumped their system versions; just run the
+  // callbacks.
+  OnConfigChanged();
 }
 
 }  // namespace Config
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 
+#include "Common/CommonTypes.h"
 #include "Common/Config/ConfigInfo.h"
 #include "Common/Config/Enums.h"
 #include "Common/Config/Layer.h"
@@ -29,6 +32,9 @@ bool LayerExists(LayerType layer);
 
 void AddConfigChangedCallback(ConfigChangedCallback func);
 void InvokeConfigChangedCallbacks();
+// Variant for when only one system's values changed; subscribers watching
+// other systems can skip their reload via GetConfigVersion(System).
+void InvokeConfigChangedCallbacks(System system);
 
 // Explicit load and save of layers
 void Load();
@@ -43,6 +49,12 @@ std::optional<System> GetSystemFromName(const std::string& system);
 const std::string& GetLayerName(LayerType layer);
 LayerType GetActiveLayerForConfig(const ConfigLocation&);
 
+// Incremented whenever any layer changes. Used to invalidate the per-info
+// value caches, so steady-state Get() doesn't walk the layers.
+u64 GetConfigVersion();
+// Incremented whenever a value belonging to the given system changes.
+u64 GetConfigVersion(System system);
+
 template <typename T>
 T Get(LayerType layer, const ConfigInfo<T>& info)
 {
@@ -54,7 +66,26 @@ T Get(LayerType layer, const ConfigInfo<T>& info)
 template <typename T>
 T Get(const ConfigInfo<T>& info)
 {
-  return GetLayer(GetActiveLayerForConfig(info.location))->Get(info);
+  if constexpr (std::is_trivially_copyable_v<T>)
+  {
+    // Resolving walks every layer doing map lookups keyed by strings, which
+    // is too slow for the emulation paths that read settings constantly, so
+    // cache the resolved value in the info until any layer changes. Only
+    // trivially copyable values are cached: a concurrent reader may then at
+    // worst see a stale value, while a std::string couldn't be swapped out
+    // safely.
+    const u64 config_version = GetConfigVersion();
+    if (info.cached_version.load(std::memory_order_acquire) != config_version)
+    {
+      info.cached_value = GetLayer(GetActiveLayerForConfig(info.location))->Get(info);
+      info.cached_version.store(config_version, std::memory_order_release);
+    }
+    return info.cached_value;
+  }
+  else
+  {
+    return GetLayer(GetActiveLayerForConfig(info.location))->Get(info);
+  }
 }
 
 template <typename T>
@@ -72,8 +103,10 @@ LayerType GetActiveLayerForConfig(const ConfigInfo<T>& info)
 template <typename T>
 void Set(LayerType layer, const ConfigInfo<T>& info, const std::common_type_t<T>& value)
 {
-  GetLayer(layer)->Set(info, value);
-  InvokeConfigChangedCallbacks();
+  // Only notify when the stored value actually changed, so re-applying a
+  // whole dialog's worth of unchanged settings doesn't storm the callbacks.
+  if (GetLayer(layer)->Set(info, value))
+    InvokeConfigChangedCallbacks(info.location.system);
 }
 
 template <typename T>
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <type_traits>
 
+#include "Common/CommonTypes.h"
 #include "Common/Config/Enums.h"
 
 namespace Config
@@ -37,6 +39,11 @@ struct ConfigInfo
   {
   }
 
+  // The cache is not copied; the copy starts out unresolved.
+  ConfigInfo(const ConfigInfo& other) : location{other.location}, default_value{other.default_value}
+  {
+  }
+
   // Make it easy to convert ConfigInfo<Enum> into ConfigInfo<UnderlyingType<Enum>>
   // so that enum settings can still easily work with code that doesn't care about the enum values.
   template <typename Enum,
@@ -49,5 +56,10 @@ struct ConfigInfo
 
   ConfigLocation location;
   T default_value;
+
+  // Cache of the value this info resolves to, maintained by Config::Get.
+  // Compared against the global config version; 0 means not resolved yet.
+  mutable T cached_value{};
+  mutable std::atomic<u64> cached_version{0};
 };
 }
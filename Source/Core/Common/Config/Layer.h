@@ -117,25 +117,29 @@ public:
     return detail::TryParse<T>(*str_value);
   }
 
+  // Setters return whether the stored value actually changed, so callers can
+  // skip change notifications for writes that are no-ops (e.g. a settings
+  // dialog re-applying every key).
   template <typename T>
-  void Set(const ConfigInfo<T>& config_info, const std::common_type_t<T>& value)
+  bool Set(const ConfigInfo<T>& config_info, const std::common_type_t<T>& value)
   {
-    Set(config_info.location, value);
+    return Set(config_info.location, value);
   }
 
   template <typename T>
-  void Set(const ConfigLocation& location, const T& value)
+  bool Set(const ConfigLocation& location, const T& value)
   {
-    Set(location, ValueToString(value));
+    return Set(location, ValueToString(value));
   }
 
-  void Set(const ConfigLocation& location, const std::string& new_value)
+  bool Set(const ConfigLocation& location, const std::string& new_value)
   {
     std::optional<std::string>& current_value = m_map[location];
     if (current_value == new_value)
-      return;
+      return false;
     m_is_dirty = true;
     current_value = new_value;
+    return true;
   }
 
   Section GetSection(System system, const std::string& section);
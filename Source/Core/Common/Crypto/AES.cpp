@@ -10,10 +10,9 @@ namespace Common
 {
 namespace AES
 {
-std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size, Mode mode)
+void DecryptEncrypt(const u8* key, u8* iv, const u8* src, u8* dst, size_t size, Mode mode)
 {
   mbedtls_aes_context aes_ctx;
-  std::vector<u8> buffer(size);
 
   if (mode == Mode::Encrypt)
     mbedtls_aes_setkey_enc(&aes_ctx, key, 128);
@@ -21,8 +20,23 @@ std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size
     mbedtls_aes_setkey_dec(&aes_ctx, key, 128);
 
   mbedtls_aes_crypt_cbc(&aes_ctx, mode == Mode::Encrypt ? MBEDTLS_AES_ENCRYPT : MBEDTLS_AES_DECRYPT,
-                        size, iv, src, buffer.data());
+                        size, iv, src, dst);
+}
+
+void Decrypt(const u8* key, u8* iv, const u8* src, u8* dst, size_t size)
+{
+  DecryptEncrypt(key, iv, src, dst, size, Mode::Decrypt);
+}
 
+void Encrypt(const u8* key, u8* iv, const u8* src, u8* dst, size_t size)
+{
+  DecryptEncrypt(key, iv, src, dst, size, Mode::Encrypt);
+}
+
+std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size, Mode mode)
+{
+  std::vector<u8> buffer(size);
+  DecryptEncrypt(key, iv, src, buffer.data(), size, mode);
   return buffer;
 }
 
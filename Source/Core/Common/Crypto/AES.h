@@ -18,6 +18,12 @@ enum class Mode
   Decrypt,
   Encrypt,
 };
+// dst must be able to hold size bytes. Callers that process many blocks should
+// prefer these over the allocating variants below and reuse the output buffer.
+void DecryptEncrypt(const u8* key, u8* iv, const u8* src, u8* dst, size_t size, Mode mode);
+void Decrypt(const u8* key, u8* iv, const u8* src, u8* dst, size_t size);
+void Encrypt(const u8* key, u8* iv, const u8* src, u8* dst, size_t size);
+
 std::vector<u8> DecryptEncrypt(const u8* key, u8* iv, const u8* src, size_t size, Mode mode);
 
 // Convenience functions
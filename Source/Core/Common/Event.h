@@ -21,6 +21,7 @@
 #include <mutex>
 
 #include "Common/Flag.h"
+#include "Common/Thread.h"
 
 namespace Common
 {
@@ -45,6 +46,23 @@ public:
     m_condvar.wait(lk, [&] { return m_flag.TestAndClear(); });
   }
 
+  // Adaptive wait: spin for a short while before sleeping on the condition
+  // variable. The kernel sleep/wake round trip costs several microseconds per
+  // handoff, so for events that are usually signalled almost immediately at
+  // high rates (e.g. CPU-GPU syncing) spinning first is a net win. Don't use
+  // this for events that commonly stay idle for a long time.
+  void WaitWithSpin()
+  {
+    for (int i = 0; i < 32; i++)
+    {
+      if (m_flag.TestAndClear())
+        return;
+      YieldCPU();
+    }
+
+    Wait();
+  }
+
   template <class Rep, class Period>
   bool WaitFor(const std::chrono::duration<Rep, Period>& rel_time)
   {
@@ -0,0 +1,155 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/EventTracer.h"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Common/FileUtil.h"
+#include "Common/Logging/Log.h"
+#include "Common/Thread.h"
+#include "Common/Timer.h"
+
+namespace Common
+{
+namespace EventTracer
+{
+namespace
+{
+struct Event
+{
+  const char* name;
+  u64 begin_us;
+  u64 end_us;
+};
+
+struct ThreadBuffer
+{
+  std::string name;
+  int id = 0;
+  std::vector<Event> events;
+  // Stack of open zones; only ever touched by the owning thread.
+  std::vector<std::pair<const char*, u64>> stack;
+};
+
+// Preallocated so the common case of recording a zone never allocates.
+constexpr size_t RESERVED_EVENTS = 0x20000;
+
+static std::atomic<bool> s_capturing{false};
+static u64 s_capture_start_us = 0;
+
+// Buffers are registered once per thread and intentionally leaked, so
+// EndCapture can still serialize events of threads that have since exited.
+static std::mutex s_registry_mutex;
+static std::vector<ThreadBuffer*> s_registry;
+
+static thread_local ThreadBuffer* tls_buffer = nullptr;
+
+static ThreadBuffer* GetThreadBuffer()
+{
+  if (!tls_buffer)
+  {
+    auto* buffer = new ThreadBuffer();
+    buffer->events.reserve(RESERVED_EVENTS);
+
+    std::lock_guard<std::mutex> lk(s_registry_mutex);
+    buffer->id = static_cast<int>(s_registry.size());
+    s_registry.push_back(buffer);
+    tls_buffer = buffer;
+  }
+  return tls_buffer;
+}
+}  // Anonymous namespace
+
+void BeginCapture()
+{
+  std::lock_guard<std::mutex> lk(s_registry_mutex);
+  for (ThreadBuffer* buffer : s_registry)
+    buffer->events.clear();
+
+  s_capture_start_us = Timer::GetTimeUs();
+  s_capturing.store(true, std::memory_order_release);
+}
+
+void EndCapture(const std::string& filename)
+{
+  if (!s_capturing.exchange(false))
+    return;
+
+  // Give zones that are just being recorded on other threads a moment to
+  // finish; anything still open after that is dropped.
+  SleepCurrentThread(10);
+
+  std::lock_guard<std::mutex> lk(s_registry_mutex);
+
+  std::ofstream file;
+  File::OpenFStream(file, filename, std::ios_base::out);
+  if (!file.is_open())
+  {
+    ERROR_LOG(COMMON, "EventTracer: failed to open %s", filename.c_str());
+    return;
+  }
+
+  size_t num_events = 0;
+  file << "{\"traceEvents\":[";
+  bool first = true;
+  for (ThreadBuffer* buffer : s_registry)
+  {
+    if (!buffer->name.empty())
+    {
+      file << (first ? "\n" : ",\n");
+      first = false;
+      file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id
+           << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+    }
+
+    for (const Event& event : buffer->events)
+    {
+      file << (first ? "\n" : ",\n");
+      first = false;
+      file << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id
+           << ",\"ts\":" << (event.begin_us - s_capture_start_us)
+           << ",\"dur\":" << (event.end_us - event.begin_us) << "}";
+    }
+    num_events += buffer->events.size();
+    buffer->events.clear();
+    buffer->stack.clear();
+  }
+  file << "\n]}\n";
+
+  NOTICE_LOG(COMMON, "EventTracer: wrote %zu events to %s", num_events, filename.c_str());
+}
+
+bool IsCapturing()
+{
+  return s_capturing.load(std::memory_order_relaxed);
+}
+
+void RegisterThread(const char* name)
+{
+  GetThreadBuffer()->name = name;
+}
+
+void PushZone(const char* name)
+{
+  ThreadBuffer* buffer = GetThreadBuffer();
+  buffer->stack.emplace_back(name, Timer::GetTimeUs());
+}
+
+void PopZone()
+{
+  ThreadBuffer* buffer = GetThreadBuffer();
+  if (buffer->stack.empty())
+    return;
+
+  const auto zone = buffer->stack.back();
+  buffer->stack.pop_back();
+  buffer->events.push_back({zone.first, zone.second, Timer::GetTimeUs()});
+}
+}  // namespace EventTracer
+}  // namespace Common
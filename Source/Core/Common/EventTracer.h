@@ -0,0 +1,71 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+#include "Common/CommonTypes.h"
+
+// Cross-thread event tracer producing chrome://tracing JSON.
+//
+// Scoped zones record begin/end timestamps into per-thread buffers, so the
+// hot path takes no locks and the zones are cheap enough to stay compiled in:
+// outside a capture a zone costs a single atomic load. Captures are bracketed
+// with BeginCapture()/EndCapture() (e.g. temporarily from code around a
+// misbehaving scene), and the resulting file loads in chrome://tracing or
+// Perfetto for a timeline view across the CPU, GPU, DVD and audio threads.
+//
+// Usage:
+//   TRACE_EVENT_THREAD("GPU");           // once per thread, names its track
+//   { TRACE_EVENT_ZONE("TexCache::Load"); DoWork(); }  // zones may nest
+
+namespace Common
+{
+namespace EventTracer
+{
+// Starts recording zones on all threads.
+void BeginCapture();
+
+// Stops recording and writes the capture as chrome trace JSON. Stopping is
+// best-effort with respect to zones still open on other threads; those are
+// dropped.
+void EndCapture(const std::string& filename);
+
+bool IsCapturing();
+
+// Names the calling thread's track in the capture.
+void RegisterThread(const char* name);
+
+void PushZone(const char* name);
+void PopZone();
+
+class ScopedZone
+{
+public:
+  explicit ScopedZone(const char* name)
+  {
+    if (IsCapturing())
+    {
+      PushZone(name);
+      m_active = true;
+    }
+  }
+  ~ScopedZone()
+  {
+    if (m_active)
+      PopZone();
+  }
+
+  ScopedZone(const ScopedZone&) = delete;
+  ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+  bool m_active = false;
+};
+}  // namespace EventTracer
+}  // namespace Common
+
+#define TRACE_EVENT_THREAD(name) Common::EventTracer::RegisterThread(name)
+#define TRACE_EVENT_ZONE(name) Common::EventTracer::ScopedZone scoped_trace_zone_(name)
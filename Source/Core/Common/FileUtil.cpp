@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
@@ -11,9 +12,11 @@
 #include <limits.h>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
+#include "Common/CPUDetect.h"
 #include "Common/Common.h"
 #include "Common/CommonFuncs.h"
 #include "Common/CommonPaths.h"
@@ -104,6 +107,11 @@ u64 FileInfo::GetSize() const
   return IsFile() ? m_stat.st_size : 0;
 }
 
+u64 FileInfo::GetModificationTime() const
+{
+  return m_exists ? static_cast<u64>(m_stat.st_mtime) : 0;
+}
+
 // Returns true if the path exists
 bool Exists(const std::string& path)
 {
@@ -397,7 +405,7 @@ bool CreateEmptyFile(const std::string& filename)
 }
 
 // Recursive or non-recursive list of files and directories under directory.
-FSTEntry ScanDirectoryTree(const std::string& directory, bool recursive)
+static FSTEntry ScanDirectoryTreeSerial(const std::string& directory, bool recursive)
 {
   INFO_LOG(COMMON, "ScanDirectoryTree: directory %s", directory.c_str());
   FSTEntry parent_entry;
@@ -432,26 +440,43 @@ FSTEntry ScanDirectoryTree(const std::string& directory, bool recursive)
       continue;
     auto physical_name = directory + DIR_SEP + virtual_name;
     FSTEntry entry;
-    const FileInfo file_info(physical_name);
-    entry.isDirectory = file_info.IsDirectory();
+#ifdef _WIN32
+    // The find data already carries the type and size, so no extra
+    // per-entry metadata lookup is needed.
+    entry.isDirectory = (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+    const u64 found_size = (static_cast<u64>(ffd.nFileSizeHigh) << 32) | ffd.nFileSizeLow;
+#else
+    // Most filesystems report the entry type in the dirent, which spares a
+    // stat per directory; DT_UNKNOWN and symlinks still need the real lookup.
+    if (result->d_type == DT_DIR)
+      entry.isDirectory = true;
+    else if (result->d_type == DT_REG)
+      entry.isDirectory = false;
+    else
+      entry.isDirectory = FileInfo(physical_name).IsDirectory();
+#endif
     if (entry.isDirectory)
     {
       if (recursive)
-        entry = ScanDirectoryTree(physical_name, true);
+        entry = ScanDirectoryTreeSerial(physical_name, true);
       else
         entry.size = 0;
       parent_entry.size += entry.size;
     }
     else
     {
-      entry.size = file_info.GetSize();
+#ifdef _WIN32
+      entry.size = found_size;
+#else
+      entry.size = FileInfo(physical_name).GetSize();
+#endif
     }
     entry.virtualName = virtual_name;
-    entry.physicalName = physical_name;
+    entry.physicalName = std::move(physical_name);
 
     ++parent_entry.size;
     // Push into the tree
-    parent_entry.children.push_back(entry);
+    parent_entry.children.push_back(std::move(entry));
 #ifdef _WIN32
   } while (FindNextFile(hFind, &ffd) != 0);
   FindClose(hFind);
@@ -463,6 +488,56 @@ FSTEntry ScanDirectoryTree(const std::string& directory, bool recursive)
   return parent_entry;
 }
 
+FSTEntry ScanDirectoryTree(const std::string& directory, bool recursive)
+{
+  FSTEntry parent_entry = ScanDirectoryTreeSerial(directory, false);
+  if (!recursive)
+    return parent_entry;
+
+  // Descend into the top-level subdirectories on worker threads. The scan is
+  // dominated by per-entry metadata lookups, so overlapping them matters on
+  // network storage where every lookup is a round trip.
+  std::vector<FSTEntry*> subdirs;
+  for (FSTEntry& entry : parent_entry.children)
+  {
+    if (entry.isDirectory)
+      subdirs.push_back(&entry);
+  }
+  if (subdirs.empty())
+    return parent_entry;
+
+  const u32 num_threads = static_cast<u32>(
+      std::min<size_t>(std::min(std::max(cpu_info.num_cores, 1), 8), subdirs.size()));
+
+  std::atomic<size_t> next_subdir{0};
+  const auto scan_worker = [&] {
+    size_t i;
+    while ((i = next_subdir.fetch_add(1)) < subdirs.size())
+    {
+      FSTEntry scanned = ScanDirectoryTreeSerial(subdirs[i]->physicalName, true);
+      scanned.virtualName = std::move(subdirs[i]->virtualName);
+      *subdirs[i] = std::move(scanned);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (u32 i = 1; i < num_threads; i++)
+    threads.emplace_back(scan_worker);
+  scan_worker();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  // Recompute the subtree count now that the subdirectories are filled in.
+  parent_entry.size = parent_entry.children.size();
+  for (const FSTEntry& entry : parent_entry.children)
+  {
+    if (entry.isDirectory)
+      parent_entry.size += entry.size;
+  }
+
+  return parent_entry;
+}
+
 // Deletes the given directory and anything under it. Returns true on success.
 bool DeleteDirRecursively(const std::string& directory)
 {
@@ -805,6 +880,7 @@ static void RebuildUserDirectories(unsigned int dir_index)
         s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_LOCATIONS;
     s_user_paths[F_MEMORYWATCHERSOCKET_IDX] =
         s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_SOCKET;
+    s_user_paths[F_MEMORYWATCHERSHM_IDX] = s_user_paths[D_MEMORYWATCHER_IDX] + MEMORYWATCHER_SHM;
 
     // The shader cache has moved to the cache directory, so remove the old one.
     // TODO: remove that someday.
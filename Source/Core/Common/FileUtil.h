@@ -66,6 +66,7 @@ enum
   F_GCSRAM_IDX,
   F_MEMORYWATCHERLOCATIONS_IDX,
   F_MEMORYWATCHERSOCKET_IDX,
+  F_MEMORYWATCHERSHM_IDX,
   F_WIISDCARD_IDX,
   NUM_PATH_INDICES
 };
@@ -101,6 +102,8 @@ public:
   bool IsFile() const;
   // Returns the size of a file (or returns 0 if the path doesn't refer to a file)
   u64 GetSize() const;
+  // Returns the time of last modification (or returns 0 if the path doesn't exist)
+  u64 GetModificationTime() const;
 
 private:
   struct stat m_stat;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <utility>
@@ -48,6 +49,39 @@ public:
     return std::move(temp);
   }
 
+  // Bulk enqueue from a contiguous buffer; copies at most two spans of the
+  // backing storage instead of paying the wrap check per element.
+  void push_array(const T* t, size_t num)
+  {
+    while (num > 0)
+    {
+      const int len = static_cast<int>(std::min(num, static_cast<size_t>(N - tail)));
+      std::copy_n(t, len, storage.begin() + tail);
+      t += len;
+      tail += len;
+      if (tail == N)
+        tail = 0;
+      count += len;
+      num -= len;
+    }
+  }
+
+  // Bulk dequeue into a contiguous buffer; same idea as push_array.
+  void pop_array(T* t, size_t num)
+  {
+    while (num > 0)
+    {
+      const int len = static_cast<int>(std::min(num, static_cast<size_t>(N - head)));
+      std::copy_n(storage.begin() + head, len, t);
+      t += len;
+      head += len;
+      if (head == N)
+        head = 0;
+      count -= len;
+      num -= len;
+    }
+  }
+
   T& front() { return storage[head]; }
   const T& front() const { return storage[head]; }
   size_t size() const { return count; }
@@ -2279,6 +2279,14 @@ u32* GekkoDisassembler::DoDisassembly(bool big_endian)
 // simplified interface
 std::string GekkoDisassembler::Disassemble(u32 opcode, u32 current_instruction_address,
                                            bool big_endian)
+{
+  std::string result;
+  Disassemble(opcode, current_instruction_address, &result, big_endian);
+  return result;
+}
+
+void GekkoDisassembler::Disassemble(u32 opcode, u32 current_instruction_address, std::string* out,
+                                    bool big_endian)
 {
   u32 opc = opcode;
   u32 addr = current_instruction_address;
@@ -2288,7 +2296,9 @@ std::string GekkoDisassembler::Disassemble(u32 opcode, u32 current_instruction_a
 
   DoDisassembly(big_endian);
 
-  return m_opcode.append("\t").append(m_operands);
+  out->append(m_opcode);
+  out->push_back('\t');
+  out->append(m_operands);
 }
 
 static const char* gprnames[] = {
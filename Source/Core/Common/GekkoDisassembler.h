@@ -47,6 +47,11 @@ class GekkoDisassembler final
 public:
   static std::string Disassemble(u32 opcode, u32 current_instruction_address,
                                  bool big_endian = true);
+  // Appends the disassembly to *out instead of returning a fresh string.
+  // When disassembling many instructions (JIT logging, block dumps), reusing
+  // one caller-owned buffer avoids an allocation per instruction.
+  static void Disassemble(u32 opcode, u32 current_instruction_address, std::string* out,
+                          bool big_endian = true);
   static const char* GetGPRName(u32 index);
   static const char* GetFPRName(u32 index);
 
@@ -8,6 +8,7 @@
 #include <cstring>
 #include "Common/BitUtils.h"
 #include "Common/CPUDetect.h"
+#include "Common/CPUDispatch.h"
 #include "Common/CommonFuncs.h"
 #include "Common/Intrinsics.h"
 
@@ -248,9 +249,66 @@ static u64 GetMurmurHash3(const u8* src, u32 len, u32 samples)
 // CRC32 hash using the SSE4.2 instruction
 #if defined(_M_X86_64)
 
+// Wide multiply-xor hash over the full buffer, used when sampling is disabled and
+// every byte has to be read anyway. crc32 retires at most eight bytes per cycle;
+// the two 256 bit accumulators here roughly double that on cache-resident data,
+// which is where safe texture hashing spends its time.
+FUNCTION_TARGET_AVX2
+static u64 GetHash64AVX2(const u8* src, u32 len)
+{
+  const __m256i k1 = _mm256_set1_epi64x(0x87c37b91114253d5);
+  const __m256i k2 = _mm256_set1_epi64x(0x4cf5ad432745937f);
+  __m256i acc1 = _mm256_set1_epi64x(0x9368e53c2f6af274);
+  __m256i acc2 = _mm256_set1_epi64x(0x586dcd208f7cd3fd);
+
+  const u8* end = src + (len & ~63u);
+  for (const u8* p = src; p < end; p += 64)
+  {
+    const __m256i d1 = _mm256_loadu_si256((const __m256i*)p);
+    const __m256i d2 = _mm256_loadu_si256((const __m256i*)(p + 32));
+    const __m256i m1 = _mm256_xor_si256(d1, k1);
+    const __m256i m2 = _mm256_xor_si256(d2, k2);
+    // 32x32->64 multiply of the low and high half of each qword, plus the
+    // dword-swapped input so no input bits get multiplied away entirely.
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epu32(m1, _mm256_srli_epi64(m1, 32)));
+    acc1 = _mm256_add_epi64(acc1, _mm256_shuffle_epi32(d1, _MM_SHUFFLE(2, 3, 0, 1)));
+    acc2 = _mm256_add_epi64(acc2, _mm256_mul_epu32(m2, _mm256_srli_epi64(m2, 32)));
+    acc2 = _mm256_add_epi64(acc2, _mm256_shuffle_epi32(d2, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+
+  if (len & 63)
+  {
+    // One more round over a zero-padded copy of the remainder.
+    alignas(32) u8 tail[64] = {};
+    std::memcpy(tail, end, len & 63);
+    const __m256i d1 = _mm256_load_si256((const __m256i*)tail);
+    const __m256i d2 = _mm256_load_si256((const __m256i*)(tail + 32));
+    const __m256i m1 = _mm256_xor_si256(d1, k1);
+    const __m256i m2 = _mm256_xor_si256(d2, k2);
+    acc1 = _mm256_add_epi64(acc1, _mm256_mul_epu32(m1, _mm256_srli_epi64(m1, 32)));
+    acc1 = _mm256_add_epi64(acc1, _mm256_shuffle_epi32(d1, _MM_SHUFFLE(2, 3, 0, 1)));
+    acc2 = _mm256_add_epi64(acc2, _mm256_mul_epu32(m2, _mm256_srli_epi64(m2, 32)));
+    acc2 = _mm256_add_epi64(acc2, _mm256_shuffle_epi32(d2, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+
+  alignas(32) u64 lanes[8];
+  _mm256_store_si256((__m256i*)lanes, acc1);
+  _mm256_store_si256((__m256i*)(lanes + 4), acc2);
+
+  u64 h = len;
+  for (u64 lane : lanes)
+    h = fmix64(h ^ lane);
+  return h;
+}
+
 FUNCTION_TARGET_SSE42
 static u64 GetCRC32(const u8* src, u32 len, u32 samples)
 {
+  // Sampling disabled means the caller wants the whole buffer hashed; use the
+  // wider kernel for it where the CPU allows.
+  if (samples == 0 && len >= 512 && cpu_info.bAVX2)
+    return GetHash64AVX2(src, len);
+
   u64 h[4] = {len, 0, 0, 0};
   u32 Step = (len / 8);
   const u64* data = (const u64*)src;
@@ -509,21 +567,13 @@ u64 GetHash64(const u8* src, u32 len, u32 samples)
 // sets the hash function used for the texture cache
 void SetHash64Function()
 {
+  ptrHashFunction = SelectVariant<decltype(ptrHashFunction)>({
+      {DispatchLevel::Scalar, &GetMurmurHash3},
 #if defined(_M_X86_64) || defined(_M_X86)
-  if (cpu_info.bSSE4_2)  // sse crc32 version
-  {
-    ptrHashFunction = &GetCRC32;
-  }
-  else
+      {DispatchLevel::SSE4, &GetCRC32},
 #elif defined(_M_ARM_64)
-  if (cpu_info.bCRC32)
-  {
-    ptrHashFunction = &GetCRC32;
-  }
-  else
+      {DispatchLevel::ArmCRC32, &GetCRC32},
 #endif
-  {
-    ptrHashFunction = &GetMurmurHash3;
-  }
+  });
 }
 }  // namespace Common
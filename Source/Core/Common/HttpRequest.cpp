@@ -4,6 +4,7 @@
 
 #include "Common/HttpRequest.h"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <mutex>
@@ -40,12 +41,30 @@ public:
 private:
   static std::mutex s_curl_was_inited_mutex;
   static bool s_curl_was_inited;
+  static CURLSH* s_curl_share;
   ProgressCallback m_callback;
   std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> m_curl{nullptr, curl_easy_cleanup};
 };
 
 std::mutex HttpRequest::Impl::s_curl_was_inited_mutex;
 bool HttpRequest::Impl::s_curl_was_inited = false;
+CURLSH* HttpRequest::Impl::s_curl_share = nullptr;
+
+// DNS results, TLS sessions and (on new enough libcurl) idle connections are
+// shared between all requests, so fetching many files from the same host only
+// pays for the resolve and handshake once. Requests can run on any thread,
+// hence the lock callbacks.
+static std::array<std::mutex, CURL_LOCK_DATA_LAST> s_curl_share_locks;
+
+static void CurlShareLock(CURL*, curl_lock_data data, curl_lock_access, void*)
+{
+  s_curl_share_locks[data].lock();
+}
+
+static void CurlShareUnlock(CURL*, curl_lock_data data, void*)
+{
+  s_curl_share_locks[data].unlock();
+}
 
 HttpRequest::HttpRequest(std::chrono::milliseconds timeout_ms, ProgressCallback callback)
     : m_impl(std::make_unique<Impl>(timeout_ms, callback))
@@ -107,6 +126,20 @@ HttpRequest::Impl::Impl(std::chrono::milliseconds timeout_ms, ProgressCallback c
     if (!s_curl_was_inited)
     {
       curl_global_init(CURL_GLOBAL_DEFAULT);
+
+      s_curl_share = curl_share_init();
+      if (s_curl_share)
+      {
+        curl_share_setopt(s_curl_share, CURLSHOPT_LOCKFUNC, CurlShareLock);
+        curl_share_setopt(s_curl_share, CURLSHOPT_UNLOCKFUNC, CurlShareUnlock);
+        curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+        // Sharing the connection cache between easy handles requires 7.57.0.
+        curl_share_setopt(s_curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+      }
+
       s_curl_was_inited = true;
     }
   }
@@ -115,6 +148,9 @@ HttpRequest::Impl::Impl(std::chrono::milliseconds timeout_ms, ProgressCallback c
   if (!m_curl)
     return;
 
+  if (s_curl_share)
+    curl_easy_setopt(m_curl.get(), CURLOPT_SHARE, s_curl_share);
+
   curl_easy_setopt(m_curl.get(), CURLOPT_NOPROGRESS, m_callback == nullptr);
 
   if (m_callback)
@@ -9,14 +9,16 @@
 #include <fstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/Version.h"
+#include "Common/ZlibUtil.h"
 
 // On disk format:
 // header{
-// u32 'DCAC';
+// u32 'DCZC';
 // u32 version;  // svn_rev
 // u16 sizeof(key_type);
 // u16 sizeof(value_type);
@@ -24,8 +26,9 @@
 
 // key_value_pair{
 // u32 value_size;
+// u32 compressed_size;  // zero means the value is stored uncompressed
 // key_type   key;
-// value_type[value_size]   value;
+// u8[compressed_size]   value;
 //}
 
 template <typename K, typename V>
@@ -77,41 +80,10 @@ public:
     if (m_file.is_open() && ValidateHeader())
     {
       // good header, read some key/value pairs
-      K key;
-
-      V* value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-
-      std::fstream::pos_type last_pos = m_file.tellg();
-
-      while (Read(&value_size))
-      {
-        std::streamoff next_extent = (last_pos - start_pos) + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
-
-        delete[] value;
-        value = new V[value_size];
-
-        // read key/value and pass to reader
-        if (Read(&key) && Read(value, value_size) && Read(&entry_number) &&
-            entry_number == m_num_entries + 1)
-        {
-          reader.Read(key, value, value_size);
-        }
-        else
-        {
-          break;
-        }
-
-        m_num_entries++;
-        last_pos = m_file.tellg();
-      }
+      std::fstream::pos_type last_pos = ReadEntries(reader, file_size, start_pos);
       m_file.seekp(last_pos);
       m_file.clear();
 
-      delete[] value;
       return m_num_entries;
     }
 
@@ -123,6 +95,41 @@ public:
     return 0;
   }
 
+  // Reads the entries of an existing cache without opening it for writing, so
+  // the file may live in a location we must not modify, e.g. a cache shared
+  // between machines. Unlike OpenAndRead, a missing or mismatched file is left
+  // untouched, and the file is closed again before returning; Append may not
+  // be used afterwards. Returns the number of entries read.
+  u32 OpenAndReadReadOnly(const std::string& filename, LinearDiskCacheReader<K, V>& reader)
+  {
+    using std::ios_base;
+
+    // Since we're reading/writing directly to the storage of K instances,
+    // K must be trivially copyable.
+    static_assert(std::is_trivially_copyable<K>::value, "K must be a trivially copyable type");
+
+    // close any currently opened file
+    Close();
+    m_num_entries = 0;
+
+    File::OpenFStream(m_file, filename, ios_base::in | ios_base::binary);
+
+    m_file.seekg(0, std::ios::end);
+    std::fstream::pos_type end_pos = m_file.tellg();
+    m_file.seekg(0, std::ios::beg);
+    std::fstream::pos_type start_pos = m_file.tellg();
+    std::streamoff file_size = end_pos - start_pos;
+
+    m_header.Init();
+    if (m_file.is_open() && ValidateHeader())
+      ReadEntries(reader, file_size, start_pos);
+
+    u32 num_entries = m_num_entries;
+    Close();
+    m_num_entries = 0;
+    return num_entries;
+  }
+
   void Sync() { m_file.flush(); }
   void Close()
   {
@@ -137,14 +144,86 @@ public:
   {
     // TODO: Should do a check that we don't already have "key"? (I think each caller does that
     // already.)
+    // Values (shader bytecode, driver program binaries) compress well, and the smaller files
+    // noticeably reduce the read time at boot. Values which do not shrink are stored raw,
+    // flagged with a zero compressed size.
+    const u32 value_bytes = value_size * sizeof(V);
+    const std::vector<u8> compressed_value =
+        Common::ZlibCompress(reinterpret_cast<const u8*>(value), value_bytes);
+    const u32 compressed_size =
+        (!compressed_value.empty() && compressed_value.size() < value_bytes) ?
+            static_cast<u32>(compressed_value.size()) :
+            0;
+
     Write(&value_size);
+    Write(&compressed_size);
     Write(&key);
-    Write(value, value_size);
+    if (compressed_size != 0)
+      Write(compressed_value.data(), compressed_size);
+    else
+      Write(value, value_size);
     m_num_entries++;
     Write(&m_num_entries);
   }
 
 private:
+  // Reads key/value pairs from the current get position until the end of the
+  // valid data, updating m_num_entries and returning the position just past
+  // the last good entry.
+  std::fstream::pos_type ReadEntries(LinearDiskCacheReader<K, V>& reader, std::streamoff file_size,
+                                     std::fstream::pos_type start_pos)
+  {
+    K key;
+
+    std::vector<V> value;
+    std::vector<u8> compressed_value;
+    u32 value_size = 0;
+    u32 compressed_size = 0;
+    u32 entry_number = 0;
+
+    std::fstream::pos_type last_pos = m_file.tellg();
+
+    while (Read(&value_size) && Read(&compressed_size))
+    {
+      const u32 value_bytes = value_size * sizeof(V);
+      const u32 stored_bytes = compressed_size != 0 ? compressed_size : value_bytes;
+      std::streamoff next_extent =
+          (last_pos - start_pos) + sizeof(value_size) + sizeof(compressed_size) + stored_bytes;
+      if (next_extent > file_size)
+        break;
+
+      value.resize(value_size);
+
+      // read key/value and pass to reader
+      bool entry_valid;
+      if (compressed_size != 0)
+      {
+        compressed_value.resize(compressed_size);
+        entry_valid = Read(&key) && Read(compressed_value.data(), compressed_size) &&
+                      Common::ZlibDecompress(compressed_value.data(), compressed_size,
+                                             reinterpret_cast<u8*>(value.data()), value_bytes);
+      }
+      else
+      {
+        entry_valid = Read(&key) && Read(value.data(), value_size);
+      }
+
+      if (entry_valid && Read(&entry_number) && entry_number == m_num_entries + 1)
+      {
+        reader.Read(key, value.data(), value_size);
+      }
+      else
+      {
+        break;
+      }
+
+      m_num_entries++;
+      last_pos = m_file.tellg();
+    }
+
+    return last_pos;
+  }
+
   void WriteHeader() { Write(&m_header); }
   bool ValidateHeader()
   {
@@ -171,7 +250,7 @@ private:
     void Init()
     {
       // Null-terminator is intentionally not copied.
-      std::memcpy(&id, "DCAC", sizeof(u32));
+      std::memcpy(&id, "DCZC", sizeof(u32));
       std::memcpy(ver, Common::scm_rev_git_str.c_str(),
                   std::min(Common::scm_rev_git_str.size(), sizeof(ver)));
     }
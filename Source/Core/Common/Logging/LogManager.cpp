@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstdarg>
+#include <cstdio>
 #include <cstring>
 #include <locale>
 #include <mutex>
@@ -207,13 +208,16 @@ void LogManager::LogWithFullPath(LogTypes::LOG_LEVELS level, LogTypes::LOG_TYPE
   char temp[MAX_MSGLEN];
   CharArrayFromFormatV(temp, MAX_MSGLEN, format, args);
 
-  std::string msg =
-      StringFromFormat("%s %s:%u %c[%s]: %s\n", Common::Timer::GetTimeFormatted().c_str(), file,
-                       line, LogTypes::LOG_LEVEL_TO_CHAR[(int)level], GetShortName(type), temp);
+  // Assemble the final line on the stack; with verbose logging enabled this
+  // runs often enough for the old StringFromFormat allocation (and its second
+  // trip through vsnprintf) to show up in profiles.
+  char msg[MAX_MSGLEN * 2];
+  snprintf(msg, sizeof(msg), "%s %s:%u %c[%s]: %s\n", Common::Timer::GetTimeFormatted().c_str(),
+           file, line, LogTypes::LOG_LEVEL_TO_CHAR[(int)level], GetShortName(type), temp);
 
   for (auto listener_id : m_listener_ids)
     if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+      m_listeners[listener_id]->Log(level, msg);
 }
 
 LogTypes::LOG_LEVELS LogManager::GetLogLevel() const
@@ -43,6 +43,14 @@ void* AllocateExecutableMemory(size_t size)
 
   if (ptr == MAP_FAILED)
     ptr = nullptr;
+#if defined(MADV_HUGEPAGE)
+  // The JIT code regions are tens of megabytes with essentially random
+  // intra-region jumps, which makes emitted code pay heavily for 4K iTLB
+  // entries. Ask the kernel to back the region with transparent huge pages;
+  // this is purely advisory, so failure is fine (e.g. THP disabled).
+  if (ptr != nullptr)
+    madvise(ptr, size, MADV_HUGEPAGE);
+#endif
 #endif
 
   if (ptr == nullptr)
@@ -8,6 +8,7 @@
 // single producer, single consumer queue
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstddef>
 
@@ -76,6 +77,60 @@ public:
     return true;
   }
 
+  // Pushes count elements with a single publish: the new nodes are filled and
+  // linked up locally, then made visible to the consumer with one release
+  // store, so per-element atomic traffic is avoided.
+  void PushMultiple(const T* data, u32 count)
+  {
+    if (count == 0)
+      return;
+
+    // The current (empty) tail node becomes the first new element.
+    m_write_ptr->current = data[0];
+
+    ElementPtr* first_new = nullptr;
+    ElementPtr* last_filled = nullptr;
+    for (u32 i = 1; i < count; ++i)
+    {
+      ElementPtr* node = new ElementPtr();
+      node->current = data[i];
+      if (last_filled)
+        last_filled->next.store(node, std::memory_order_relaxed);
+      else
+        first_new = node;
+      last_filled = node;
+    }
+
+    ElementPtr* new_tail = new ElementPtr();
+    if (last_filled)
+      last_filled->next.store(new_tail, std::memory_order_relaxed);
+    else
+      first_new = new_tail;
+
+    m_write_ptr->next.store(first_new, std::memory_order_release);
+    m_write_ptr = new_tail;
+    if (NeedSize)
+      m_size += count;
+  }
+
+  // Pops up to max_count elements into out, with a single size adjustment.
+  // Returns the number of elements written.
+  u32 PopMultiple(T* out, u32 max_count)
+  {
+    u32 count = 0;
+    while (count < max_count && !Empty())
+    {
+      ElementPtr* tmpptr = m_read_ptr;
+      m_read_ptr = tmpptr->next.load(std::memory_order_acquire);
+      out[count++] = std::move(tmpptr->current);
+      tmpptr->next.store(nullptr);
+      delete tmpptr;
+    }
+    if (NeedSize && count != 0)
+      m_size -= count;
+    return count;
+  }
+
   // not thread-safe
   void Clear()
   {
@@ -103,8 +158,77 @@ private:
     std::atomic<ElementPtr*> next;
   };
 
-  ElementPtr* m_write_ptr;
-  ElementPtr* m_read_ptr;
-  std::atomic<u32> m_size;
+  // The producer only writes m_write_ptr and the consumer only writes
+  // m_read_ptr; keep them (and the shared size counter) on separate cache
+  // lines so neither side invalidates the other's state on every operation.
+  alignas(64) ElementPtr* m_write_ptr;
+  alignas(64) ElementPtr* m_read_ptr;
+  alignas(64) std::atomic<u32> m_size;
+};
+
+// Fixed-capacity single producer, single consumer ring. Unlike SPSCQueue there
+// is no per-element allocation, so it suits constant-rate traffic like audio
+// sample handoff; the price is that Push can fail when the ring is full.
+template <typename T, size_t Capacity>
+class SPSCRingQueue
+{
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  size_t Size() const
+  {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+  bool Empty() const { return Size() == 0; }
+
+  bool Push(const T& t) { return PushMultiple(&t, 1) != 0; }
+
+  // Copies as many of the given elements as fit and publishes them with a
+  // single index store. Returns the number of elements pushed.
+  size_t PushMultiple(const T* data, size_t count)
+  {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    const size_t head = m_head.load(std::memory_order_acquire);
+    count = std::min(count, Capacity - (tail - head));
+
+    for (size_t i = 0; i < count; ++i)
+      m_data[(tail + i) & (Capacity - 1)] = data[i];
+
+    if (count != 0)
+      m_tail.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  bool Pop(T& t) { return PopMultiple(&t, 1) != 0; }
+
+  // Pops up to max_count elements into out with a single index store.
+  // Returns the number of elements written.
+  size_t PopMultiple(T* out, size_t max_count)
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    const size_t tail = m_tail.load(std::memory_order_acquire);
+    const size_t count = std::min(max_count, tail - head);
+
+    for (size_t i = 0; i < count; ++i)
+      out[i] = std::move(m_data[(head + i) & (Capacity - 1)]);
+
+    if (count != 0)
+      m_head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  // not thread-safe
+  void Clear()
+  {
+    m_head.store(0);
+    m_tail.store(0);
+  }
+
+private:
+  std::array<T, Capacity> m_data{};
+  // Producer and consumer indices live on distinct cache lines, see above.
+  alignas(64) std::atomic<size_t> m_tail{0};  // written by the producer
+  alignas(64) std::atomic<size_t> m_head{0};  // written by the consumer
 };
 }
@@ -0,0 +1,31 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Common/ZlibUtil.h"
+
+#include <zlib.h>
+
+namespace Common
+{
+std::vector<u8> ZlibCompress(const u8* src, size_t src_len)
+{
+  uLongf compressed_len = compressBound(static_cast<uLong>(src_len));
+  std::vector<u8> result(compressed_len);
+  if (compress2(result.data(), &compressed_len, src, static_cast<uLong>(src_len), Z_BEST_SPEED) !=
+      Z_OK)
+  {
+    return {};
+  }
+
+  result.resize(compressed_len);
+  return result;
+}
+
+bool ZlibDecompress(const u8* src, size_t src_len, u8* dst, size_t dst_len)
+{
+  uLongf decompressed_len = static_cast<uLongf>(dst_len);
+  return uncompress(dst, &decompressed_len, src, static_cast<uLong>(src_len)) == Z_OK &&
+         decompressed_len == dst_len;
+}
+}  // namespace Common
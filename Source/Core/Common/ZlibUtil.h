@@ -0,0 +1,21 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Compresses a buffer with zlib, tuned for speed over ratio.
+// Returns an empty vector on failure.
+std::vector<u8> ZlibCompress(const u8* src, size_t src_len);
+
+// Decompresses a zlib stream into a caller-provided buffer, whose size must match the
+// original uncompressed length exactly. Returns false on failure or size mismatch.
+bool ZlibDecompress(const u8* src, size_t src_len, u8* dst, size_t dst_len);
+}  // namespace Common
@@ -1835,6 +1835,19 @@ void XEmitter::WriteAVXOp(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, con
   WriteVEXOp(opPrefix, op, regOp1, regOp2, arg, W, extrabytes);
 }
 
+void XEmitter::WriteAVX256Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
+                             int W, int extrabytes)
+{
+  if (!cpu_info.bAVX)
+    PanicAlert("Trying to use AVX on a system that doesn't support it. Bad programmer.");
+  int mmmmm = GetVEXmmmmm(op);
+  int pp = GetVEXpp(opPrefix);
+  // Same as WriteVEXOp, but with VEX.L set for a 256-bit operand size.
+  arg.WriteVEX(this, regOp1, regOp2, 1, pp, mmmmm, W);
+  Write8(op & 0xFF);
+  arg.WriteRest(this, extrabytes, regOp1);
+}
+
 void XEmitter::WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
                            X64Reg regOp3, int W)
 {
@@ -2983,6 +2996,24 @@ void XEmitter::VPXOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
   WriteAVXOp(0x66, 0xEF, regOp1, regOp2, arg);
 }
 
+void XEmitter::VXORPS256(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
+{
+  WriteAVX256Op(0x00, sseXOR, regOp1, regOp2, arg);
+}
+void XEmitter::VMOVAPS256(const OpArg& arg, X64Reg regOp)
+{
+  WriteAVX256Op(0x00, sseMOVAPtoRM, regOp, INVALID_REG, arg);
+}
+void XEmitter::VZEROUPPER()
+{
+  if (!cpu_info.bAVX)
+    PanicAlert("Trying to use AVX on a system that doesn't support it. Bad programmer.");
+  // VEX.128.0F 77
+  Write8(0xC5);
+  Write8(0xF8);
+  Write8(0x77);
+}
+
 void XEmitter::VFMADD132PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg)
 {
   WriteFMA3Op(0x98, regOp1, regOp2, arg);
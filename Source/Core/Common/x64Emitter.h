@@ -362,6 +362,8 @@ private:
                   int extrabytes = 0);
   void WriteAVXOp4(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
                    X64Reg regOp3, int W = 0);
+  void WriteAVX256Op(u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0,
+                     int extrabytes = 0);
   void WriteFMA3Op(u8 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
   void WriteFMA4Op(u8 op, X64Reg dest, X64Reg regOp1, X64Reg regOp2, const OpArg& arg, int W = 0);
   void WriteBMIOp(int size, u8 opPrefix, u16 op, X64Reg regOp1, X64Reg regOp2, const OpArg& arg,
@@ -888,6 +890,14 @@ public:
   void VPOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VPXOR(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
 
+  // 256-bit (ymm) forms. The AVX helpers above all emit VEX.128 encodings;
+  // these are the few whole-register ymm operations the JIT uses to touch an
+  // entire 32-byte cache line at once. Follow uses with VZEROUPPER before
+  // executing legacy SSE code again to avoid AVX-SSE transition penalties.
+  void VXORPS256(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
+  void VMOVAPS256(const OpArg& arg, X64Reg regOp);
+  void VZEROUPPER();
+
   // FMA3
   void VFMADD132PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
   void VFMADD213PS(X64Reg regOp1, X64Reg regOp2, const OpArg& arg);
@@ -1165,6 +1175,20 @@ public:
     auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
     ABI_CallFunctionPC(trampoline, reinterpret_cast<const void*>(f), p1);
   }
+
+  template <typename T, typename... Args>
+  void ABI_CallLambdaCA(int bits, const std::function<T(Args...)>* f, u32 p1,
+                        const Gen::OpArg& arg2)
+  {
+    auto trampoline = &XEmitter::CallLambdaTrampoline<T, Args...>;
+    // Move the value argument first in case it currently lives in ABI_PARAM1
+    // or ABI_PARAM2.
+    if (!arg2.IsSimpleReg(ABI_PARAM3))
+      MOV(bits, R(ABI_PARAM3), arg2);
+    MOV(64, R(ABI_PARAM1), Imm64(reinterpret_cast<u64>(f)));
+    MOV(32, R(ABI_PARAM2), Imm32(p1));
+    ABI_CallFunction(trampoline);
+  }
 };  // class XEmitter
 
 class X64CodeBlock : public Common::CodeBlock<XEmitter>
@@ -90,6 +90,22 @@ static std::atomic<bool> s_use_internal_log{false};
 static const ARCode* s_current_code = nullptr;
 static bool s_disable_logging = false;
 
+// A single preresolved RAM write lowered from an active code. Codes made up
+// entirely of unconditional RAM writes and fills - the overwhelmingly common
+// case - are executed from this flat list in a tight loop every frame instead
+// of being re-interpreted. Everything else (conditionals, zero codes, pointer
+// writes) keeps going through the interpreter.
+struct CompiledWrite
+{
+  u32 address;
+  u32 value;
+  u32 count;
+  u8 size;
+};
+static std::vector<CompiledWrite> s_compiled_writes;
+static std::vector<const ARCode*> s_interpreted_codes;
+static bool s_codes_compiled = false;
+
 struct ARAddr
 {
   union
@@ -118,6 +134,7 @@ void ApplyCodes(const std::vector<ARCode>& codes)
 
   std::lock_guard<std::mutex> guard(s_lock);
   s_disable_logging = false;
+  s_codes_compiled = false;
   s_active_codes.clear();
   std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                [](const ARCode& code) { return code.active; });
@@ -126,6 +143,7 @@ void ApplyCodes(const std::vector<ARCode>& codes)
 
 void SetSyncedCodesAsActive()
 {
+  s_codes_compiled = false;
   s_active_codes.clear();
   s_active_codes.reserve(s_synced_codes.size());
   s_active_codes = s_synced_codes;
@@ -146,6 +164,7 @@ std::vector<ARCode> ApplyAndReturnCodes(const std::vector<ARCode>& codes)
   {
     std::lock_guard<std::mutex> guard(s_lock);
     s_disable_logging = false;
+    s_codes_compiled = false;
     s_active_codes.clear();
     std::copy_if(codes.begin(), codes.end(), std::back_inserter(s_active_codes),
                  [](const ARCode& code) { return code.active; });
@@ -164,6 +183,7 @@ void AddCode(ARCode code)
   {
     std::lock_guard<std::mutex> guard(s_lock);
     s_disable_logging = false;
+    s_codes_compiled = false;
     s_active_codes.emplace_back(std::move(code));
   }
 }
@@ -969,6 +989,73 @@ static bool RunCodeLocked(const ARCode& arcode)
   return true;
 }
 
+// Tries to lower a code into s_compiled_writes. Returns false (leaving the
+// list untouched) if any op needs the interpreter: conditionals, zero codes,
+// pointer writes, add codes, master codes and self modification all change
+// control flow or depend on values read back from emulated memory, so they
+// cannot be preresolved.
+static bool TryCompileCodeLocked(const ARCode& arcode)
+{
+  const size_t start = s_compiled_writes.size();
+
+  for (const AREntry& entry : arcode.ops)
+  {
+    const ARAddr addr(entry.cmd_addr);
+
+    if (0x0 == addr || (addr >= 0x00002000 && addr < 0x00003000) || addr.type != 0x00 ||
+        addr.subtype != SUB_RAM_WRITE)
+    {
+      s_compiled_writes.resize(start);
+      return false;
+    }
+
+    CompiledWrite write;
+    write.address = addr.GCAddress();
+    write.size = addr.size;
+
+    switch (addr.size)
+    {
+    case DATATYPE_8BIT:
+      write.value = entry.value & 0xFF;
+      write.count = (entry.value >> 8) + 1;
+      break;
+
+    case DATATYPE_16BIT:
+      write.value = entry.value & 0xFFFF;
+      write.count = (entry.value >> 16) + 1;
+      break;
+
+    case DATATYPE_32BIT_FLOAT:
+    case DATATYPE_32BIT:
+      write.value = entry.value;
+      write.count = 1;
+      break;
+
+    default:
+      s_compiled_writes.resize(start);
+      return false;
+    }
+
+    s_compiled_writes.push_back(write);
+  }
+
+  return true;
+}
+
+static void CompileActiveCodesLocked()
+{
+  s_compiled_writes.clear();
+  s_interpreted_codes.clear();
+
+  for (const ARCode& code : s_active_codes)
+  {
+    if (!TryCompileCodeLocked(code))
+      s_interpreted_codes.push_back(&code);
+  }
+
+  s_codes_compiled = true;
+}
+
 void RunAllActive()
 {
   if (!SConfig::GetInstance().bEnableCheats)
@@ -978,14 +1065,62 @@ void RunAllActive()
   // are only atomic ops unless contested. It should be rare for this to
   // be contested.
   std::lock_guard<std::mutex> guard(s_lock);
-  s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
-                                      [](const ARCode& code) {
-                                        bool success = RunCodeLocked(code);
-                                        LogInfo("\n");
-                                        return !success;
-                                      }),
-                       s_active_codes.end());
-  s_disable_logging = true;
+
+  if (!s_codes_compiled)
+  {
+    // First run after the active list changed: interpret everything once so
+    // the usual per-code logging happens and broken codes get dropped, then
+    // lower the survivors.
+    s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
+                                        [](const ARCode& code) {
+                                          bool success = RunCodeLocked(code);
+                                          LogInfo("\n");
+                                          return !success;
+                                        }),
+                         s_active_codes.end());
+    s_disable_logging = true;
+    CompileActiveCodesLocked();
+    return;
+  }
+
+  for (const CompiledWrite& write : s_compiled_writes)
+  {
+    switch (write.size)
+    {
+    case DATATYPE_8BIT:
+      for (u32 i = 0; i < write.count; ++i)
+        PowerPC::HostWrite_U8(static_cast<u8>(write.value), write.address + i);
+      break;
+
+    case DATATYPE_16BIT:
+      for (u32 i = 0; i < write.count; ++i)
+        PowerPC::HostWrite_U16(static_cast<u16>(write.value), write.address + i * 2);
+      break;
+
+    default:
+      PowerPC::HostWrite_U32(write.value, write.address);
+      break;
+    }
+  }
+
+  std::vector<const ARCode*> failed_codes;
+  for (const ARCode* code : s_interpreted_codes)
+  {
+    if (!RunCodeLocked(*code))
+      failed_codes.push_back(code);
+  }
+
+  if (!failed_codes.empty())
+  {
+    s_active_codes.erase(std::remove_if(s_active_codes.begin(), s_active_codes.end(),
+                                        [&failed_codes](const ARCode& code) {
+                                          return std::find(failed_codes.begin(),
+                                                           failed_codes.end(),
+                                                           &code) != failed_codes.end();
+                                        }),
+                         s_active_codes.end());
+    CompileActiveCodesLocked();
+  }
 }
 
 }  // namespace ActionReplay
@@ -9,10 +9,13 @@
 
 #include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/SettingsHandler.h"
+#include "Common/StringUtil.h"
 
 #include "Core/Boot/Boot.h"
 #include "Core/CommonTitles.h"
@@ -44,6 +47,62 @@ void PresetTimeBaseTicks()
 
   PowerPC::HostWrite_U64(time_base_ticks, 0x800030D8);
 }
+
+// On-disk cache of the apploader's output: the DVD copy commands it issued and
+// the low-memory globals it published. Replaying these on a repeat boot of the
+// same disc skips the interpreted apploader run entirely. The version must be
+// bumped whenever the file format or the captured region changes.
+constexpr u32 APPLOADER_CACHE_MAGIC = 0x31435041;  // "APC1"
+constexpr u32 APPLOADER_CACHE_VERSION = 1;
+
+// Everything the apploader publishes for the game (FST location, arena bounds,
+// OS globals) lives below 0x3400. setting.txt at 0x3800 is written by the
+// current boot before the apploader runs and must not be replayed.
+constexpr u32 APPLOADER_CACHE_LOWMEM_SIZE = 0x3400;
+
+// Some unlicensed titles drive the copy loop from a table in the apploader,
+// so allow for considerably more commands than a DOL has sections.
+constexpr u32 APPLOADER_CACHE_MAX_COPIES = 512;
+
+struct ApploaderCopyCommand
+{
+  u64 dvd_offset;
+  u32 ram_address;
+  u32 length;
+};
+
+std::string GetApploaderCachePath(const DiscIO::Volume& volume)
+{
+  const std::string game_id = volume.GetGameID();
+  if (game_id.empty())
+    return "";
+  return StringFromFormat("%s%s-r%d-d%d.appboot", File::GetUserPath(D_CACHE_IDX).c_str(),
+                          game_id.c_str(), volume.GetRevision().value_or(0),
+                          volume.GetDiscNumber().value_or(0));
+}
+
+// Best effort - a failed write just means the next boot runs the apploader again.
+void SaveApploaderCache(bool is_wii, const DiscIO::Volume& volume,
+                        const std::vector<ApploaderCopyCommand>& copies, u32 entry)
+{
+  const std::string path = GetApploaderCachePath(volume);
+  if (path.empty() || copies.size() > APPLOADER_CACHE_MAX_COPIES)
+    return;
+
+  std::vector<u8> lowmem(APPLOADER_CACHE_LOWMEM_SIZE);
+  Memory::CopyFromEmu(lowmem.data(), 0x00000000, lowmem.size());
+
+  File::IOFile file(path, "wb");
+  const u32 wii = is_wii ? 1 : 0;
+  const u32 num_copies = static_cast<u32>(copies.size());
+  file.WriteArray(&APPLOADER_CACHE_MAGIC, 1);
+  file.WriteArray(&APPLOADER_CACHE_VERSION, 1);
+  file.WriteArray(&wii, 1);
+  file.WriteArray(&entry, 1);
+  file.WriteArray(&num_copies, 1);
+  file.WriteArray(copies.data(), copies.size());
+  file.WriteArray(lowmem.data(), lowmem.size());
+}
 }  // Anonymous namespace
 
 void CBoot::RunFunction(u32 address)
@@ -85,10 +144,72 @@ void CBoot::SetupBAT(bool is_wii)
   PowerPC::IBATUpdated();
 }
 
+bool CBoot::BootFromApploaderCache(bool is_wii, const DiscIO::Volume& volume)
+{
+  const std::string path = GetApploaderCachePath(volume);
+  if (path.empty())
+    return false;
+
+  File::IOFile file(path, "rb");
+  if (!file)
+    return false;
+
+  u32 magic, version, cached_wii, entry, num_copies;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) ||
+      !file.ReadArray(&cached_wii, 1) || !file.ReadArray(&entry, 1) ||
+      !file.ReadArray(&num_copies, 1))
+  {
+    return false;
+  }
+
+  if (magic != APPLOADER_CACHE_MAGIC || version != APPLOADER_CACHE_VERSION ||
+      cached_wii != (is_wii ? 1u : 0u) || num_copies > APPLOADER_CACHE_MAX_COPIES)
+  {
+    return false;
+  }
+
+  std::vector<ApploaderCopyCommand> copies(num_copies);
+  std::vector<u8> lowmem(APPLOADER_CACHE_LOWMEM_SIZE);
+  if (!file.ReadArray(copies.data(), copies.size()) ||
+      !file.ReadArray(lowmem.data(), lowmem.size()))
+  {
+    return false;
+  }
+
+  const DiscIO::Partition partition = volume.GetGamePartition();
+  for (const ApploaderCopyCommand& copy : copies)
+  {
+    // Reject anything that would land outside MEM1; a corrupt or stale cache
+    // file must never scribble over unrelated memory.
+    const u32 address = copy.ram_address & 0x3FFFFFFF;
+    if (address >= Memory::REALRAM_SIZE || copy.length > Memory::REALRAM_SIZE - address)
+      return false;
+    if (!DVDRead(volume, copy.dvd_offset, copy.ram_address, copy.length, partition))
+      return false;
+  }
+
+  Memory::CopyToEmu(0x00000000, lowmem.data(), lowmem.size());
+
+  // The snapshot contains the time base preset of the boot that recorded it.
+  if (!is_wii)
+    PresetTimeBaseTicks();
+
+  PC = entry;
+
+  INFO_LOG(BOOT, "Booting from cached apploader output (%u DVD copies)", num_copies);
+  return true;
+}
+
 bool CBoot::RunApploader(bool is_wii, const DiscIO::Volume& volume)
 {
   const DiscIO::Partition partition = volume.GetGamePartition();
 
+  // Replaying the output of a previous run of the same disc skips the
+  // interpreted apploader execution entirely. Movies and netplay always take
+  // the real path so their timing matches a boot without a populated cache.
+  if (!Core::WantsDeterminism() && BootFromApploaderCache(is_wii, volume))
+    return true;
+
   // Load Apploader to Memory - The apploader is hardcoded to begin at 0x2440 on the disc,
   // but the size can differ between discs. Compare with YAGCD chap 13.
   constexpr u32 offset = 0x2440;
@@ -136,6 +257,7 @@ bool CBoot::RunApploader(bool is_wii, const DiscIO::Volume& volume)
   // Typical behaviour is doing it once for each section defined in the DOL header. Some unlicensed
   // titles don't have a properly constructed DOL and maintain a table of these values in apploader.
   // iAppLoaderMain returns 0 when there are no more sections to copy.
+  std::vector<ApploaderCopyCommand> recorded_copies;
   while (PowerPC::ppcState.gpr[3] != 0x00)
   {
     u32 iRamAddress = PowerPC::Read_U32(0x81300004);
@@ -145,6 +267,7 @@ bool CBoot::RunApploader(bool is_wii, const DiscIO::Volume& volume)
     INFO_LOG(MASTER_LOG, "DVDRead: offset: %08x   memOffset: %08x   length: %i", iDVDOffset,
              iRamAddress, iLength);
     DVDRead(volume, iDVDOffset, iRamAddress, iLength, partition);
+    recorded_copies.push_back({iDVDOffset, iRamAddress, iLength});
 
     PowerPC::ppcState.gpr[3] = 0x81300004;
     PowerPC::ppcState.gpr[4] = 0x81300008;
@@ -161,6 +284,9 @@ bool CBoot::RunApploader(bool is_wii, const DiscIO::Volume& volume)
   // return
   PC = PowerPC::ppcState.gpr[3];
 
+  if (!Core::WantsDeterminism())
+    SaveApploaderCache(is_wii, volume, recorded_copies, PC);
+
   return true;
 }
 
@@ -58,6 +58,7 @@ const ConfigInfo<bool> GFX_ENABLE_GPU_TEXTURE_DECODING{
 const ConfigInfo<bool> GFX_ENABLE_PIXEL_LIGHTING{{System::GFX, "Settings", "EnablePixelLighting"},
                                                  false};
 const ConfigInfo<bool> GFX_FAST_DEPTH_CALC{{System::GFX, "Settings", "FastDepthCalc"}, true};
+const ConfigInfo<bool> GFX_CPU_CULL{{System::GFX, "Settings", "CPUCull"}, false};
 const ConfigInfo<u32> GFX_MSAA{{System::GFX, "Settings", "MSAA"}, 1};
 const ConfigInfo<bool> GFX_SSAA{{System::GFX, "Settings", "SSAA"}, false};
 const ConfigInfo<int> GFX_EFB_SCALE{{System::GFX, "Settings", "InternalResolution"}, 1};
@@ -83,6 +84,10 @@ const ConfigInfo<bool> GFX_BACKEND_MULTITHREADING{
 const ConfigInfo<int> GFX_COMMAND_BUFFER_EXECUTE_INTERVAL{
     {System::GFX, "Settings", "CommandBufferExecuteInterval"}, 100};
 const ConfigInfo<bool> GFX_SHADER_CACHE{{System::GFX, "Settings", "ShaderCache"}, true};
+const ConfigInfo<std::string> GFX_SHARED_SHADER_CACHE_PATH{
+    {System::GFX, "Settings", "SharedShaderCachePath"}, ""};
+const ConfigInfo<NullCutoffStage> GFX_NULL_CUTOFF_STAGE{{System::GFX, "Settings", "NullCutoffStage"},
+                                                        NullCutoffStage::Disabled};
 const ConfigInfo<bool> GFX_WAIT_FOR_SHADERS_BEFORE_STARTING{
     {System::GFX, "Settings", "WaitForShadersBeforeStarting"}, false};
 const ConfigInfo<ShaderCompilationMode> GFX_SHADER_COMPILATION_MODE{
@@ -130,6 +130,10 @@ struct SConfig
   int iSyncGpuMaxDistance;
   int iSyncGpuMinDistance;
   float fSyncGpuOverclock;
+  // Maximum number of copied FIFO bytes the deterministic GPU thread may
+  // still have to decode before the CPU thread is made to wait (lockstep
+  // mode, enabled by combining SyncGPU with the deterministic GPU thread).
+  int iSyncGpuLockstepDistance;
 
   int SelectedLanguage = 0;
   bool bOverrideGCLanguage = false;
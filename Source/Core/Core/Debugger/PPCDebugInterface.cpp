@@ -173,6 +173,11 @@ std::string PPCDebugInterface::Disassemble(unsigned int address)
     }
 
     const u32 op = PowerPC::HostRead_Instruction(address);
+
+    const auto it = m_disasm_cache.find(address);
+    if (it != m_disasm_cache.end() && it->second.op == op)
+      return it->second.text;
+
     std::string disasm = Common::GekkoDisassembler::Disassemble(op, address);
     const UGeckoInstruction inst{op};
 
@@ -181,6 +186,12 @@ std::string PPCDebugInterface::Disassemble(unsigned int address)
       disasm += " (hle)";
     }
 
+    // Keep the cache bounded; dropping it entirely is fine since it refills
+    // with whatever the debugger is currently looking at.
+    if (m_disasm_cache.size() >= 0x10000)
+      m_disasm_cache.clear();
+    m_disasm_cache[address] = {op, disasm};
+
     return disasm;
   }
   else
@@ -344,4 +355,5 @@ void PPCDebugInterface::Clear()
   ClearAllMemChecks();
   ClearPatches();
   ClearWatches();
+  m_disasm_cache.clear();
 }
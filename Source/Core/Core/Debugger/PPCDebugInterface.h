@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <string>
+#include <unordered_map>
 
 #include "Common/DebugInterface.h"
 
@@ -80,6 +81,18 @@ public:
   void Clear() override;
 
 private:
+  // The code view re-disassembles every visible line on each repaint, so
+  // memoize the result per address. The entry stores the instruction word it
+  // was produced from; if the word in memory no longer matches (patch, DOL
+  // load, self-modifying code), the entry is simply re-generated, so no
+  // explicit invalidation is needed.
+  struct CachedDisassembly
+  {
+    u32 op;
+    std::string text;
+  };
+  std::unordered_map<u32, CachedDisassembly> m_disasm_cache;
+
   Common::Debug::Watches m_watches;
   PPCPatches m_patches;
 };
@@ -4,10 +4,18 @@
 
 #include "Core/FifoPlayer/FifoDataFile.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
+
 #include <algorithm>
 #include <cstring>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/File.h"
@@ -70,7 +78,59 @@ static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 byt
 
 FifoDataFile::FifoDataFile() = default;
 
-FifoDataFile::~FifoDataFile() = default;
+FifoDataFile::~FifoDataFile()
+{
+  UnmapFile();
+}
+
+// Maps the capture read-only so frames can stream straight out of the page cache
+// instead of being copied into per-frame heap buffers at load time. On failure
+// m_Map stays null and Load() falls back to owned copies.
+void FifoDataFile::MapFile()
+{
+  const u64 size = m_File.GetSize();
+  if (size == 0)
+    return;
+
+#ifdef _WIN32
+  HANDLE file_handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_File.GetHandle())));
+  if (file_handle == INVALID_HANDLE_VALUE)
+    return;
+  m_MappingHandle = CreateFileMapping(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!m_MappingHandle)
+    return;
+  m_Map = static_cast<u8*>(MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0));
+  if (!m_Map)
+  {
+    CloseHandle(m_MappingHandle);
+    m_MappingHandle = nullptr;
+    return;
+  }
+#else
+  void* map =
+      mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_SHARED, fileno(m_File.GetHandle()), 0);
+  if (map == MAP_FAILED)
+    return;
+  m_Map = static_cast<u8*>(map);
+#endif
+  m_MapSize = size;
+}
+
+void FifoDataFile::UnmapFile()
+{
+  if (!m_Map)
+    return;
+
+#ifdef _WIN32
+  UnmapViewOfFile(m_Map);
+  CloseHandle(m_MappingHandle);
+  m_MappingHandle = nullptr;
+#else
+  munmap(m_Map, static_cast<size_t>(m_MapSize));
+#endif
+  m_Map = nullptr;
+  m_MapSize = 0;
+}
 
 bool FifoDataFile::ShouldGenerateFakeVIUpdates() const
 {
@@ -238,30 +298,43 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     file.ReadArray(dataFile->m_TexMem, size);
   }
 
+  // The file is kept open and mapped so frame data can reference it directly.
+  dataFile->m_File = std::move(file);
+  dataFile->MapFile();
+  File::IOFile& data_file_handle = dataFile->m_File;
+
   // Read frames
   for (u32 i = 0; i < header.frameCount; ++i)
   {
     u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
-    file.Seek(frameOffset, SEEK_SET);
+    data_file_handle.Seek(frameOffset, SEEK_SET);
     FileFrameInfo srcFrame;
-    file.ReadBytes(&srcFrame, sizeof(FileFrameInfo));
+    data_file_handle.ReadBytes(&srcFrame, sizeof(FileFrameInfo));
 
     FifoFrameInfo dstFrame;
-    dstFrame.fifoData.resize(srcFrame.fifoDataSize);
     dstFrame.fifoStart = srcFrame.fifoStart;
     dstFrame.fifoEnd = srcFrame.fifoEnd;
 
-    file.Seek(srcFrame.fifoDataOffset, SEEK_SET);
-    file.ReadBytes(dstFrame.fifoData.data(), srcFrame.fifoDataSize);
+    if (dataFile->m_Map && srcFrame.fifoDataOffset <= dataFile->m_MapSize &&
+        srcFrame.fifoDataSize <= dataFile->m_MapSize - srcFrame.fifoDataOffset)
+    {
+      dstFrame.fifoData.SetMapped(dataFile->m_Map + srcFrame.fifoDataOffset,
+                                  srcFrame.fifoDataSize);
+    }
+    else
+    {
+      std::vector<u8> fifoData(srcFrame.fifoDataSize);
+      data_file_handle.Seek(srcFrame.fifoDataOffset, SEEK_SET);
+      data_file_handle.ReadBytes(fifoData.data(), srcFrame.fifoDataSize);
+      dstFrame.fifoData = std::move(fifoData);
+    }
 
     ReadMemoryUpdates(srcFrame.memoryUpdatesOffset, srcFrame.numMemoryUpdates,
-                      dstFrame.memoryUpdates, file);
+                      dstFrame.memoryUpdates, data_file_handle);
 
     dataFile->AddFrame(dstFrame);
   }
 
-  file.Close();
-
   return dataFile;
 }
 
@@ -9,13 +9,9 @@
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
 #include "VideoCommon/XFMemory.h"
 
-namespace File
-{
-class IOFile;
-}
-
 struct MemoryUpdate
 {
   enum Type
@@ -32,9 +28,49 @@ struct MemoryUpdate
   Type type;
 };
 
+// Holds a frame's FIFO stream. Frames loaded from a memory-mapped capture reference
+// the mapping owned by their FifoDataFile instead of copying it into a heap buffer;
+// recorded frames (and frames loaded without a mapping) own their data.
+class FifoFrameData
+{
+public:
+  FifoFrameData() = default;
+
+  FifoFrameData& operator=(const std::vector<u8>& data)
+  {
+    m_Storage = data;
+    m_MappedData = nullptr;
+    return *this;
+  }
+
+  FifoFrameData& operator=(std::vector<u8>&& data)
+  {
+    m_Storage = std::move(data);
+    m_MappedData = nullptr;
+    return *this;
+  }
+
+  // The mapping must outlive this object (it is owned by the FifoDataFile that loaded it).
+  void SetMapped(const u8* data, size_t size)
+  {
+    m_MappedData = data;
+    m_MappedSize = size;
+    m_Storage.clear();
+  }
+
+  const u8* data() const { return m_MappedData ? m_MappedData : m_Storage.data(); }
+  size_t size() const { return m_MappedData ? m_MappedSize : m_Storage.size(); }
+  const u8& operator[](size_t offset) const { return data()[offset]; }
+
+private:
+  const u8* m_MappedData = nullptr;
+  size_t m_MappedSize = 0;
+  std::vector<u8> m_Storage;
+};
+
 struct FifoFrameInfo
 {
-  std::vector<u8> fifoData;
+  FifoFrameData fifoData;
 
   u32 fifoStart;
   u32 fifoEnd;
@@ -87,10 +123,22 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
+  void MapFile();
+  void UnmapFile();
+
   u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
 
+  // Kept open for the lifetime of the mapping, so loaded frames can reference
+  // the capture directly instead of owning copies.
+  File::IOFile m_File;
+  u8* m_Map = nullptr;
+  u64 m_MapSize = 0;
+#ifdef _WIN32
+  void* m_MappingHandle = nullptr;
+#endif
+
   u32 m_BPMem[BP_MEM_SIZE];
   u32 m_CPMem[CP_MEM_SIZE];
   u32 m_XFMem[XF_MEM_SIZE];
@@ -45,7 +45,10 @@ bool FifoPlayer::Open(const std::string& filename)
 {
   Close();
 
-  m_File = FifoDataFile::Load(filename, false);
+  if (m_PreloadedFile.valid() && filename == m_PreloadFilename)
+    m_File = m_PreloadedFile.get();
+  else
+    m_File = FifoDataFile::Load(filename, false);
 
   if (m_File)
   {
@@ -69,6 +72,17 @@ void FifoPlayer::Close()
   m_FrameRangeEnd = 0;
 }
 
+void FifoPlayer::PreloadFile(const std::string& filename)
+{
+  // Discard any previous preload; get() joins the worker if it is still loading.
+  if (m_PreloadedFile.valid())
+    m_PreloadedFile.get();
+
+  m_PreloadFilename = filename;
+  m_PreloadedFile =
+      std::async(std::launch::async, [filename] { return FifoDataFile::Load(filename, false); });
+}
+
 bool FifoPlayer::IsPlaying() const
 {
   return GetFile() != nullptr && Core::IsRunning();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -64,6 +65,11 @@ public:
   bool Open(const std::string& filename);
   void Close();
 
+  // Starts loading a capture on a worker thread so that a later Open() with the
+  // same filename only has to pick up the result. Intended for frontends that
+  // play many captures back to back and want to hide per-capture setup time.
+  void PreloadFile(const std::string& filename);
+
   // Returns a CPUCoreBase instance that can be injected into PowerPC as a
   // pseudo-CPU. The instance is only valid while the FifoPlayer is Open().
   // Returns nullptr if the FifoPlayer is not initialized correctly.
@@ -158,5 +164,8 @@ private:
 
   std::unique_ptr<FifoDataFile> m_File;
 
+  std::string m_PreloadFilename;
+  std::future<std::unique_ptr<FifoDataFile>> m_PreloadedFile;
+
   std::vector<AnalyzedFrameInfo> m_FrameInfo;
 };
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <utility>
 
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
@@ -18,6 +19,60 @@ static FifoRecorder instance;
 
 FifoRecorder::FifoRecorder() = default;
 
+FifoRecorder::~FifoRecorder()
+{
+  StopWriterThread();
+}
+
+void FifoRecorder::StopWriterThread()
+{
+  if (m_WriterThread.joinable())
+  {
+    m_WriterShutdown.Set();
+    m_WriterWakeup.Set();
+    m_WriterThread.join();
+  }
+}
+
+void FifoRecorder::WriterThread()
+{
+  Common::SetCurrentThreadName("FifoRecorder writer");
+
+  while (true)
+  {
+    m_WriterWakeup.Wait();
+
+    StagedItem item{};
+    while (m_StagedItems.Pop(item))
+      ProcessStagedItem(item);
+
+    if (m_WriterShutdown.IsSet())
+      return;
+  }
+}
+
+void FifoRecorder::ProcessStagedItem(StagedItem& item)
+{
+  if (!item.is_frame)
+  {
+    m_PendingMemoryUpdates.push_back(std::move(item.memory_update));
+    return;
+  }
+
+  item.frame.memoryUpdates = std::move(m_PendingMemoryUpdates);
+  m_PendingMemoryUpdates.clear();
+
+  std::lock_guard<std::recursive_mutex> lk(m_mutex);
+
+  // Copy frame to file
+  // The file will be responsible for freeing the memory allocated for each frame's fifoData
+  if (m_File)
+    m_File->AddFrame(item.frame);
+
+  if (item.is_last_frame && m_FinishedCb)
+    m_FinishedCb();
+}
+
 void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 {
   std::lock_guard<std::recursive_mutex> lk(m_mutex);
@@ -55,6 +110,9 @@ void FifoRecorder::StartRecording(s32 numFrames, CallbackFunc finishedCb)
 
   m_RequestedRecordingEnd = false;
   m_FinishedCb = finishedCb;
+
+  if (!m_WriterThread.joinable())
+    m_WriterThread = std::thread(&FifoRecorder::WriterThread, this);
 }
 
 void FifoRecorder::StopRecording()
@@ -94,21 +152,24 @@ void FifoRecorder::WriteGPCommand(const u8* data, u32 size)
 
   if (m_FrameEnded && !m_FifoData.empty())
   {
-    m_CurrentFrame.fifoData = m_FifoData;
+    // Hand the completed frame to the writer thread; the fifo data is moved, not
+    // copied, so the video thread doesn't stall on multi-megabyte frames.
+    StagedItem item{};
+    item.is_frame = true;
+    item.frame.fifoStart = m_CurrentFrame.fifoStart;
+    item.frame.fifoEnd = m_CurrentFrame.fifoEnd;
+    item.frame.fifoData = std::move(m_FifoData);
 
     {
       std::lock_guard<std::recursive_mutex> lk(m_mutex);
-
-      // Copy frame to file
-      // The file will be responsible for freeing the memory allocated for each frame's fifoData
-      m_File->AddFrame(m_CurrentFrame);
-
-      if (m_FinishedCb && m_RequestedRecordingEnd)
-        m_FinishedCb();
+      item.is_last_frame = m_RequestedRecordingEnd;
     }
 
-    m_CurrentFrame.memoryUpdates.clear();
+    m_StagedItems.Push(std::move(item));
+    m_WriterWakeup.Set();
+
     m_FifoData.clear();
+    m_FifoData.reserve(1024 * 1024 * 4);
     m_FrameEnded = false;
   }
 
@@ -135,15 +196,18 @@ void FifoRecorder::UseMemory(u32 address, u32 size, MemoryUpdate::Type type, boo
     // Update current memory
     memcpy(curData, newData, size);
 
-    // Record memory update
-    MemoryUpdate memUpdate;
+    // Record memory update. The data must be copied here, before emulation can
+    // touch it again, but collecting it into the frame happens on the writer thread.
+    StagedItem item{};
+    MemoryUpdate& memUpdate = item.memory_update;
     memUpdate.address = address;
     memUpdate.fifoPosition = (u32)(m_FifoData.size());
     memUpdate.type = type;
     memUpdate.data.resize(size);
     std::copy(newData, newData + size, memUpdate.data.begin());
 
-    m_CurrentFrame.memoryUpdates.push_back(std::move(memUpdate));
+    m_StagedItems.Push(std::move(item));
+    m_WriterWakeup.Set();
   }
   else if (dynamicUpdate)
   {
@@ -7,8 +7,12 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
+#include "Common/Event.h"
+#include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 #include "Core/FifoPlayer/FifoDataFile.h"
 
 class FifoRecorder
@@ -17,6 +21,7 @@ public:
   using CallbackFunc = std::function<void()>;
 
   FifoRecorder();
+  ~FifoRecorder();
 
   void StartRecording(s32 numFrames, CallbackFunc finishedCb);
   void StopRecording();
@@ -48,6 +53,21 @@ public:
   static FifoRecorder& GetInstance();
 
 private:
+  // Work staged by the video thread for the writer thread: either one recorded
+  // memory update, or a completed frame (is_frame == true) which adopts all the
+  // memory updates staged before it.
+  struct StagedItem
+  {
+    bool is_frame = false;
+    bool is_last_frame = false;
+    MemoryUpdate memory_update;
+    FifoFrameInfo frame;
+  };
+
+  void StopWriterThread();
+  void WriterThread();
+  void ProcessStagedItem(StagedItem& item);
+
   // Accessed from both GUI and video threads
 
   std::recursive_mutex m_mutex;
@@ -60,6 +80,17 @@ private:
   CallbackFunc m_FinishedCb;
   std::unique_ptr<FifoDataFile> m_File;
 
+  // Staging ring between the video thread (producer) and the writer thread
+  // (consumer), so packaging frames and growing the file don't stall recording.
+  Common::SPSCQueue<StagedItem, false> m_StagedItems;
+  std::thread m_WriterThread;
+  Common::Event m_WriterWakeup;
+  Common::Flag m_WriterShutdown;
+
+  // Accessed only from the writer thread
+
+  std::vector<MemoryUpdate> m_PendingMemoryUpdates;
+
   // Accessed only from video thread
 
   bool m_SkipNextData = true;
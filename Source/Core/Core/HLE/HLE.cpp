@@ -69,6 +69,13 @@ static const SPatch OSPatches[] = {
     {"___blank",                     HLE_OS::HLE_GeneralDebugPrint,         HookType::Start,   HookFlag::Debug}, // used for early init things (normally)
     {"__write_console",              HLE_OS::HLE_write_console,             HookType::Start,   HookFlag::Debug}, // used by sysmenu (+more?)
 
+    // Fast-path replacements for the hottest SDK routines. These only take
+    // effect when a symbol map or signature database identifies the function.
+    {"memcpy",                       HLE_Misc::HLEMemcpy,                   HookType::Replace, HookFlag::Generic},
+    {"memset",                       HLE_Misc::HLEMemset,                   HookType::Replace, HookFlag::Generic},
+    {"bzero",                        HLE_Misc::HLEBzero,                    HookType::Replace, HookFlag::Generic},
+    {"DCFlushRange",                 HLE_Misc::HLEDCFlushRange,             HookType::Replace, HookFlag::Generic},
+
     {"GeckoCodehandler",             HLE_Misc::GeckoCodeHandlerICacheFlush, HookType::Start,   HookFlag::Fixed},
     {"GeckoHandlerReturnTrampoline", HLE_Misc::GeckoReturnTrampoline,       HookType::Replace, HookFlag::Fixed},
     {"AppLoaderReport",              HLE_OS::HLE_GeneralDebugPrint,         HookType::Replace, HookFlag::Fixed} // apploader needs OSReport-like function
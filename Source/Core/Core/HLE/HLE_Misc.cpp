@@ -4,10 +4,13 @@
 
 #include "Core/HLE/HLE_Misc.h"
 
+#include <cstring>
+
 #include "Common/Common.h"
 #include "Common/CommonTypes.h"
 #include "Core/GeckoCode.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -68,4 +71,112 @@ void GeckoReturnTrampoline()
                    PowerPC::HostRead_U64(SP + 24 + (2 * i + 1) * sizeof(u64)));
   }
 }
+
+// Returns a host pointer when the whole range lies in linearly-mapped RAM
+// under the current BATs (the same condition the JIT uses for unchecked
+// fastmem accesses), or nullptr when the range needs the full MMU path.
+static u8* HostPointerForRange(u32 address, u32 size)
+{
+  const u32 end = address + size - 1;
+  if (size == 0 || end < address)
+    return nullptr;
+
+  for (u32 page = address >> PowerPC::BAT_INDEX_SHIFT; page <= end >> PowerPC::BAT_INDEX_SHIFT;
+       page++)
+  {
+    if (!PowerPC::IsOptimizableRAMAddress(page << PowerPC::BAT_INDEX_SHIFT))
+      return nullptr;
+  }
+
+  const u32 masked = address & 0x3FFFFFFF;
+  if (masked < Memory::REALRAM_SIZE && size <= Memory::REALRAM_SIZE - masked)
+    return Memory::m_pRAM + masked;
+  if (Memory::m_pEXRAM && (masked >> 28) == 0x1 &&
+      (masked & Memory::EXRAM_MASK) + size <= Memory::EXRAM_SIZE)
+    return Memory::m_pEXRAM + (masked & Memory::EXRAM_MASK);
+  return nullptr;
+}
+
+// The SDK's memcpy/memset/bzero dominate block-level profiles in most titles;
+// with a symbol map (or signature hit) for them we can run the copy natively.
+// The slow path goes byte-by-byte through the MMU, which stays correct when
+// translation is enabled with non-standard page mappings.
+void HLEMemcpy()
+{
+  const u32 dest = GPR(3);
+  const u32 src = GPR(4);
+  const u32 count = GPR(5);
+
+  if (count != 0)
+  {
+    u8* dest_ptr = HostPointerForRange(dest, count);
+    const u8* src_ptr = HostPointerForRange(src, count);
+    if (dest_ptr && src_ptr)
+    {
+      // memmove, as some games rely on the SDK implementation's copy direction
+      // for overlapping buffers.
+      memmove(dest_ptr, src_ptr, count);
+    }
+    else
+    {
+      for (u32 i = 0; i < count; i++)
+        PowerPC::HostWrite_U8(PowerPC::HostRead_U8(src + i), dest + i);
+    }
+  }
+
+  // The return value (r3 = dest) is already in place.
+  NPC = LR;
+}
+
+void HLEMemset()
+{
+  const u32 dest = GPR(3);
+  const u8 value = static_cast<u8>(GPR(4));
+  const u32 count = GPR(5);
+
+  if (count != 0)
+  {
+    u8* dest_ptr = HostPointerForRange(dest, count);
+    if (dest_ptr)
+    {
+      memset(dest_ptr, value, count);
+    }
+    else
+    {
+      for (u32 i = 0; i < count; i++)
+        PowerPC::HostWrite_U8(value, dest + i);
+    }
+  }
+
+  NPC = LR;
+}
+
+void HLEBzero()
+{
+  const u32 dest = GPR(3);
+  const u32 count = GPR(4);
+
+  if (count != 0)
+  {
+    u8* dest_ptr = HostPointerForRange(dest, count);
+    if (dest_ptr)
+    {
+      memset(dest_ptr, 0, count);
+    }
+    else
+    {
+      for (u32 i = 0; i < count; i++)
+        PowerPC::HostWrite_U8(0, dest + i);
+    }
+  }
+
+  NPC = LR;
+}
+
+void HLEDCFlushRange()
+{
+  // We don't emulate the data cache, so flushing a range is a no-op; DMA and
+  // the GPU always see RAM directly.
+  NPC = LR;
+}
 }
@@ -10,4 +10,8 @@ void UnimplementedFunction();
 void HBReload();
 void GeckoCodeHandlerICacheFlush();
 void GeckoReturnTrampoline();
+void HLEMemcpy();
+void HLEMemset();
+void HLEBzero();
+void HLEDCFlushRange();
 }
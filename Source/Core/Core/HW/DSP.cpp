@@ -24,6 +24,7 @@
 
 #include "Core/HW/DSP.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "AudioCommon/AudioCommon.h"
@@ -34,9 +35,11 @@
 #include "Core/CoreTiming.h"
 #include "Core/DSPEmulator.h"
 
+#include "Core/HW/AudioInterface.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/Memmap.h"
 #include "Core/HW/ProcessorInterface.h"
+#include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/PowerPC.h"
 
 namespace DSP
@@ -92,7 +95,8 @@ union UAudioDMAControl
 struct AudioDMA
 {
   u32 current_source_address = 0;
-  u16 remaining_blocks_count = 0;
+  u16 latched_blocks_count = 0;
+  u64 period_start_ticks = 0;
   u32 SourceAddress = 0;
   UAudioDMAControl AudioDMAControl;
 };
@@ -163,6 +167,7 @@ void DoState(PointerWrap& p)
 static void UpdateInterrupts();
 static void Do_ARAM_DMA();
 static void GenerateDSPInterrupt(u64 DSPIntType, s64 cyclesLate = 0);
+static u16 AudioDMABlocksRemaining();
 
 static CoreTiming::EventType* s_et_GenerateDSPInterrupt;
 static CoreTiming::EventType* s_et_CompleteARAM;
@@ -357,7 +362,8 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
         if (!already_enabled && s_audioDMA.AudioDMAControl.Enable)
         {
           s_audioDMA.current_source_address = s_audioDMA.SourceAddress;
-          s_audioDMA.remaining_blocks_count = s_audioDMA.AudioDMAControl.NumBlocks;
+          s_audioDMA.latched_blocks_count = s_audioDMA.AudioDMAControl.NumBlocks;
+          s_audioDMA.period_start_ticks = CoreTiming::GetTicks();
 
           INFO_LOG(AUDIO_INTERFACE, "Audio DMA configured: %i blocks from 0x%08x",
                    s_audioDMA.AudioDMAControl.NumBlocks, s_audioDMA.SourceAddress);
@@ -375,13 +381,13 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
 
   // Audio DMA blocks remaining is invalid to write to, and requires logic on
   // the read side.
-  mmio->Register(
-      base | AUDIO_DMA_BLOCKS_LEFT, MMIO::ComplexRead<u16>([](u32) {
-        // remaining_blocks_count is zero-based.  DreamMix World Fighters will hang if it never
-        // reaches zero.
-        return (s_audioDMA.remaining_blocks_count > 0 ? s_audioDMA.remaining_blocks_count - 1 : 0);
-      }),
-      MMIO::InvalidWrite<u16>());
+  mmio->Register(base | AUDIO_DMA_BLOCKS_LEFT, MMIO::ComplexRead<u16>([](u32) {
+                   // The register is zero-based.  DreamMix World Fighters will hang if it never
+                   // reaches zero.
+                   const u16 remaining = AudioDMABlocksRemaining();
+                   return static_cast<u16>(remaining > 0 ? remaining - 1 : 0);
+                 }),
+                 MMIO::InvalidWrite<u16>());
 
   // 32 bit reads/writes are a combination of two 16 bit accesses.
   for (int i = 0; i < 0x1000; i += 4)
@@ -436,39 +442,60 @@ void UpdateDSPSlice(int cycles)
   }
 }
 
-// This happens at 4 khz, since 32 bytes at 4khz = 4 bytes at 32 khz (16bit stereo pcm)
-void UpdateAudioDMA()
+// One 32-byte block drains per 32 bytes' worth of the AID sample rate, i.e. at 4khz for
+// 32khz 16bit stereo pcm.
+static u64 GetTicksPerAudioDMABlock()
+{
+  return SystemTimers::GetTicksPerSecond() / (AudioInterface::GetAIDSampleRate() * 4 / 32);
+}
+
+// Instead of stepping a counter from a per-block event, derive how many blocks of the
+// latched period have drained from the tick clock whenever someone needs to know.
+static u16 AudioDMABlocksRemaining()
+{
+  const u64 elapsed_blocks =
+      (CoreTiming::GetTicks() - s_audioDMA.period_start_ticks) / GetTicksPerAudioDMABlock();
+  return static_cast<u16>(
+      s_audioDMA.latched_blocks_count -
+      std::min<u64>(elapsed_blocks, s_audioDMA.latched_blocks_count));
+}
+
+// Called once per DMA period rather than once per block. The mixer is handed the whole
+// buffer when a period is latched, so all that is left to do here is relatch and raise
+// AID on the same tick the last 32-byte block used to complete under per-block eventing.
+// Returns the number of block periods to sleep until the next event.
+int UpdateAudioDMA()
 {
   static short zero_samples[8 * 2] = {0};
   if (s_audioDMA.AudioDMAControl.Enable)
   {
-    // Read audio at g_audioDMA.current_source_address in RAM and push onto an
-    // external audio fifo in the emulator, to be mixed with the disc
-    // streaming output.
-
-    if (s_audioDMA.remaining_blocks_count != 0)
+    const u16 blocks_left = AudioDMABlocksRemaining();
+    if (blocks_left > 1)
     {
-      s_audioDMA.remaining_blocks_count--;
-      s_audioDMA.current_source_address += 32;
+      // A fresh buffer was latched by the control register since the last event. The old
+      // per-block scheme consumed one block on its first tick after the latch, so sleep
+      // for one block less than what remains to keep the interrupt on the same tick.
+      return blocks_left - 1;
     }
 
-    if (s_audioDMA.remaining_blocks_count == 0)
-    {
-      s_audioDMA.current_source_address = s_audioDMA.SourceAddress;
-      s_audioDMA.remaining_blocks_count = s_audioDMA.AudioDMAControl.NumBlocks;
+    // The period has drained; relatch and fire the AID interrupt.
+    s_audioDMA.current_source_address = s_audioDMA.SourceAddress;
+    s_audioDMA.latched_blocks_count = s_audioDMA.AudioDMAControl.NumBlocks;
+    s_audioDMA.period_start_ticks = CoreTiming::GetTicks();
 
-      if (s_audioDMA.remaining_blocks_count != 0)
-      {
-        // We make the samples ready as soon as possible
-        void* address = Memory::GetPointer(s_audioDMA.SourceAddress);
-        AudioCommon::SendAIBuffer((short*)address, s_audioDMA.AudioDMAControl.NumBlocks * 8);
-      }
-      GenerateDSPInterrupt(DSP::INT_AID);
+    if (s_audioDMA.latched_blocks_count != 0)
+    {
+      // We make the samples ready as soon as possible
+      void* address = Memory::GetPointer(s_audioDMA.SourceAddress);
+      AudioCommon::SendAIBuffer((short*)address, s_audioDMA.AudioDMAControl.NumBlocks * 8);
     }
+    GenerateDSPInterrupt(DSP::INT_AID);
+    return std::max<u16>(s_audioDMA.latched_blocks_count, 1);
   }
   else
   {
     AudioCommon::SendAIBuffer(&zero_samples[0], 8);
+    return 1;
   }
 }
 
@@ -79,7 +79,8 @@ void WriteARAM(u8 value, u32 address);
 // Debugger Helper
 u8* GetARAMPtr();
 
-void UpdateAudioDMA();
+// Returns the number of 32-byte block periods until the next audio DMA event is due.
+int UpdateAudioDMA();
 void UpdateDSPSlice(int cycles);
 
 }  // end of namespace DSP
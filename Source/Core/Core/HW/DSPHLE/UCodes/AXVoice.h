@@ -16,6 +16,7 @@
 #include <memory>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/MathUtil.h"
 #include "Core/DSP/DSPAccelerator.h"
 #include "Core/HW/DSP.h"
@@ -408,7 +409,58 @@ void MixAdd(int* out, const s16* input, u32 count, u16* pvol, s16* dpop, bool ra
   if (!ramp)
     volume_delta = 0;
 
-  for (u32 i = 0; i < count; ++i)
+  u32 i = 0;
+
+#ifdef _M_X86
+  // Mix 8 samples per iteration, with per-lane volumes so ramping stays
+  // per-sample exact. This computes bit for bit what the scalar loop below
+  // does; the loop below handles the tail (and non-x86 builds).
+  if (count >= 8)
+  {
+    __m128i vol = _mm_setr_epi16(
+        static_cast<s16>(volume), static_cast<s16>(volume + volume_delta),
+        static_cast<s16>(volume + 2 * volume_delta), static_cast<s16>(volume + 3 * volume_delta),
+        static_cast<s16>(volume + 4 * volume_delta), static_cast<s16>(volume + 5 * volume_delta),
+        static_cast<s16>(volume + 6 * volume_delta), static_cast<s16>(volume + 7 * volume_delta));
+    const __m128i vol_step = _mm_set1_epi16(static_cast<s16>(8 * volume_delta));
+    const __m128i min_sample = _mm_set1_epi16(-0x7FFF);
+    __m128i clamped = _mm_setzero_si128();
+
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+
+      // 32-bit products of the signed samples and the unsigned volumes
+      // (mulhi is signed*signed, so lanes with the volume's top bit set
+      // need the sample added back into the high half).
+      const __m128i lo = _mm_mullo_epi16(in, vol);
+      const __m128i hi =
+          _mm_add_epi16(_mm_mulhi_epi16(in, vol), _mm_and_si128(in, _mm_srai_epi16(vol, 15)));
+
+      const __m128i prod_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+      const __m128i prod_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+
+      // packs saturates to -32768, the scalar code clamps to -32767
+      clamped = _mm_max_epi16(_mm_packs_epi32(prod_lo, prod_hi), min_sample);
+
+      const __m128i ext_lo = _mm_srai_epi32(_mm_unpacklo_epi16(clamped, clamped), 16);
+      const __m128i ext_hi = _mm_srai_epi32(_mm_unpackhi_epi16(clamped, clamped), 16);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i]),
+                       _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&out[i])),
+                                     ext_lo));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[i + 4]),
+                       _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&out[i + 4])),
+                                     ext_hi));
+
+      vol = _mm_add_epi16(vol, vol_step);
+    }
+
+    volume += static_cast<u16>(volume_delta * i);
+    *dpop = static_cast<s16>(_mm_extract_epi16(clamped, 7));
+  }
+#endif
+
+  for (; i < count; ++i)
   {
     s64 sample = input[i];
     sample *= volume;
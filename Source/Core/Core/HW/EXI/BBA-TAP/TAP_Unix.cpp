@@ -14,6 +14,7 @@
 #include "Core/HW/EXI/EXI_DeviceEthernet.h"
 
 #ifdef __linux__
+#include <cerrno>
 #include <fcntl.h>
 #include <linux/if_tun.h>
 #include <net/if.h>
@@ -21,6 +22,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #endif
 
 namespace ExpansionInterface
@@ -70,6 +72,11 @@ bool CEXIETHERNET::Activate()
   }
   ioctl(fd, TUNSETNOCSUM, 1);
 
+  // Non-blocking reads let the read thread drain every queued frame per
+  // select() wakeup. TAP writes never block regardless, so sends are
+  // unaffected.
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
   INFO_LOG(SP1, "BBA initialized with associated tap %s", ifr.ifr_name);
   return RecvInit();
 #else
@@ -139,17 +146,46 @@ void CEXIETHERNET::ReadThreadHandler(CEXIETHERNET* self)
     if (select(self->fd + 1, &rfds, nullptr, nullptr, &timeout) <= 0)
       continue;
 
-    int readBytes = read(self->fd, self->mRecvBuffer.get(), BBA_RECV_SIZE);
-    if (readBytes < 0)
-    {
-      ERROR_LOG(SP1, "Failed to read from BBA, err=%d", readBytes);
-    }
-    else if (self->readEnabled.IsSet())
+    // Drain every frame that arrived before going back to sleep in select() -
+    // one wakeup per burst instead of one per frame. Frames go straight into
+    // the receive ring whenever it has room; the staging buffer is only used
+    // as the fallback.
+    while (!self->readThreadShutdown.IsSet())
     {
-      DEBUG_LOG(SP1, "Read data: %s",
-                ArrayToString(self->mRecvBuffer.get(), readBytes, 0x10).c_str());
-      self->mRecvBufferLength = readBytes;
-      self->RecvHandlePacket();
+      ssize_t readBytes;
+      RecvSpan spans[2];
+      const u32 num_spans = self->readEnabled.IsSet() ? self->GetRecvSpans(spans) : 0;
+      if (num_spans != 0)
+      {
+        iovec iov[2];
+        for (u32 i = 0; i < num_spans; i++)
+          iov[i] = {spans[i].data, spans[i].size};
+        readBytes = readv(self->fd, iov, num_spans);
+        if (readBytes > 0)
+        {
+          self->RecvHandleInPlacePacket(static_cast<u32>(readBytes));
+          continue;
+        }
+      }
+      else
+      {
+        readBytes = read(self->fd, self->mRecvBuffer.get(), BBA_RECV_SIZE);
+        if (readBytes > 0)
+        {
+          if (self->readEnabled.IsSet())
+          {
+            DEBUG_LOG(SP1, "Read data: %s",
+                      ArrayToString(self->mRecvBuffer.get(), readBytes, 0x10).c_str());
+            self->mRecvBufferLength = static_cast<u32>(readBytes);
+            self->RecvHandlePacket();
+          }
+          continue;
+        }
+      }
+
+      if (readBytes < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+        ERROR_LOG(SP1, "Failed to read from BBA, err=%d", errno);
+      break;
     }
   }
 }
@@ -32,6 +32,8 @@ CEXIAgp::CEXIAgp(int index)
 
 CEXIAgp::~CEXIAgp()
 {
+  EnsureRomLoaded();
+
   std::string path;
   std::string filename;
   std::string ext;
@@ -81,10 +83,21 @@ void CEXIAgp::LoadRom()
                           SConfig::GetInstance().m_strGbaCartB,
             &path, &filename, &ext);
   gbapath = path + filename;
-  LoadFileToROM(gbapath + ext);
-  INFO_LOG(EXPANSIONINTERFACE, "Loaded GBA rom: %s card: %d", gbapath.c_str(), m_slot);
-  LoadFileToEEPROM(gbapath + ".sav");
-  INFO_LOG(EXPANSIONINTERFACE, "Loaded GBA sav: %s card: %d", gbapath.c_str(), m_slot);
+  // The first AGP command arrives well after boot, so the full-image ROM read
+  // can overlap the rest of the boot process.
+  m_rom_load_thread = std::thread([this, rom_path = gbapath + ext, sav_path = gbapath + ".sav"] {
+    LoadFileToROM(rom_path);
+    INFO_LOG(EXPANSIONINTERFACE, "Loaded GBA rom: %s card: %d", rom_path.c_str(), m_slot);
+    // The EEPROM setup depends on the ROM size, so it has to follow the ROM load.
+    LoadFileToEEPROM(sav_path);
+    INFO_LOG(EXPANSIONINTERFACE, "Loaded GBA sav: %s card: %d", sav_path.c_str(), m_slot);
+  });
+}
+
+void CEXIAgp::EnsureRomLoaded()
+{
+  if (m_rom_load_thread.joinable())
+    m_rom_load_thread.join();
 }
 
 void CEXIAgp::LoadFileToROM(const std::string& filename)
@@ -170,6 +183,8 @@ void CEXIAgp::SaveFileFromEEPROM(const std::string& filename)
 
 u32 CEXIAgp::ImmRead(u32 _uSize)
 {
+  EnsureRomLoaded();
+
   u32 uData = 0;
   u8 RomVal1, RomVal2, RomVal3, RomVal4;
 
@@ -266,6 +281,8 @@ u32 CEXIAgp::ImmRead(u32 _uSize)
 
 void CEXIAgp::ImmWrite(u32 _uData, u32 _uSize)
 {
+  EnsureRomLoaded();
+
   // 0x00 = Execute current command?
   if ((_uSize == 1) && ((_uData & 0xFF000000) == 0))
     return;
@@ -363,6 +380,8 @@ void CEXIAgp::ImmWrite(u32 _uData, u32 _uSize)
 
 void CEXIAgp::DoState(PointerWrap& p)
 {
+  EnsureRomLoaded();
+
   p.Do(m_slot);
   p.Do(m_address);
   p.Do(m_current_cmd);
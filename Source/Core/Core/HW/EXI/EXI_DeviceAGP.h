@@ -5,6 +5,7 @@
 #pragma once
 
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Core/HW/EXI/EXI_Device.h"
@@ -59,8 +60,14 @@ private:
   void LoadFileToEEPROM(const std::string& filename);
   void SaveFileFromEEPROM(const std::string& filename);
   void LoadRom();
+  void EnsureRomLoaded();
   void CRC8(const u8* data, u32 size);
 
+  // The ROM image can live on slow storage, so the full-image read happens on
+  // this thread instead of blocking boot. Everything that touches the ROM
+  // joins it first via EnsureRomLoaded().
+  std::thread m_rom_load_thread;
+
   u8 m_hash = 0;
   u32 m_current_cmd = 0;
   u32 m_return_pos = 0;
@@ -4,6 +4,7 @@
 
 #include "Core/HW/EXI/EXI_DeviceEthernet.h"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -432,7 +433,7 @@ inline u8 CEXIETHERNET::HashIndex(const u8* dest_eth_addr)
   return crc >> 26;
 }
 
-inline bool CEXIETHERNET::RecvMACFilter()
+inline bool CEXIETHERNET::RecvMACFilter(const u8* frame)
 {
   static u8 const broadcast[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
 
@@ -441,11 +442,11 @@ inline bool CEXIETHERNET::RecvMACFilter()
     return true;
 
   // Unicast?
-  if ((mRecvBuffer[0] & 0x01) == 0)
+  if ((frame[0] & 0x01) == 0)
   {
-    return memcmp(mRecvBuffer.get(), &mBbaMem[BBA_NAFR_PAR0], 6) == 0;
+    return memcmp(frame, &mBbaMem[BBA_NAFR_PAR0], 6) == 0;
   }
-  else if (memcmp(mRecvBuffer.get(), broadcast, 6) == 0)
+  else if (memcmp(frame, broadcast, 6) == 0)
   {
     // Accept broadcast?
     return !!(mBbaMem[BBA_NCRB] & NCRB_AB);
@@ -458,7 +459,7 @@ inline bool CEXIETHERNET::RecvMACFilter()
   else
   {
     // Lookup the dest eth address in the hashmap
-    u16 index = HashIndex(mRecvBuffer.get());
+    u16 index = HashIndex(frame);
     return !!(mBbaMem[BBA_NAFR_MAR0 + index / 8] & (1 << (index % 8)));
   }
 }
@@ -484,7 +485,7 @@ bool CEXIETHERNET::RecvHandlePacket()
   u32 status = 0;
   u16 rwp_initial = page_ptr(BBA_RWP);
 
-  if (!RecvMACFilter())
+  if (!RecvMACFilter(mRecvBuffer.get()))
     goto wait_for_next;
 
 #ifdef BBA_TRACK_PAGE_PTRS
@@ -577,6 +578,108 @@ bool CEXIETHERNET::RecvHandlePacket()
     WARN_LOG(SP1, "NOT raising recv interrupt");
   }
 
+wait_for_next:
+  if (mBbaMem[BBA_NCRA] & NCRA_SR)
+    RecvStart();
+
+  return true;
+}
+
+// Describes where in the receive ring the backend may read the next frame
+// directly, skipping the mRecvBuffer staging copy. Returns the number of spans
+// written; 0 means the caller must use the staging path (unconfigured page
+// pointers, or not enough free space for a worst-case read - the staging path
+// keeps the overflow handling).
+u32 CEXIETHERNET::GetRecvSpans(RecvSpan (&spans)[2])
+{
+  const u16 bp = page_ptr(BBA_BP);
+  const u16 rwp = page_ptr(BBA_RWP);
+  const u16 rrp = page_ptr(BBA_RRP);
+  const u16 rhbp = page_ptr(BBA_RHBP);
+
+  // The driver is free to leave the page pointers unconfigured, so sanity
+  // check them before trusting them.
+  if (rhbp >= BBA_NUM_PAGES || bp >= rhbp || rwp < bp || rwp >= rhbp || rrp < bp || rrp >= rhbp)
+    return 0;
+
+  u8* const write_ptr = ptr_from_page_ptr(BBA_RWP) + 4;
+  u8* const end_ptr = ptr_from_page_ptr(BBA_RHBP);
+  u8* const read_ptr = ptr_from_page_ptr(BBA_RRP);
+  u8* const base_ptr = ptr_from_page_ptr(BBA_BP);
+
+  u32 num_spans;
+  u32 total;
+  if (read_ptr > write_ptr)
+  {
+    spans[0] = {write_ptr, static_cast<u32>(read_ptr - write_ptr)};
+    total = spans[0].size;
+    num_spans = 1;
+  }
+  else
+  {
+    spans[0] = {write_ptr, static_cast<u32>(end_ptr - write_ptr)};
+    spans[1] = {base_ptr, static_cast<u32>(read_ptr - base_ptr)};
+    total = spans[0].size + spans[1].size;
+    num_spans = spans[1].size != 0 ? 2 : 1;
+  }
+
+  if (total < BBA_RECV_SIZE)
+    return 0;
+
+  // Cap at the same maximum read size as the staging path.
+  if (spans[0].size >= BBA_RECV_SIZE)
+  {
+    spans[0].size = BBA_RECV_SIZE;
+    num_spans = 1;
+  }
+  else if (num_spans == 2)
+  {
+    spans[1].size = std::min(spans[1].size, BBA_RECV_SIZE - spans[0].size);
+  }
+
+  return num_spans;
+}
+
+// Commits a frame the backend received directly into the spans returned by
+// GetRecvSpans. Overflow cannot occur here: the in-place path is only taken
+// when the free span fits a worst-case read.
+bool CEXIETHERNET::RecvHandleInPlacePacket(u32 length)
+{
+  u8* const page = ptr_from_page_ptr(BBA_RWP);
+  const u8* const frame = page + 4;
+  u32 status = 0;
+
+  // A rejected frame simply leaves RWP alone; the bytes already written sit in
+  // unclaimed pages no descriptor points at.
+  if (!RecvMACFilter(frame))
+    goto wait_for_next;
+
+  if (frame[0] & 0x01)
+    status |= DESC_MF;
+
+  // Advance RWP by the number of pages the descriptor and frame occupy,
+  // mirroring the per-byte walk of the staging path.
+  for (u32 pages = (length + 4 + BBA_PAGE_SIZE - 1) / BBA_PAGE_SIZE; pages != 0; pages--)
+    inc_rwp();
+
+  ((Descriptor*)page)->set(*(u16*)&mBbaMem[BBA_RWP], 4 + length, status);
+
+  mBbaMem[BBA_LRPS] = status;
+
+  // Raise interrupt
+  if (mBbaMem[BBA_IMR] & INT_R)
+  {
+    mBbaMem[BBA_IR] |= INT_R;
+
+    exi_status.interrupt |= exi_status.TRANSFER;
+    ExpansionInterface::ScheduleUpdateInterrupts(CoreTiming::FromThread::NON_CPU, 0);
+  }
+  else
+  {
+    // This occurs if software is still processing the last raised recv interrupt
+    WARN_LOG(SP1, "NOT raising recv interrupt");
+  }
+
 wait_for_next:
   if (mBbaMem[BBA_NCRA] & NCRA_SR)
     RecvStart();
@@ -290,10 +290,21 @@ private:
   void SendFromPacketBuffer();
   void SendComplete();
   u8 HashIndex(const u8* dest_eth_addr);
-  bool RecvMACFilter();
+  bool RecvMACFilter(const u8* frame);
   void inc_rwp();
   bool RecvHandlePacket();
 
+  // Zero-copy receive path: when the free span of the receive ring is large
+  // enough for a worst-case frame, the backend reads frame data straight into
+  // place behind the next descriptor instead of staging it in mRecvBuffer.
+  struct RecvSpan
+  {
+    u8* data;
+    u32 size;
+  };
+  u32 GetRecvSpans(RecvSpan (&spans)[2]);
+  bool RecvHandleInPlacePacket(u32 length);
+
   std::unique_ptr<u8[]> mBbaMem;
   std::unique_ptr<u8[]> tx_fifo;
 
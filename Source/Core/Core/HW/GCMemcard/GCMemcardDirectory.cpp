@@ -187,41 +187,57 @@ GCMemcardDirectory::GCMemcardDirectory(const std::string& directory, int slot, u
     File::IOFile((m_save_directory + MC_HDR), "rb").ReadBytes(&m_hdr, BLOCK_SIZE);
   }
 
-  std::vector<std::string> filenames = Common::DoFileSearch({m_save_directory}, {".gci"});
+  // Scanning the folder and loading the saves can take a while with large
+  // collections or slow storage, so it happens on a worker thread. Games take
+  // a moment to issue their first card access, which joins the worker, so the
+  // scan overlaps the rest of the boot process.
+  m_load_thread = std::thread([this] {
+    Common::SetCurrentThreadName(StringFromFormat("Memcard %d load thread", m_card_index).c_str());
 
-  if (filenames.size() > 112)
-  {
-    Core::DisplayMessage("Warning: There are more than 112 save files on this memory card.\n"
-                         " Only loading the first 112 in the folder, unless the game ID is the "
-                         "same as the current game's ID",
-                         4000);
-  }
+    std::vector<std::string> filenames = Common::DoFileSearch({m_save_directory}, {".gci"});
 
-  for (const std::string& gci_file : filenames)
-  {
-    if (m_saves.size() == DIRLEN)
+    if (filenames.size() > 112)
     {
-      PanicAlertT(
-          "There are too many GCI files in the folder\n%s.\nOnly the first 127 will be available",
-          m_save_directory.c_str());
-      break;
+      Core::DisplayMessage("Warning: There are more than 112 save files on this memory card.\n"
+                           " Only loading the first 112 in the folder, unless the game ID is the "
+                           "same as the current game's ID",
+                           4000);
     }
-    int index = LoadGCI(gci_file, m_saves.size() > 112 ||
-                                      Config::Get(Config::MAIN_GCI_FOLDER_CURRENT_GAME_ONLY));
-    if (index != NO_INDEX)
+
+    for (const std::string& gci_file : filenames)
     {
-      m_loaded_saves.push_back(m_saves.at(index).m_gci_header.GCI_FileName());
+      if (m_saves.size() == DIRLEN)
+      {
+        PanicAlertT(
+            "There are too many GCI files in the folder\n%s.\nOnly the first 127 will be available",
+            m_save_directory.c_str());
+        break;
+      }
+      int index = LoadGCI(gci_file, m_saves.size() > 112 ||
+                                        Config::Get(Config::MAIN_GCI_FOLDER_CURRENT_GAME_ONLY));
+      if (index != NO_INDEX)
+      {
+        m_loaded_saves.push_back(m_saves.at(index).m_gci_header.GCI_FileName());
+      }
     }
-  }
 
-  m_loaded_saves.clear();
-  m_dir1.fixChecksums();
-  m_dir2 = m_dir1;
-  m_bat2 = m_bat1;
+    m_loaded_saves.clear();
+    m_dir1.fixChecksums();
+    m_dir2 = m_dir1;
+    m_bat2 = m_bat1;
+  });
 
   m_flush_thread = std::thread(&GCMemcardDirectory::FlushThread, this);
 }
 
+void GCMemcardDirectory::EnsureCardReady()
+{
+  // Both the CPU thread and the flush thread can get here, so serialize the join.
+  std::lock_guard<std::mutex> lk(m_load_mutex);
+  if (m_load_thread.joinable())
+    m_load_thread.join();
+}
+
 void GCMemcardDirectory::FlushThread()
 {
   if (!SConfig::GetInstance().bEnableMemcardSdWriting)
@@ -253,6 +269,8 @@ void GCMemcardDirectory::FlushThread()
 
 GCMemcardDirectory::~GCMemcardDirectory()
 {
+  EnsureCardReady();
+
   m_exiting.Set();
   m_flush_trigger.Set();
   m_flush_thread.join();
@@ -262,6 +280,8 @@ GCMemcardDirectory::~GCMemcardDirectory()
 
 s32 GCMemcardDirectory::Read(u32 src_address, s32 length, u8* dest_address)
 {
+  EnsureCardReady();
+
   s32 block = src_address / BLOCK_SIZE;
   u32 offset = src_address % BLOCK_SIZE;
   s32 extra = 0;  // used for read calls that are across multiple blocks
@@ -319,6 +339,8 @@ s32 GCMemcardDirectory::Read(u32 src_address, s32 length, u8* dest_address)
 
 s32 GCMemcardDirectory::Write(u32 dest_address, s32 length, const u8* src_address)
 {
+  EnsureCardReady();
+
   std::unique_lock<std::mutex> l(m_write_mutex);
   if (length != 0x80)
     INFO_LOG(EXPANSIONINTERFACE, "Writing to 0x%x. Length: 0x%x", dest_address, length);
@@ -387,6 +409,8 @@ s32 GCMemcardDirectory::Write(u32 dest_address, s32 length, const u8* src_addres
 
 void GCMemcardDirectory::ClearBlock(u32 address)
 {
+  EnsureCardReady();
+
   if (address % BLOCK_SIZE)
   {
     PanicAlertT("GCMemcardDirectory: ClearBlock called with invalid block address");
@@ -581,6 +605,8 @@ bool GCMemcardDirectory::SetUsedBlocks(int save_index)
 
 void GCMemcardDirectory::FlushToFile()
 {
+  EnsureCardReady();
+
   std::unique_lock<std::mutex> l(m_write_mutex);
   int errors = 0;
   DEntry invalid;
@@ -675,6 +701,8 @@ void GCMemcardDirectory::FlushToFile()
 
 void GCMemcardDirectory::DoState(PointerWrap& p)
 {
+  EnsureCardReady();
+
   std::unique_lock<std::mutex> l(m_write_mutex);
   m_last_block = -1;
   m_last_block_address = nullptr;
@@ -45,6 +45,7 @@ private:
   s32 DirectoryWrite(u32 dest_address, u32 length, const u8* src_address);
   inline void SyncSaves();
   bool SetUsedBlocks(int save_index);
+  void EnsureCardReady();
 
   u32 m_game_id;
   s32 m_last_block;
@@ -61,4 +62,10 @@ private:
   std::mutex m_write_mutex;
   Common::Flag m_exiting;
   std::thread m_flush_thread;
+
+  // Scanning the save folder and loading the GCI files can hit slow storage,
+  // so it runs on this thread instead of blocking boot. Every card access
+  // joins it first via EnsureCardReady().
+  std::mutex m_load_mutex;
+  std::thread m_load_thread;
 };
@@ -4,12 +4,15 @@
 
 #include "Core/HW/GCMemcard/GCMemcardRaw.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "Common/ChunkFile.h"
 #include "Common/CommonPaths.h"
@@ -57,6 +60,10 @@ MemoryCard::MemoryCard(const std::string& filename, int card_index, u16 size_mbi
     INFO_LOG(EXPANSIONINTERFACE, "No memory card found. A new one was created instead.");
   }
 
+  // A freshly formatted card must reach the disk in full; for one loaded
+  // from disk, nothing is dirty yet.
+  m_dirty_blocks.assign(m_memory_card_size / BLOCK_SIZE, !file);
+
   // Class members (including inherited ones) have now been initialized, so
   // it's safe to startup the flush thread (which reads them).
   m_flush_buffer = std::make_unique<u8[]>(m_memory_card_size);
@@ -176,11 +183,38 @@ void MemoryCard::FlushThread()
       return;
     }
 
+    // If the file was just created (or someone truncated it behind our back),
+    // every block has to be written; otherwise only the blocks dirtied since
+    // the last flush. The data is copied out under the lock and written
+    // afterwards, so EXI writes are never stalled by disk I/O.
+    const bool full_flush = file.GetSize() != m_memory_card_size;
+    std::vector<std::pair<u32, u32>> dirty_runs;  // (first block, number of blocks)
     {
       std::unique_lock<std::mutex> l(m_flush_mutex);
-      memcpy(&m_flush_buffer[0], &m_memcard_data[0], m_memory_card_size);
+      const u32 num_blocks = m_memory_card_size / BLOCK_SIZE;
+      for (u32 i = 0; i < num_blocks; i++)
+      {
+        if (!full_flush && !m_dirty_blocks[i])
+          continue;
+        const u32 run_start = i;
+        while (i < num_blocks && (full_flush || m_dirty_blocks[i]))
+        {
+          m_dirty_blocks[i] = false;
+          i++;
+        }
+        dirty_runs.emplace_back(run_start, i - run_start);
+      }
+      for (const auto& run : dirty_runs)
+      {
+        memcpy(&m_flush_buffer[run.first * BLOCK_SIZE], &m_memcard_data[run.first * BLOCK_SIZE],
+               run.second * BLOCK_SIZE);
+      }
+    }
+    for (const auto& run : dirty_runs)
+    {
+      file.Seek(static_cast<u64>(run.first) * BLOCK_SIZE, SEEK_SET);
+      file.WriteBytes(&m_flush_buffer[run.first * BLOCK_SIZE], run.second * BLOCK_SIZE);
     }
-    file.WriteBytes(&m_flush_buffer[0], m_memory_card_size);
 
     if (!do_exit)
     {
@@ -201,6 +235,14 @@ void MemoryCard::MakeDirty()
   m_dirty.Set();
 }
 
+// Caller must hold m_flush_mutex.
+void MemoryCard::MakeBlocksDirty(u32 address, s32 length)
+{
+  const u32 last_block = (address + length - 1) / BLOCK_SIZE;
+  for (u32 i = address / BLOCK_SIZE; i <= last_block; i++)
+    m_dirty_blocks[i] = true;
+}
+
 s32 MemoryCard::Read(u32 src_address, s32 length, u8* dest_address)
 {
   if (!IsAddressInBounds(src_address))
@@ -224,6 +266,7 @@ s32 MemoryCard::Write(u32 dest_address, s32 length, const u8* src_address)
   {
     std::unique_lock<std::mutex> l(m_flush_mutex);
     memcpy(&m_memcard_data[dest_address], src_address, length);
+    MakeBlocksDirty(dest_address, length);
   }
   MakeDirty();
   return length;
@@ -240,6 +283,7 @@ void MemoryCard::ClearBlock(u32 address)
   {
     std::unique_lock<std::mutex> l(m_flush_mutex);
     memset(&m_memcard_data[address], 0xFF, BLOCK_SIZE);
+    MakeBlocksDirty(address, BLOCK_SIZE);
   }
   MakeDirty();
 }
@@ -249,6 +293,7 @@ void MemoryCard::ClearAll()
   {
     std::unique_lock<std::mutex> l(m_flush_mutex);
     memset(&m_memcard_data[0], 0xFF, m_memory_card_size);
+    std::fill(m_dirty_blocks.begin(), m_dirty_blocks.end(), true);
   }
   MakeDirty();
 }
@@ -258,4 +303,12 @@ void MemoryCard::DoState(PointerWrap& p)
   p.Do(m_card_index);
   p.Do(m_memory_card_size);
   p.DoArray(&m_memcard_data[0], m_memory_card_size);
+  if (p.GetMode() == PointerWrap::MODE_READ)
+  {
+    // Loading a state can change any block. The card used to be written out
+    // in full on every flush, which persisted loaded states implicitly -
+    // keep that guarantee.
+    std::unique_lock<std::mutex> l(m_flush_mutex);
+    std::fill(m_dirty_blocks.begin(), m_dirty_blocks.end(), true);
+  }
 }
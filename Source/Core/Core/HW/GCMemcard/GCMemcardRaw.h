@@ -8,6 +8,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "Common/Event.h"
 #include "Common/Flag.h"
 #include "Core/HW/GCMemcard/GCMemcard.h"
@@ -30,6 +31,8 @@ public:
   void DoState(PointerWrap& p) override;
 
 private:
+  void MakeBlocksDirty(u32 address, s32 length);
+
   std::string m_filename;
   std::unique_ptr<u8[]> m_memcard_data;
   std::unique_ptr<u8[]> m_flush_buffer;
@@ -37,4 +40,7 @@ private:
   std::mutex m_flush_mutex;
   Common::Event m_flush_trigger;
   Common::Flag m_dirty;
+  // One bit per 8 KiB card block, so the flush thread only writes what
+  // changed since the last flush. Protected by m_flush_mutex.
+  std::vector<bool> m_dirty_blocks;
 };
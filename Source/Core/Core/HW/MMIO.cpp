@@ -305,28 +305,35 @@ void ReadHandler<T>::ResetMethod(ReadHandlingMethod<T>* method)
 {
   m_Method.reset(method);
 
-  struct FuncCreatorVisitor : public ReadHandlingMethodVisitor<T>
+  struct FlattenVisitor : public ReadHandlingMethodVisitor<T>
   {
-    virtual ~FuncCreatorVisitor() = default;
+    explicit FlattenVisitor(ReadHandler<T>* handler) : self(handler) {}
+    virtual ~FlattenVisitor() = default;
 
-    std::function<T(u32)> ret;
+    ReadHandler<T>* self;
 
     void VisitConstant(T value) override
     {
-      ret = [value](u32) { return value; };
+      self->m_type = ReadHandler<T>::Type::Constant;
+      self->m_value = value;
     }
 
     void VisitDirect(const T* addr, u32 mask) override
     {
-      ret = [addr, mask](u32) { return *addr & mask; };
+      self->m_type = ReadHandler<T>::Type::Direct;
+      self->m_direct_addr = addr;
+      self->m_mask = mask;
     }
 
-    void VisitComplex(const std::function<T(u32)>* lambda) override { ret = *lambda; }
+    void VisitComplex(const std::function<T(u32)>* lambda) override
+    {
+      self->m_type = ReadHandler<T>::Type::Complex;
+      self->m_ReadFunc = *lambda;
+    }
   };
 
-  FuncCreatorVisitor v;
+  FlattenVisitor v(this);
   Visit(v);
-  m_ReadFunc = v.ret;
 }
 
 template <typename T>
@@ -359,28 +366,31 @@ void WriteHandler<T>::ResetMethod(WriteHandlingMethod<T>* method)
 {
   m_Method.reset(method);
 
-  struct FuncCreatorVisitor : public WriteHandlingMethodVisitor<T>
+  struct FlattenVisitor : public WriteHandlingMethodVisitor<T>
   {
-    virtual ~FuncCreatorVisitor() = default;
+    explicit FlattenVisitor(WriteHandler<T>* handler) : self(handler) {}
+    virtual ~FlattenVisitor() = default;
 
-    std::function<void(u32, T)> ret;
+    WriteHandler<T>* self;
 
-    void VisitNop() override
-    {
-      ret = [](u32, T) {};
-    }
+    void VisitNop() override { self->m_type = WriteHandler<T>::Type::Nop; }
 
     void VisitDirect(T* ptr, u32 mask) override
     {
-      ret = [ptr, mask](u32, T val) { *ptr = val & mask; };
+      self->m_type = WriteHandler<T>::Type::Direct;
+      self->m_direct_addr = ptr;
+      self->m_mask = mask;
     }
 
-    void VisitComplex(const std::function<void(u32, T)>* lambda) override { ret = *lambda; }
+    void VisitComplex(const std::function<void(u32, T)>* lambda) override
+    {
+      self->m_type = WriteHandler<T>::Type::Complex;
+      self->m_WriteFunc = *lambda;
+    }
   };
 
-  FuncCreatorVisitor v;
+  FlattenVisitor v(this);
   Visit(v);
-  m_WriteFunc = v.ret;
 }
 
 // Define all the public specializations that are exported in MMIOHandlers.h.
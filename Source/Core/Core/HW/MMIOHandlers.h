@@ -139,19 +139,41 @@ public:
     if (!m_Method)
       InitializeInvalid();
 
-    return m_ReadFunc(addr);
+    // Constant and direct handlers (the overwhelming majority) are
+    // dispatched inline; only complex handlers pay for a std::function call.
+    switch (m_type)
+    {
+    case Type::Constant:
+      return m_value;
+    case Type::Direct:
+      return *m_direct_addr & m_mask;
+    default:
+      return m_ReadFunc(addr);
+    }
   }
 
   // Internal method called when changing the internal method object. Its
-  // main role is to make sure the read function is updated at the same time.
+  // main role is to make sure the flattened dispatch information is updated
+  // at the same time.
   void ResetMethod(ReadHandlingMethod<T>* method);
 
 private:
+  enum class Type : u8
+  {
+    Complex,
+    Constant,
+    Direct,
+  };
+
   // Initialize this handler to an invalid handler. Done lazily to avoid
   // useless initialization of thousands of unused handler objects.
   void InitializeInvalid() { ResetMethod(InvalidRead<T>()); }
   std::unique_ptr<ReadHandlingMethod<T>> m_Method;
   std::function<T(u32)> m_ReadFunc;
+  const T* m_direct_addr = nullptr;
+  u32 m_mask = 0;
+  T m_value = 0;
+  Type m_type = Type::Complex;
 };
 template <typename T>
 class WriteHandler
@@ -175,20 +197,42 @@ public:
     if (!m_Method)
       InitializeInvalid();
 
-    m_WriteFunc(addr, val);
+    // Nop and direct handlers are dispatched inline; only complex handlers
+    // pay for a std::function call.
+    switch (m_type)
+    {
+    case Type::Nop:
+      return;
+    case Type::Direct:
+      *m_direct_addr = val & m_mask;
+      return;
+    default:
+      m_WriteFunc(addr, val);
+      return;
+    }
   }
 
   // Internal method called when changing the internal method object. Its
-  // main role is to make sure the write function is updated at the same
-  // time.
+  // main role is to make sure the flattened dispatch information is updated
+  // at the same time.
   void ResetMethod(WriteHandlingMethod<T>* method);
 
 private:
+  enum class Type : u8
+  {
+    Complex,
+    Nop,
+    Direct,
+  };
+
   // Initialize this handler to an invalid handler. Done lazily to avoid
   // useless initialization of thousands of unused handler objects.
   void InitializeInvalid() { ResetMethod(InvalidWrite<T>()); }
   std::unique_ptr<WriteHandlingMethod<T>> m_Method;
   std::function<void(u32, T)> m_WriteFunc;
+  T* m_direct_addr = nullptr;
+  u32 m_mask = 0;
+  Type m_type = Type::Complex;
 };
 
 // Boilerplate boilerplate boilerplate.
@@ -45,6 +45,11 @@ u8* logical_base = nullptr;
 
 // The MemArena class
 static Common::MemArena g_arena;
+// Size of the backing segment currently held by g_arena, or 0 if none.
+// The segment is kept alive across emulation restarts and only recreated
+// when the memory layout changes (e.g. GameCube <-> Wii), since creating
+// it is surprisingly expensive on Windows.
+static u32 s_shm_size = 0;
 // ==============
 
 // STATE_TO_SAVE
@@ -189,7 +194,13 @@ void Init()
     region.shm_position = mem_size;
     mem_size += region.size;
   }
-  g_arena.GrabSHMSegment(mem_size);
+  if (mem_size != s_shm_size)
+  {
+    if (s_shm_size != 0)
+      g_arena.ReleaseSHMSegment();
+    g_arena.GrabSHMSegment(mem_size);
+    s_shm_size = mem_size;
+  }
   physical_base = Common::MemArena::FindMemoryBase();
 
   for (PhysicalMemoryRegion& region : physical_regions)
@@ -297,7 +308,7 @@ void Shutdown()
     g_arena.ReleaseView(entry.mapped_pointer, entry.mapped_size);
   }
   logical_mapped_entries.clear();
-  g_arena.ReleaseSHMSegment();
+  // The backing segment is intentionally kept for the next Init(); see s_shm_size.
   physical_base = nullptr;
   logical_base = nullptr;
   mmio_mapping.reset();
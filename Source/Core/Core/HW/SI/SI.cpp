@@ -13,6 +13,7 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/MMIO.h"
@@ -219,6 +220,10 @@ static USIStatusReg s_status_reg;
 static USIEXIClockCount s_exi_clock_count;
 static std::array<u8, 128> s_si_buffer;
 
+// Wall-clock time of the last host input update. Not part of the
+// emulated state, so not saved.
+static u64 s_last_input_update_us;
+
 static void SetNoResponse(u32 channel)
 {
   // raise the NO RESPONSE error
@@ -631,7 +636,16 @@ void UpdateDevices()
 
   // Update inputs at the rate of SI
   // Typically 120hz but is variable
-  g_controller_interface.UpdateInput();
+  // The snapshot below serves all four channels, and host devices don't
+  // deliver new data faster than about once a millisecond, so when the game
+  // programs a very high poll rate (or we're fast-forwarding) skip the trip
+  // through the input backends and reuse the previous snapshot.
+  const u64 now_us = Common::Timer::GetTimeUs();
+  if (now_us - s_last_input_update_us >= 1000)
+  {
+    s_last_input_update_us = now_us;
+    g_controller_interface.UpdateInput();
+  }
 
   // Update channels and set the status bit if there's new data
   s_status_reg.RDST0 =
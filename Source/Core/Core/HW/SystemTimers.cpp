@@ -73,7 +73,6 @@ namespace SystemTimers
 namespace
 {
 CoreTiming::EventType* et_Dec;
-CoreTiming::EventType* et_VI;
 CoreTiming::EventType* et_AudioDMA;
 CoreTiming::EventType* et_DSP;
 CoreTiming::EventType* et_IPC_HLE;
@@ -117,8 +116,9 @@ void DSPCallback(u64 userdata, s64 cyclesLate)
 void AudioDMACallback(u64 userdata, s64 cyclesLate)
 {
   int period = s_cpu_core_clock / (AudioInterface::GetAIDSampleRate() * 4 / 32);
-  DSP::UpdateAudioDMA();  // Push audio to speakers.
-  CoreTiming::ScheduleEvent(period - cyclesLate, et_AudioDMA);
+  int blocks = DSP::UpdateAudioDMA();  // Push audio to speakers.
+  // One event per DMA period: sleep until the next relatch instead of ticking per block.
+  CoreTiming::ScheduleEvent(period * blocks - cyclesLate, et_AudioDMA);
 }
 
 void IPC_HLE_UpdateCallback(u64 userdata, s64 cyclesLate)
@@ -130,12 +130,6 @@ void IPC_HLE_UpdateCallback(u64 userdata, s64 cyclesLate)
   }
 }
 
-void VICallback(u64 userdata, s64 cyclesLate)
-{
-  VideoInterface::Update(CoreTiming::GetTicks() - cyclesLate);
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine() - cyclesLate, et_VI);
-}
-
 void DecrementerCallback(u64 userdata, s64 cyclesLate)
 {
   PowerPC::ppcState.spr[SPR_DEC] = 0xFFFFFFFF;
@@ -323,14 +317,12 @@ void Init()
   CoreTiming::SetFakeDecStartTicks(CoreTiming::GetTicks());
 
   et_Dec = CoreTiming::RegisterEvent("DecCallback", DecrementerCallback);
-  et_VI = CoreTiming::RegisterEvent("VICallback", VICallback);
   et_DSP = CoreTiming::RegisterEvent("DSPCallback", DSPCallback);
   et_AudioDMA = CoreTiming::RegisterEvent("AudioDMACallback", AudioDMACallback);
   et_IPC_HLE = CoreTiming::RegisterEvent("IPC_HLE_UpdateCallback", IPC_HLE_UpdateCallback);
   et_PatchEngine = CoreTiming::RegisterEvent("PatchEngine", PatchEngineCallback);
   et_Throttle = CoreTiming::RegisterEvent("Throttle", ThrottleCallback);
 
-  CoreTiming::ScheduleEvent(VideoInterface::GetTicksPerHalfLine(), et_VI);
   CoreTiming::ScheduleEvent(0, et_DSP);
   CoreTiming::ScheduleEvent(s_audio_dma_period, et_AudioDMA);
   CoreTiming::ScheduleEvent(0, et_Throttle, Common::Timer::GetTimeUs());
@@ -66,8 +66,8 @@ static constexpr std::array<u32, 2> s_clock_freqs{{
     54000000,
 }};
 
-static u64 s_ticks_last_line_start;  // number of ticks when the current full scanline started
-static u32 s_half_line_count;        // number of halflines that have occurred for this full frame
+static u64 s_ticks_last_update;  // number of ticks when the beam entered halfline s_half_line_count
+static u32 s_half_line_count;    // the halfline the beam is scanning (reset each full frame)
 static u32 s_half_line_of_next_si_poll;  // halfline when next SI poll results should be available
 static constexpr u32 num_half_lines_for_si_poll = (7 * 2) + 1;  // this is how long an SI poll takes
 
@@ -79,6 +79,13 @@ static u32 s_odd_field_first_hl;   // index first halfline of the odd field
 static u32 s_even_field_last_hl;   // index last halfline of the even field
 static u32 s_odd_field_last_hl;    // index last halfline of the odd field
 
+static CoreTiming::EventType* s_update_event;
+
+// These are declared up here because the MMIO handlers below need them.
+static u32 GetCurrentHalfLine();
+static void ScheduleNextUpdate();
+static void UpdateCallback(u64 userdata, s64 cycles_late);
+
 void DoState(PointerWrap& p)
 {
   p.DoPOD(m_VerticalTimingRegister);
@@ -104,7 +111,7 @@ void DoState(PointerWrap& p)
   p.Do(m_FBWidth);
   p.Do(m_BorderHBlank);
   p.Do(s_target_refresh_rate);
-  p.Do(s_ticks_last_line_start);
+  p.Do(s_ticks_last_update);
   p.Do(s_half_line_count);
   p.Do(s_half_line_of_next_si_poll);
   p.Do(s_current_field);
@@ -190,7 +197,7 @@ void Preset(bool _bNTSC)
   m_FBWidth.Hex = 0;
   m_BorderHBlank.Hex = 0;
 
-  s_ticks_last_line_start = 0;
+  s_ticks_last_update = CoreTiming::GetTicks();
   s_half_line_count = 1;
   s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first sampling starts at vsync
   s_current_field = FieldType::Odd;
@@ -200,6 +207,9 @@ void Preset(bool _bNTSC)
 
 void Init()
 {
+  // The event is registered before Preset so that the UpdateParameters call
+  // in there can schedule the first update.
+  s_update_event = CoreTiming::RegisterEvent("VICallback", UpdateCallback);
   Preset(true);
 }
 
@@ -317,7 +327,7 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   // MMIOs with unimplemented writes that trigger warnings.
   mmio->Register(
       base | VI_VERTICAL_BEAM_POSITION,
-      MMIO::ComplexRead<u16>([](u32) { return 1 + (s_half_line_count - 1) / 2; }),
+      MMIO::ComplexRead<u16>([](u32) { return 1 + (GetCurrentHalfLine() - 1) / 2; }),
       MMIO::ComplexWrite<u16>([](u32, u16 val) {
         WARN_LOG(VIDEOINTERFACE,
                  "Changing vertical beam position to 0x%04x - not documented or implemented yet",
@@ -325,9 +335,13 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
       }));
   mmio->Register(
       base | VI_HORIZONTAL_BEAM_POSITION, MMIO::ComplexRead<u16>([](u32) {
-        u16 value = static_cast<u16>(1 + m_HTiming0.HLW *
-                                             (CoreTiming::GetTicks() - s_ticks_last_line_start) /
-                                             (GetTicksPerHalfLine()));
+        const u32 ticks_per_half_line = GetTicksPerHalfLine();
+        u64 ticks_into_line = (CoreTiming::GetTicks() - s_ticks_last_update) % ticks_per_half_line;
+        // The second halfline of a scanline is the second half of it.
+        if ((GetCurrentHalfLine() & 1) == 0)
+          ticks_into_line += ticks_per_half_line;
+        const u16 value =
+            static_cast<u16>(1 + m_HTiming0.HLW * ticks_into_line / ticks_per_half_line);
         return MathUtil::Clamp(value, static_cast<u16>(1), static_cast<u16>(m_HTiming0.HLW * 2));
       }),
       MMIO::ComplexWrite<u16>([](u32, u16 val) {
@@ -337,28 +351,33 @@ void RegisterMMIO(MMIO::Mapping* mmio, u32 base)
       }));
 
   // The following MMIOs are interrupts related and update interrupt status
-  // on writes.
+  // on writes. Writing the vertical position a line interrupt fires on also
+  // invalidates the update schedule.
   mmio->Register(base | VI_PRERETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[0].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[0].Hi = val;
                    UpdateInterrupts();
+                   ScheduleNextUpdate();
                  }));
   mmio->Register(base | VI_POSTRETRACE_HI, MMIO::DirectRead<u16>(&m_InterruptRegister[1].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[1].Hi = val;
                    UpdateInterrupts();
+                   ScheduleNextUpdate();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_2_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[2].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[2].Hi = val;
                    UpdateInterrupts();
+                   ScheduleNextUpdate();
                  }));
   mmio->Register(base | VI_DISPLAY_INTERRUPT_3_HI,
                  MMIO::DirectRead<u16>(&m_InterruptRegister[3].Hi),
                  MMIO::ComplexWrite<u16>([](u32, u16 val) {
                    m_InterruptRegister[3].Hi = val;
                    UpdateInterrupts();
+                   ScheduleNextUpdate();
                  }));
 
   // Unknown anti-aliasing related MMIO register: puts a warning on log and
@@ -618,6 +637,9 @@ void UpdateParameters()
 
   s_target_refresh_rate = lround(2.0 * SystemTimers::GetTicksPerSecond() /
                                  (GetTicksPerEvenField() + GetTicksPerOddField()));
+
+  // The positions of the halflines Update needs to run on may have moved.
+  ScheduleNextUpdate();
 }
 
 u32 GetTargetRefreshRate()
@@ -725,62 +747,128 @@ static void EndField()
   Core::VideoThrottle();
 }
 
+// Returns the halfline the beam is currently scanning, computed from the
+// number of ticks that have passed since the last Update.
+static u32 GetCurrentHalfLine()
+{
+  const u64 ticks_since_update = CoreTiming::GetTicks() - s_ticks_last_update;
+  const u32 half_lines_since_update = static_cast<u32>(ticks_since_update / GetTicksPerHalfLine());
+  const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+  return (s_half_line_count + half_lines_since_update - 1) % total_half_lines + 1;
+}
+
+// Returns how many halflines it will take to reach the next one that Update
+// actually does something on. Running Update only on those halflines saves
+// tens of thousands of CoreTiming events per second; the beam position
+// registers are derived from the tick count when they are read instead.
+static u32 GetHalfLinesUntilNextEvent()
+{
+  const u32 total_half_lines = GetHalfLinesPerEvenField() + GetHalfLinesPerOddField();
+
+  // The halfline count wraps after the last halfline of the frame.
+  u32 next_event_hl = total_half_lines;
+
+  const auto consider = [&next_event_hl](u32 half_line) {
+    if (half_line >= s_half_line_count && half_line < next_event_hl)
+      next_event_hl = half_line;
+  };
+
+  consider(s_half_line_of_next_si_poll);
+  consider(s_even_field_first_hl);
+  consider(s_odd_field_first_hl);
+  consider(s_even_field_last_hl);
+  consider(s_odd_field_last_hl);
+  // The SI poll window is reset when the count reaches the start of the odd field.
+  consider(GetHalfLinesPerEvenField() - 1);
+  for (const UVIInterruptRegister& reg : m_InterruptRegister)
+  {
+    if (reg.VCT != 0)
+      consider(2 * reg.VCT - 1);
+  }
+
+  // Can happen if the frame was shrunk below the current position;
+  // the next Update will wrap the count.
+  if (next_event_hl < s_half_line_count)
+    return 1;
+
+  return next_event_hl - s_half_line_count + 1;
+}
+
+static void ScheduleNextUpdate()
+{
+  const u64 next_update_tick =
+      s_ticks_last_update + static_cast<u64>(GetHalfLinesUntilNextEvent()) * GetTicksPerHalfLine();
+  CoreTiming::RemoveEvent(s_update_event);
+  CoreTiming::ScheduleEvent(static_cast<s64>(next_update_tick - CoreTiming::GetTicks()),
+                            s_update_event);
+}
+
+static void UpdateCallback(u64 userdata, s64 cycles_late)
+{
+  Update(CoreTiming::GetTicks() - cycles_late);
+  ScheduleNextUpdate();
+}
+
 // Purpose: Send VI interrupt when triggered
 // Run when: When a frame is scanned (progressive/interlace)
 void Update(u64 ticks)
 {
-  if (s_half_line_of_next_si_poll == s_half_line_count)
-  {
-    SerialInterface::UpdateDevices();
-
-    // If this setting is enabled, only poll twice per field instead of what the game wanted. It may
-    // be set during NetPlay or Movie playback.
-    if (Config::Get(Config::MAIN_REDUCE_POLLING_RATE))
-      s_half_line_of_next_si_poll += GetHalfLinesPerEvenField() / 2;
-    else
-      s_half_line_of_next_si_poll += SerialInterface::GetPollXLines();
-  }
-  if (s_half_line_count == s_even_field_first_hl)
-  {
-    BeginField(FieldType::Even, ticks);
-  }
-  else if (s_half_line_count == s_odd_field_first_hl)
+  // Catch up on all the halflines that have been scanned since the last time
+  // this ran. ScheduleNextUpdate arranges for that to be the ones where none
+  // of the checks below hit, so normally only the last iteration does any
+  // work, but looping keeps a late reschedule from skipping anything.
+  while (s_ticks_last_update + GetTicksPerHalfLine() <= ticks)
   {
-    BeginField(FieldType::Odd, ticks);
-  }
-  else if (s_half_line_count == s_even_field_last_hl)
-  {
-    EndField();
-  }
-  else if (s_half_line_count == s_odd_field_last_hl)
-  {
-    EndField();
-  }
+    s_ticks_last_update += GetTicksPerHalfLine();
 
-  for (UVIInterruptRegister& reg : m_InterruptRegister)
-  {
-    if (s_half_line_count + 1 == 2u * reg.VCT)
+    if (s_half_line_of_next_si_poll == s_half_line_count)
     {
-      reg.IR_INT = 1;
+      SerialInterface::UpdateDevices();
+
+      // If this setting is enabled, only poll twice per field instead of what the game wanted. It
+      // may be set during NetPlay or Movie playback.
+      if (Config::Get(Config::MAIN_REDUCE_POLLING_RATE))
+        s_half_line_of_next_si_poll += GetHalfLinesPerEvenField() / 2;
+      else
+        s_half_line_of_next_si_poll += SerialInterface::GetPollXLines();
+    }
+    if (s_half_line_count == s_even_field_first_hl)
+    {
+      BeginField(FieldType::Even, s_ticks_last_update);
+    }
+    else if (s_half_line_count == s_odd_field_first_hl)
+    {
+      BeginField(FieldType::Odd, s_ticks_last_update);
+    }
+    else if (s_half_line_count == s_even_field_last_hl)
+    {
+      EndField();
+    }
+    else if (s_half_line_count == s_odd_field_last_hl)
+    {
+      EndField();
     }
-  }
 
-  s_half_line_count++;
+    for (UVIInterruptRegister& reg : m_InterruptRegister)
+    {
+      if (s_half_line_count + 1 == 2u * reg.VCT)
+      {
+        reg.IR_INT = 1;
+      }
+    }
 
-  if (s_half_line_count > GetHalfLinesPerEvenField() + GetHalfLinesPerOddField())
-  {
-    s_half_line_count = 1;
-    s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first results start at vsync
-  }
+    s_half_line_count++;
 
-  if (s_half_line_count == GetHalfLinesPerEvenField())
-  {
-    s_half_line_of_next_si_poll = GetHalfLinesPerEvenField() + num_half_lines_for_si_poll;
-  }
+    if (s_half_line_count > GetHalfLinesPerEvenField() + GetHalfLinesPerOddField())
+    {
+      s_half_line_count = 1;
+      s_half_line_of_next_si_poll = num_half_lines_for_si_poll;  // first results start at vsync
+    }
 
-  if (s_half_line_count & 1)
-  {
-    s_ticks_last_line_start = CoreTiming::GetTicks();
+    if (s_half_line_count == GetHalfLinesPerEvenField())
+    {
+      s_half_line_of_next_si_poll = GetHalfLinesPerEvenField() + num_half_lines_for_si_poll;
+    }
   }
 
   UpdateInterrupts();
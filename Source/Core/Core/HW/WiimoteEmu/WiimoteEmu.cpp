@@ -132,6 +132,7 @@ void Wiimote::Reset()
   // Dynamics:
   m_swing_state = {};
   m_tilt_state = {};
+  m_cursor_mtx = Common::Matrix44::Identity();
 
   m_shake_step = {};
   m_shake_soft_step = {};
@@ -689,7 +690,7 @@ void Wiimote::StepDynamics()
   EmulateTilt(&m_tilt_state, m_tilt, 1.f / ::Wiimote::UPDATE_FREQ);
 
   // TODO: Move cursor state out of ControllerEmu::Cursor
-  // const auto cursor_mtx = EmulateCursorMovement(m_ir);
+  m_cursor_mtx = EmulateCursorMovement(m_ir);
 }
 
 Common::Vec3 Wiimote::GetAcceleration()
@@ -739,7 +740,7 @@ Common::Matrix44 Wiimote::GetTransformation() const
 
   return Common::Matrix44::FromMatrix33(GetRotationalMatrix(-m_tilt_state.angle) *
                                         GetRotationalMatrix(-m_swing_state.angle)) *
-         EmulateCursorMovement(m_ir) * Common::Matrix44::Translate(-m_swing_state.position);
+         m_cursor_mtx * Common::Matrix44::Translate(-m_swing_state.position);
 }
 
 }  // namespace WiimoteEmu
@@ -270,6 +270,10 @@ private:
   // Dynamics:
   MotionState m_swing_state;
   RotationalState m_tilt_state;
+  // Cursor movement is stateful (smoothing, auto-hide), so it is stepped once
+  // per report in StepDynamics() and the result is reused by both the IR
+  // camera and the accelerometer instead of being recomputed for each.
+  Common::Matrix44 m_cursor_mtx;
 
   // TODO: kill these:
   std::array<u8, 3> m_shake_step{};
@@ -61,6 +61,8 @@ void Wiimote::Shutdown()
   ClearReadQueue();
   m_write_reports.Clear();
 
+  LogInputLatency();
+
   NOTICE_LOG(WIIMOTE, "Disconnected real wiimote.");
 }
 
@@ -130,7 +132,7 @@ void Wiimote::ResetDataReporting()
 
 void Wiimote::ClearReadQueue()
 {
-  Report rpt;
+  TimestampedReport rpt;
 
   // The "Clear" function isn't thread-safe :/
   while (m_read_reports.Pop(rpt))
@@ -227,7 +229,7 @@ void Wiimote::Read()
 
     // Add it to queue
     rpt.resize(result);
-    m_read_reports.Push(std::move(rpt));
+    m_read_reports.Push(TimestampedReport{std::move(rpt), std::chrono::steady_clock::now()});
   }
   else if (0 == result)
   {
@@ -340,12 +342,50 @@ static bool IsDataReport(const Report& rpt)
   return rpt.size() >= 2 && rpt[1] >= u8(InputReportID::ReportCore);
 }
 
+// Records the host arrival -> CPU thread consumption latency of a report.
+// There is nothing to feed these timings back into: reports are handed over
+// at the emulated poll cadence, so the queue wait measured here is exactly
+// the latency a player experiences on top of the Bluetooth link itself.
+void Wiimote::RecordInputLatency(std::chrono::steady_clock::time_point arrival_time)
+{
+  const s64 latency_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now() - arrival_time)
+                             .count();
+
+  int bucket = 0;
+  while (bucket < LATENCY_BUCKETS - 1 && latency_us >= (1000 << bucket))
+    bucket++;
+  m_latency_histogram[bucket]++;
+
+  if (++m_latency_samples >= LATENCY_LOG_INTERVAL)
+    LogInputLatency();
+}
+
+void Wiimote::LogInputLatency()
+{
+  if (m_latency_samples == 0)
+    return;
+
+  INFO_LOG(WIIMOTE,
+           "Wii Remote %d input latency over %u reports (ms): "
+           "<1: %u  <2: %u  <4: %u  <8: %u  <16: %u  <32: %u  <64: %u  >=64: %u",
+           m_index + 1, m_latency_samples, m_latency_histogram[0], m_latency_histogram[1],
+           m_latency_histogram[2], m_latency_histogram[3], m_latency_histogram[4],
+           m_latency_histogram[5], m_latency_histogram[6], m_latency_histogram[7]);
+
+  m_latency_histogram.fill(0);
+  m_latency_samples = 0;
+}
+
 // Returns the next report that should be sent
 Report& Wiimote::ProcessReadQueue()
 {
   // Pop through the queued reports
-  while (m_read_reports.Pop(m_last_input_report))
+  TimestampedReport queued;
+  while (m_read_reports.Pop(queued))
   {
+    RecordInputLatency(queued.arrival_time);
+    m_last_input_report = std::move(queued.report);
     if (!IsDataReport(m_last_input_report))
     {
       // A non-data report, use it.
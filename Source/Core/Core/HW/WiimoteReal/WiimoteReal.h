@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -125,6 +127,14 @@ protected:
   bool m_really_disconnect = false;
 
 private:
+  // A report as read on the device thread, together with its host arrival
+  // time so the latency until the CPU thread consumes it can be measured.
+  struct TimestampedReport
+  {
+    Report report;
+    std::chrono::steady_clock::time_point arrival_time;
+  };
+
   void ClearReadQueue();
   void WriteReport(Report rpt);
 
@@ -134,6 +144,9 @@ private:
 
   void ThreadFunc();
 
+  void RecordInputLatency(std::chrono::steady_clock::time_point arrival_time);
+  void LogInputLatency();
+
   // We track the speaker state to convert unnecessary speaker data into rumble reports.
   bool m_speaker_enable = false;
   bool m_speaker_mute = false;
@@ -149,8 +162,16 @@ private:
   // Triggered when the thread has finished ConnectInternal.
   Common::Event m_thread_ready_event;
 
-  Common::SPSCQueue<Report> m_read_reports;
+  Common::SPSCQueue<TimestampedReport> m_read_reports;
   Common::SPSCQueue<Report> m_write_reports;
+
+  // Input latency histogram, bucketed by powers of two starting at 1 ms with
+  // the last bucket collecting everything at 64 ms and above. A summary is
+  // logged every LATENCY_LOG_INTERVAL reports and on shutdown.
+  static constexpr int LATENCY_BUCKETS = 8;
+  static constexpr u32 LATENCY_LOG_INTERVAL = 5000;
+  std::array<u32, LATENCY_BUCKETS> m_latency_histogram{};
+  u32 m_latency_samples = 0;
 };
 
 class WiimoteScannerBackend
@@ -190,6 +190,7 @@ namespace HotkeyManagerEmu
 static std::array<u32, NUM_HOTKEY_GROUPS> s_hotkey_down;
 static HotkeyStatus s_hotkey;
 static bool s_enabled;
+static bool s_previous_active;
 
 static InputConfig s_config("Hotkeys", _trans("Hotkeys"), "Hotkeys");
 
@@ -198,10 +199,24 @@ InputConfig* GetConfig()
   return &s_config;
 }
 
-void GetStatus()
+bool GetStatus()
 {
   // Get input
   static_cast<HotkeyManager*>(s_config.GetController(0))->GetInput(&s_hotkey);
+
+  // Dispatch is only worth the caller's time when a key is down now, or one
+  // was down on the previous poll (so releases still get one evaluation to
+  // reset any held-key state). While idle, keep the edge-detection state
+  // cleared so the next real press isn't mistaken for a repeat.
+  const bool active =
+      std::any_of(s_hotkey.button.begin(), s_hotkey.button.end(), [](u32 b) { return b != 0; });
+  const bool worth_dispatching = active || s_previous_active;
+  s_previous_active = active;
+
+  if (!worth_dispatching)
+    s_hotkey_down = {};
+
+  return worth_dispatching;
 }
 
 bool IsEnabled()
@@ -325,13 +340,19 @@ std::string HotkeyManager::GetName() const
 void HotkeyManager::GetInput(HotkeyStatus* const kb)
 {
   const auto lock = GetStateLock();
+
+  // Bitmask table shared by every group; no group has more than 32 keys since
+  // each packs into a u32, so this avoids a vector allocation per group, per
+  // poll.
+  static const std::array<u32, 32> bitmasks = [] {
+    std::array<u32, 32> masks{};
+    for (std::size_t key = 0; key < masks.size(); key++)
+      masks[key] = static_cast<u32>(1 << key);
+    return masks;
+  }();
+
   for (std::size_t group = 0; group < s_groups_info.size(); group++)
   {
-    const int group_count = (s_groups_info[group].last - s_groups_info[group].first) + 1;
-    std::vector<u32> bitmasks(group_count);
-    for (size_t key = 0; key < bitmasks.size(); key++)
-      bitmasks[key] = static_cast<u32>(1 << key);
-
     kb->button[group] = 0;
     m_keys[group]->GetState(&kb->button[group], bitmasks.data());
   }
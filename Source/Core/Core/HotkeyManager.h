@@ -232,7 +232,9 @@ void LoadConfig();
 
 InputConfig* GetConfig();
 ControllerEmu::ControlGroup* GetHotkeyGroup(HotkeyGroup group);
-void GetStatus();
+// Polls the hotkey state. Returns false when no key is down and none was down
+// on the previous poll, i.e. when every IsPressed call would return false.
+bool GetStatus();
 bool IsEnabled();
 void Enable(bool enable_toggle);
 bool IsPressed(int Id, bool held);
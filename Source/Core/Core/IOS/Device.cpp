@@ -16,6 +16,11 @@
 
 namespace IOS::HLE
 {
+PayloadSpan PayloadSpan::FromEmu(const u32 address, const u32 size)
+{
+  return {size != 0 ? Memory::GetPointer(address) : nullptr, size};
+}
+
 Request::Request(const u32 address_) : address(address_)
 {
   command = static_cast<IPCCommandType>(Memory::Read_U32(address));
@@ -55,6 +60,21 @@ IOCtlRequest::IOCtlRequest(const u32 address_) : Request(address_)
   buffer_out_size = Memory::Read_U32(address + 0x1c);
 }
 
+PayloadSpan IOCtlRequest::In() const
+{
+  return PayloadSpan::FromEmu(buffer_in, buffer_in_size);
+}
+
+PayloadSpan IOCtlRequest::Out() const
+{
+  return PayloadSpan::FromEmu(buffer_out, buffer_out_size);
+}
+
+PayloadSpan IOCtlVRequest::IOVector::Span() const
+{
+  return PayloadSpan::FromEmu(address, size);
+}
+
 IOCtlVRequest::IOCtlVRequest(const u32 address_) : Request(address_)
 {
   request = Memory::Read_U32(address + 0x0c);
@@ -193,7 +213,9 @@ IPCCommandResult Device::GetDefaultReply(const s32 return_value)
   // Because we currently don't emulate timing very accurately, we should not return
   // the minimum possible reply time (~960 ticks from the kernel or ~2700 from devices)
   // but an average time, otherwise we are going to be much too fast in most cases.
-  return {return_value, true, 4000 * SystemTimers::TIMER_RATIO};
+  // Since the delay is only an average, these replies are marked as having low timing
+  // sensitivity so the kernel may batch them onto a shared CoreTiming event.
+  return {return_value, true, 4000 * SystemTimers::TIMER_RATIO, true};
 }
 
 // Returns an IPCCommandResult with no reply. Useful for async commands that will generate a reply
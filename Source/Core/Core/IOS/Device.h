@@ -72,6 +72,17 @@ enum ReturnCode : s32
   USB_ECANCELED = -7022,  // USB OH0 insertion hook cancelled
 };
 
+// A view of an IPC payload mapped directly from emulated memory. Devices that can
+// consume or produce their data in place should prefer this over staging a host-side
+// copy of the request/response buffers: IPC-heavy titles issue thousands of ioctls
+// per second and a round of allocation+copy per request adds up.
+struct PayloadSpan
+{
+  u8* data = nullptr;
+  u32 size = 0;
+  static PayloadSpan FromEmu(u32 address, u32 size);
+};
+
 struct Request
 {
   u32 address = 0;
@@ -129,6 +140,8 @@ struct IOCtlRequest final : Request
   // Contrary to the name, the output buffer can also be used for input.
   u32 buffer_out = 0;
   u32 buffer_out_size = 0;
+  PayloadSpan In() const;
+  PayloadSpan Out() const;
   explicit IOCtlRequest(u32 address);
   void Log(const std::string& description, LogTypes::LOG_TYPE type = LogTypes::IOS,
            LogTypes::LOG_LEVELS level = LogTypes::LINFO) const;
@@ -144,6 +157,7 @@ struct IOCtlVRequest final : Request
   {
     u32 address = 0;
     u32 size = 0;
+    PayloadSpan Span() const;
   };
   u32 request = 0;
   // In vectors are *mostly* used for input buffers. Sometimes they are also used as
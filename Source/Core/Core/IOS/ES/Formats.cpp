@@ -547,13 +547,24 @@ SharedContentMap::SharedContentMap(std::shared_ptr<HLE::FS::FileSystem> fs) : m_
 {
   static_assert(sizeof(Entry) == 28, "SharedContentMap::Entry has the wrong size");
 
-  Entry entry;
   const auto file = fs->OpenFile(PID_KERNEL, PID_KERNEL, CONTENT_MAP_PATH, HLE::FS::Mode::Read);
-  while (file && file->Read(&entry, 1))
+  if (!file)
+    return;
+
+  // Read the whole map with a single request instead of going through the
+  // filesystem layer once per 28-byte entry. The map is re-parsed for every
+  // content path lookup, so this adds up on shared-content-heavy NANDs.
+  const auto status = file->GetStatus();
+  if (!status)
+    return;
+
+  m_entries.resize(status->size / sizeof(Entry));
+  if (!m_entries.empty() && !file->Read(m_entries.data(), m_entries.size()))
   {
-    m_entries.push_back(entry);
-    m_last_id++;
+    m_entries.clear();
+    return;
   }
+  m_last_id = static_cast<u32>(m_entries.size());
 }
 
 SharedContentMap::~SharedContentMap() = default;
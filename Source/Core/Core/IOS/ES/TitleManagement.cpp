@@ -302,6 +302,12 @@ ReturnCode ES::ImportContentBegin(Context& context, u64 title_id, u32 content_id
   context.title_import_export.content.iv[0] = (content_info.index >> 8) & 0xFF;
   context.title_import_export.content.iv[1] = content_info.index & 0xFF;
 
+  // The encrypted data arrives in small chunks, so reserve the full size up
+  // front (padded to the AES block size) to avoid repeatedly reallocating
+  // multi-megabyte buffers during imports.
+  context.title_import_export.content.buffer.reserve(
+      Common::AlignUp(static_cast<size_t>(content_info.size), 16));
+
   context.title_import_export.content.valid = true;
 
   // We're supposed to return a "content file descriptor" here, which is
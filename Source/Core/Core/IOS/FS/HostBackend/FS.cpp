@@ -51,8 +51,19 @@ HostFileSystem::HostFileSystem(const std::string& root_path) : m_root_path{root_
 
 HostFileSystem::~HostFileSystem() = default;
 
+void HostFileSystem::InvalidateCaches()
+{
+  m_metadata_cache.clear();
+  m_directory_cache.clear();
+}
+
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  // Savestating rewrites /tmp below and loading replaces the NAND contents,
+  // so nothing cached (or pooled open) can be trusted across this.
+  InvalidateCaches();
+  ClearHostFilePool();
+
   p.Do(m_root_path);
 
   // Temporarily close the file, to prevent any issues with the savestating of /tmp
@@ -161,6 +172,8 @@ void HostFileSystem::DoState(PointerWrap& p)
 
 ResultCode HostFileSystem::Format(Uid uid)
 {
+  InvalidateCaches();
+  ClearHostFilePool();
   const std::string root = BuildFilename("/");
   if (!File::DeleteDirRecursively(root) || !File::CreateDir(root))
     return ResultCode::UnknownError;
@@ -182,6 +195,7 @@ ResultCode HostFileSystem::CreateFile(Uid, Gid, const std::string& path, FileAtt
     return ResultCode::Invalid;
   }
 
+  InvalidateCaches();
   return ResultCode::Success;
 }
 
@@ -196,6 +210,7 @@ ResultCode HostFileSystem::CreateDirectory(Uid, Gid, const std::string& path, Fi
   File::CreateFullPath(name);
   DEBUG_ASSERT_MSG(IOS_FS, File::IsDirectory(name), "CREATE_DIR %s failed", name.c_str());
 
+  InvalidateCaches();
   return ResultCode::Success;
 }
 
@@ -205,6 +220,8 @@ ResultCode HostFileSystem::Delete(Uid, Gid, const std::string& path)
     return ResultCode::Invalid;
 
   const std::string file_name = BuildFilename(path);
+  InvalidateCaches();
+  RemoveFromHostFilePool(file_name);
   if (File::Delete(file_name))
     INFO_LOG(IOS_FS, "DeleteFile %s", file_name.c_str());
   else if (File::DeleteDirRecursively(file_name))
@@ -226,6 +243,10 @@ ResultCode HostFileSystem::Rename(Uid, Gid, const std::string& old_path,
     return ResultCode::Invalid;
   const std::string new_name = BuildFilename(new_path);
 
+  InvalidateCaches();
+  RemoveFromHostFilePool(old_name);
+  RemoveFromHostFilePool(new_name);
+
   // try to make the basis directory
   File::CreateFullPath(new_name);
 
@@ -257,6 +278,10 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid, Gid, const s
   if (!IsValidWiiPath(path))
     return ResultCode::Invalid;
 
+  const auto cached = m_directory_cache.find(path);
+  if (cached != m_directory_cache.end())
+    return cached->second;
+
   // the Wii uses this function to define the type (dir or file)
   const std::string dir_name(BuildFilename(path));
 
@@ -293,19 +318,24 @@ Result<std::vector<std::string>> HostFileSystem::ReadDirectory(Uid, Gid, const s
   std::vector<std::string> output;
   for (File::FSTEntry& child : entry.children)
     output.emplace_back(child.virtualName);
+  m_directory_cache.emplace(path, output);
   return output;
 }
 
 Result<Metadata> HostFileSystem::GetMetadata(Uid, Gid, const std::string& path)
 {
+  if (!IsValidWiiPath(path))
+    return ResultCode::Invalid;
+
+  const auto cached = m_metadata_cache.find(path);
+  if (cached != m_metadata_cache.end())
+    return cached->second;
+
   Metadata metadata;
   metadata.uid = 0;
   metadata.gid = 0x3031;  // this is also known as makercd, 01 (0x3031) for nintendo and 08
                           // (0x3038) for MH3 etc
 
-  if (!IsValidWiiPath(path))
-    return ResultCode::Invalid;
-
   std::string file_name = BuildFilename(path);
   metadata.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
   metadata.attribute = 0x00;  // no attributes
@@ -326,6 +356,7 @@ Result<Metadata> HostFileSystem::GetMetadata(Uid, Gid, const std::string& path)
   metadata.size = info.GetSize();
   if (!info.Exists())
     return ResultCode::NotFound;
+  m_metadata_cache.emplace(path, metadata);
   return metadata;
 }
 
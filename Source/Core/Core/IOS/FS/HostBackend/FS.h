@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -73,9 +74,26 @@ private:
   std::string BuildFilename(const std::string& wii_path) const;
   std::shared_ptr<File::IOFile> OpenHostFile(const std::string& host_path);
 
+  /// Forget all cached metadata and directory listings. Must be called
+  /// whenever the NAND contents are modified through this filesystem.
+  void InvalidateCaches();
+  /// Keep a recently used host file open, so that guests which reopen the
+  /// same file over and over don't pay an open/close syscall every time.
+  void AddToHostFilePool(const std::string& host_path, std::shared_ptr<File::IOFile> file);
+  void RemoveFromHostFilePool(const std::string& host_path);
+  void ClearHostFilePool();
+
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
+
+  /// Guest-visible metadata is expensive to recompute (host stats plus a TMD
+  /// lookup per call) and some titles stat the same paths every frame.
+  std::map<std::string, Metadata> m_metadata_cache;
+  std::map<std::string, std::vector<std::string>> m_directory_cache;
+  /// Most recently used first; holds strong references so the files outlive
+  /// their guest handles. Ordering still comes from m_open_files.
+  std::vector<std::pair<std::string, std::shared_ptr<File::IOFile>>> m_host_file_pool;
 };
 
 }  // namespace IOS::HLE::FS
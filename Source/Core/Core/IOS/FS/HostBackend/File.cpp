@@ -14,6 +14,42 @@
 
 namespace IOS::HLE::FS
 {
+// Enough for the handful of content files a title cycles through per frame,
+// without keeping half the NAND open on the host.
+constexpr size_t HOST_FILE_POOL_MAX_SIZE = 8;
+
+void HostFileSystem::AddToHostFilePool(const std::string& host_path,
+                                       std::shared_ptr<File::IOFile> file)
+{
+  const auto it =
+      std::find_if(m_host_file_pool.begin(), m_host_file_pool.end(),
+                   [&host_path](const auto& entry) { return entry.first == host_path; });
+  if (it != m_host_file_pool.end())
+  {
+    // Already pooled; just mark it as most recently used.
+    std::rotate(m_host_file_pool.begin(), it, it + 1);
+    return;
+  }
+
+  if (m_host_file_pool.size() >= HOST_FILE_POOL_MAX_SIZE)
+    m_host_file_pool.pop_back();
+  m_host_file_pool.emplace(m_host_file_pool.begin(), host_path, std::move(file));
+}
+
+void HostFileSystem::RemoveFromHostFilePool(const std::string& host_path)
+{
+  const auto it =
+      std::find_if(m_host_file_pool.begin(), m_host_file_pool.end(),
+                   [&host_path](const auto& entry) { return entry.first == host_path; });
+  if (it != m_host_file_pool.end())
+    m_host_file_pool.erase(it);
+}
+
+void HostFileSystem::ClearHostFilePool()
+{
+  m_host_file_pool.clear();
+}
+
 // This isn't theadsafe, but it's only called from the CPU thread.
 std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& host_path)
 {
@@ -38,7 +74,9 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   if (search != m_open_files.end())
   {
     // Lock a shared pointer to use.
-    return search->second.lock();
+    auto file_ptr = search->second.lock();
+    AddToHostFilePool(host_path, file_ptr);
+    return file_ptr;
   }
 
   // All files are opened read/write. Actual access rights will be controlled per handle by the
@@ -72,6 +110,7 @@ std::shared_ptr<File::IOFile> HostFileSystem::OpenHostFile(const std::string& ho
   // Store a weak pointer to our newly opened file in the cache.
   m_open_files[host_path] = std::weak_ptr<File::IOFile>(file_ptr);
 
+  AddToHostFilePool(host_path, file_ptr);
   return file_ptr;
 }
 
@@ -154,6 +193,9 @@ Result<u32> HostFileSystem::WriteBytesToFile(Fd fd, const u8* ptr, u32 count)
   if (!handle->host_file->WriteBytes(ptr, count))
     return ResultCode::AccessDenied;
 
+  // The file size (and thus its metadata) may have changed.
+  InvalidateCaches();
+
   handle->file_offset += count;
   return count;
 }
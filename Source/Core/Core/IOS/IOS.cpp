@@ -65,6 +65,7 @@ static std::unique_ptr<EmulationKernel> s_ios;
 
 constexpr u64 ENQUEUE_REQUEST_FLAG = 0x100000000ULL;
 constexpr u64 ENQUEUE_ACKNOWLEDGEMENT_FLAG = 0x200000000ULL;
+constexpr u64 ENQUEUE_BATCH_FLUSH_FLAG = 0x400000000ULL;
 static CoreTiming::EventType* s_event_enqueue;
 static CoreTiming::EventType* s_event_sdio_notify;
 
@@ -568,6 +569,18 @@ IPCCommandResult Kernel::HandleIPCCommand(const Request& request)
   return ret;
 }
 
+// Writes the return value and reply type back to emulated memory. Done as soon as a handler
+// completes so that batched replies only differ from individually scheduled ones in when the
+// IPC interrupt is raised.
+static void WriteReplyToMemory(const Request& request, const s32 return_value)
+{
+  Memory::Write_U32(static_cast<u32>(return_value), request.address + 4);
+  // IOS writes back the command that was responded to in the FD field.
+  Memory::Write_U32(request.command, request.address + 8);
+  // IOS also overwrites the command type with the reply type.
+  Memory::Write_U32(IPC_REPLY, request.address);
+}
+
 void Kernel::ExecuteIPCCommand(const u32 address)
 {
   Request request{address};
@@ -576,12 +589,32 @@ void Kernel::ExecuteIPCCommand(const u32 address)
   if (!result.send_reply)
     return;
 
+  if (result.low_timing_sensitivity && m_batch_reply_event_scheduled)
+  {
+    // A flush for a previous default-delay reply is already pending. Its tick is never
+    // earlier than m_last_reply_time, so piggybacking on it keeps replies in order and
+    // avoids one CoreTiming event per chatty ioctl.
+    WriteReplyToMemory(request, result.return_value);
+    m_batch_reply_queue.push_back(request.address);
+    return;
+  }
+
   // Ensure replies happen in order
   const s64 ticks_until_last_reply = m_last_reply_time - CoreTiming::GetTicks();
   if (ticks_until_last_reply > 0)
     result.reply_delay_ticks += ticks_until_last_reply;
   m_last_reply_time = CoreTiming::GetTicks() + result.reply_delay_ticks;
 
+  if (result.low_timing_sensitivity)
+  {
+    WriteReplyToMemory(request, result.return_value);
+    m_batch_reply_queue.push_back(request.address);
+    m_batch_reply_event_scheduled = true;
+    CoreTiming::ScheduleEvent(static_cast<int>(result.reply_delay_ticks), s_event_enqueue,
+                              ENQUEUE_BATCH_FLUSH_FLAG);
+    return;
+  }
+
   EnqueueIPCReply(request, result.return_value, static_cast<int>(result.reply_delay_ticks));
 }
 
@@ -615,7 +648,16 @@ void Kernel::EnqueueIPCAcknowledgement(u32 address, int cycles_in_future)
 
 void Kernel::HandleIPCEvent(u64 userdata)
 {
-  if (userdata & ENQUEUE_ACKNOWLEDGEMENT_FLAG)
+  if (userdata & ENQUEUE_BATCH_FLUSH_FLAG)
+  {
+    m_batch_reply_event_scheduled = false;
+    while (!m_batch_reply_queue.empty())
+    {
+      m_reply_queue.push_back(m_batch_reply_queue.front());
+      m_batch_reply_queue.pop_front();
+    }
+  }
+  else if (userdata & ENQUEUE_ACKNOWLEDGEMENT_FLAG)
     m_ack_queue.push_back(static_cast<u32>(userdata));
   else if (userdata & ENQUEUE_REQUEST_FLAG)
     m_request_queue.push_back(static_cast<u32>(userdata));
@@ -688,6 +730,8 @@ void Kernel::DoState(PointerWrap& p)
 {
   p.Do(m_request_queue);
   p.Do(m_reply_queue);
+  p.Do(m_batch_reply_queue);
+  p.Do(m_batch_reply_event_scheduled);
   p.Do(m_last_reply_time);
   p.Do(m_title_id);
   p.Do(m_ppc_uid);
@@ -42,6 +42,10 @@ struct IPCCommandResult
   s32 return_value;
   bool send_reply;
   u64 reply_delay_ticks;
+  // Set for replies that only carry the default, average delay (see GetDefaultReply).
+  // These don't need an exact delivery tick and may share a single CoreTiming event;
+  // devices that computed an accurate delay keep their own event.
+  bool low_timing_sensitivity = false;
 };
 
 enum IPCCommandType : u32
@@ -123,6 +127,9 @@ protected:
   IPCMsgQueue m_request_queue;  // ppc -> arm
   IPCMsgQueue m_reply_queue;    // arm -> ppc
   IPCMsgQueue m_ack_queue;      // arm -> ppc
+  // Replies with low timing sensitivity that share a single pending flush event.
+  IPCMsgQueue m_batch_reply_queue;  // arm -> ppc
+  bool m_batch_reply_event_scheduled = false;
   u64 m_last_reply_time = 0;
 
   IOSC m_iosc;
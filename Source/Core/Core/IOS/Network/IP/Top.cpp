@@ -24,6 +24,7 @@
 #include "Common/Network.h"
 #include "Common/ScopeGuard.h"
 #include "Common/StringUtil.h"
+#include "Common/Timer.h"
 
 #include "Core/Core.h"
 #include "Core/HW/Memmap.h"
@@ -345,6 +346,26 @@ IPCCommandResult NetIPTop::IOCtlV(const IOCtlVRequest& request)
 void NetIPTop::Update()
 {
   WiiSockMan::GetInstance().Update();
+
+  if (m_pending_polls.empty())
+    return;
+
+  const u64 now_us = Common::Timer::GetTimeUs();
+  auto it = m_pending_polls.begin();
+  while (it != m_pending_polls.end())
+  {
+    const IOCtlRequest request{it->request_address};
+    s32 ret = 0;
+    if (PollSockets(request, &ret) || (it->deadline_us != 0 && now_us >= it->deadline_us))
+    {
+      m_ios.EnqueueIPCReply(request, ret);
+      it = m_pending_polls.erase(it);
+    }
+    else
+    {
+      ++it;
+    }
+  }
 }
 
 IPCCommandResult NetIPTop::HandleStartUpRequest(const IOCtlRequest& request)
@@ -595,7 +616,7 @@ IPCCommandResult NetIPTop::HandleInetNToPRequest(const IOCtlRequest& request)
   return GetDefaultReply(0);
 }
 
-IPCCommandResult NetIPTop::HandlePollRequest(const IOCtlRequest& request)
+bool NetIPTop::PollSockets(const IOCtlRequest& request, s32* result) const
 {
   // Map Wii/native poll events types
   struct
@@ -608,7 +629,6 @@ IPCCommandResult NetIPTop::HandlePollRequest(const IOCtlRequest& request)
   };
 
   u32 unknown = Memory::Read_U32(request.buffer_in);
-  u32 timeout = Memory::Read_U32(request.buffer_in + 4);
 
   int nfds = request.buffer_out_size / 0xc;
   if (nfds == 0)
@@ -645,7 +665,7 @@ IPCCommandResult NetIPTop::HandlePollRequest(const IOCtlRequest& request)
       ERROR_LOG(IOS_NET, "SO_POLL: unhandled Wii event types: %04x", unhandled_events);
   }
 
-  int ret = poll(ufds.data(), nfds, timeout);
+  int ret = poll(ufds.data(), nfds, 0);
   ret = WiiSockMan::GetNetErrorCode(ret, "SO_POLL", false);
 
   for (int i = 0; i < nfds; ++i)
@@ -667,7 +687,26 @@ IPCCommandResult NetIPTop::HandlePollRequest(const IOCtlRequest& request)
               ufds[i].events, ufds[i].revents);
   }
 
-  return GetDefaultReply(ret);
+  *result = ret;
+  return ret != 0;
+}
+
+IPCCommandResult NetIPTop::HandlePollRequest(const IOCtlRequest& request)
+{
+  const u32 timeout = Memory::Read_U32(request.buffer_in + 4);
+
+  s32 ret = 0;
+  if (PollSockets(request, &ret) || timeout == 0)
+    return GetDefaultReply(ret);
+
+  // Nothing is ready yet. Defer the reply and recheck on IPC updates rather
+  // than blocking the CPU thread in poll() until the guest's timeout expires.
+  PendingPoll poll;
+  poll.request_address = request.address;
+  if (timeout != ~0u)
+    poll.deadline_us = Common::Timer::GetTimeUs() + u64(timeout) * 1000;
+  m_pending_polls.push_back(poll);
+  return GetNoReply();
 }
 
 IPCCommandResult NetIPTop::HandleGetHostByNameRequest(const IOCtlRequest& request)
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <list>
 #include <string>
 
 #include "Common/CommonTypes.h"
@@ -93,6 +94,20 @@ private:
   IPCCommandResult HandleGetAddressInfoRequest(const IOCtlVRequest& request);
   IPCCommandResult HandleICMPPingRequest(const IOCtlVRequest& request);
 
+  // A SO_POLL request whose reply has been deferred so the CPU thread does
+  // not block in poll() until the guest's timeout expires.
+  struct PendingPoll
+  {
+    u32 request_address = 0;
+    // Wall-clock expiry time; 0 when the guest asked for an infinite timeout.
+    u64 deadline_us = 0;
+  };
+  // Polls the request's descriptors without blocking and writes the revents
+  // back to guest memory. Returns true when the request has completed.
+  bool PollSockets(const IOCtlRequest& request, s32* result) const;
+
+  std::list<PendingPoll> m_pending_polls;
+
 #ifdef _WIN32
   WSADATA InitData;
 #endif
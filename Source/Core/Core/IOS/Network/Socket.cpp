@@ -201,7 +201,7 @@ s32 WiiSocket::FCntl(u32 cmd, u32 arg)
   return ret;
 }
 
-void WiiSocket::Update(bool read, bool write, bool except)
+void WiiSocket::Update()
 {
   auto it = pending_sockops.begin();
   while (it != pending_sockops.end())
@@ -681,25 +681,16 @@ s32 WiiSockMan::DeleteSocket(s32 s)
 
 void WiiSockMan::Update()
 {
-  s32 nfds = 0;
-  fd_set read_fds, write_fds, except_fds;
-  struct timeval t = {0, 0};
-  FD_ZERO(&read_fds);
-  FD_ZERO(&write_fds);
-  FD_ZERO(&except_fds);
-
+  // Pending operations are all retried in a non-blocking fashion, so there
+  // is no need to find out which sockets are ready first. The select() pass
+  // that used to happen here scanned every socket on each IPC update without
+  // its results ever being consumed.
   auto socket_iter = WiiSockets.begin();
-  auto end_socks = WiiSockets.end();
-
-  while (socket_iter != end_socks)
+  while (socket_iter != WiiSockets.end())
   {
-    WiiSocket& sock = socket_iter->second;
-    if (sock.IsValid())
+    if (socket_iter->second.IsValid())
     {
-      FD_SET(sock.fd, &read_fds);
-      FD_SET(sock.fd, &write_fds);
-      FD_SET(sock.fd, &except_fds);
-      nfds = std::max(nfds, sock.fd + 1);
+      socket_iter->second.Update();
       ++socket_iter;
     }
     else
@@ -708,24 +699,6 @@ void WiiSockMan::Update()
       socket_iter = WiiSockets.erase(socket_iter);
     }
   }
-  s32 ret = select(nfds, &read_fds, &write_fds, &except_fds, &t);
-
-  if (ret >= 0)
-  {
-    for (auto& pair : WiiSockets)
-    {
-      WiiSocket& sock = pair.second;
-      sock.Update(FD_ISSET(sock.fd, &read_fds) != 0, FD_ISSET(sock.fd, &write_fds) != 0,
-                  FD_ISSET(sock.fd, &except_fds) != 0);
-    }
-  }
-  else
-  {
-    for (auto& elem : WiiSockets)
-    {
-      elem.second.Update(false, false, false);
-    }
-  }
 }
 
 void WiiSockMan::Convert(WiiSockAddrIn const& from, sockaddr_in& to)
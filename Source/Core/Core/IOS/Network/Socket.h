@@ -199,7 +199,7 @@ private:
 
   void DoSock(Request request, NET_IOCTL type);
   void DoSock(Request request, SSL_IOCTL type);
-  void Update(bool read, bool write, bool except);
+  void Update();
   bool IsValid() const { return fd >= 0; }
   s32 fd = -1;
   s32 wii_fd = -1;
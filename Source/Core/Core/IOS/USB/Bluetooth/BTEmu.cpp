@@ -767,6 +767,15 @@ bool BluetoothEmu::SendEventRoleChange(bdaddr_t bd, bool master)
 
 bool BluetoothEmu::SendEventNumberOfCompletedPackets()
 {
+  // This runs on every Update(), so don't bother building an event
+  // (which includes zeroing its 1 KiB buffer) when no packet completed.
+  if (std::all_of(m_packet_count, m_packet_count + m_wiimotes.size(),
+                  [](u32 count) { return count == 0; }))
+  {
+    DEBUG_LOG(IOS_WIIMOTE, "SendEventNumberOfCompletedPackets: no packets; no event");
+    return true;
+  }
+
   SQueuedEvent event((u32)(sizeof(hci_event_hdr_t) + sizeof(hci_num_compl_pkts_ep) +
                            (sizeof(hci_num_compl_pkts_info) * m_wiimotes.size())),
                      0);
@@ -781,8 +790,6 @@ bool BluetoothEmu::SendEventNumberOfCompletedPackets()
   event_hdr->length = sizeof(hci_num_compl_pkts_ep);
   hci_event->num_con_handles = 0;
 
-  u32 acc = 0;
-
   for (unsigned int i = 0; i < m_wiimotes.size(); i++)
   {
     event_hdr->length += sizeof(hci_num_compl_pkts_info);
@@ -793,19 +800,11 @@ bool BluetoothEmu::SendEventNumberOfCompletedPackets()
     DEBUG_LOG(IOS_WIIMOTE, "  Connection_Handle: 0x%04x", info->con_handle);
     DEBUG_LOG(IOS_WIIMOTE, "  Number_Of_Completed_Packets: %i", info->compl_pkts);
 
-    acc += info->compl_pkts;
     m_packet_count[i] = 0;
     info++;
   }
 
-  if (acc)
-  {
-    AddEventToQueue(event);
-  }
-  else
-  {
-    DEBUG_LOG(IOS_WIIMOTE, "SendEventNumberOfCompletedPackets: no packets; no event");
-  }
+  AddEventToQueue(event);
 
   return true;
 }
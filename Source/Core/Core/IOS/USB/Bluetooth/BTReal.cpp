@@ -282,9 +282,10 @@ void BluetoothReal::DoState(PointerWrap& p)
   }
 
   // Prevent the transfer callbacks from messing with m_current_transfers after we have started
-  // writing a savestate. We cannot use a scoped lock here because DoState is called twice and
-  // we would lose the lock between the two calls.
-  if (p.GetMode() == PointerWrap::MODE_MEASURE || p.GetMode() == PointerWrap::MODE_VERIFY)
+  // writing a savestate. We cannot use a scoped lock here because a measure + write save calls
+  // DoState twice and we would lose the lock between the two calls.
+  if (p.GetMode() == PointerWrap::MODE_MEASURE || p.GetMode() == PointerWrap::MODE_VERIFY ||
+      p.GetMode() == PointerWrap::MODE_APPEND)
     m_transfers_mutex.lock();
 
   std::vector<u32> addresses_to_discard;
@@ -311,7 +312,8 @@ void BluetoothReal::DoState(PointerWrap& p)
                     OSD::Duration::NORMAL);
   }
 
-  if (!s_has_shown_savestate_warning && p.GetMode() == PointerWrap::MODE_WRITE)
+  if (!s_has_shown_savestate_warning && (p.GetMode() == PointerWrap::MODE_WRITE ||
+                                         p.GetMode() == PointerWrap::MODE_APPEND))
   {
     OSD::AddMessage("Savestates may not work with Bluetooth passthrough in all cases.\n"
                     "They will only work if no remote is connected when restoring the state,\n"
@@ -321,7 +323,7 @@ void BluetoothReal::DoState(PointerWrap& p)
   }
 
   // We have finished the savestate now, so the transfers mutex can be unlocked.
-  if (p.GetMode() == PointerWrap::MODE_WRITE)
+  if (p.GetMode() == PointerWrap::MODE_WRITE || p.GetMode() == PointerWrap::MODE_APPEND)
     m_transfers_mutex.unlock();
 }
 
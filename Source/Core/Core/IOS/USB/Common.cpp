@@ -14,6 +14,12 @@
 
 namespace IOS::HLE::USB
 {
+u8* TransferCommand::GetPayloadPointer() const
+{
+  ASSERT_MSG(IOS_USB, data_address != 0, "Invalid data_address");
+  return Memory::GetPointer(data_address);
+}
+
 std::unique_ptr<u8[]> TransferCommand::MakeBuffer(const size_t size) const
 {
   ASSERT_MSG(IOS_USB, data_address != 0, "Invalid data_address");
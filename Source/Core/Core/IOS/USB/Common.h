@@ -108,6 +108,10 @@ struct TransferCommand
   // Called after a transfer has completed to reply to the IPC request.
   // This can be overridden for additional processing before replying.
   virtual void OnTransferComplete(s32 return_value) const;
+  // Maps the data payload directly from emulated memory. Transfers that don't need
+  // a host-side staging buffer (e.g. no setup packet to prepend) should use this
+  // instead of MakeBuffer/FillBuffer to avoid a copy in each direction.
+  u8* GetPayloadPointer() const;
   std::unique_ptr<u8[]> MakeBuffer(size_t size) const;
   void FillBuffer(const u8* src, size_t size) const;
 
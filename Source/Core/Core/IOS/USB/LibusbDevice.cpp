@@ -231,9 +231,10 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<BulkMessage> cmd)
     return LIBUSB_ERROR_NOT_FOUND;
 
   libusb_transfer* transfer = libusb_alloc_transfer(0);
-  libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint,
-                            cmd->MakeBuffer(cmd->length).release(), cmd->length, TransferCallback,
-                            this, 0);
+  // The payload is mapped straight from emulated memory: the device reads/writes it
+  // in place, so no staging buffer or copy-back is needed.
+  libusb_fill_bulk_transfer(transfer, m_handle, cmd->endpoint, cmd->GetPayloadPointer(),
+                            cmd->length, TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
@@ -245,9 +246,8 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IntrMessage> cmd)
     return LIBUSB_ERROR_NOT_FOUND;
 
   libusb_transfer* transfer = libusb_alloc_transfer(0);
-  libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint,
-                                 cmd->MakeBuffer(cmd->length).release(), cmd->length,
-                                 TransferCallback, this, 0);
+  libusb_fill_interrupt_transfer(transfer, m_handle, cmd->endpoint, cmd->GetPayloadPointer(),
+                                 cmd->length, TransferCallback, this, 0);
   transfer->flags |= LIBUSB_TRANSFER_FREE_TRANSFER;
   m_transfer_endpoints[transfer->endpoint].AddTransfer(std::move(cmd), transfer);
   return libusb_submit_transfer(transfer);
@@ -259,7 +259,7 @@ int LibusbDevice::SubmitTransfer(std::unique_ptr<IsoMessage> cmd)
     return LIBUSB_ERROR_NOT_FOUND;
 
   libusb_transfer* transfer = libusb_alloc_transfer(cmd->num_packets);
-  transfer->buffer = cmd->MakeBuffer(cmd->length).release();
+  transfer->buffer = cmd->GetPayloadPointer();
   transfer->callback = TransferCallback;
   transfer->dev_handle = m_handle;
   transfer->endpoint = cmd->endpoint;
@@ -289,12 +289,13 @@ void LibusbDevice::TransferCallback(libusb_transfer* transfer)
 {
   auto* device = static_cast<LibusbDevice*>(transfer->user_data);
   device->m_transfer_endpoints[transfer->endpoint].HandleTransfer(transfer, [&](const auto& cmd) {
+    // The transfer buffer is the emulated memory payload itself, so the data is
+    // already in place and there is nothing to copy back.
     switch (transfer->type)
     {
     case LIBUSB_TRANSFER_TYPE_ISOCHRONOUS:
     {
       auto& iso_msg = static_cast<const IsoMessage&>(cmd);
-      cmd.FillBuffer(transfer->buffer, iso_msg.length);
       for (size_t i = 0; i < iso_msg.num_packets; ++i)
         iso_msg.SetPacketReturnValue(i, transfer->iso_packet_desc[i].actual_length);
       // Note: isochronous transfers *must* return 0 as the return value. Anything else
@@ -302,7 +303,6 @@ void LibusbDevice::TransferCallback(libusb_transfer* transfer)
       return static_cast<s32>(IPC_SUCCESS);
     }
     default:
-      cmd.FillBuffer(transfer->buffer, transfer->actual_length);
       return static_cast<s32>(transfer->actual_length);
     }
   });
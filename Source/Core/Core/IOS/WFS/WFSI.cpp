@@ -47,6 +47,12 @@ void ARCUnpacker::AddBytes(const std::vector<u8>& bytes)
   m_whole_file.insert(m_whole_file.end(), bytes.begin(), bytes.end());
 }
 
+u8* ARCUnpacker::ReserveBytes(u32 size)
+{
+  m_whole_file.resize(m_whole_file.size() + size);
+  return m_whole_file.data() + m_whole_file.size() - size;
+}
+
 void ARCUnpacker::Extract(const WriteCallback& callback)
 {
   u32 fourcc = Common::swap32(m_whole_file.data());
@@ -227,11 +233,11 @@ IPCCommandResult WFSI::IOCtl(const IOCtlRequest& request)
     INFO_LOG(IOS_WFS, "%s: %08x bytes of data at %08x from content id %d", ioctl_name, input_size,
              input_ptr, content_id);
 
-    std::vector<u8> decrypted(input_size);
-    mbedtls_aes_crypt_cbc(&m_aes_ctx, MBEDTLS_AES_DECRYPT, input_size, m_aes_iv,
-                          Memory::GetPointer(input_ptr), decrypted.data());
-
-    m_arc_unpacker.AddBytes(decrypted);
+    // Decrypt the chunk from emulated memory directly into the unpacker's buffer
+    // instead of staging it in a temporary vector.
+    const PayloadSpan input = PayloadSpan::FromEmu(input_ptr, input_size);
+    mbedtls_aes_crypt_cbc(&m_aes_ctx, MBEDTLS_AES_DECRYPT, input_size, m_aes_iv, input.data,
+                          m_arc_unpacker.ReserveBytes(input_size));
     break;
   }
 
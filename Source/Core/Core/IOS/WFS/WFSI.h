@@ -25,6 +25,11 @@ public:
 
   void AddBytes(const std::vector<u8>& bytes);
 
+  // Grows the file buffer by size bytes and returns a pointer to the new region, so
+  // callers can produce data (e.g. decrypt a chunk) directly in place instead of
+  // staging it in a temporary buffer first.
+  u8* ReserveBytes(u32 size);
+
   using WriteCallback = std::function<void(const std::string&, const std::vector<u8>&)>;
   void Extract(const WriteCallback& callback);
 
@@ -296,7 +296,8 @@ IPCCommandResult WFSSRV::IOCtl(const IOCtlRequest& request)
       fd_obj->file.Seek(position, SEEK_SET);
     }
     size_t read_bytes;
-    fd_obj->file.ReadArray(Memory::GetPointer(addr), size, &read_bytes);
+    // Read directly into emulated memory, no staging buffer.
+    fd_obj->file.ReadArray(PayloadSpan::FromEmu(addr, size).data, size, &read_bytes);
     // TODO(wfs): Handle read errors.
     if (absolute)
     {
@@ -336,7 +337,7 @@ IPCCommandResult WFSSRV::IOCtl(const IOCtlRequest& request)
     {
       fd_obj->file.Seek(position, SEEK_SET);
     }
-    fd_obj->file.WriteArray(Memory::GetPointer(addr), size);
+    fd_obj->file.WriteArray(PayloadSpan::FromEmu(addr, size).data, size);
     // TODO(wfs): Handle write errors.
     if (absolute)
     {
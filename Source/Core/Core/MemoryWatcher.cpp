@@ -2,10 +2,13 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include "Common/FileUtil.h"
@@ -18,6 +21,9 @@ static std::unique_ptr<MemoryWatcher> s_memory_watcher;
 static CoreTiming::EventType* s_event;
 static const int MW_RATE = 600;  // Steps per second
 
+static const u32 MW_SHM_MAGIC = 0x3153574D;  // "MWS1"
+static const u32 MW_SHM_VERSION = 1;
+
 static void MWCallback(u64 userdata, s64 cyclesLate)
 {
   s_memory_watcher->Step();
@@ -42,6 +48,8 @@ MemoryWatcher::MemoryWatcher()
   m_running = false;
   if (!LoadAddresses(File::GetUserPath(F_MEMORYWATCHERLOCATIONS_IDX)))
     return;
+  if (!OpenSharedMemory(File::GetUserPath(F_MEMORYWATCHERSHM_IDX)))
+    return;
   if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
     return;
   m_running = true;
@@ -49,6 +57,12 @@ MemoryWatcher::MemoryWatcher()
 
 MemoryWatcher::~MemoryWatcher()
 {
+  if (m_shm_header)
+  {
+    munmap(m_shm_header, sizeof(SharedHeader) + 2 * m_values.size() * sizeof(u32));
+    close(m_shm_fd);
+  }
+
   if (!m_running)
     return;
 
@@ -82,6 +96,36 @@ void MemoryWatcher::ParseLine(const std::string& line)
     m_addresses[line].push_back(offset);
 }
 
+bool MemoryWatcher::OpenSharedMemory(const std::string& path)
+{
+  m_shm_fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  if (m_shm_fd < 0)
+    return false;
+
+  size_t size = sizeof(SharedHeader) + 2 * m_values.size() * sizeof(u32);
+  if (ftruncate(m_shm_fd, size) != 0)
+  {
+    close(m_shm_fd);
+    return false;
+  }
+
+  void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_shm_fd, 0);
+  if (mapping == MAP_FAILED)
+  {
+    close(m_shm_fd);
+    return false;
+  }
+
+  m_shm_header = static_cast<SharedHeader*>(mapping);
+  m_shm_buffers = reinterpret_cast<u32*>(m_shm_header + 1);
+
+  m_shm_header->num_values = static_cast<u32>(m_values.size());
+  m_shm_header->sequence = 0;
+  m_shm_header->version = MW_SHM_VERSION;
+  m_shm_header->magic = MW_SHM_MAGIC;
+  return true;
+}
+
 bool MemoryWatcher::OpenSocket(const std::string& path)
 {
   memset(&m_addr, 0, sizeof(m_addr));
@@ -100,31 +144,38 @@ u32 MemoryWatcher::ChasePointer(const std::string& line)
   return value;
 }
 
-std::string MemoryWatcher::ComposeMessage(const std::string& line, u32 value)
-{
-  std::stringstream message_stream;
-  message_stream << line << '\n' << std::hex << value;
-  return message_stream.str();
-}
-
 void MemoryWatcher::Step()
 {
   if (!m_running)
     return;
 
+  const u32 next_sequence = m_shm_header->sequence + 1;
+  u32* buffer = m_shm_buffers + (next_sequence & 1) * m_values.size();
+
+  bool changed = false;
+  size_t index = 0;
   for (auto& entry : m_values)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(address);
-    if (new_value != current_value)
+    u32 new_value = ChasePointer(entry.first);
+    if (new_value != entry.second)
     {
-      // Update the value
-      current_value = new_value;
-      std::string message = ComposeMessage(address, new_value);
-      sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
-             sizeof(m_addr));
+      entry.second = new_value;
+      changed = true;
     }
+    buffer[index++] = new_value;
   }
+
+  if (!changed)
+    return;
+
+  // Publish the snapshot, then ring the doorbell: a single datagram carrying
+  // the new sequence number, instead of one message per changed address.
+  std::atomic_thread_fence(std::memory_order_release);
+  m_shm_header->sequence = next_sequence;
+
+  std::stringstream message_stream;
+  message_stream << std::hex << next_sequence;
+  std::string message = message_stream.str();
+  sendto(m_fd, message.c_str(), message.size() + 1, 0, reinterpret_cast<sockaddr*>(&m_addr),
+         sizeof(m_addr));
 }
@@ -9,14 +9,24 @@
 #include <sys/un.h>
 #include <vector>
 
-// MemoryWatcher reads a file containing in-game memory addresses and outputs
-// changes to those memory addresses to a unix domain socket as the game runs.
+#include "Common/CommonTypes.h"
+
+// MemoryWatcher reads a file containing in-game memory addresses and exports
+// snapshots of their values to a shared-memory file as the game runs. A
+// datagram on a unix domain socket acts as a doorbell: one is sent per step
+// in which any watched value changed, so consumers can sleep on the socket
+// instead of polling the snapshot.
 //
 // The input file is a newline-separated list of hex memory addresses, without
 // the "0x". To follow pointers, separate addresses with a space. For example,
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
-// The output to the socket is two lines. The first is the address from the
-// input file, and the second is the new value in hex.
+//
+// The shared-memory file starts with a SharedHeader, followed by two snapshot
+// buffers of num_values u32s each. Values appear in the sorted order of the
+// lines in the input file. The writer fills the inactive buffer and then
+// publishes it by storing a new sequence number whose low bit selects it;
+// readers should copy the selected buffer and re-check the sequence number to
+// detect a torn read.
 class MemoryWatcher final
 {
 public:
@@ -28,18 +38,31 @@ public:
   static void Shutdown();
 
 private:
+  struct SharedHeader
+  {
+    u32 magic;  // "MWS1"
+    u32 version;
+    u32 num_values;
+    u32 sequence;  // low bit selects the buffer holding the latest snapshot
+  };
+
   bool LoadAddresses(const std::string& path);
+  bool OpenSharedMemory(const std::string& path);
   bool OpenSocket(const std::string& path);
 
   void ParseLine(const std::string& line);
   u32 ChasePointer(const std::string& line);
-  std::string ComposeMessage(const std::string& line, u32 value);
 
   bool m_running;
 
   int m_fd;
   sockaddr_un m_addr;
 
+  int m_shm_fd = -1;
+  SharedHeader* m_shm_header = nullptr;
+  // The two snapshot buffers, back to back.
+  u32* m_shm_buffers = nullptr;
+
   // Address as stored in the file -> list of offsets to follow
   std::map<std::string, std::vector<u32>> m_addresses;
   // Address as stored in the file -> current value
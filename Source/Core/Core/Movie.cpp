@@ -606,6 +606,11 @@ static std::string Analog1DToString(u8 v, const std::string& prefix, u8 range =
 // NOTE: CPU Thread
 static void SetInputDisplayString(ControllerState padState, int controllerID)
 {
+  // Building the string and taking the display lock on every poll is wasted work
+  // while the input display is hidden, and shows up at unlocked playback speeds.
+  if (!SConfig::GetInstance().m_ShowInputDisplay)
+    return;
+
   std::string display_str = StringFromFormat("P%d:", controllerID + 1);
 
   if (padState.is_connected)
@@ -652,6 +657,9 @@ static void SetInputDisplayString(ControllerState padState, int controllerID)
 static void SetWiiInputDisplayString(int remoteID, const DataReportBuilder& rpt, int ext,
                                      const EncryptionKey& key)
 {
+  if (!SConfig::GetInstance().m_ShowInputDisplay)
+    return;
+
   int controllerID = remoteID + 4;
 
   std::string display_str = StringFromFormat("R%d:", remoteID + 1);
@@ -811,6 +819,16 @@ void CheckPadStatus(const GCPadStatus* PadStatus, int controllerID)
   SetInputDisplayString(s_padState, controllerID);
 }
 
+// Keeps the recording buffer's capacity ahead of the write position in megabyte
+// steps, so the per-poll resize below never has to touch the allocator. The
+// size still tracks the exact number of recorded bytes for saving and playback.
+static void ReserveInputBuffer(size_t bound)
+{
+  constexpr size_t RESERVE_CHUNK = 1024 * 1024;
+  if (bound > s_temp_input.capacity())
+    s_temp_input.reserve(((bound / RESERVE_CHUNK) + 1) * RESERVE_CHUNK);
+}
+
 // NOTE: CPU Thread
 void RecordInput(const GCPadStatus* PadStatus, int controllerID)
 {
@@ -819,6 +837,7 @@ void RecordInput(const GCPadStatus* PadStatus, int controllerID)
 
   CheckPadStatus(PadStatus, controllerID);
 
+  ReserveInputBuffer(s_currentByte + sizeof(ControllerState));
   s_temp_input.resize(s_currentByte + sizeof(ControllerState));
   memcpy(&s_temp_input[s_currentByte], &s_padState, sizeof(ControllerState));
   s_currentByte += sizeof(ControllerState);
@@ -840,6 +859,7 @@ void RecordWiimote(int wiimote, const u8* data, u8 size)
     return;
 
   InputUpdate();
+  ReserveInputBuffer(s_currentByte + size + 1);
   s_temp_input.resize(s_currentByte + size + 1);
   s_temp_input[s_currentByte++] = size;
   memcpy(&s_temp_input[s_currentByte], data, size);
@@ -25,7 +25,6 @@
 #include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
-#include "Common/MD5.h"
 #include "Common/MsgHandler.h"
 #include "Common/NandPaths.h"
 #include "Common/QoSSession.h"
@@ -53,6 +52,7 @@
 #include "Core/Movie.h"
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/WiiRoot.h"
+#include "DiscIO/DiscDigest.h"
 #include "InputCommon/ControllerEmu/ControlGroup/Attachments.h"
 #include "InputCommon/GCAdapter.h"
 #include "InputCommon/InputConfig.h"
@@ -430,11 +430,9 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
       PadIndex map;
       packet >> map;
 
-      GCPadStatus pad;
-      packet >> pad.button >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >>
-          pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
-
       // Trusting server for good map value (>=0 && <4)
+      const GCPadStatus pad = ReadPadDelta(packet, &m_last_pad_status_received.at(map));
+
       // add to pad buffer
       m_pad_buffer.at(map).Push(pad);
       m_gc_pad_event.Set();
@@ -540,6 +538,12 @@ unsigned int NetPlayClient::OnData(sf::Packet& packet)
       packet >> m_current_game;
       packet >> m_net_settings.m_CPUthread;
 
+      // Restart the pad delta encoding from a known state. This has to happen
+      // here on the netplay thread, in order with the pad data messages,
+      // since data for the new game can arrive before the game has booted.
+      m_last_pad_status_sent.fill(GCPadStatus{});
+      m_last_pad_status_received.fill(GCPadStatus{});
+
       INFO_LOG(NETPLAY, "Start of game %s", m_selected_game.c_str());
 
       {
@@ -1214,25 +1218,34 @@ void NetPlayClient::ThreadFunc()
     }
     if (net > 0)
     {
-      sf::Packet rpac;
-      switch (netEvent.type)
+      // Drain every event that is already queued before going back to
+      // enet_host_service; input-heavy sessions deliver several packets
+      // per wakeup and the housekeeping above doesn't need to run for
+      // each of them.
+      bool connection_lost = false;
+      do
       {
-      case ENET_EVENT_TYPE_RECEIVE:
-        rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
-        OnData(rpac);
+        sf::Packet rpac;
+        switch (netEvent.type)
+        {
+        case ENET_EVENT_TYPE_RECEIVE:
+          rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
+          OnData(rpac);
 
-        enet_packet_destroy(netEvent.packet);
-        break;
-      case ENET_EVENT_TYPE_DISCONNECT:
-        m_dialog->OnConnectionLost();
+          enet_packet_destroy(netEvent.packet);
+          break;
+        case ENET_EVENT_TYPE_DISCONNECT:
+          m_dialog->OnConnectionLost();
 
-        if (m_is_running.IsSet())
-          StopGame();
+          if (m_is_running.IsSet())
+            StopGame();
 
-        break;
-      default:
-        break;
-      }
+          connection_lost = true;
+          break;
+        default:
+          break;
+        }
+      } while (!connection_lost && enet_host_check_events(m_client, &netEvent) > 0);
     }
   }
 
@@ -1324,8 +1337,7 @@ void NetPlayClient::AddPadStateToPacket(const int in_game_pad, const GCPadStatus
                                         sf::Packet& packet)
 {
   packet << static_cast<PadIndex>(in_game_pad);
-  packet << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY << pad.substickX
-         << pad.substickY << pad.triggerLeft << pad.triggerRight << pad.isConnected;
+  WritePadDelta(packet, pad, &m_last_pad_status_sent[in_game_pad]);
 }
 
 // called from ---CPU--- thread
@@ -2093,7 +2105,12 @@ void NetPlayClient::ComputeMD5(const std::string& file_identifier)
   if (m_MD5_thread.joinable())
     m_MD5_thread.join();
   m_MD5_thread = std::thread([this, file]() {
-    std::string sum = MD5::MD5Sum(file, [&](int progress) {
+    // Not actually an MD5 sum anymore: the parallel, junk-skipping disc
+    // digest is much faster and its result is cached per file, so repeat
+    // checks are instant. Only equality of the strings matters here, and
+    // all session members run the same version. The message names are kept
+    // to avoid churning the whole protocol enum.
+    std::string sum = DiscIO::ComputeDiscDigest(file, [&](int progress) {
       sf::Packet packet;
       packet << static_cast<MessageId>(NP_MSG_MD5_PROGRESS);
       packet << progress;
@@ -160,6 +160,11 @@ protected:
 
   std::array<bool, 4> m_first_pad_status_received{};
 
+  // References for the delta-encoded pad data, per in-game pad.
+  // Reset on both ends when a game starts.
+  std::array<GCPadStatus, 4> m_last_pad_status_sent{};
+  std::array<GCPadStatus, 4> m_last_pad_status_received{};
+
   std::chrono::time_point<std::chrono::steady_clock> m_buffer_under_target_last;
 
   NetPlayUI* m_dialog = nullptr;
@@ -0,0 +1,110 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "Core/NetPlayProto.h"
+
+#include <SFML/Network/Packet.hpp>
+
+#include "InputCommon/GCPadStatus.h"
+
+namespace NetPlay
+{
+namespace
+{
+// One bit per serialized GCPadStatus field. The field order of WritePadDelta
+// and ReadPadDelta must match.
+enum : u16
+{
+  DELTA_FIELD_BUTTON = 0x001,
+  DELTA_FIELD_ANALOG_A = 0x002,
+  DELTA_FIELD_ANALOG_B = 0x004,
+  DELTA_FIELD_STICK_X = 0x008,
+  DELTA_FIELD_STICK_Y = 0x010,
+  DELTA_FIELD_SUBSTICK_X = 0x020,
+  DELTA_FIELD_SUBSTICK_Y = 0x040,
+  DELTA_FIELD_TRIGGER_LEFT = 0x080,
+  DELTA_FIELD_TRIGGER_RIGHT = 0x100,
+  DELTA_FIELD_CONNECTED = 0x200,
+};
+}  // Anonymous namespace
+
+void WritePadDelta(sf::Packet& packet, const GCPadStatus& pad, GCPadStatus* last, const bool full)
+{
+  u16 fields = 0;
+  if (full || pad.button != last->button)
+    fields |= DELTA_FIELD_BUTTON;
+  if (full || pad.analogA != last->analogA)
+    fields |= DELTA_FIELD_ANALOG_A;
+  if (full || pad.analogB != last->analogB)
+    fields |= DELTA_FIELD_ANALOG_B;
+  if (full || pad.stickX != last->stickX)
+    fields |= DELTA_FIELD_STICK_X;
+  if (full || pad.stickY != last->stickY)
+    fields |= DELTA_FIELD_STICK_Y;
+  if (full || pad.substickX != last->substickX)
+    fields |= DELTA_FIELD_SUBSTICK_X;
+  if (full || pad.substickY != last->substickY)
+    fields |= DELTA_FIELD_SUBSTICK_Y;
+  if (full || pad.triggerLeft != last->triggerLeft)
+    fields |= DELTA_FIELD_TRIGGER_LEFT;
+  if (full || pad.triggerRight != last->triggerRight)
+    fields |= DELTA_FIELD_TRIGGER_RIGHT;
+  if (full || pad.isConnected != last->isConnected)
+    fields |= DELTA_FIELD_CONNECTED;
+
+  packet << fields;
+
+  if (fields & DELTA_FIELD_BUTTON)
+    packet << pad.button;
+  if (fields & DELTA_FIELD_ANALOG_A)
+    packet << pad.analogA;
+  if (fields & DELTA_FIELD_ANALOG_B)
+    packet << pad.analogB;
+  if (fields & DELTA_FIELD_STICK_X)
+    packet << pad.stickX;
+  if (fields & DELTA_FIELD_STICK_Y)
+    packet << pad.stickY;
+  if (fields & DELTA_FIELD_SUBSTICK_X)
+    packet << pad.substickX;
+  if (fields & DELTA_FIELD_SUBSTICK_Y)
+    packet << pad.substickY;
+  if (fields & DELTA_FIELD_TRIGGER_LEFT)
+    packet << pad.triggerLeft;
+  if (fields & DELTA_FIELD_TRIGGER_RIGHT)
+    packet << pad.triggerRight;
+  if (fields & DELTA_FIELD_CONNECTED)
+    packet << pad.isConnected;
+
+  *last = pad;
+}
+
+GCPadStatus ReadPadDelta(sf::Packet& packet, GCPadStatus* last)
+{
+  u16 fields = 0;
+  packet >> fields;
+
+  if (fields & DELTA_FIELD_BUTTON)
+    packet >> last->button;
+  if (fields & DELTA_FIELD_ANALOG_A)
+    packet >> last->analogA;
+  if (fields & DELTA_FIELD_ANALOG_B)
+    packet >> last->analogB;
+  if (fields & DELTA_FIELD_STICK_X)
+    packet >> last->stickX;
+  if (fields & DELTA_FIELD_STICK_Y)
+    packet >> last->stickY;
+  if (fields & DELTA_FIELD_SUBSTICK_X)
+    packet >> last->substickX;
+  if (fields & DELTA_FIELD_SUBSTICK_Y)
+    packet >> last->substickY;
+  if (fields & DELTA_FIELD_TRIGGER_LEFT)
+    packet >> last->triggerLeft;
+  if (fields & DELTA_FIELD_TRIGGER_RIGHT)
+    packet >> last->triggerRight;
+  if (fields & DELTA_FIELD_CONNECTED)
+    packet >> last->isConnected;
+
+  return *last;
+}
+}  // namespace NetPlay
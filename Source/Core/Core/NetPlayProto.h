@@ -5,10 +5,14 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <string>
 #include <vector>
 #include "Common/CommonTypes.h"
 #include "Core/HW/EXI/EXI_Device.h"
 
+struct GCPadStatus;
+
 namespace IOS::HLE::FS
 {
 class FileSystem;
@@ -17,6 +21,10 @@ namespace PowerPC
 {
 enum class CPUCore;
 }
+namespace sf
+{
+class Packet;
+}
 
 namespace NetPlay
 {
@@ -201,6 +209,16 @@ using FrameNum = u32;
 using PadIndex = s8;
 using PadMappingArray = std::array<PlayerId, 4>;
 
+// Pad data is sent as a delta against the previous status sent for the same
+// pad: a bitfield of the fields that changed followed by only those fields.
+// Pad data travels on a reliable ordered channel, so sender and receiver can
+// track the previous status without explicit acknowledgements. Both sides
+// start from a zeroed status at game start. "full" forces every field to be
+// written, for streams where the receiver's previous status may be stale.
+void WritePadDelta(sf::Packet& packet, const GCPadStatus& pad, GCPadStatus* last,
+                   bool full = false);
+GCPadStatus ReadPadDelta(sf::Packet& packet, GCPadStatus* last);
+
 bool IsNetPlayRunning();
 // Precondition: A netplay client instance must be present. In other words,
 //               IsNetPlayRunning() must be true before calling this.
@@ -139,7 +139,6 @@ NetPlayServer::NetPlayServer(const u16 port, const bool forward_port,
     m_do_loop = true;
     m_thread = std::thread(&NetPlayServer::ThreadFunc, this);
     m_target_buffer_size = 5;
-    m_chunked_data_thread = std::thread(&NetPlayServer::ChunkedDataThreadFunc, this);
 
 #ifdef USE_UPNP
     if (forward_port)
@@ -205,75 +204,81 @@ void NetPlayServer::ThreadFunc()
     }
     if (net > 0)
     {
-      switch (netEvent.type)
-      {
-      case ENET_EVENT_TYPE_CONNECT:
-      {
-        // Actual client initialization is deferred to the receive event, so here
-        // we'll just log the new connection.
-        INFO_LOG(NETPLAY, "Peer connected from: %x:%u", netEvent.peer->address.host,
-                 netEvent.peer->address.port);
-      }
-      break;
-      case ENET_EVENT_TYPE_RECEIVE:
+      // Drain every event that is already queued before going back to
+      // enet_host_service, so the housekeeping above runs once per wakeup
+      // instead of once per packet.
+      do
       {
-        sf::Packet rpac;
-        rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
-
-        if (!netEvent.peer->data)
+        switch (netEvent.type)
+        {
+        case ENET_EVENT_TYPE_CONNECT:
+        {
+          // Actual client initialization is deferred to the receive event, so here
+          // we'll just log the new connection.
+          INFO_LOG(NETPLAY, "Peer connected from: %x:%u", netEvent.peer->address.host,
+                   netEvent.peer->address.port);
+        }
+        break;
+        case ENET_EVENT_TYPE_RECEIVE:
         {
-          // uninitialized client, we'll assume this is their initialization packet
-          unsigned int error;
+          sf::Packet rpac;
+          rpac.append(netEvent.packet->data, netEvent.packet->dataLength);
+
+          if (!netEvent.peer->data)
           {
-            std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
-            error = OnConnect(netEvent.peer, rpac);
+            // uninitialized client, we'll assume this is their initialization packet
+            unsigned int error;
+            {
+              std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
+              error = OnConnect(netEvent.peer, rpac);
+            }
+
+            if (error)
+            {
+              sf::Packet spac;
+              spac << static_cast<MessageId>(error);
+              // don't need to lock, this client isn't in the client map
+              Send(netEvent.peer, spac);
+
+              ClearPeerPlayerId(netEvent.peer);
+              enet_peer_disconnect_later(netEvent.peer, 0);
+            }
           }
-
-          if (error)
+          else
           {
-            sf::Packet spac;
-            spac << static_cast<MessageId>(error);
-            // don't need to lock, this client isn't in the client map
-            Send(netEvent.peer, spac);
-
-            ClearPeerPlayerId(netEvent.peer);
-            enet_peer_disconnect_later(netEvent.peer, 0);
+            auto it = m_players.find(*PeerPlayerId(netEvent.peer));
+            Client& client = it->second;
+            if (OnData(rpac, client) != 0)
+            {
+              // if a bad packet is received, disconnect the client
+              std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
+              OnDisconnect(client);
+
+              ClearPeerPlayerId(netEvent.peer);
+            }
           }
+          enet_packet_destroy(netEvent.packet);
         }
-        else
+        break;
+        case ENET_EVENT_TYPE_DISCONNECT:
         {
+          std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
+          if (!netEvent.peer->data)
+            break;
           auto it = m_players.find(*PeerPlayerId(netEvent.peer));
-          Client& client = it->second;
-          if (OnData(rpac, client) != 0)
+          if (it != m_players.end())
           {
-            // if a bad packet is received, disconnect the client
-            std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
+            Client& client = it->second;
             OnDisconnect(client);
 
             ClearPeerPlayerId(netEvent.peer);
           }
         }
-        enet_packet_destroy(netEvent.packet);
-      }
-      break;
-      case ENET_EVENT_TYPE_DISCONNECT:
-      {
-        std::lock_guard<std::recursive_mutex> lkg(m_crit.game);
-        if (!netEvent.peer->data)
+        break;
+        default:
           break;
-        auto it = m_players.find(*PeerPlayerId(netEvent.peer));
-        if (it != m_players.end())
-        {
-          Client& client = it->second;
-          OnDisconnect(client);
-
-          ClearPeerPlayerId(netEvent.peer);
         }
-      }
-      break;
-      default:
-        break;
-      }
+      } while (enet_host_check_events(m_server, &netEvent) > 0);
     }
   }
 
@@ -573,8 +578,16 @@ void NetPlayServer::SendAsyncToClients(sf::Packet&& packet, const PlayerId skip_
   ENetUtil::WakeupThread(m_server);
 }
 
+// called from multiple threads
+void NetPlayServer::StartChunkedDataThread()
+{
+  std::call_once(m_chunked_data_thread_start,
+                 [this] { m_chunked_data_thread = std::thread(&NetPlayServer::ChunkedDataThreadFunc, this); });
+}
+
 void NetPlayServer::SendChunked(sf::Packet&& packet, const PlayerId pid, const std::string& title)
 {
+  StartChunkedDataThread();
   {
     std::lock_guard<std::recursive_mutex> lkq(m_crit.chunked_data_queue_write);
     m_chunked_data_queue.Push(
@@ -586,6 +599,7 @@ void NetPlayServer::SendChunked(sf::Packet&& packet, const PlayerId pid, const s
 void NetPlayServer::SendChunkedToClients(sf::Packet&& packet, const PlayerId skip_pid,
                                          const std::string& title)
 {
+  StartChunkedDataThread();
   {
     std::lock_guard<std::recursive_mutex> lkq(m_crit.chunked_data_queue_write);
     m_chunked_data_queue.Push(
@@ -666,14 +680,12 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         return 1;
       }
 
-      GCPadStatus pad;
-      packet >> pad.button >> pad.analogA >> pad.analogB >> pad.stickX >> pad.stickY >>
-          pad.substickX >> pad.substickY >> pad.triggerLeft >> pad.triggerRight >> pad.isConnected;
+      // m_last_pad_status is also the reference the sending client encoded
+      // the delta against, so it is kept up to date in both modes.
+      const GCPadStatus pad = ReadPadDelta(packet, &m_last_pad_status[map]);
 
       if (m_host_input_authority)
       {
-        m_last_pad_status[map] = pad;
-
         if (!m_first_pad_status_received[map])
         {
           m_first_pad_status_received[map] = true;
@@ -682,9 +694,8 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       }
       else
       {
-        spac << map << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY
-             << pad.substickX << pad.substickY << pad.triggerLeft << pad.triggerRight
-             << pad.isConnected;
+        spac << map;
+        WritePadDelta(spac, pad, &m_last_pad_status_relayed[map]);
       }
     }
 
@@ -701,6 +712,9 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
     sf::Packet spac;
     spac << static_cast<MessageId>(NP_MSG_PAD_DATA);
 
+    // This is sent to every client, unlike the regular relay which skips the
+    // pad's owner - so the owner's delta reference may be stale. Send the
+    // full status here (which also keeps the references in sync).
     if (pad_num < 0)
     {
       for (size_t i = 0; i < m_pad_map.size(); i++)
@@ -708,18 +722,14 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         if (m_pad_map[i] == 0)
           continue;
 
-        const GCPadStatus& pad = m_last_pad_status[i];
-        spac << static_cast<PadIndex>(i) << pad.button << pad.analogA << pad.analogB << pad.stickX
-             << pad.stickY << pad.substickX << pad.substickY << pad.triggerLeft << pad.triggerRight
-             << pad.isConnected;
+        spac << static_cast<PadIndex>(i);
+        WritePadDelta(spac, m_last_pad_status[i], &m_last_pad_status_relayed[i], true);
       }
     }
     else if (m_pad_map.at(pad_num) != 0)
     {
-      const GCPadStatus& pad = m_last_pad_status[pad_num];
-      spac << pad_num << pad.button << pad.analogA << pad.analogB << pad.stickX << pad.stickY
-           << pad.substickX << pad.substickY << pad.triggerLeft << pad.triggerRight
-           << pad.isConnected;
+      spac << pad_num;
+      WritePadDelta(spac, m_last_pad_status[pad_num], &m_last_pad_status_relayed[pad_num], true);
     }
 
     SendToClients(spac);
@@ -1142,6 +1152,8 @@ bool NetPlayServer::StartGame()
     AdjustPadBufferSize(m_target_buffer_size);
 
   m_first_pad_status_received.fill(false);
+  m_last_pad_status.fill(GCPadStatus{});
+  m_last_pad_status_relayed.fill(GCPadStatus{});
 
   const sf::Uint64 initial_rtc = GetInitialNetPlayRTC();
 
@@ -1648,10 +1660,7 @@ bool NetPlayServer::CompressFileIntoPacket(const std::string& file_path, sf::Pac
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != NETPLAY_LZO_IN_LEN)
       break;
@@ -1703,10 +1712,7 @@ bool NetPlayServer::CompressBufferIntoPacket(const std::vector<u8>& in_buffer, s
 
     // The size of the data to write is 'out_len'
     packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
+    packet.append(out_buffer.data(), out_len);
 
     if (cur_len != NETPLAY_LZO_IN_LEN)
       break;
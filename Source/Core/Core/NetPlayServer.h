@@ -136,6 +136,7 @@ private:
   void UpdateWiimoteMapping();
   std::vector<std::pair<std::string, std::string>> GetInterfaceListInternal() const;
   void ChunkedDataThreadFunc();
+  void StartChunkedDataThread();
   void ChunkedDataSend(sf::Packet&& packet, PlayerId pid, const TargetMode target_mode);
 
   NetSettings m_settings;
@@ -163,6 +164,9 @@ private:
 
   std::array<GCPadStatus, 4> m_last_pad_status{};
   std::array<bool, 4> m_first_pad_status_received{};
+  // Reference for the delta-encoded pad data sent to clients; the clients
+  // keep the matching state. Reset on both ends when a game starts.
+  std::array<GCPadStatus, 4> m_last_pad_status_relayed{};
 
   struct
   {
@@ -180,7 +184,10 @@ private:
   std::thread m_thread;
   Common::Event m_chunked_data_event;
   Common::Event m_chunked_data_complete_event;
+  // Only started once something actually gets sent chunked, so idle sessions
+  // don't carry the extra thread around.
   std::thread m_chunked_data_thread;
+  std::once_flag m_chunked_data_thread_start;
   u32 m_next_chunked_data_id;
   std::unordered_map<u32, unsigned int> m_chunked_data_complete_count;
 
@@ -163,6 +163,17 @@ void MemChecks::AddFromStrings(const TMemChecksStr& mc_strings)
   }
 }
 
+void MemChecks::UpdateExtents()
+{
+  m_min_address = 0xFFFFFFFF;
+  m_max_address = 0;
+  for (const TMemCheck& mc : m_mem_checks)
+  {
+    m_min_address = std::min(m_min_address, mc.start_address);
+    m_max_address = std::max(m_max_address, mc.end_address);
+  }
+}
+
 void MemChecks::Add(const TMemCheck& memory_check)
 {
   if (GetMemCheck(memory_check.start_address) != nullptr)
@@ -171,6 +182,7 @@ void MemChecks::Add(const TMemCheck& memory_check)
   bool had_any = HasAny();
   Core::RunAsCPUThread([&] {
     m_mem_checks.push_back(memory_check);
+    UpdateExtents();
     // If this is the first one, clear the JIT cache so it can switch to
     // watchpoint-compatible code.
     if (!had_any)
@@ -190,14 +202,24 @@ void MemChecks::Remove(u32 address)
 
   Core::RunAsCPUThread([&] {
     m_mem_checks.erase(iter);
+    UpdateExtents();
     if (!HasAny())
       JitInterface::ClearCache();
     PowerPC::DBATUpdated();
   });
 }
 
+void MemChecks::Clear()
+{
+  m_mem_checks.clear();
+  UpdateExtents();
+}
+
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
+  if (address > m_max_address || address + size - 1 < m_min_address)
+    return nullptr;
+
   const auto iter =
       std::find_if(m_mem_checks.begin(), m_mem_checks.end(), [address, size](const auto& mc) {
         return mc.end_address >= address && address + size - 1 >= mc.start_address;
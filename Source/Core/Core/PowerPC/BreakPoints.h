@@ -88,9 +88,15 @@ public:
   bool OverlapsMemcheck(u32 address, u32 length) const;
   void Remove(u32 address);
 
-  void Clear() { m_mem_checks.clear(); }
+  void Clear();
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  void UpdateExtents();
+
   TMemChecks m_mem_checks;
+  // Cached bounds over all checks so the hot lookups can reject unwatched
+  // addresses with two compares instead of walking the list on every access.
+  u32 m_min_address = 0xFFFFFFFF;
+  u32 m_max_address = 0;
 };
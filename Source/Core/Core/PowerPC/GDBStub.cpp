@@ -53,9 +53,6 @@ typedef struct
 } gdb_bp_t;
 
 static gdb_bp_t bp_x[GDB_MAX_BP];
-static gdb_bp_t bp_r[GDB_MAX_BP];
-static gdb_bp_t bp_w[GDB_MAX_BP];
-static gdb_bp_t bp_a[GDB_MAX_BP];
 
 // private helpers
 static u8 hex2char(u8 hex)
@@ -134,12 +131,6 @@ static gdb_bp_t* gdb_bp_ptr(u32 type)
   {
   case GDB_BP_TYPE_X:
     return bp_x;
-  case GDB_BP_TYPE_R:
-    return bp_x;
-  case GDB_BP_TYPE_W:
-    return bp_x;
-  case GDB_BP_TYPE_A:
-    return bp_x;
   default:
     return nullptr;
   }
@@ -440,7 +431,7 @@ static void gdb_read_register()
     wbe32hex(reply, GPR(id));
     break;
   case 32 ... 63:
-    wbe64hex(reply, riPS0(id - 32));
+    wbe64hex(reply, rPS(id - 32).PS0AsU64());
     break;
   case 64:
     wbe32hex(reply, PC);
@@ -525,7 +516,7 @@ static void gdb_write_register()
     GPR(id) = re32hex(bufptr);
     break;
   case 32 ... 63:
-    riPS0(id - 32) = re64hex(bufptr);
+    rPS(id - 32).SetPS0(re64hex(bufptr));
     break;
   case 64:
     PC = re32hex(bufptr);
@@ -626,8 +617,29 @@ static void gdb_continue()
   send_signal = 1;
 }
 
+// Watchpoints are registered as memchecks so that only the watched accesses
+// take the slow path; everything else runs at full speed instead of the stub
+// having to compare every access against its own tables.
+static bool gdb_add_watchpoint(u32 type, u32 addr, u32 len)
+{
+  TMemCheck watch;
+  watch.start_address = addr;
+  watch.end_address = addr + len - 1;
+  watch.is_ranged = len > 1;
+  watch.is_break_on_read = type == GDB_BP_TYPE_R || type == GDB_BP_TYPE_A;
+  watch.is_break_on_write = type == GDB_BP_TYPE_W || type == GDB_BP_TYPE_A;
+  watch.break_on_hit = true;
+
+  PowerPC::memchecks.Add(watch);
+  DEBUG_LOG(GDB_STUB, "gdb: added %d watchpoint: %08x bytes at %08x", type, len, addr);
+  return true;
+}
+
 bool gdb_add_bp(u32 type, u32 addr, u32 len)
 {
+  if (type != GDB_BP_TYPE_X)
+    return gdb_add_watchpoint(type, addr, len);
+
   gdb_bp_t* bp;
   bp = gdb_bp_empty_slot(type);
   if (bp == nullptr)
@@ -714,7 +726,10 @@ static void gdb_remove_bp()
   while (i < cmd_len)
     len = (len << 4) | hex2char(cmd_bfr[i++]);
 
-  gdb_bp_remove(type, addr, len);
+  if (type != GDB_BP_TYPE_X)
+    PowerPC::memchecks.Remove(addr);
+  else
+    gdb_bp_remove(type, addr, len);
   gdb_reply("OK");
 }
 
@@ -831,9 +846,6 @@ static void gdb_init_generic(int domain, const sockaddr* server_addr, socklen_t
 #endif
 
   memset(bp_x, 0, sizeof bp_x);
-  memset(bp_r, 0, sizeof bp_r);
-  memset(bp_w, 0, sizeof bp_w);
-  memset(bp_a, 0, sizeof bp_a);
 
   tmpsock = socket(domain, SOCK_STREAM, 0);
   if (tmpsock == -1)
@@ -915,26 +927,14 @@ int gdb_bp_x(u32 addr)
   return gdb_bp_check(addr, GDB_BP_TYPE_X);
 }
 
-int gdb_bp_r(u32 addr)
-{
-  if (sock == -1)
-    return 0;
-
-  return gdb_bp_check(addr, GDB_BP_TYPE_R);
-}
-
-int gdb_bp_w(u32 addr)
-{
-  if (sock == -1)
-    return 0;
-
-  return gdb_bp_check(addr, GDB_BP_TYPE_W);
-}
-
-int gdb_bp_a(u32 addr)
+// Called when a memcheck registered through the stub pauses the core. Sends
+// the stop reply and hands control to the client right away instead of leaving
+// the core parked in Stepping with the client still waiting.
+void gdb_watchpoint_hit()
 {
   if (sock == -1)
-    return 0;
+    return;
 
-  return gdb_bp_check(addr, GDB_BP_TYPE_A);
+  gdb_signal(GDB_SIGTRAP);
+  gdb_handle_exception();
 }
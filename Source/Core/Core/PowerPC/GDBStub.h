@@ -35,8 +35,6 @@ void gdb_handle_exception();
 int gdb_signal(u32 signal);
 
 int gdb_bp_x(u32 addr);
-int gdb_bp_r(u32 addr);
-int gdb_bp_w(u32 addr);
-int gdb_bp_a(u32 addr);
+void gdb_watchpoint_hit();
 
 bool gdb_add_bp(u32 type, u32 addr, u32 len);
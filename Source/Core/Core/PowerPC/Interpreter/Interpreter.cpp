@@ -179,6 +179,11 @@ int Interpreter::SingleStepInner()
     Trace(m_prev_inst);
   }
 
+  // A single lookup in the flattened table gives us both the final handler
+  // (without the RunTableX trampoline hop) and the op info for the cycle
+  // count and FPU check below.
+  const GekkoDispatchEntry& dispatch = m_dispatchTable[FlattenedOpIndex(m_prev_inst)];
+
   if (m_prev_inst.hex != 0)
   {
     if (IsInvalidPairedSingleExecution(m_prev_inst))
@@ -188,7 +193,7 @@ int Interpreter::SingleStepInner()
     }
     else if (MSR.FP)
     {
-      m_op_table[m_prev_inst.OPCD](m_prev_inst);
+      dispatch.function(m_prev_inst);
       if (PowerPC::ppcState.Exceptions & EXCEPTION_DSI)
       {
         CheckExceptions();
@@ -197,14 +202,14 @@ int Interpreter::SingleStepInner()
     else
     {
       // check if we have to generate a FPU unavailable exception or a program exception.
-      if (PPCTables::UsesFPU(m_prev_inst))
+      if (dispatch.opinfo->flags & FL_USE_FPU)
       {
         PowerPC::ppcState.Exceptions |= EXCEPTION_FPU_UNAVAILABLE;
         CheckExceptions();
       }
       else
       {
-        m_op_table[m_prev_inst.OPCD](m_prev_inst);
+        dispatch.function(m_prev_inst);
         if (PowerPC::ppcState.Exceptions & EXCEPTION_DSI)
         {
           CheckExceptions();
@@ -219,7 +224,7 @@ int Interpreter::SingleStepInner()
   }
 
   UpdatePC();
-  return PPCTables::GetOpInfo(m_prev_inst)->numCycles;
+  return dispatch.opinfo->numCycles;
 }
 
 void Interpreter::SingleStep()
@@ -3,13 +3,44 @@
 // Refer to the license.txt file included.
 
 #include <cmath>
+#include <limits>
 
 #include "Common/CommonTypes.h"
 #include "Common/FloatUtils.h"
+#include "Common/Intrinsics.h"
 #include "Core/PowerPC/Interpreter/Interpreter.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
 #include "Core/PowerPC/PowerPC.h"
 
+#ifdef _M_X86
+// With all-finite inputs, none of the NaN/infinity FPSCR paths in the NI_*
+// helpers can trigger, so the common case of the paired arithmetic ops can
+// compute both elements in one SSE2 op and skip the exception bookkeeping.
+static bool IsAllFinite(__m128d a, __m128d b)
+{
+  const __m128d abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+  const __m128d infinity = _mm_set1_pd(std::numeric_limits<double>::infinity());
+  const __m128d a_finite = _mm_cmplt_pd(_mm_and_pd(a, abs_mask), infinity);
+  const __m128d b_finite = _mm_cmplt_pd(_mm_and_pd(b, abs_mask), infinity);
+  return _mm_movemask_pd(_mm_and_pd(a_finite, b_finite)) == 3;
+}
+
+static void StorePairAndUpdateFPRF(UGeckoInstruction inst, __m128d result)
+{
+  alignas(16) double elements[2];
+  _mm_store_pd(elements, result);
+
+  const double ps0 = ForceSingle(elements[0]);
+  const double ps1 = ForceSingle(elements[1]);
+
+  rPS(inst.FD).SetBoth(ps0, ps1);
+  PowerPC::UpdateFPRF(ps0);
+
+  if (inst.Rc)
+    Helper_UpdateCR1();
+}
+#endif
+
 // These "binary instructions" do not alter FPSCR.
 void Interpreter::ps_sel(UGeckoInstruction inst)
 {
@@ -189,6 +220,16 @@ void Interpreter::ps_sub(UGeckoInstruction inst)
   const auto& a = rPS(inst.FA);
   const auto& b = rPS(inst.FB);
 
+#ifdef _M_X86
+  const __m128d v_lhs = _mm_set_pd(a.PS1AsDouble(), a.PS0AsDouble());
+  const __m128d v_rhs = _mm_set_pd(b.PS1AsDouble(), b.PS0AsDouble());
+  if (IsAllFinite(v_lhs, v_rhs))
+  {
+    StorePairAndUpdateFPRF(inst, _mm_sub_pd(v_lhs, v_rhs));
+    return;
+  }
+#endif
+
   const double ps0 = ForceSingle(NI_sub(a.PS0AsDouble(), b.PS0AsDouble()).value);
   const double ps1 = ForceSingle(NI_sub(a.PS1AsDouble(), b.PS1AsDouble()).value);
 
@@ -204,6 +245,16 @@ void Interpreter::ps_add(UGeckoInstruction inst)
   const auto& a = rPS(inst.FA);
   const auto& b = rPS(inst.FB);
 
+#ifdef _M_X86
+  const __m128d v_lhs = _mm_set_pd(a.PS1AsDouble(), a.PS0AsDouble());
+  const __m128d v_rhs = _mm_set_pd(b.PS1AsDouble(), b.PS0AsDouble());
+  if (IsAllFinite(v_lhs, v_rhs))
+  {
+    StorePairAndUpdateFPRF(inst, _mm_add_pd(v_lhs, v_rhs));
+    return;
+  }
+#endif
+
   const double ps0 = ForceSingle(NI_add(a.PS0AsDouble(), b.PS0AsDouble()).value);
   const double ps1 = ForceSingle(NI_add(a.PS1AsDouble(), b.PS1AsDouble()).value);
 
@@ -222,6 +273,16 @@ void Interpreter::ps_mul(UGeckoInstruction inst)
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
+#ifdef _M_X86
+  const __m128d v_lhs = _mm_set_pd(a.PS1AsDouble(), a.PS0AsDouble());
+  const __m128d v_rhs = _mm_set_pd(c1, c0);
+  if (IsAllFinite(v_lhs, v_rhs))
+  {
+    StorePairAndUpdateFPRF(inst, _mm_mul_pd(v_lhs, v_rhs));
+    return;
+  }
+#endif
+
   const double ps0 = ForceSingle(NI_mul(a.PS0AsDouble(), c0).value);
   const double ps1 = ForceSingle(NI_mul(a.PS1AsDouble(), c1).value);
 
@@ -352,6 +413,17 @@ void Interpreter::ps_muls0(UGeckoInstruction inst)
   const auto& c = rPS(inst.FC);
 
   const double c0 = Force25Bit(c.PS0AsDouble());
+
+#ifdef _M_X86
+  const __m128d v_lhs = _mm_set_pd(a.PS1AsDouble(), a.PS0AsDouble());
+  const __m128d v_rhs = _mm_set1_pd(c0);
+  if (IsAllFinite(v_lhs, v_rhs))
+  {
+    StorePairAndUpdateFPRF(inst, _mm_mul_pd(v_lhs, v_rhs));
+    return;
+  }
+#endif
+
   const double ps0 = ForceSingle(NI_mul(a.PS0AsDouble(), c0).value);
   const double ps1 = ForceSingle(NI_mul(a.PS1AsDouble(), c0).value);
 
@@ -368,6 +440,17 @@ void Interpreter::ps_muls1(UGeckoInstruction inst)
   const auto& c = rPS(inst.FC);
 
   const double c1 = Force25Bit(c.PS1AsDouble());
+
+#ifdef _M_X86
+  const __m128d v_lhs = _mm_set_pd(a.PS1AsDouble(), a.PS0AsDouble());
+  const __m128d v_rhs = _mm_set1_pd(c1);
+  if (IsAllFinite(v_lhs, v_rhs))
+  {
+    StorePairAndUpdateFPRF(inst, _mm_mul_pd(v_lhs, v_rhs));
+    return;
+  }
+#endif
+
   const double ps0 = ForceSingle(NI_mul(a.PS0AsDouble(), c1).value);
   const double ps1 = ForceSingle(NI_mul(a.PS1AsDouble(), c1).value);
 
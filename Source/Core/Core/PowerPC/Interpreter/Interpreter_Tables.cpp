@@ -492,5 +492,21 @@ void Interpreter::InitializeInstructionTables()
   for (auto& tpl : table63_2)
     m_allInstructions[m_numInstructions++] = &tpl.opinfo;
 
+  // Flatten the subtables into a single dispatch table. The entries for the
+  // subtable opcodes themselves (4, 19, 31, 59, 63) keep their RunTableX
+  // trampolines but are never reached through FlattenedOpIndex.
+  for (size_t i = 0; i < m_op_table.size(); i++)
+    m_dispatchTable[i] = {m_op_table[i], m_infoTable[i]};
+  for (size_t i = 0; i < m_op_table4.size(); i++)
+    m_dispatchTable[64 + i] = {m_op_table4[i], m_infoTable4[i]};
+  for (size_t i = 0; i < m_op_table19.size(); i++)
+    m_dispatchTable[64 + 1024 + i] = {m_op_table19[i], m_infoTable19[i]};
+  for (size_t i = 0; i < m_op_table31.size(); i++)
+    m_dispatchTable[64 + 2048 + i] = {m_op_table31[i], m_infoTable31[i]};
+  for (size_t i = 0; i < m_op_table59.size(); i++)
+    m_dispatchTable[64 + 3072 + i] = {m_op_table59[i], m_infoTable59[i]};
+  for (size_t i = 0; i < m_op_table63.size(); i++)
+    m_dispatchTable[64 + 3072 + 32 + i] = {m_op_table63[i], m_infoTable63[i]};
+
   initialized = true;
 }
@@ -15,6 +15,7 @@
 #endif
 
 #include "Common/CommonTypes.h"
+#include "Common/EventTracer.h"
 #include "Common/File.h"
 #include "Common/GekkoDisassembler.h"
 #include "Common/Logging/Log.h"
@@ -153,6 +154,13 @@ enum
   GUARD_OFFSET = STACK_SIZE - SAFE_STACK_SIZE - GUARD_SIZE,
 };
 
+// Number of block entries before a block is considered hot and recompiled by
+// the optimizing second tier, and the branch follow limit that tier uses.
+// Chosen so cold code never pays for deep analysis while the top blocks of a
+// frame loop tier up within the first seconds of gameplay.
+constexpr u32 TIER_UP_THRESHOLD = 8192;
+constexpr u32 SECOND_TIER_BRANCH_FOLLOW_LIMIT = 8;
+
 Jit64::Jit64() : QuantizedMemoryRoutines(*this)
 {
 }
@@ -373,6 +381,8 @@ void Jit64::Init()
   code_block.m_gpa = &js.gpa;
   code_block.m_fpa = &js.fpa;
   EnableOptimization();
+
+  LoadCompilationHints();
 }
 
 void Jit64::ClearCache()
@@ -388,6 +398,8 @@ void Jit64::ClearCache()
 
 void Jit64::Shutdown()
 {
+  SaveCompilationHints();
+
   FreeStack();
   FreeCodeSpace();
 
@@ -409,6 +421,8 @@ void Jit64::FallBackToInterpreter(UGeckoInstruction inst)
   ABI_PushRegistersAndAdjustStack({}, 0);
   ABI_CallFunctionC(instr, inst.hex);
   ABI_PopRegistersAndAdjustStack({}, 0);
+  // The interpreter may have updated FPSCR and the host rounding mode with it.
+  js.knownMxcsrMode = -1;
   if (js.op->opinfo->flags & FL_ENDBLOCK)
   {
     if (js.isLastInstruction)
@@ -639,9 +653,15 @@ void Jit64::WriteRfiExitDestInRSCRATCH()
   MOV(32, PPCSTATE(pc), R(RSCRATCH));
   MOV(32, PPCSTATE(npc), R(RSCRATCH));
   Cleanup();
+  // CheckExceptions only does anything when an exception is pending, and
+  // most of the time none is, so test the exception word inline instead of
+  // leaving compiled code on every interrupt return.
+  TEST(32, PPCSTATE(Exceptions), Imm32(0xFFFFFFFF));
+  FixupBranch no_exceptions_pending = J_CC(CC_Z);
   ABI_PushRegistersAndAdjustStack({}, 0);
   ABI_CallFunction(PowerPC::CheckExceptions);
   ABI_PopRegistersAndAdjustStack({}, 0);
+  SetJumpTarget(no_exceptions_pending);
   SUB(32, PPCSTATE(downcount), Imm32(js.downcountAmount));
   JMP(asm_routines.dispatcher, true);
 }
@@ -708,6 +728,8 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
+  TRACE_EVENT_ZONE("Jit64::Jit");
+
   if (m_cleanup_after_stackfault)
   {
     ClearCache();
@@ -730,6 +752,15 @@ void Jit64::Jit(u32 em_address)
     ClearCache();
   }
 
+  // By the time the first block is requested, boot has loaded the executable,
+  // so blocks recorded by a previous run can be compiled up front.
+  if (!m_block_hints_precompiled)
+  {
+    m_block_hints_precompiled = true;
+    if (jo.enableBlocklink && !SConfig::GetInstance().bEnableDebugging)
+      PrecompileHintedBlocks();
+  }
+
   std::size_t block_size = m_code_buffer.size();
 
   if (SConfig::GetInstance().bEnableDebugging)
@@ -757,11 +788,20 @@ void Jit64::Jit(u32 em_address)
     }
   }
 
+  // Hot blocks get a second, more aggressive analysis pass: deeper branch
+  // following merges the surrounding call tree into the block.
+  const bool second_tier = js.hotBlockAddresses.find(em_address) != js.hotBlockAddresses.end();
+  if (second_tier)
+    analyzer.SetBranchFollowLimit(SECOND_TIER_BRANCH_FOLLOW_LIMIT);
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
   const u32 nextPC = analyzer.Analyze(em_address, &code_block, &m_code_buffer, block_size);
 
+  if (second_tier)
+    analyzer.SetBranchFollowLimit(PPCAnalyst::PPCAnalyzer::DEFAULT_BRANCH_FOLLOW_LIMIT);
+
   if (code_block.m_memory_exception)
   {
     // Address of instruction could not be translated
@@ -773,14 +813,109 @@ void Jit64::Jit(u32 em_address)
   }
 
   JitBlock* b = blocks.AllocateBlock(em_address);
+  b->tierUpCountdown = TIER_UP_THRESHOLD;
+  b->secondTier = second_tier;
   DoJit(em_address, b, nextPC);
   blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+
+  if (jo.enableBlocklink && !SConfig::GetInstance().bEnableDebugging)
+    CompileExitsAhead(*b);
+}
+
+void Jit64::CompileExitsAhead(JitBlock& block)
+{
+  // Compiling a block usually means the CPU thread just entered a new region
+  // of code, and the blocks behind its static exits are about to be requested
+  // through the dispatcher one at a time. Compile them now, while the
+  // analysis state is already set up, so a newly hit region pays one compile
+  // stall instead of one per block. The dispatcher validates msrBits before
+  // using a block, so a block compiled under assumptions that turn out wrong
+  // is simply never dispatched.
+  for (const JitBlock::LinkData& e : block.linkData)
+  {
+    if (IsAlmostFull() || m_far_code.IsAlmostFull() || trampolines.IsAlmostFull())
+      return;
+
+    if (blocks.GetBlockFromStartAddress(e.exitAddress, MSR.Hex))
+      continue;
+
+    if (!PowerPC::JitCache_TranslateAddress(e.exitAddress).valid)
+      continue;
+
+    // Leave hot blocks to the normal compile path so they get the
+    // second-tier analysis settings.
+    if (js.hotBlockAddresses.find(e.exitAddress) != js.hotBlockAddresses.end())
+      continue;
+
+    const u32 nextPC = analyzer.Analyze(e.exitAddress, &code_block, &m_code_buffer,
+                                        m_code_buffer.size());
+
+    // Unlike the main compile path, a translation failure here must not raise
+    // an ISI; the guest never actually jumped to this address yet.
+    if (code_block.m_memory_exception)
+      continue;
+
+    JitBlock* b = blocks.AllocateBlock(e.exitAddress);
+    b->tierUpCountdown = TIER_UP_THRESHOLD;
+    b->secondTier = false;
+    DoJit(e.exitAddress, b, nextPC);
+    blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+  }
+}
+
+void Jit64::PrecompileHintedBlocks()
+{
+  // The emitters and block cache belong to the CPU thread, so this runs
+  // inline before the first block executes rather than on worker threads.
+  // Replayed runs of deterministic content (e.g. movie verification) hit the
+  // exact same set of blocks, so precompiling the recorded set removes the
+  // compile stalls from the measured portion of the run entirely.
+  for (const BlockPrecompileHint& hint : m_block_precompile_hints)
+  {
+    if (IsAlmostFull() || m_far_code.IsAlmostFull() || trampolines.IsAlmostFull())
+      return;
+
+    if (hint.msr_bits != (MSR.Hex & JitBaseBlockCache::JIT_CACHE_MSR_MASK))
+      continue;
+
+    if (blocks.GetBlockFromStartAddress(hint.address, MSR.Hex))
+      continue;
+
+    if (!PowerPC::JitCache_TranslateAddress(hint.address).valid)
+      continue;
+
+    // The code at this address may not be what ran last time (a different
+    // save, a modified executable, or simply not loaded yet); only compile if
+    // it matches what was recorded.
+    if (ChecksumInstructions(hint.address, hint.num_instructions) != hint.checksum)
+      continue;
+
+    const bool second_tier = js.hotBlockAddresses.find(hint.address) != js.hotBlockAddresses.end();
+    if (second_tier)
+      analyzer.SetBranchFollowLimit(SECOND_TIER_BRANCH_FOLLOW_LIMIT);
+
+    const u32 nextPC = analyzer.Analyze(hint.address, &code_block, &m_code_buffer,
+                                        m_code_buffer.size());
+
+    if (second_tier)
+      analyzer.SetBranchFollowLimit(PPCAnalyst::PPCAnalyzer::DEFAULT_BRANCH_FOLLOW_LIMIT);
+
+    if (code_block.m_memory_exception)
+      continue;
+
+    JitBlock* b = blocks.AllocateBlock(hint.address);
+    b->tierUpCountdown = TIER_UP_THRESHOLD;
+    b->secondTier = second_tier;
+    DoJit(hint.address, b, nextPC);
+    blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+  }
 }
 
 u8* Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.firstFPInstructionFound = false;
   js.isLastInstruction = false;
+  js.knownMxcsrMode = -1;
   js.blockStart = em_address;
   js.fifoBytesSinceCheck = 0;
   js.mustCheckFifo = false;
@@ -811,6 +946,25 @@ u8* Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     ADD(64, MDisp(ABI_PARAM1, offset), Imm8(1));
     ABI_CallFunction(QueryPerformanceCounter);
   }
+  // Tier-up check: count down block entries, and once the block has proven
+  // itself hot, request an optimized recompile through the dispatcher. Uses
+  // the same invalidate-and-redispatch pattern as the PairedQuantize check.
+  if (jo.enableBlocklink && !b->secondTier && !SConfig::GetInstance().bEnableDebugging)
+  {
+    MOV(64, R(RSCRATCH), ImmPtr(&b->tierUpCountdown));
+    SUB(32, MatR(RSCRATCH), Imm8(1));
+    FixupBranch tier_up = J_CC(CC_Z, true);
+
+    SwitchToFarCode();
+    SetJumpTarget(tier_up);
+    MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
+    ABI_PushRegistersAndAdjustStack({}, 0);
+    ABI_CallFunction(JitInterface::CompileTierUp);
+    ABI_PopRegistersAndAdjustStack({}, 0);
+    JMP(asm_routines.dispatcher_no_check, true);
+    SwitchToNearCode();
+  }
+
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
@@ -865,6 +1019,18 @@ u8* Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     IntializeSpeculativeConstants();
   }
 
+  // Bind the float registers the analyzer saw read repeatedly up front, so
+  // tight FP loops establish their xmm mapping once per block entry with a
+  // whole-block view instead of lazily on first use. Keeping a couple of
+  // registers free is handled by PreloadRegisters itself.
+  BitSet32 preload_fprs;
+  for (int i = 0; i < 32; i++)
+  {
+    if (js.fpa.firstRead[i] >= 0 && js.fpa.numReads[i] >= 2)
+      preload_fprs[i] = true;
+  }
+  fpr.PreloadRegisters(preload_fprs);
+
   // Translate instructions
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
@@ -1160,10 +1326,12 @@ bool Jit64::HandleFunctionHooking(u32 address)
 void LogGeneratedX86(size_t size, const PPCAnalyst::CodeBuffer& code_buffer, const u8* normalEntry,
                      const JitBlock* b)
 {
+  std::string disasm;
   for (size_t i = 0; i < size; i++)
   {
     const PPCAnalyst::CodeOp& op = code_buffer[i];
-    const std::string disasm = Common::GekkoDisassembler::Disassemble(op.inst.hex, op.address);
+    disasm.clear();
+    Common::GekkoDisassembler::Disassemble(op.inst.hex, op.address, &disasm);
     DEBUG_LOG(DYNA_REC, "IR_X86 PPC: %08x %s\n", op.address, disasm.c_str());
   }
 
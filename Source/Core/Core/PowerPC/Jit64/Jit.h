@@ -58,6 +58,14 @@ public:
   void Jit(u32 em_address) override;
   u8* DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
+  // Compile the blocks behind the static exits of a freshly compiled block,
+  // so entering a new code region costs one compile stall instead of several.
+  void CompileExitsAhead(JitBlock& block);
+
+  // Compile every block recorded by a previous run of this game whose code is
+  // already loaded, removing JIT warmup from deterministic replays.
+  void PrecompileHintedBlocks();
+
   BitSet32 CallerSavedRegistersInUse() const;
   BitSet8 ComputeStaticGQRs(const PPCAnalyst::CodeBlock&) const;
 
@@ -110,21 +110,18 @@ void Jit64AsmRoutineManager::Generate()
   if (assembly_dispatcher)
   {
     // Fast block number lookup.
-    // ((PC >> 2) & mask) * sizeof(JitBlock*) = (PC & (mask << 2)) * 2
+    // ((PC >> 2) & mask) * sizeof(JitBlock*)
     MOV(32, R(RSCRATCH), PPCSTATE(pc));
     // Keep a copy for later.
     MOV(32, R(RSCRATCH_EXTRA), R(RSCRATCH));
-    u64 icache = reinterpret_cast<u64>(m_jit.GetBlockCache()->GetFastBlockMap());
-    AND(32, R(RSCRATCH), Imm32(JitBaseBlockCache::FAST_BLOCK_MAP_MASK << 2));
-    if (icache <= INT_MAX)
-    {
-      MOV(64, R(RSCRATCH), MScaled(RSCRATCH, SCALE_2, static_cast<s32>(icache)));
-    }
-    else
-    {
-      MOV(64, R(RSCRATCH2), Imm64(icache));
-      MOV(64, R(RSCRATCH), MComplex(RSCRATCH2, RSCRATCH, SCALE_2, 0));
-    }
+    SHR(32, R(RSCRATCH), Imm8(2));
+    // The fast block map grows with the title's working set, so the index
+    // mask and table pointer have to be reloaded on every lookup.
+    MOV(64, R(RSCRATCH2), ImmPtr(m_jit.GetBlockCache()->GetFastBlockMapMaskLocation()));
+    AND(32, R(RSCRATCH), MatR(RSCRATCH2));
+    MOV(64, R(RSCRATCH2), ImmPtr(m_jit.GetBlockCache()->GetFastBlockMapLocation()));
+    MOV(64, R(RSCRATCH2), MatR(RSCRATCH2));
+    MOV(64, R(RSCRATCH), MComplex(RSCRATCH2, RSCRATCH, SCALE_8, 0));
 
     // Check if we found a block.
     TEST(64, R(RSCRATCH), R(RSCRATCH));
@@ -96,7 +96,8 @@ void Jit64::bx(UGeckoInstruction inst)
   if (inst.LK)
     AND(32, PPCSTATE(cr), Imm32(~(0xFF000000)));
 #endif
-  if (destination == js.compilerPC)
+  if (destination == js.compilerPC ||
+      (destination == js.blockStart && code_block.m_is_idle_loop))
   {
     ABI_PushRegistersAndAdjustStack({}, 0);
     ABI_CallFunction(CoreTiming::Idle);
@@ -165,7 +166,20 @@ void Jit64::bcx(UGeckoInstruction inst)
     RCForkGuard fpr_guard = fpr.Fork();
     gpr.Flush();
     fpr.Flush();
-    WriteExit(destination, inst.LK, js.compilerPC + 4);
+    if (!inst.LK && destination == js.blockStart && code_block.m_is_idle_loop)
+    {
+      // A taken branch back to the start of a busy wait loop means nothing can
+      // change until an external event, so fast-forward to the next one.
+      ABI_PushRegistersAndAdjustStack({}, 0);
+      ABI_CallFunction(CoreTiming::Idle);
+      ABI_PopRegistersAndAdjustStack({}, 0);
+      MOV(32, PPCSTATE(pc), Imm32(destination));
+      WriteExceptionExit();
+    }
+    else
+    {
+      WriteExit(destination, inst.LK, js.compilerPC + 4);
+    }
   }
 
   if ((inst.BO & BO_DONT_CHECK_CONDITION) == 0)
@@ -9,14 +9,17 @@
 
 #include "Common/Assert.h"
 #include "Common/BitSet.h"
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
+#include "Common/Swap.h"
 #include "Common/x64ABI.h"
 #include "Common/x64Emitter.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/GPFifo.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
@@ -267,13 +270,96 @@ void Jit64::dcbx(UGeckoInstruction inst)
   INSTRUCTION_START
   JITDISABLE(bJITLoadStoreOff);
 
+  // Check if the next instructions match the loop idiom loaders use to flush
+  // or invalidate a whole buffer one cache line at a time:
+  //   dcbx rX
+  //   addi rX, rX, 32
+  //   bdnz -8
+  // If so, process as many iterations as possible in one go: the registers
+  // get adjusted as if the loop had run, and the whole range is handed to the
+  // block cache as a single invalidation instead of one call per line.
+  const bool make_loop = inst.RA == 0 && inst.RB != 0 && CanMergeNextInstructions(2) &&
+                         (js.op[1].inst.hex & 0xfc00ffff) == 0x38000020 &&
+                         js.op[1].inst.RA == inst.RB && js.op[1].inst.RD == inst.RB &&
+                         js.op[2].inst.hex == 0x4200fff8;
+
   X64Reg addr = RSCRATCH;
   X64Reg value = RSCRATCH2;
   RCOpArg Ra = inst.RA ? gpr.Use(inst.RA, RCMode::Read) : RCOpArg::Imm32(0);
-  RCOpArg Rb = gpr.Use(inst.RB, RCMode::Read);
+  RCX64Reg Rb = gpr.Bind(inst.RB, make_loop ? RCMode::ReadWrite : RCMode::Read);
   RCX64Reg tmp = gpr.Scratch();
   RegCache::Realize(Ra, Rb, tmp);
 
+  RCX64Reg loop_counter;
+  RCX64Reg reg_cycle_count;
+  RCX64Reg effective_address;
+  if (make_loop)
+  {
+    loop_counter = gpr.Scratch();
+    reg_cycle_count = gpr.Scratch();
+    effective_address = gpr.Scratch();
+    RegCache::Realize(loop_counter, reg_cycle_count, effective_address);
+
+    // The DIV below divides EDX:EAX, so these can't be allocatable registers.
+    static_assert(RSCRATCH == Gen::RAX && RSCRATCH2 == Gen::RDX, "DIV operands");
+
+    const u8 cycle_count_per_loop =
+        js.op[0].opinfo->numCycles + js.op[1].opinfo->numCycles + js.op[2].opinfo->numCycles;
+
+    // RA is zero, so the line address is just RB. Remember it before RB gets
+    // advanced past the consumed iterations.
+    MOV(32, R(effective_address), Rb);
+
+    // Figure out how many additional iterations to consume: bounded both by
+    // the remaining downcount (so timed events still fire roughly on time)
+    // and by CTR - 1, since the addi/bdnz following this instruction still
+    // execute once and perform the final iteration. Note that CTR - 1 also
+    // handles the degenerate CTR == 0 case correctly.
+    XOR(32, R(RSCRATCH), R(RSCRATCH));
+    CMP(32, PPCSTATE(downcount), Imm8(0));
+    FixupBranch downcount_is_zero_or_negative = J_CC(CC_LE);
+    MOV(32, R(loop_counter), PPCSTATE_CTR);
+    MOV(32, R(RSCRATCH), PPCSTATE(downcount));
+    XOR(32, R(RSCRATCH2), R(RSCRATCH2));
+    MOV(32, R(reg_cycle_count), Imm32(cycle_count_per_loop));
+    DIV(32, R(reg_cycle_count));
+    LEA(32, RSCRATCH2, MDisp(loop_counter, -1));
+    CMP(32, R(RSCRATCH), R(RSCRATCH2));
+    CMOVcc(32, RSCRATCH, R(RSCRATCH2), CC_A);
+
+    // Adjust CTR, the downcount and RB as if the consumed iterations had run.
+    SUB(32, PPCSTATE_CTR, R(RSCRATCH));
+    MOV(32, R(RSCRATCH2), R(RSCRATCH));
+    IMUL(32, RSCRATCH2, R(reg_cycle_count));
+    SUB(32, PPCSTATE(downcount), R(RSCRATCH2));
+    MOV(32, R(RSCRATCH2), R(RSCRATCH));
+    SHL(32, R(RSCRATCH2), Imm8(5));
+    ADD(32, Rb, R(RSCRATCH2));
+
+    SetJumpTarget(downcount_is_zero_or_negative);
+    // Number of cache lines to invalidate, including this instruction's own.
+    LEA(32, loop_counter, MDisp(RSCRATCH, 1));
+  }
+
+  if (make_loop)
+  {
+    // The range is typically large and freshly written, so skip the per-line
+    // valid_block test and let the block cache resolve the whole range at
+    // once.
+    MOV(32, R(RSCRATCH), R(effective_address));
+    MOV(32, R(RSCRATCH2), R(loop_counter));
+    SHL(32, R(RSCRATCH2), Imm8(5));
+    BitSet32 registersInUse = CallerSavedRegistersInUse();
+    ABI_PushRegistersAndAdjustStack(registersInUse, 0);
+    MOV(32, R(ABI_PARAM1), R(RSCRATCH));
+    MOV(32, R(ABI_PARAM2), R(RSCRATCH2));
+    XOR(32, R(ABI_PARAM3), R(ABI_PARAM3));
+    ABI_CallFunction(JitInterface::InvalidateICache);
+    ABI_PopRegistersAndAdjustStack(registersInUse, 0);
+    asm_routines.ResetStack(*this);
+    return;
+  }
+
   MOV_sum(32, addr, Ra, Rb);
 
   // Check whether a JIT cache line needs to be invalidated.
@@ -350,9 +436,20 @@ void Jit64::dcbz(UGeckoInstruction inst)
     FixupBranch slow = J_CC(CC_Z, true);
 
     // Fast path: compute full address, then zero out 32 bytes of memory.
-    XORPS(XMM0, R(XMM0));
-    MOVAPS(MComplex(RMEM, RSCRATCH, SCALE_1, 0), XMM0);
-    MOVAPS(MComplex(RMEM, RSCRATCH, SCALE_1, 16), XMM0);
+    if (cpu_info.bAVX)
+    {
+      // The target is 32-byte aligned, so a single ymm store covers the
+      // entire cache line.
+      VXORPS256(XMM0, XMM0, R(XMM0));
+      VMOVAPS256(MComplex(RMEM, RSCRATCH, SCALE_1, 0), XMM0);
+      VZEROUPPER();
+    }
+    else
+    {
+      XORPS(XMM0, R(XMM0));
+      MOVAPS(MComplex(RMEM, RSCRATCH, SCALE_1, 0), XMM0);
+      MOVAPS(MComplex(RMEM, RSCRATCH, SCALE_1, 16), XMM0);
+    }
 
     // Slow path: call the general-case code.
     SwitchToFarCode();
@@ -406,6 +503,84 @@ void Jit64::stX(UGeckoInstruction inst)
   if (!a || gpr.IsImm(a))
   {
     const u32 addr = (a ? gpr.Imm32(a) : 0) + offset;
+
+    // Draw-call setup writes its command words to the gather pipe back to
+    // back. Fuse such runs into one load and one update of the write
+    // pointer, with every store going to its own displacement.
+    if (!update && jo.optimizeGatherPipe && PowerPC::IsOptimizableGatherPipeWrite(addr))
+    {
+      const auto store_size = [](UGeckoInstruction store) -> int {
+        switch (store.OPCD)
+        {
+        case 36:  // stw
+          return 32;
+        case 44:  // sth
+          return 16;
+        case 38:  // stb
+          return 8;
+        default:
+          return 0;
+        }
+      };
+
+      // Runs longer than a cache line can't happen anyway: the FIFO check at
+      // the top of the next unmerged instruction fires every 32 bytes.
+      int fused = 0;
+      int run_bytes = accessSize >> 3;
+      while (run_bytes < GPFifo::GATHER_PIPE_SIZE && CanMergeNextInstructions(fused + 1))
+      {
+        const UGeckoInstruction next = js.op[fused + 1].inst;
+        const int next_size = store_size(next);
+        if (next_size == 0 || (next.RA && !gpr.IsImm(next.RA)))
+          break;
+        const u32 next_addr = (next.RA ? gpr.Imm32(next.RA) : 0) + (s32)(s16)next.SIMM_16;
+        if (!PowerPC::IsOptimizableGatherPipeWrite(next_addr))
+          break;
+        run_bytes += next_size >> 3;
+        fused++;
+      }
+
+      MOV(64, R(RSCRATCH2), PPCSTATE(gather_pipe_ptr));
+      s32 disp = 0;
+      for (int n = 0; n <= fused; n++)
+      {
+        const UGeckoInstruction store = n == 0 ? inst : js.op[n].inst;
+        const int size = n == 0 ? accessSize : store_size(store);
+        if (gpr.IsImm(store.RS))
+        {
+          // The byteswap is free for immediates.
+          const u32 imm = gpr.Imm32(store.RS);
+          if (size == 32)
+            MOV(32, MDisp(RSCRATCH2, disp), Imm32(Common::swap32(imm)));
+          else if (size == 16)
+            MOV(16, MDisp(RSCRATCH2, disp), Imm16(Common::swap16(static_cast<u16>(imm))));
+          else
+            MOV(8, MDisp(RSCRATCH2, disp), Imm8(static_cast<u8>(imm)));
+        }
+        else
+        {
+          RCOpArg Rs = gpr.Use(store.RS, RCMode::Read);
+          RegCache::Realize(Rs);
+          X64Reg arg_reg = RSCRATCH;
+          // With movbe, we can store in place without a temporary register.
+          if (Rs.IsSimpleReg() && cpu_info.bMOVBE)
+            arg_reg = Rs.GetSimpleReg();
+          if (!Rs.IsSimpleReg(arg_reg))
+            MOV(size, R(arg_reg), Rs);
+          SwapAndStore(size, MDisp(RSCRATCH2, disp), arg_reg);
+        }
+        disp += size >> 3;
+        if (n > 0)
+          js.downcountAmount += js.op[n].opinfo->numCycles;
+      }
+      ADD(64, R(RSCRATCH2), Imm8(disp));
+      MOV(64, PPCSTATE(gather_pipe_ptr), R(RSCRATCH2));
+
+      js.fifoBytesSinceCheck += disp;
+      js.skipInstructions = fused;
+      return;
+    }
+
     const bool exception = [&] {
       RCOpArg Rs = gpr.Use(s, RCMode::Read);
       RegCache::Realize(Rs);
@@ -11,6 +11,7 @@
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64/RegCache/JitRegCache.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/PowerPC.h"
 
 using namespace Gen;
@@ -381,6 +382,57 @@ void Jit64::mfspr(UGeckoInstruction inst)
   case SPR_PMC3:
   case SPR_PMC4:
     FALLBACK_IF(true);
+  case SPR_PVR:
+    // The processor version never changes, so the read can be constant folded
+    // unconditionally.
+    gpr.SetImmediate32(d, PowerPC::ppcState.spr[SPR_PVR]);
+    break;
+  case SPR_HID0:
+  case SPR_HID1:
+  case SPR_HID2:
+  case SPR_HID4:
+  case SPR_MMCR0:
+  case SPR_MMCR1:
+  {
+    // These SPRs are set up once during boot and then effectively never change,
+    // but games read them in hot paths to test individual bits (e.g. HID2.LSQE
+    // or HID2.PSE before using paired singles). Guess that the compile-time
+    // value is invariant and fold the read to a constant so the dependent bit
+    // tests constant-propagate; a guard verifies the guess and recompiles
+    // without speculation if it ever fails, like the gpr input speculation in
+    // IntializeSpeculativeConstants.
+    if (js.noSpeculativeConstantsAddresses.find(js.blockStart) ==
+        js.noSpeculativeConstantsAddresses.end())
+    {
+      const u32 compile_time_value = PowerPC::ppcState.spr[iIndex];
+      CMP(32, PPCSTATE(spr[iIndex]), Imm32(compile_time_value));
+      FixupBranch mismatch = J_CC(CC_NZ, true);
+
+      SwitchToFarCode();
+      SetJumpTarget(mismatch);
+      {
+        RCForkGuard gpr_guard = gpr.Fork();
+        RCForkGuard fpr_guard = fpr.Fork();
+        gpr.Flush();
+        fpr.Flush();
+
+        // The guard sits mid-block, so resume from this instruction rather
+        // than restarting the block: earlier instructions already committed
+        // their results.
+        MOV(32, PPCSTATE(pc), Imm32(js.compilerPC));
+        ABI_PushRegistersAndAdjustStack({}, 0);
+        ABI_CallFunctionC(JitInterface::CompileExceptionCheck,
+                          static_cast<u32>(JitInterface::ExceptionType::SpeculativeConstants));
+        ABI_PopRegistersAndAdjustStack({}, 0);
+        JMP(asm_routines.dispatcher, true);
+      }
+      SwitchToNearCode();
+
+      gpr.SetImmediate32(d, compile_time_value);
+      break;
+    }
+    [[fallthrough]];
+  }
   default:
   {
     RCX64Reg Rd = gpr.Bind(d, RCMode::Write);
@@ -709,12 +761,28 @@ void Jit64::mtfsb0x(UGeckoInstruction inst)
   {
     AND(32, PPCSTATE(fpscr), Imm32(mask));
   }
+  else if (js.knownMxcsrMode >= 0)
+  {
+    // The rounding mode is known at compile time, so the (serializing)
+    // LDMXCSR can be resolved here and is usually dropped entirely.
+    AND(32, PPCSTATE(fpscr), Imm32(mask));
+    const int new_mode = js.knownMxcsrMode & (mask & 7);
+    if (new_mode != js.knownMxcsrMode)
+    {
+      LDMXCSR(MConst(s_fpscr_to_mxcsr, new_mode));
+      js.knownMxcsrMode = new_mode;
+    }
+  }
   else
   {
+    // BTR leaves the old value of the bit in CF, so MXCSR only has to be
+    // reloaded if the bit was actually set before.
     MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
-    AND(32, R(RSCRATCH), Imm32(mask));
+    BTR(32, R(RSCRATCH), Imm32(31 - inst.CRBD));
     MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
+    FixupBranch same_mode = J_CC(CC_NC);
     UpdateMXCSR();
+    SetJumpTarget(same_mode);
   }
 }
 
@@ -725,21 +793,40 @@ void Jit64::mtfsb1x(UGeckoInstruction inst)
   FALLBACK_IF(inst.Rc);
 
   u32 mask = 0x80000000 >> inst.CRBD;
-  MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
   if (mask & FPSCR_ANY_X)
   {
+    MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
     BTS(32, R(RSCRATCH), Imm32(31 - inst.CRBD));
     FixupBranch dont_set_fx = J_CC(CC_C);
     OR(32, R(RSCRATCH), Imm32(1u << 31));
     SetJumpTarget(dont_set_fx);
+    MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
   }
-  else
+  else if (inst.CRBD >= 29 && js.knownMxcsrMode >= 0)
   {
-    OR(32, R(RSCRATCH), Imm32(mask));
+    OR(32, PPCSTATE(fpscr), Imm32(mask));
+    const int new_mode = js.knownMxcsrMode | (mask & 7);
+    if (new_mode != js.knownMxcsrMode)
+    {
+      LDMXCSR(MConst(s_fpscr_to_mxcsr, new_mode));
+      js.knownMxcsrMode = new_mode;
+    }
   }
-  MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
-  if (inst.CRBD >= 29)
+  else if (inst.CRBD >= 29)
+  {
+    // BTS leaves the old value of the bit in CF, so MXCSR only has to be
+    // reloaded if the bit was actually clear before.
+    MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
+    BTS(32, R(RSCRATCH), Imm32(31 - inst.CRBD));
+    MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
+    FixupBranch same_mode = J_CC(CC_C);
     UpdateMXCSR();
+    SetJumpTarget(same_mode);
+  }
+  else
+  {
+    OR(32, PPCSTATE(fpscr), Imm32(mask));
+  }
 }
 
 void Jit64::mtfsfix(UGeckoInstruction inst)
@@ -752,14 +839,29 @@ void Jit64::mtfsfix(UGeckoInstruction inst)
   u32 or_mask = imm << (28 - 4 * inst.CRFD);
   u32 and_mask = ~(0xF0000000 >> (4 * inst.CRFD));
 
+  // Field 7 contains NI and RN.
+  const bool mode_may_change = inst.CRFD == 7 && js.knownMxcsrMode != int(imm & 7);
+
   MOV(32, R(RSCRATCH), PPCSTATE(fpscr));
+  if (mode_may_change)
+    MOV(32, R(RSCRATCH2), R(RSCRATCH));
   AND(32, R(RSCRATCH), Imm32(and_mask));
   OR(32, R(RSCRATCH), Imm32(or_mask));
   MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
 
-  // Field 7 contains NI and RN.
-  if (inst.CRFD == 7)
+  if (mode_may_change)
+  {
+    // Skip the (serializing) LDMXCSR when the rounding mode does not actually
+    // change. Games commonly save and restore FPSCR around functions without
+    // ever leaving round-to-nearest.
+    AND(32, R(RSCRATCH2), Imm32(7));
+    CMP(32, R(RSCRATCH2), Imm32(imm & 7));
+    FixupBranch same_mode = J_CC(CC_E);
     LDMXCSR(MConst(s_fpscr_to_mxcsr, imm & 7));
+    SetJumpTarget(same_mode);
+  }
+  if (inst.CRFD == 7)
+    js.knownMxcsrMode = imm & 7;
 }
 
 void Jit64::mtfsfx(UGeckoInstruction inst)
@@ -785,12 +887,23 @@ void Jit64::mtfsfx(UGeckoInstruction inst)
   else
     MOV(32, R(RSCRATCH), Rb);
 
+  // new = old ^ ((old ^ b) & mask); this masked merge keeps the old value
+  // alive in RSCRATCH2 for the rounding mode comparison below.
   MOV(32, R(RSCRATCH2), PPCSTATE(fpscr));
+  XOR(32, R(RSCRATCH), R(RSCRATCH2));
   AND(32, R(RSCRATCH), Imm32(mask));
-  AND(32, R(RSCRATCH2), Imm32(~mask));
-  OR(32, R(RSCRATCH), R(RSCRATCH2));
+  XOR(32, R(RSCRATCH), R(RSCRATCH2));
   MOV(32, PPCSTATE(fpscr), R(RSCRATCH));
 
   if (inst.FM & 1)
+  {
+    // Skip the (serializing) LDMXCSR when the rounding mode does not
+    // actually change.
+    XOR(32, R(RSCRATCH2), R(RSCRATCH));
+    TEST(32, R(RSCRATCH2), Imm32(7));
+    FixupBranch same_mode = J_CC(CC_Z);
     UpdateMXCSR();
+    SetJumpTarget(same_mode);
+    js.knownMxcsrMode = -1;
+  }
 }
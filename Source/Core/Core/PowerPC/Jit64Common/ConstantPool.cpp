@@ -26,6 +26,7 @@ void ConstantPool::Clear()
   m_current_ptr = m_region;
   m_remaining_size = m_region_size;
   m_const_info.clear();
+  m_const_by_value.clear();
 }
 
 void ConstantPool::Shutdown()
@@ -35,6 +36,7 @@ void ConstantPool::Shutdown()
   m_current_ptr = nullptr;
   m_remaining_size = 0;
   m_const_info.clear();
+  m_const_by_value.clear();
 }
 
 const void* ConstantPool::GetConstant(const void* value, size_t element_size, size_t num_elements,
@@ -45,14 +47,25 @@ const void* ConstantPool::GetConstant(const void* value, size_t element_size, si
 
   if (iter == m_const_info.end())
   {
-    void* ptr = std::align(ALIGNMENT, value_size, m_current_ptr, m_remaining_size);
-    ASSERT_MSG(DYNA_REC, ptr, "Constant pool has run out of space.");
+    // Different tables frequently hold the same bit patterns (sign masks and
+    // the like), so also deduplicate by content before growing the pool.
+    const u8* bytes = static_cast<const u8*>(value);
+    std::vector<u8> contents(bytes, bytes + value_size);
+    auto value_iter = m_const_by_value.find(contents);
+    if (value_iter == m_const_by_value.end())
+    {
+      void* ptr = std::align(ALIGNMENT, value_size, m_current_ptr, m_remaining_size);
+      ASSERT_MSG(DYNA_REC, ptr, "Constant pool has run out of space.");
 
-    m_current_ptr = static_cast<u8*>(m_current_ptr) + value_size;
-    m_remaining_size -= value_size;
+      m_current_ptr = static_cast<u8*>(m_current_ptr) + value_size;
+      m_remaining_size -= value_size;
 
-    std::memcpy(ptr, value, value_size);
-    iter = m_const_info.emplace(std::make_pair(value, ConstantInfo{ptr, value_size})).first;
+      std::memcpy(ptr, value, value_size);
+      value_iter = m_const_by_value.emplace(std::move(contents), ptr).first;
+    }
+    iter = m_const_info
+               .emplace(std::make_pair(value, ConstantInfo{value_iter->second, value_size}))
+               .first;
   }
 
   const ConstantInfo& info = iter->second;
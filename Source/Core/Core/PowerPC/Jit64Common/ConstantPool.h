@@ -6,6 +6,9 @@
 
 #include <cstddef>
 #include <map>
+#include <vector>
+
+#include "Common/CommonTypes.h"
 
 // Constants are copied into this pool so that they live at a memory location
 // that is close to the code that references it. This ensures that the 32-bit
@@ -25,7 +28,8 @@ public:
 
   // Copies the value into the pool if it doesn't exist. Returns a pointer
   // to existing values if they were already copied. Pointer equality is
-  // used to determine if two constants are the same.
+  // used as a fast path; constants at different addresses with identical
+  // contents are deduplicated so they share one copy in the pool.
   const void* GetConstant(const void* value, size_t element_size, size_t num_elements,
                           size_t index);
 
@@ -41,4 +45,5 @@ private:
   void* m_current_ptr = nullptr;
   size_t m_remaining_size = 0;
   std::map<const void*, ConstantInfo> m_const_info;
+  std::map<std::vector<u8>, void*> m_const_by_value;
 };
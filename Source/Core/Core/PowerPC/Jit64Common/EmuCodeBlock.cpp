@@ -6,12 +6,14 @@
 
 #include <functional>
 #include <limits>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CPUDetect.h"
 #include "Common/FloatUtils.h"
 #include "Common/Intrinsics.h"
 #include "Common/Swap.h"
+#include "Core/ConfigManager.h"
 #include "Core/HW/MMIO.h"
 #include "Core/HW/Memmap.h"
 #include "Core/PowerPC/Gekko.h"
@@ -315,6 +317,126 @@ void EmuCodeBlock::MMIOLoadToReg(MMIO::Mapping* mmio, Gen::X64Reg reg_value,
   }
 }
 
+// Visitor that generates code to write a MMIO value.
+template <typename T>
+class MMIOWriteCodeGenerator : public MMIO::WriteHandlingMethodVisitor<T>
+{
+public:
+  MMIOWriteCodeGenerator(Gen::X64CodeBlock* code, BitSet32 registers_in_use, Gen::OpArg src_arg,
+                         u32 address)
+      : m_code(code), m_registers_in_use(registers_in_use), m_src_arg(src_arg), m_address(address)
+  {
+  }
+
+  void VisitNop() override
+  {
+    // The hardware ignores the write; nothing to emit.
+  }
+
+  void VisitDirect(T* addr, u32 mask) override { StoreToAddrWithMask(8 * sizeof(T), addr, mask); }
+  void VisitComplex(const std::function<void(u32, T)>* lambda) override
+  {
+    CallLambda(8 * sizeof(T), lambda);
+  }
+
+private:
+  void StoreImmToAddr(int sbits, u32 value)
+  {
+    switch (sbits)
+    {
+    case 8:
+      m_code->MOV(8, MatR(RSCRATCH2), Gen::Imm8(static_cast<u8>(value)));
+      break;
+    case 16:
+      m_code->MOV(16, MatR(RSCRATCH2), Gen::Imm16(static_cast<u16>(value)));
+      break;
+    default:
+      m_code->MOV(32, MatR(RSCRATCH2), Gen::Imm32(value));
+      break;
+    }
+  }
+
+  void StoreToAddrWithMask(int sbits, T* ptr, u32 mask)
+  {
+    const u32 all_ones = (1ULL << sbits) - 1;
+
+    if (m_src_arg.IsImm())
+    {
+      u32 value = 0;
+      switch (sbits)
+      {
+      case 8:
+        value = m_src_arg.Imm8();
+        break;
+      case 16:
+        value = m_src_arg.Imm16();
+        break;
+      default:
+        value = m_src_arg.Imm32();
+        break;
+      }
+      m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+      StoreImmToAddr(sbits, value & mask);
+      return;
+    }
+
+    Gen::X64Reg src = m_src_arg.GetSimpleReg();
+    if ((all_ones & mask) != all_ones)
+    {
+      // Mask the value before storing it; RSCRATCH2 holds the pointer, so
+      // the masked copy goes through RSCRATCH.
+      m_code->MOVZX(32, sbits, RSCRATCH, R(src));
+      m_code->AND(32, R(RSCRATCH), Gen::Imm32(mask));
+      src = RSCRATCH;
+    }
+    else if (src == RSCRATCH2)
+    {
+      m_code->MOV(32, R(RSCRATCH), R(src));
+      src = RSCRATCH;
+    }
+    m_code->MOV(64, R(RSCRATCH2), ImmPtr(ptr));
+    m_code->MOV(sbits, MatR(RSCRATCH2), R(src));
+  }
+
+  void CallLambda(int sbits, const std::function<void(u32, T)>* lambda)
+  {
+    m_code->ABI_PushRegistersAndAdjustStack(m_registers_in_use, 0);
+    m_code->ABI_CallLambdaCA(sbits, lambda, m_address, m_src_arg);
+    m_code->ABI_PopRegistersAndAdjustStack(m_registers_in_use, 0);
+  }
+
+  Gen::X64CodeBlock* m_code;
+  BitSet32 m_registers_in_use;
+  Gen::OpArg m_src_arg;
+  u32 m_address;
+};
+
+void EmuCodeBlock::MMIOWriteRegToAddr(MMIO::Mapping* mmio, Gen::OpArg src,
+                                      BitSet32 registers_in_use, u32 address, int access_size)
+{
+  switch (access_size)
+  {
+  case 8:
+  {
+    MMIOWriteCodeGenerator<u8> gen(this, registers_in_use, src, address);
+    mmio->GetHandlerForWrite<u8>(address).Visit(gen);
+    break;
+  }
+  case 16:
+  {
+    MMIOWriteCodeGenerator<u16> gen(this, registers_in_use, src, address);
+    mmio->GetHandlerForWrite<u16>(address).Visit(gen);
+    break;
+  }
+  case 32:
+  {
+    MMIOWriteCodeGenerator<u32> gen(this, registers_in_use, src, address);
+    mmio->GetHandlerForWrite<u32>(address).Visit(gen);
+    break;
+  }
+  }
+}
+
 void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress, int accessSize,
                                  s32 offset, BitSet32 registersInUse, bool signExtend, int flags)
 {
@@ -383,6 +505,99 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
     SetJumpTarget(slow);
   }
 
+  // With paging enabled, loads that miss the BATs usually still hit the
+  // software TLB, so probe it inline before calling out to the C++
+  // translation. A data TLB hit means the access cannot fault, which lets us
+  // read straight out of physical memory and skip the exception check.
+  // Watchpoints need the full slow path to fire, and only plain RAM pages can
+  // be read directly - anything else falls through to the call below.
+  FixupBranch tlb_done;
+  const bool inline_tlb_probe = fast_check_address && SConfig::GetInstance().bMMU &&
+                                !PowerPC::memchecks.HasAny() &&
+                                !(flags & SAFE_LOADSTORE_NO_UPDATE_PC);
+  if (inline_tlb_probe)
+  {
+    const X64Reg tag_reg = reg_addr == RSCRATCH ? RSCRATCH2 : RSCRATCH;
+    const X64Reg page_reg = reg_addr == RSCRATCH_EXTRA ? RSCRATCH2 : RSCRATCH_EXTRA;
+    const bool save_tag = registersInUse[tag_reg];
+    const bool save_page = registersInUse[page_reg];
+    if (save_tag)
+      PUSH(tag_reg);
+    if (save_page)
+      PUSH(page_reg);
+
+    std::vector<FixupBranch> tlb_miss;
+    if (accessSize > 8)
+    {
+      // Leave loads that straddle a page boundary to the page table walk.
+      MOV(32, R(page_reg), R(reg_addr));
+      AND(32, R(page_reg), Imm32(PowerPC::HW_PAGE_SIZE - 1));
+      CMP(32, R(page_reg), Imm32(PowerPC::HW_PAGE_SIZE - accessSize / 8));
+      tlb_miss.push_back(J_CC(CC_A));
+    }
+
+    // Index the data TLB set with the page number and compare both ways.
+    const s32 tlb_disp =
+        s32(reinterpret_cast<const char*>(&PowerPC::ppcState.tlb[0][0]) -
+            reinterpret_cast<const char*>(&PowerPC::ppcState)) -
+        0x80;
+    MOV(32, R(tag_reg), R(reg_addr));
+    SHR(32, R(tag_reg), Imm8(PowerPC::HW_PAGE_INDEX_SHIFT));
+    MOV(32, R(page_reg), R(tag_reg));
+    AND(32, R(page_reg), Imm32(PowerPC::HW_PAGE_INDEX_MASK));
+    IMUL(32, page_reg, R(page_reg), Imm32(sizeof(PowerPC::TLBEntry)));
+    CMP(32, R(tag_reg),
+        MComplex(RPPCSTATE, page_reg, SCALE_1, tlb_disp + s32(offsetof(PowerPC::TLBEntry, tag))));
+    FixupBranch way_one = J_CC(CC_NE);
+    MOV(32, R(page_reg),
+        MComplex(RPPCSTATE, page_reg, SCALE_1, tlb_disp + s32(offsetof(PowerPC::TLBEntry, paddr))));
+    FixupBranch tlb_hit = J();
+    SetJumpTarget(way_one);
+    CMP(32, R(tag_reg),
+        MComplex(RPPCSTATE, page_reg, SCALE_1,
+                 tlb_disp + s32(offsetof(PowerPC::TLBEntry, tag) + sizeof(u32))));
+    tlb_miss.push_back(J_CC(CC_NE));
+    MOV(32, R(page_reg),
+        MComplex(RPPCSTATE, page_reg, SCALE_1,
+                 tlb_disp + s32(offsetof(PowerPC::TLBEntry, paddr) + sizeof(u32))));
+    SetJumpTarget(tlb_hit);
+
+    // page_reg holds the physical page base; recover the full address.
+    MOV(32, R(tag_reg), R(reg_addr));
+    AND(32, R(tag_reg), Imm32(PowerPC::HW_PAGE_SIZE - 1));
+    OR(32, R(tag_reg), R(page_reg));
+
+    CMP(32, R(tag_reg), Imm32(Memory::REALRAM_SIZE));
+    if (SConfig::GetInstance().bWii)
+    {
+      FixupBranch mem1 = J_CC(CC_B);
+      LEA(32, page_reg, MDisp(tag_reg, -0x10000000));
+      CMP(32, R(page_reg), Imm32(Memory::EXRAM_SIZE));
+      tlb_miss.push_back(J_CC(CC_AE));
+      SetJumpTarget(mem1);
+    }
+    else
+    {
+      tlb_miss.push_back(J_CC(CC_AE));
+    }
+
+    MOV(64, R(page_reg), ImmPtr(Memory::physical_base));
+    LoadAndSwap(accessSize, reg_value, MComplex(page_reg, tag_reg, SCALE_1, 0), signExtend);
+
+    if (save_page)
+      POP(page_reg);
+    if (save_tag)
+      POP(tag_reg);
+    tlb_done = J(true);
+
+    for (FixupBranch& miss : tlb_miss)
+      SetJumpTarget(miss);
+    if (save_page)
+      POP(page_reg);
+    if (save_tag)
+      POP(tag_reg);
+  }
+
   // Helps external systems know which instruction triggered the read.
   // Invalid for calls from Jit64AsmCommon routines
   if (!(flags & SAFE_LOADSTORE_NO_UPDATE_PC))
@@ -420,6 +635,9 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
     MOVZX(64, accessSize, reg_value, R(ABI_RETURN));
   }
 
+  if (inline_tlb_probe)
+    SetJumpTarget(tlb_done);
+
   if (fast_check_address)
   {
     if (m_far_code.Enabled())
@@ -648,6 +866,18 @@ bool EmuCodeBlock::WriteToConstAddress(int accessSize, OpArg arg, u32 address,
   }
   else
   {
+    // If the address maps to an MMIO register, inline the write handler the
+    // same way reads are inlined; polling loops that store to VI/PE/DSP
+    // registers otherwise pay a full MMIO dispatch per iteration.
+    const u32 mmio_address =
+        accessSize != 64 ? PowerPC::IsOptimizableMMIOAccess(address, accessSize) : 0;
+    if (mmio_address)
+    {
+      MMIOWriteRegToAddr(Memory::mmio_mapping.get(), arg, registersInUse, mmio_address,
+                         accessSize);
+      return false;
+    }
+
     // Helps external systems know which instruction triggered the write
     MOV(32, PPCSTATE(pc), Imm32(m_jit.js.compilerPC));
 
@@ -5,6 +5,7 @@
 #include "Core/PowerPC/JitArm64/Jit.h"
 
 #include <cstdio>
+#include <vector>
 
 #include "Common/Arm64Emitter.h"
 #include "Common/CommonTypes.h"
@@ -69,6 +70,8 @@ void JitArm64::Init()
 
   AllocStack();
   GenerateAsm();
+
+  LoadCompilationHints();
 }
 
 bool JitArm64::HandleFault(uintptr_t access_address, SContext* ctx)
@@ -133,6 +136,7 @@ void JitArm64::ClearCache()
 
 void JitArm64::Shutdown()
 {
+  SaveCompilationHints();
   FreeCodeSpace();
   blocks.Shutdown();
   FreeStack();
@@ -628,17 +632,43 @@ void JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
     BeginTimeProfile(b);
   }
 
-  if (code_block.m_gqr_used.Count() == 1 &&
-      js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
+  js.constantGqr.clear();
+  if (js.pairedQuantizeAddresses.find(js.blockStart) == js.pairedQuantizeAddresses.end())
   {
-    int gqr = *code_block.m_gqr_used.begin();
-    if (!code_block.m_gqr_modified[gqr] && !GQR(gqr))
+    // If there are GQRs used but not set, we'll treat those as constant and bake
+    // their quantizer configuration into the code for this block. The guard
+    // below recompiles the block without the optimization if the guess turns
+    // out wrong.
+    const BitSet8 gqr_static = code_block.m_gqr_used & ~code_block.m_gqr_modified;
+    if (gqr_static)
     {
-      LDR(INDEX_UNSIGNED, W0, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0]) + gqr * 4);
-      FixupBranch no_fail = CBZ(W0);
-      FixupBranch fail = B();
+      bool all_zero = true;
+      std::vector<FixupBranch> fails;
+      for (int gqr : gqr_static)
+      {
+        const u32 value = GQR(gqr);
+        js.constantGqr[gqr] = value;
+        all_zero &= value == 0;
+
+        LDR(INDEX_UNSIGNED, W0, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0]) + gqr * 4);
+        FixupBranch no_fail;
+        if (value == 0)
+        {
+          no_fail = CBZ(W0);
+        }
+        else
+        {
+          MOVI2R(W1, value);
+          CMP(W0, W1);
+          no_fail = B(CC_EQ);
+        }
+        fails.push_back(B());
+        SetJumpTarget(no_fail);
+      }
+
       SwitchToFarCode();
-      SetJumpTarget(fail);
+      for (FixupBranch& fail : fails)
+        SetJumpTarget(fail);
       MOVI2R(DISPATCHER_PC, js.blockStart);
       STR(INDEX_UNSIGNED, DISPATCHER_PC, PPC_REG, PPCSTATE_OFF(pc));
       MOVI2R(W0, static_cast<u32>(JitInterface::ExceptionType::PairedQuantize));
@@ -646,8 +676,10 @@ void JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
       BLR(X1);
       B(dispatcher);
       SwitchToNearCode();
-      SetJumpTarget(no_fail);
-      js.assumeNoPairedQuantize = true;
+
+      // With every quantizer used by the block known to be zero, psq_l/psq_st
+      // can skip dequantization entirely.
+      js.assumeNoPairedQuantize = all_zero && gqr_static == code_block.m_gqr_used;
     }
   }
 
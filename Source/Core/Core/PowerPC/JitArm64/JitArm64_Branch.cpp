@@ -105,7 +105,8 @@ void JitArm64::bx(UGeckoInstruction inst)
   gpr.Flush(FlushMode::FLUSH_ALL);
   fpr.Flush(FlushMode::FLUSH_ALL);
 
-  if (destination == js.compilerPC)
+  if (destination == js.compilerPC ||
+      (destination == js.blockStart && code_block.m_is_idle_loop))
   {
     // make idle loops go faster
     ARM64Reg WA = gpr.GetReg();
@@ -115,7 +116,7 @@ void JitArm64::bx(UGeckoInstruction inst)
     BLR(XA);
     gpr.Unlock(WA);
 
-    WriteExceptionExit(js.compilerPC);
+    WriteExceptionExit(destination);
     return;
   }
 
@@ -169,7 +170,23 @@ void JitArm64::bcx(UGeckoInstruction inst)
   gpr.Flush(FlushMode::FLUSH_MAINTAIN_STATE);
   fpr.Flush(FlushMode::FLUSH_MAINTAIN_STATE);
 
-  WriteExit(destination, inst.LK, js.compilerPC + 4);
+  if (!inst.LK && destination == js.blockStart && code_block.m_is_idle_loop)
+  {
+    // A taken branch back to the start of a busy wait loop means nothing can
+    // change until an external event, so fast-forward to the next one.
+    ARM64Reg WB = gpr.GetReg();
+    ARM64Reg XB = EncodeRegTo64(WB);
+
+    MOVP2R(XB, &CoreTiming::Idle);
+    BLR(XB);
+    gpr.Unlock(WB);
+
+    WriteExceptionExit(destination);
+  }
+  else
+  {
+    WriteExit(destination, inst.LK, js.compilerPC + 4);
+  }
 
   SwitchToNearCode();
 
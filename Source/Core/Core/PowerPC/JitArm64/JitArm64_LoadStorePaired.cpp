@@ -11,6 +11,7 @@
 #include "Core/CoreTiming.h"
 #include "Core/PowerPC/JitArm64/Jit.h"
 #include "Core/PowerPC/JitArm64/JitArm64_RegCache.h"
+#include "Core/PowerPC/JitCommon/JitAsmCommon.h"
 #include "Core/PowerPC/PPCTables.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -61,7 +62,16 @@ void JitArm64::psq_l(UGeckoInstruction inst)
     MOV(arm_addr, addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  // If the guard at the top of the block pinned this GQR to a constant, the
+  // type and scale are known here and can be baked into the code instead of
+  // dispatching through the quantizer routine table at runtime.
+  const auto gqr = js.constantGqr.find(inst.I);
+  const bool gqr_constant = !js.assumeNoPairedQuantize && gqr != js.constantGqr.end();
+  const EQuantizeType ld_type =
+      gqr_constant ? static_cast<EQuantizeType>(UGQR(gqr->second).ld_type.Value()) : QUANTIZE_FLOAT;
+  const u32 ld_scale = gqr_constant ? UGQR(gqr->second).ld_scale.Value() : 0;
+
+  if (js.assumeNoPairedQuantize || (gqr_constant && ld_type == QUANTIZE_FLOAT))
   {
     VS = fpr.RW(inst.RS, REG_REG_SINGLE);
     if (!inst.W)
@@ -77,13 +87,68 @@ void JitArm64::psq_l(UGeckoInstruction inst)
   }
   else
   {
-    LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + inst.I]));
-    UBFM(type_reg, scale_reg, 16, 18);   // Type
-    UBFM(scale_reg, scale_reg, 24, 29);  // Scale
+    if (gqr_constant && ld_type >= QUANTIZE_U8)
+    {
+      // Same sequences as the quantized load routines, but with the
+      // dequantization scale resolved at compile time.
+      ADD(EncodeRegTo64(addr_reg), EncodeRegTo64(addr_reg), MEM_REG);
+      switch (ld_type)
+      {
+      case QUANTIZE_U8:
+      case QUANTIZE_S8:
+        m_float_emit.LDR(inst.W ? 8 : 16, INDEX_UNSIGNED, D0, EncodeRegTo64(addr_reg), 0);
+        if (ld_type == QUANTIZE_U8)
+        {
+          m_float_emit.UXTL(8, D0, D0);
+          m_float_emit.UXTL(16, D0, D0);
+          m_float_emit.UCVTF(32, D0, D0);
+        }
+        else
+        {
+          m_float_emit.SXTL(8, D0, D0);
+          m_float_emit.SXTL(16, D0, D0);
+          m_float_emit.SCVTF(32, D0, D0);
+        }
+        break;
+      case QUANTIZE_U16:
+      case QUANTIZE_S16:
+        if (inst.W)
+          m_float_emit.LDR(16, INDEX_UNSIGNED, D0, EncodeRegTo64(addr_reg), 0);
+        else
+          m_float_emit.LD1(16, 1, D0, EncodeRegTo64(addr_reg));
+        m_float_emit.REV16(8, D0, D0);
+        if (ld_type == QUANTIZE_U16)
+        {
+          m_float_emit.UXTL(16, D0, D0);
+          m_float_emit.UCVTF(32, D0, D0);
+        }
+        else
+        {
+          m_float_emit.SXTL(16, D0, D0);
+          m_float_emit.SCVTF(32, D0, D0);
+        }
+        break;
+      default:
+        break;
+      }
+
+      if (ld_scale != 0)
+      {
+        MOVP2R(EncodeRegTo64(type_reg), &m_dequantizeTableS[ld_scale * 2]);
+        m_float_emit.LDR(32, INDEX_UNSIGNED, D1, EncodeRegTo64(type_reg), 0);
+        m_float_emit.FMUL(32, D0, D0, D1, 0);
+      }
+    }
+    else
+    {
+      LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + inst.I]));
+      UBFM(type_reg, scale_reg, 16, 18);   // Type
+      UBFM(scale_reg, scale_reg, 24, 29);  // Scale
 
-    MOVP2R(X30, inst.W ? single_load_quantized : paired_load_quantized);
-    LDR(X30, X30, ArithOption(EncodeRegTo64(type_reg), true));
-    BLR(X30);
+      MOVP2R(X30, inst.W ? single_load_quantized : paired_load_quantized);
+      LDR(X30, X30, ArithOption(EncodeRegTo64(type_reg), true));
+      BLR(X30);
+    }
 
     VS = fpr.RW(inst.RS, REG_REG_SINGLE);
     m_float_emit.ORR(EncodeRegToDouble(VS), D0, D0);
@@ -153,7 +218,15 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     MOV(arm_addr, addr_reg);
   }
 
-  if (js.assumeNoPairedQuantize)
+  // As in psq_l, a GQR pinned to a constant by the block-entry guard lets us
+  // resolve the type and scale at compile time.
+  const auto gqr = js.constantGqr.find(inst.I);
+  const bool gqr_constant = !js.assumeNoPairedQuantize && gqr != js.constantGqr.end();
+  const EQuantizeType st_type =
+      gqr_constant ? static_cast<EQuantizeType>(UGQR(gqr->second).st_type.Value()) : QUANTIZE_FLOAT;
+  const u32 st_scale = gqr_constant ? UGQR(gqr->second).st_scale.Value() : 0;
+
+  if (js.assumeNoPairedQuantize || (gqr_constant && st_type == QUANTIZE_FLOAT))
   {
     u32 flags = BackPatchInfo::FLAG_STORE;
 
@@ -179,9 +252,13 @@ void JitArm64::psq_st(UGeckoInstruction inst)
         m_float_emit.FCVTN(32, D0, VS);
     }
 
-    LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + inst.I]));
-    UBFM(type_reg, scale_reg, 0, 2);    // Type
-    UBFM(scale_reg, scale_reg, 8, 13);  // Scale
+    const bool inline_quantize = gqr_constant && st_type >= QUANTIZE_U8;
+    if (!inline_quantize)
+    {
+      LDR(INDEX_UNSIGNED, scale_reg, PPC_REG, PPCSTATE_OFF(spr[SPR_GQR0 + inst.I]));
+      UBFM(type_reg, scale_reg, 0, 2);    // Type
+      UBFM(scale_reg, scale_reg, 8, 13);  // Scale
+    }
 
     // Inline address check
     // FIXME: This doesn't correctly account for the BAT configuration.
@@ -192,8 +269,17 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     SwitchToFarCode();
     SetJumpTarget(fail);
     // Slow
-    MOVP2R(X30, &paired_store_quantized[16 + inst.W * 8]);
-    LDR(EncodeRegTo64(type_reg), X30, ArithOption(EncodeRegTo64(type_reg), true));
+    if (inline_quantize)
+    {
+      // The slow routine quantizes itself, so it still wants the scale in W0.
+      MOVI2R(scale_reg, st_scale);
+      MOVP2R(EncodeRegTo64(type_reg), paired_store_quantized[16 + inst.W * 8 + st_type]);
+    }
+    else
+    {
+      MOVP2R(X30, &paired_store_quantized[16 + inst.W * 8]);
+      LDR(EncodeRegTo64(type_reg), X30, ArithOption(EncodeRegTo64(type_reg), true));
+    }
 
     ABI_PushRegisters(gprs_in_use);
     m_float_emit.ABI_PushRegisters(fprs_in_use, X30);
@@ -205,9 +291,65 @@ void JitArm64::psq_st(UGeckoInstruction inst)
     SetJumpTarget(pass);
 
     // Fast
-    MOVP2R(X30, &paired_store_quantized[inst.W * 8]);
-    LDR(EncodeRegTo64(type_reg), X30, ArithOption(EncodeRegTo64(type_reg), true));
-    BLR(EncodeRegTo64(type_reg));
+    if (inline_quantize)
+    {
+      // Same sequences as the quantized store routines, but with the scale
+      // resolved at compile time and no indirect call.
+      if (st_scale != 0)
+      {
+        MOVP2R(EncodeRegTo64(type_reg), &m_quantizeTableS[st_scale * 2]);
+        m_float_emit.LDR(32, INDEX_UNSIGNED, D1, EncodeRegTo64(type_reg), 0);
+        m_float_emit.FMUL(32, D0, D0, D1, 0);
+      }
+
+      switch (st_type)
+      {
+      case QUANTIZE_U8:
+      case QUANTIZE_S8:
+        if (st_type == QUANTIZE_U8)
+        {
+          m_float_emit.FCVTZU(32, D0, D0);
+          m_float_emit.UQXTN(16, D0, D0);
+          m_float_emit.UQXTN(8, D0, D0);
+        }
+        else
+        {
+          m_float_emit.FCVTZS(32, D0, D0);
+          m_float_emit.SQXTN(16, D0, D0);
+          m_float_emit.SQXTN(8, D0, D0);
+        }
+        break;
+      case QUANTIZE_U16:
+      case QUANTIZE_S16:
+        if (st_type == QUANTIZE_U16)
+        {
+          m_float_emit.FCVTZU(32, D0, D0);
+          m_float_emit.UQXTN(16, D0, D0);
+        }
+        else
+        {
+          m_float_emit.FCVTZS(32, D0, D0);
+          m_float_emit.SQXTN(16, D0, D0);
+        }
+        m_float_emit.REV16(8, D0, D0);
+        break;
+      default:
+        break;
+      }
+
+      ADD(EncodeRegTo64(addr_reg), EncodeRegTo64(addr_reg), MEM_REG);
+      const bool byte_sized = st_type == QUANTIZE_U8 || st_type == QUANTIZE_S8;
+      if (inst.W)
+        m_float_emit.ST1(byte_sized ? 8 : 16, Q0, 0, EncodeRegTo64(addr_reg));
+      else
+        m_float_emit.ST1(byte_sized ? 16 : 32, Q0, 0, EncodeRegTo64(addr_reg), SP);
+    }
+    else
+    {
+      MOVP2R(X30, &paired_store_quantized[inst.W * 8]);
+      LDR(EncodeRegTo64(type_reg), X30, ArithOption(EncodeRegTo64(type_reg), true));
+      BLR(EncodeRegTo64(type_reg));
+    }
 
     SetJumpTarget(continue1);
   }
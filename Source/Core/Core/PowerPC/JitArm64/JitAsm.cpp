@@ -96,9 +96,14 @@ void JitArm64::GenerateAsm()
     ARM64Reg pc_masked = W25;
     ARM64Reg cache_base = X27;
     ARM64Reg block = X30;
-    ORRI2R(pc_masked, WZR, JitBaseBlockCache::FAST_BLOCK_MAP_MASK << 3);
+    // The fast block map grows with the title's working set, so the index
+    // mask and table pointer have to be reloaded on every lookup.
+    MOVP2R(cache_base, GetBlockCache()->GetFastBlockMapMaskLocation());
+    LDR(INDEX_UNSIGNED, pc_masked, cache_base, 0);
+    LSL(pc_masked, pc_masked, 3);
     AND(pc_masked, pc_masked, DISPATCHER_PC, ArithOption(DISPATCHER_PC, ST_LSL, 1));
-    MOVP2R(cache_base, GetBlockCache()->GetFastBlockMap());
+    MOVP2R(cache_base, GetBlockCache()->GetFastBlockMapLocation());
+    LDR(INDEX_UNSIGNED, cache_base, cache_base, 0);
     LDR(block, cache_base, EncodeRegTo64(pc_masked));
     FixupBranch not_found = CBZ(block);
 
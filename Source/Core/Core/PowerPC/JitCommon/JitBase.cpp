@@ -4,9 +4,17 @@
 
 #include "Core/PowerPC/JitCommon/JitBase.h"
 
+#include <string>
+#include <vector>
+
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/StringUtil.h"
 #include "Core/ConfigManager.h"
 #include "Core/HW/CPU.h"
+#include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCAnalyst.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -42,6 +50,131 @@ bool JitBase::CanMergeNextInstructions(int count) const
   return true;
 }
 
+// On-disk compilation hint cache. Version must be bumped whenever the meaning
+// of one of the stored sets changes.
+constexpr u32 HINT_CACHE_MAGIC = 0x444A4348;  // "DJCH"
+constexpr u32 HINT_CACHE_VERSION = 3;
+
+static std::string GetCompilationHintPath()
+{
+  const std::string& game_id = SConfig::GetInstance().GetGameID();
+  if (game_id.empty())
+    return "";
+  return StringFromFormat("%s%s.jithints", File::GetUserPath(D_CACHE_IDX).c_str(), game_id.c_str());
+}
+
+static bool ReadAddressSet(File::IOFile& file, std::unordered_set<u32>* set)
+{
+  u32 count;
+  if (!file.ReadArray(&count, 1))
+    return false;
+  std::vector<u32> addresses(count);
+  if (!file.ReadArray(addresses.data(), count))
+    return false;
+  set->insert(addresses.begin(), addresses.end());
+  return true;
+}
+
+static void WriteAddressSet(File::IOFile& file, const std::unordered_set<u32>& set)
+{
+  const std::vector<u32> addresses(set.begin(), set.end());
+  const u32 count = static_cast<u32>(addresses.size());
+  file.WriteArray(&count, 1);
+  file.WriteArray(addresses.data(), count);
+}
+
+u32 JitBase::ChecksumInstructions(u32 address, u32 num_instructions)
+{
+  std::vector<u32> code(num_instructions);
+  for (u32 i = 0; i < num_instructions; i++)
+  {
+    const u32 instruction_address = address + i * 4;
+    if (!PowerPC::HostIsInstructionRAMAddress(instruction_address))
+      return 0;
+    code[i] = PowerPC::HostRead_Instruction(instruction_address);
+  }
+  return Common::HashAdler32(reinterpret_cast<const u8*>(code.data()), code.size() * sizeof(u32));
+}
+
+void JitBase::LoadCompilationHints()
+{
+  const std::string path = GetCompilationHintPath();
+  if (path.empty())
+    return;
+
+  File::IOFile file(path, "rb");
+  if (!file)
+    return;
+
+  u32 magic, version;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) || magic != HINT_CACHE_MAGIC ||
+      version != HINT_CACHE_VERSION)
+    return;
+
+  // A stale entry is harmless: it only makes the affected block slightly more
+  // conservative, exactly as if it had been discovered at runtime.
+  u32 hint_count = 0;
+  bool success = ReadAddressSet(file, &js.fifoWriteAddresses) &&
+                 ReadAddressSet(file, &js.pairedQuantizeAddresses) &&
+                 ReadAddressSet(file, &js.noSpeculativeConstantsAddresses) &&
+                 ReadAddressSet(file, &js.hotBlockAddresses) && file.ReadArray(&hint_count, 1);
+  if (success)
+  {
+    m_block_precompile_hints.resize(hint_count);
+    success = file.ReadArray(m_block_precompile_hints.data(), hint_count);
+  }
+  if (!success)
+  {
+    js.fifoWriteAddresses.clear();
+    js.pairedQuantizeAddresses.clear();
+    js.noSpeculativeConstantsAddresses.clear();
+    js.hotBlockAddresses.clear();
+    m_block_precompile_hints.clear();
+  }
+}
+
+void JitBase::SaveCompilationHints()
+{
+  const std::string path = GetCompilationHintPath();
+  if (path.empty())
+    return;
+
+  File::IOFile file(path, "wb");
+  if (!file)
+    return;
+
+  const u32 magic = HINT_CACHE_MAGIC;
+  const u32 version = HINT_CACHE_VERSION;
+  file.WriteArray(&magic, 1);
+  file.WriteArray(&version, 1);
+  WriteAddressSet(file, js.fifoWriteAddresses);
+  WriteAddressSet(file, js.pairedQuantizeAddresses);
+  WriteAddressSet(file, js.noSpeculativeConstantsAddresses);
+  WriteAddressSet(file, js.hotBlockAddresses);
+
+  // Record the currently compiled blocks so the next run can precompile them.
+  CaptureBlockPrecompileHints();
+  const u32 hint_count = static_cast<u32>(m_block_precompile_hints.size());
+  file.WriteArray(&hint_count, 1);
+  file.WriteArray(m_block_precompile_hints.data(), hint_count);
+}
+
+void JitBase::CaptureBlockPrecompileHints()
+{
+  // Only blocks matching the current translation mode can be checksummed
+  // through the MMU, which covers everything a game executes in practice.
+  m_block_precompile_hints.clear();
+  GetBlockCache()->RunOnBlocks([this](const JitBlock& block) {
+    if (block.msrBits != (MSR.Hex & JitBaseBlockCache::JIT_CACHE_MSR_MASK))
+      return;
+    const u32 checksum = ChecksumInstructions(block.effectiveAddress, block.originalSize);
+    if (checksum != 0)
+      m_block_precompile_hints.push_back(
+          {block.effectiveAddress, block.msrBits, block.originalSize, checksum});
+  });
+  m_block_hints_precompiled = false;
+}
+
 void JitBase::UpdateMemoryOptions()
 {
   bool any_watchpoints = PowerPC::memchecks.HasAny();
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/x64Emitter.h"
@@ -69,6 +70,9 @@ protected:
 
     bool assumeNoPairedQuantize;
     std::map<u8, u32> constantGqr;
+    // Value of FPSCR.NI/RN mirrored by the host MXCSR if known at compile
+    // time, -1 otherwise.
+    int knownMxcsrMode;
     bool firstFPInstructionFound;
     bool isLastInstruction;
     int skipInstructions;
@@ -91,6 +95,7 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_set<u32> hotBlockAddresses;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -101,11 +106,40 @@ protected:
 
   void UpdateMemoryOptions();
 
+  // Blocks compiled during a previous run of the same game. A later run can
+  // compile them ahead of execution reaching them; the checksum verifies that
+  // the same code is actually loaded at the address this time around.
+  struct BlockPrecompileHint
+  {
+    u32 address;
+    u32 msr_bits;
+    u32 num_instructions;
+    u32 checksum;
+  };
+  std::vector<BlockPrecompileHint> m_block_precompile_hints;
+  bool m_block_hints_precompiled = false;
+
+  // Returns 0 if any instruction in the range is unreadable.
+  static u32 ChecksumInstructions(u32 address, u32 num_instructions);
+
+  // The fifo-write / paired-quantize / speculative-constants address sets are
+  // discovered at runtime through faults and invalidations, which makes the
+  // first minutes of every boot pay a compile-fault-recompile cycle for each
+  // entry. Persist them per game so later boots start with warm hints.
+  void LoadCompilationHints();
+  void SaveCompilationHints();
+
 public:
   JitBase();
   ~JitBase() override;
 
   static const u8* Dispatch(JitBase& jit);
+
+  // Record the currently compiled blocks as precompile hints, so they can be
+  // recompiled eagerly after something (e.g. a savestate load) throws the
+  // cache away.
+  void CaptureBlockPrecompileHints();
+
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
   virtual void Jit(u32 em_address) = 0;
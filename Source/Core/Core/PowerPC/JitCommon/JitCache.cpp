@@ -15,6 +15,7 @@
 #include <functional>
 #include <map>
 #include <set>
+#include <unordered_set>
 #include <utility>
 
 #include "Common/CommonTypes.h"
@@ -48,6 +49,10 @@ void JitBaseBlockCache::Init()
 {
   JitRegister::Init(SConfig::GetInstance().m_perfDir);
 
+  fast_block_map.assign(FAST_BLOCK_MAP_INITIAL_ELEMENTS, nullptr);
+  m_fast_block_map_ptr = fast_block_map.data();
+  m_fast_block_map_mask = FAST_BLOCK_MAP_INITIAL_ELEMENTS - 1;
+
   Clear();
 }
 
@@ -75,7 +80,9 @@ void JitBaseBlockCache::Clear()
 
   valid_block.ClearAll();
 
-  fast_block_map.fill(nullptr);
+  // The map keeps its grown size: the title's working set doesn't shrink just
+  // because the cache was flushed.
+  std::fill(fast_block_map.begin(), fast_block_map.end(), nullptr);
 }
 
 void JitBaseBlockCache::Reset()
@@ -84,9 +91,14 @@ void JitBaseBlockCache::Reset()
   Init();
 }
 
-JitBlock** JitBaseBlockCache::GetFastBlockMap()
+JitBlock*** JitBaseBlockCache::GetFastBlockMapLocation()
+{
+  return &m_fast_block_map_ptr;
+}
+
+const u32* JitBaseBlockCache::GetFastBlockMapMaskLocation() const
 {
-  return fast_block_map.data();
+  return &m_fast_block_map_mask;
 }
 
 void JitBaseBlockCache::RunOnBlocks(std::function<void(const JitBlock&)> f)
@@ -110,6 +122,11 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                       const std::set<u32>& physical_addresses)
 {
+  // Grow the fast map once the number of live blocks makes collisions likely.
+  if (block_map.size() > fast_block_map.size() / 2 &&
+      fast_block_map.size() < FAST_BLOCK_MAP_MAX_ELEMENTS)
+    GrowFastBlockMap();
+
   size_t index = FastLookupIndexForAddress(block.effectiveAddress);
   fast_block_map[index] = &block;
   block.fast_block_map_index = index;
@@ -200,6 +217,22 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
     else
       valid_block.Clear(pAddr / 32);
   }
+  else if (length != 0 && length < 0x01000000)
+  {
+    // Also use the bitset for the batched multi-line invalidations issued by
+    // the JIT's dcbx loop, so ranges which never contained code stay cheap.
+    bool line_had_code = false;
+    const u32 last_line = (pAddr + length - 1) / 32;
+    for (u32 line = pAddr / 32; line <= last_line; line++)
+    {
+      if (valid_block.Test(line))
+      {
+        line_had_code = true;
+        valid_block.Clear(line);
+      }
+    }
+    destroy_block = line_had_code;
+  }
 
   if (destroy_block)
   {
@@ -212,10 +245,29 @@ void JitBaseBlockCache::InvalidateICache(u32 address, u32 length, bool forced)
     // being in the right place between instructions).
     if (!forced)
     {
-      for (u32 i = address; i < address + length; i += 4)
+      if (length <= 0x1000)
+      {
+        for (u32 i = address; i < address + length; i += 4)
+        {
+          m_jit.js.fifoWriteAddresses.erase(i);
+          m_jit.js.pairedQuantizeAddresses.erase(i);
+        }
+      }
+      else
       {
-        m_jit.js.fifoWriteAddresses.erase(i);
-        m_jit.js.pairedQuantizeAddresses.erase(i);
+        // For large batched ranges it's cheaper to walk the (small) address
+        // sets than to probe them once per instruction in the range.
+        const auto erase_in_range = [&](std::unordered_set<u32>& addresses) {
+          for (auto it = addresses.begin(); it != addresses.end();)
+          {
+            if (*it >= address && *it < address + length)
+              it = addresses.erase(it);
+            else
+              ++it;
+          }
+        };
+        erase_in_range(m_jit.js.fifoWriteAddresses);
+        erase_in_range(m_jit.js.pairedQuantizeAddresses);
       }
     }
   }
@@ -386,5 +438,25 @@ JitBlock* JitBaseBlockCache::MoveBlockIntoFastCache(u32 addr, u32 msr)
 
 size_t JitBaseBlockCache::FastLookupIndexForAddress(u32 address)
 {
-  return (address >> 2) & FAST_BLOCK_MAP_MASK;
+  return (address >> 2) & m_fast_block_map_mask;
+}
+
+void JitBaseBlockCache::GrowFastBlockMap()
+{
+  // Every lookup, including the assembly dispatchers, goes through
+  // m_fast_block_map_ptr and m_fast_block_map_mask, so the table can simply
+  // be swapped; no emitted code holds the old pointer.
+  std::vector<JitBlock*> new_map(fast_block_map.size() * 2, nullptr);
+  fast_block_map = std::move(new_map);
+  m_fast_block_map_ptr = fast_block_map.data();
+  m_fast_block_map_mask = static_cast<u32>(fast_block_map.size() - 1);
+
+  // Reinsert all live blocks at their new slots so dispatch stays warm.
+  for (auto& e : block_map)
+  {
+    JitBlock& b = e.second;
+    const size_t index = FastLookupIndexForAddress(b.effectiveAddress);
+    fast_block_map[index] = &b;
+    b.fast_block_map_index = index;
+  }
 }
@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <array>
 #include <bitset>
 #include <cstring>
 #include <functional>
@@ -77,6 +76,13 @@ struct JitBlock
   // This tracks the position if this block within the fast block cache.
   // We allow each block to have only one map entry.
   size_t fast_block_map_index;
+
+  // Number of block entries left before the JIT considers this block hot
+  // and recompiles it with more aggressive analysis. Decremented by emitted
+  // code, so the field must stay at a stable address for the block lifetime.
+  u32 tierUpCountdown;
+  // Whether this block was already compiled by the optimizing second tier.
+  bool secondTier;
 };
 
 typedef void (*CompiledCode)();
@@ -118,8 +124,11 @@ public:
   // is valid (MSR.IR and MSR.DR, the address translation bits).
   static constexpr u32 JIT_CACHE_MSR_MASK = 0x30;
 
-  static constexpr u32 FAST_BLOCK_MAP_ELEMENTS = 0x10000;
-  static constexpr u32 FAST_BLOCK_MAP_MASK = FAST_BLOCK_MAP_ELEMENTS - 1;
+  // Initial size of the fast block map. It grows in powers of two up to
+  // FAST_BLOCK_MAP_MAX_ELEMENTS once enough blocks are live that collisions
+  // would push lookups onto the slow path.
+  static constexpr u32 FAST_BLOCK_MAP_INITIAL_ELEMENTS = 0x10000;
+  static constexpr u32 FAST_BLOCK_MAP_MAX_ELEMENTS = 0x400000;
 
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
@@ -130,7 +139,10 @@ public:
   void Reset();
 
   // Code Cache
-  JitBlock** GetFastBlockMap();
+  // Locations read by the assembly dispatchers on every lookup; the table
+  // pointer and index mask change whenever the fast block map grows.
+  JitBlock*** GetFastBlockMapLocation();
+  const u32* GetFastBlockMapMaskLocation() const;
   void RunOnBlocks(std::function<void(const JitBlock&)> f);
 
   JitBlock* AllocateBlock(u32 em_address);
@@ -169,6 +181,10 @@ private:
   // Fast but risky block lookup based on fast_block_map.
   size_t FastLookupIndexForAddress(u32 address);
 
+  // Double the fast block map and reinsert all live blocks at their new
+  // slots. The dispatchers pick up the new table through the locations above.
+  void GrowFastBlockMap();
+
   // links_to hold all exit points of all valid blocks in a reverse way.
   // It is used to query all blocks which links to an address.
   std::multimap<u32, JitBlock*> links_to;  // destination_PC -> number
@@ -187,7 +203,12 @@ private:
   // It is used to provide a fast way to query if no icache invalidation is needed.
   ValidBlockBitSet valid_block;
 
-  // This array is indexed with the masked PC and likely holds the correct block id.
+  // This table is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
-  std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map;  // start_addr & mask -> number
+  // It grows with the title's working set; m_fast_block_map_ptr and
+  // m_fast_block_map_mask mirror data() and size() - 1 at stable addresses
+  // for the assembly dispatchers.
+  std::vector<JitBlock*> fast_block_map;  // start_addr & mask -> number
+  JitBlock** m_fast_block_map_ptr = nullptr;
+  u32 m_fast_block_map_mask = 0;
 };
@@ -7,8 +7,11 @@
 #include <algorithm>
 #include <cinttypes>
 #include <cstdio>
+#include <map>
 #include <string>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -48,7 +51,14 @@ void SetJit(JitBase* jit)
 void DoState(PointerWrap& p)
 {
   if (g_jit && p.GetMode() == PointerWrap::MODE_READ)
+  {
+    // Remember which blocks were compiled before the cache is thrown away, so
+    // they can be recompiled eagerly when emulation resumes instead of
+    // stuttering through a cold JIT cache. The checksums are verified against
+    // the loaded memory, so stale entries are simply skipped.
+    g_jit->CaptureBlockPrecompileHints();
     g_jit->ClearCache();
+  }
 }
 CPUCoreBase* InitJitCore(PowerPC::CPUCore core)
 {
@@ -115,6 +125,57 @@ void WriteProfileResults(const std::string& filename)
             name.c_str(), stat.run_count, stat.cost, stat.tick_counter, percent, timePercent,
             (double)stat.tick_counter * 1000.0 / (double)prof_stats.countsPerSec, stat.block_size);
   }
+
+  // Per-opcode attribution: distribute each block's measured time over the
+  // instructions it contains, weighted by their static cycle cost, and
+  // aggregate by opcode. Branch following can pull in instructions from
+  // outside the linear range, so this is an approximation, but it is accurate
+  // enough to show which guest instructions dominate a title.
+  struct OpcodeCost
+  {
+    u64 executions = 0;
+    double time = 0.0;
+  };
+  std::map<std::string, OpcodeCost> opcode_costs;
+
+  for (const auto& stat : prof_stats.block_stats)
+  {
+    std::vector<GekkoOPInfo*> infos;
+    u64 cycles_total = 0;
+    for (u32 i = 0; i < stat.instruction_count; i++)
+    {
+      const u32 address = stat.addr + i * 4;
+      if (!PowerPC::HostIsInstructionRAMAddress(address))
+        break;
+      GekkoOPInfo* info = PPCTables::GetOpInfo(PowerPC::HostRead_Instruction(address));
+      if (!info)
+        break;
+      infos.push_back(info);
+      cycles_total += info->numCycles;
+    }
+    if (cycles_total == 0)
+      continue;
+
+    for (const GekkoOPInfo* info : infos)
+    {
+      OpcodeCost& entry = opcode_costs[info->opname];
+      entry.executions += stat.run_count;
+      entry.time += (double)stat.tick_counter * (double)info->numCycles / (double)cycles_total;
+    }
+  }
+
+  std::vector<std::pair<std::string, OpcodeCost>> sorted_opcodes(opcode_costs.begin(),
+                                                                 opcode_costs.end());
+  std::sort(sorted_opcodes.begin(), sorted_opcodes.end(),
+            [](const auto& a, const auto& b) { return a.second.time > b.second.time; });
+
+  fprintf(f.GetHandle(), "\nopcode\texecutions\ttime(ms)\ttimePercent\n");
+  for (const auto& [opname, entry] : sorted_opcodes)
+  {
+    fprintf(f.GetHandle(), "%s\t%" PRIu64 "\t%.2f\t%.2f\n", opname.c_str(), entry.executions,
+            entry.time * 1000.0 / (double)prof_stats.countsPerSec,
+            100.0 * entry.time / (double)prof_stats.timecost_sum);
+  }
 }
 
 void GetProfileResults(Profiler::ProfileStats* prof_stats)
@@ -139,7 +200,7 @@ void GetProfileResults(Profiler::ProfileStats* prof_stats)
     // Todo: tweak.
     if (data.runCount >= 1)
       prof_stats->block_stats.emplace_back(block.effectiveAddress, cost, timecost, data.runCount,
-                                           block.codeSize);
+                                           block.codeSize, block.originalSize);
     prof_stats->cost_sum += cost;
     prof_stats->timecost_sum += timecost;
   });
@@ -263,6 +324,18 @@ void CompileExceptionCheck(ExceptionType type)
   }
 }
 
+void CompileTierUp()
+{
+  if (!g_jit)
+    return;
+
+  // Invalidate the block so the next dispatch recompiles it with the
+  // second-tier analysis settings. Blocks already marked hot don't emit the
+  // countdown check again, so this only ever fires once per block address.
+  if (PC != 0 && g_jit->js.hotBlockAddresses.insert(PC).second)
+    g_jit->GetBlockCache()->InvalidateICache(PC, 4, true);
+}
+
 void Shutdown()
 {
   if (g_jit)
@@ -66,6 +66,10 @@ void InvalidateICache(u32 address, u32 size, bool forced);
 
 void CompileExceptionCheck(ExceptionType type);
 
+// Called by emitted code once a block's entry countdown hits zero; marks the
+// block at PC as hot so it gets recompiled by the optimizing second tier.
+void CompileTierUp();
+
 /// used for the page fault unit test, don't use outside of tests!
 void SetJit(JitBase* jit);
 
@@ -27,10 +27,6 @@
 
 namespace PowerPC
 {
-constexpr size_t HW_PAGE_SIZE = 4096;
-constexpr u32 HW_PAGE_INDEX_SHIFT = 12;
-constexpr u32 HW_PAGE_INDEX_MASK = 0x3f;
-
 // EFB RE
 /*
 GXPeekZ
@@ -443,6 +439,17 @@ static void Memcheck(u32 address, u32 var, bool write, size_t size)
       bool pause = mc->Action(&PowerPC::debug_interface, var, address, write, size, PC);
       if (pause)
       {
+#ifdef USE_GDBSTUB
+        // An attached gdb client takes control here directly: the stub's
+        // protocol loop runs on the CPU thread, and on continue the access
+        // simply completes. Parking the core in Stepping would leave the
+        // client waiting for a stop reply that never comes.
+        if (gdb_active() && PowerPC::GetMode() == PowerPC::CoreMode::Interpreter)
+        {
+          gdb_watchpoint_hit();
+          return;
+        }
+#endif
         CPU::Break();
         // Fake a DSI so that all the code that tests for it in order to skip
         // the rest of the instruction will apply.  (This means that
@@ -783,6 +790,15 @@ void ClearCacheLine(u32 address)
     address = translated_address.address;
   }
 
+  // The common case is a line in physical RAM; clear it with one memset
+  // instead of going through WriteToHardware eight bytes at a time. The line
+  // is 32-byte aligned, so it cannot straddle the mirror mask boundary.
+  if ((address & 0xF8000000) == 0x00000000)
+  {
+    std::memset(&Memory::m_pRAM[address & Memory::RAM_MASK], 0, 32);
+    return;
+  }
+
   // TODO: This isn't precisely correct for non-RAM regions, but the difference
   // is unlikely to matter.
   for (u32 i = 0; i < 32; i += 8)
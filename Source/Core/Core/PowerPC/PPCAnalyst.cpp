@@ -8,14 +8,17 @@
 #include <map>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PPCSymbolDB.h"
@@ -37,9 +40,6 @@
 
 namespace PPCAnalyst
 {
-// 0 does not perform block merging
-constexpr u32 BRANCH_FOLLOWING_THRESHOLD = 2;
-
 constexpr u32 INVALID_BRANCH_TARGET = 0xFFFFFFFF;
 
 static u32 EvaluateBranchTarget(UGeckoInstruction instr, u32 pc)
@@ -254,38 +254,75 @@ static bool CanSwapAdjacentOps(const CodeOp& a, const CodeOp& b)
 // called by another function. Therefore, let's scan the
 // entire space for bl operations and find what functions
 // get called.
-static void FindFunctionsFromBranches(u32 startAddr, u32 endAddr, Common::SymbolDB* func_db)
+// Reads an instruction from the standard BAT-mapped RAM regions without going
+// through TryReadInstruction, which fills shared icache/TLB state and therefore
+// cannot be called from multiple threads.
+static bool ReadInstructionFromRAM(u32 addr, u32* hex)
+{
+  if (Memory::m_pRAM && addr >= 0x80000000 && addr < 0x80000000 + Memory::RAM_SIZE)
+    *hex = Common::swap32(&Memory::m_pRAM[addr & Memory::RAM_MASK]);
+  else if (Memory::m_pEXRAM && addr >= 0x90000000 && addr < 0x90000000 + Memory::EXRAM_SIZE)
+    *hex = Common::swap32(&Memory::m_pEXRAM[addr & Memory::EXRAM_MASK]);
+  else
+    return false;
+  return true;
+}
+
+static void ScanBranchTargets(u32 startAddr, u32 endAddr, std::vector<u32>* targets)
 {
   for (u32 addr = startAddr; addr < endAddr; addr += 4)
   {
-    const PowerPC::TryReadInstResult read_result = PowerPC::TryReadInstruction(addr);
-    const UGeckoInstruction instr = read_result.hex;
+    u32 hex;
+    if (!ReadInstructionFromRAM(addr, &hex))
+      continue;
 
-    if (read_result.valid && PPCTables::IsValidInstruction(instr))
+    const UGeckoInstruction instr = hex;
+    if (!PPCTables::IsValidInstruction(instr))
+      continue;
+
+    if (instr.OPCD == 18 && instr.LK)  // bl
     {
-      switch (instr.OPCD)
-      {
-      case 18:  // branch instruction
-      {
-        if (instr.LK)  // bl
-        {
-          u32 target = SignExt26(instr.LI << 2);
-          if (!instr.AA)
-            target += addr;
-          if (PowerPC::HostIsRAMAddress(target))
-          {
-            func_db->AddFunction(target);
-          }
-        }
-      }
-      break;
-      default:
-        break;
-      }
+      u32 target = SignExt26(instr.LI << 2);
+      if (!instr.AA)
+        target += addr;
+      u32 target_hex;
+      if (ReadInstructionFromRAM(target, &target_hex))
+        targets->push_back(target);
     }
   }
 }
 
+static void FindFunctionsFromBranches(u32 startAddr, u32 endAddr, Common::SymbolDB* func_db)
+{
+  // Sweeping the address range for bl instructions dominates the scan time, so
+  // it is split into disjoint chunks scanned in parallel. Each candidate still
+  // goes through AnalyzeFunction on the calling thread afterwards, so a stale
+  // or misread word only costs a rejected candidate.
+  const u32 range = endAddr - startAddr;
+  const u32 num_threads =
+      std::max<u32>(1, std::min<u32>(std::thread::hardware_concurrency(), range / 0x100000));
+  const u32 chunk_size = ((range / num_threads) + 3) & ~3u;
+
+  std::vector<std::vector<u32>> targets(num_threads);
+  std::vector<std::thread> scan_threads;
+  for (u32 i = 0; i < num_threads; ++i)
+  {
+    const u32 chunk_start = startAddr + i * chunk_size;
+    const u32 chunk_end = std::min(endAddr, chunk_start + chunk_size);
+    if (chunk_start >= chunk_end)
+      break;
+    scan_threads.emplace_back(ScanBranchTargets, chunk_start, chunk_end, &targets[i]);
+  }
+  for (std::thread& thread : scan_threads)
+    thread.join();
+
+  for (const std::vector<u32>& chunk_targets : targets)
+  {
+    for (u32 target : chunk_targets)
+      func_db->AddFunction(target);
+  }
+}
+
 static void FindFunctionsFromHandlers(PPCSymbolDB* func_db)
 {
   static const std::map<u32, const char* const> handlers = {
@@ -642,6 +679,71 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const Gekk
   }
 }
 
+// Very basic algorithm to detect busy wait loops:
+//   * The block ends with a branch (not linking, not decrementing CTR) back to
+//     its own start.
+//   * The body only consists of integer ops, loads and followed branches, so
+//     it never writes to memory.
+//   * No value is carried from one iteration to the next; every register the
+//     loop writes is recomputed from constants and memory each time around.
+// Taking the backwards branch of such a loop means the CPU is only waiting for
+// an external event, so the JITs can fast-forward to the next one instead of
+// spinning. This also covers loops that poll through a followed bl/blr pair.
+static bool IsBusyWaitLoop(const CodeBlock* block, const CodeOp* code, size_t num_inst)
+{
+  if (num_inst == 0)
+    return false;
+
+  const UGeckoInstruction branch = code[num_inst - 1].inst;
+  const u32 branch_address = code[num_inst - 1].address;
+  u32 destination;
+  if (branch.OPCD == 18)
+    destination = SignExt26(branch.LI << 2) + (branch.AA ? 0 : branch_address);
+  else if (branch.OPCD == 16 && (branch.BO & BO_DONT_DECREMENT_FLAG))
+    destination = SignExt16(branch.BD << 2) + (branch.AA ? 0 : branch_address);
+  else
+    return false;
+
+  if (destination != block->m_address || branch.LK)
+    return false;
+
+  BitSet32 all_writes;
+  for (size_t i = 0; i < num_inst - 1; i++)
+    all_writes |= code[i].regsOut;
+
+  BitSet32 defined;
+  bool ca_defined = false;
+  for (size_t i = 0; i < num_inst - 1; i++)
+  {
+    const CodeOp& op = code[i];
+    if (op.opinfo->type == OpType::Branch)
+    {
+      // Followed calls and conditional exits have no side effects we care
+      // about, but a CTR decrement is state carried across iterations.
+      if ((op.inst.OPCD == 16 || (op.inst.OPCD == 19 && op.inst.SUBOP10 == 16)) &&
+          (op.inst.BO & BO_DONT_DECREMENT_FLAG) == 0)
+        return false;
+    }
+    else if (op.opinfo->type != OpType::Integer && op.opinfo->type != OpType::Load)
+    {
+      // Stores, floating point, timebase reads and system instructions all
+      // have effects we can't prove away.
+      return false;
+    }
+
+    // A register or carry value read before the loop redefines it changes from
+    // iteration to iteration (e.g. a counter), so the loop isn't pure waiting.
+    if (op.regsIn & all_writes & ~defined)
+      return false;
+    if ((op.opinfo->flags & FL_READ_CA) && !ca_defined)
+      return false;
+
+    defined |= op.regsOut;
+    ca_defined |= (op.opinfo->flags & FL_SET_CA) != 0;
+  }
+  return true;
+}
+
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size)
 {
   // Clear block stats
@@ -705,11 +807,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
 
     bool conditional_continue = false;
 
-    // TODO: Find the optimal value for BRANCH_FOLLOWING_THRESHOLD.
-    //       If it is small, the performance will be down.
-    //       If it is big, the size of generated code will be big and
-    //       cache clearning will happen many times.
-    if (enable_follow && HasOption(OPTION_BRANCH_FOLLOW) && numFollows < BRANCH_FOLLOWING_THRESHOLD)
+    if (enable_follow && HasOption(OPTION_BRANCH_FOLLOW) && numFollows < m_branch_follow_limit)
     {
       if (inst.OPCD == 18 && block_size > 1)
       {
@@ -817,6 +915,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std:
   }
 
   block->m_num_instructions = num_inst;
+  block->m_is_idle_loop = IsBusyWaitLoop(block, code, num_inst);
 
   if (block->m_num_instructions > 1)
     ReorderInstructions(block->m_num_instructions, code);
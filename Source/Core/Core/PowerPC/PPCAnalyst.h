@@ -142,6 +142,9 @@ struct CodeBlock
   // Did we have a memory_exception?
   bool m_memory_exception;
 
+  // Is this block a busy-wait loop with no effect besides burning time?
+  bool m_is_idle_loop;
+
   // Which GQRs this block uses, if any.
   BitSet8 m_gqr_used;
 
@@ -196,10 +199,21 @@ public:
     OPTION_CROR_MERGE = (1 << 6),
   };
 
+  // 0 does not perform block merging.
+  // TODO: Find the optimal value for the follow limit.
+  //       If it is small, the performance will be down.
+  //       If it is big, the size of generated code will be big and
+  //       cache clearing will happen many times.
+  static constexpr u32 DEFAULT_BRANCH_FOLLOW_LIMIT = 2;
+
   // Option setting/getting
   void SetOption(AnalystOption option) { m_options |= option; }
   void ClearOption(AnalystOption option) { m_options &= ~(option); }
   bool HasOption(AnalystOption option) const { return !!(m_options & option); }
+
+  // Number of unconditional branches Analyze() may follow. The JIT raises
+  // this when recompiling a block which has proven itself hot.
+  void SetBranchFollowLimit(u32 limit) { m_branch_follow_limit = limit; }
   u32 Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer, std::size_t block_size);
 
 private:
@@ -216,6 +230,7 @@ private:
 
   // Options
   u32 m_options = 0;
+  u32 m_branch_follow_limit = DEFAULT_BRANCH_FOLLOW_LIMIT;
 };
 
 void LogFunctionCall(u32 addr);
@@ -12,6 +12,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
+#include "Common/FileUtil.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
 #include "Core/PowerPC/MMU.h"
@@ -215,11 +216,173 @@ void PPCSymbolDB::LogFunctionCall(u32 addr)
 // https://forums.oculus.com/viewtopic.php?f=42&t=11241&start=580
 // https://m2k2.taigaforum.com/post/metroid_prime_hacking_help_25.html#metroid_prime_hacking_help_25
 
+namespace
+{
+// Binary sidecar written next to a text .map after a successful parse. Loading
+// it back skips both the line-by-line text parsing and the per-symbol function
+// analysis and checksum computation, which dominate LoadMap time on maps with
+// tens of thousands of symbols.
+constexpr u32 MAP_CACHE_MAGIC = 0x50414D44;  // "DMAP"
+constexpr u32 MAP_CACHE_VERSION = 1;
+
+struct MapCacheHeader
+{
+  u32 magic;
+  u32 version;
+  u32 bad;
+  u32 symbol_count;
+  u32 call_count;
+  u32 string_table_size;
+};
+
+struct MapCacheSymbol
+{
+  u32 address;
+  u32 size;
+  u32 hash;
+  u32 flags;
+  u32 type;
+  u32 analyzed;
+  u32 name_offset;
+  u32 call_offset;
+  u32 call_count;
+};
+
+struct MapCacheCall
+{
+  u32 function;
+  u32 call_address;
+};
+}  // namespace
+
+bool PPCSymbolDB::LoadMapCache(const std::string& cache_filename, bool bad)
+{
+  File::IOFile f(cache_filename, "rb");
+  if (!f)
+    return false;
+
+  MapCacheHeader header;
+  if (!f.ReadArray(&header, 1) || header.magic != MAP_CACHE_MAGIC ||
+      header.version != MAP_CACHE_VERSION || header.bad != static_cast<u32>(bad))
+  {
+    return false;
+  }
+
+  std::vector<MapCacheSymbol> symbols(header.symbol_count);
+  std::vector<MapCacheCall> calls(header.call_count);
+  std::vector<char> string_table(header.string_table_size);
+  if (!f.ReadArray(symbols.data(), symbols.size()) || !f.ReadArray(calls.data(), calls.size()) ||
+      !f.ReadArray(string_table.data(), string_table.size()))
+  {
+    return false;
+  }
+  if (string_table.empty() || string_table.back() != '\0')
+    return false;
+
+  // Validate everything before touching the database so a truncated or
+  // corrupt cache leaves it unchanged.
+  for (const MapCacheSymbol& entry : symbols)
+  {
+    if (entry.name_offset >= string_table.size() || entry.type > 1 ||
+        entry.call_offset + entry.call_count > calls.size())
+    {
+      return false;
+    }
+  }
+
+  for (const MapCacheSymbol& entry : symbols)
+  {
+    Common::Symbol symbol;
+    symbol.Rename(&string_table[entry.name_offset]);
+    symbol.address = entry.address;
+    symbol.size = entry.size;
+    symbol.hash = entry.hash;
+    symbol.flags = entry.flags;
+    symbol.type = static_cast<Common::Symbol::Type>(entry.type);
+    symbol.analyzed = entry.analyzed != 0;
+    symbol.calls.reserve(entry.call_count);
+    for (u32 i = 0; i < entry.call_count; ++i)
+    {
+      symbol.calls.emplace_back(calls[entry.call_offset + i].function,
+                                calls[entry.call_offset + i].call_address);
+    }
+
+    Common::Symbol& dest = m_functions[entry.address];
+    dest = std::move(symbol);
+    if (dest.type == Common::Symbol::Type::Function)
+      m_checksum_to_function[dest.hash].insert(&dest);
+  }
+
+  Index();
+  NOTICE_LOG(SYMBOLS, "%u symbols loaded from map cache %s", header.symbol_count,
+             cache_filename.c_str());
+  return true;
+}
+
+void PPCSymbolDB::SaveMapCache(const std::string& cache_filename, bool bad) const
+{
+  std::vector<MapCacheSymbol> symbols;
+  std::vector<MapCacheCall> calls;
+  std::vector<char> string_table;
+  symbols.reserve(m_functions.size());
+
+  for (const auto& function : m_functions)
+  {
+    const Common::Symbol& symbol = function.second;
+
+    MapCacheSymbol entry;
+    entry.address = symbol.address;
+    entry.size = symbol.size;
+    entry.hash = symbol.hash;
+    entry.flags = symbol.flags;
+    entry.type = static_cast<u32>(symbol.type);
+    entry.analyzed = symbol.analyzed ? 1 : 0;
+    entry.name_offset = static_cast<u32>(string_table.size());
+    entry.call_offset = static_cast<u32>(calls.size());
+    entry.call_count = static_cast<u32>(symbol.calls.size());
+    symbols.push_back(entry);
+
+    string_table.insert(string_table.end(), symbol.name.begin(), symbol.name.end());
+    string_table.push_back('\0');
+    for (const Common::SCall& call : symbol.calls)
+      calls.push_back({call.function, call.call_address});
+  }
+
+  MapCacheHeader header;
+  header.magic = MAP_CACHE_MAGIC;
+  header.version = MAP_CACHE_VERSION;
+  header.bad = static_cast<u32>(bad);
+  header.symbol_count = static_cast<u32>(symbols.size());
+  header.call_count = static_cast<u32>(calls.size());
+  header.string_table_size = static_cast<u32>(string_table.size());
+
+  File::IOFile f(cache_filename, "wb");
+  if (!f)
+  {
+    WARN_LOG(SYMBOLS, "Unable to write map cache %s", cache_filename.c_str());
+    return;
+  }
+  f.WriteArray(&header, 1);
+  f.WriteArray(symbols.data(), symbols.size());
+  f.WriteArray(calls.data(), calls.size());
+  f.WriteArray(string_table.data(), string_table.size());
+}
+
 // This one can load both leftover map files on game discs (like Zelda), and mapfiles
 // produced by SaveSymbolMap below.
 // bad=true means carefully load map files that might not be from exactly the right version
 bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
 {
+  // A cache that is at least as new as the text map supersedes it.
+  const std::string cache_filename = filename + ".cache";
+  if (File::Exists(cache_filename) &&
+      File::FileInfo(cache_filename).GetModificationTime() >=
+          File::FileInfo(filename).GetModificationTime() &&
+      LoadMapCache(cache_filename, bad))
+  {
+    return true;
+  }
+
   File::IOFile f(filename, "r");
   if (!f)
     return false;
@@ -413,6 +576,10 @@ bool PPCSymbolDB::LoadMap(const std::string& filename, bool bad)
 
   Index();
   NOTICE_LOG(SYMBOLS, "%d symbols loaded, %d symbols ignored.", good_count, bad_count);
+
+  if (good_count > 0)
+    SaveMapCache(cache_filename, bad);
+
   return true;
 }
 
@@ -39,6 +39,9 @@ public:
   void LogFunctionCall(u32 addr);
 
 private:
+  bool LoadMapCache(const std::string& cache_filename, bool bad);
+  void SaveMapCache(const std::string& cache_filename, bool bad) const;
+
   Common::DebugInterface* debugger;
 };
 
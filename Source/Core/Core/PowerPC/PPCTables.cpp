@@ -31,6 +31,8 @@ std::array<GekkoOPInfo*, 1024> m_infoTable63;
 std::array<GekkoOPInfo*, 512> m_allInstructions;
 size_t m_numInstructions;
 
+std::array<GekkoDispatchEntry, FLATTENED_TABLE_SIZE> m_dispatchTable;
+
 namespace PPCTables
 {
 GekkoOPInfo* GetOpInfo(UGeckoInstruction inst)
@@ -105,6 +105,37 @@ extern std::array<GekkoOPInfo*, 1024> m_infoTable63;
 extern std::array<GekkoOPInfo*, 512> m_allInstructions;
 extern size_t m_numInstructions;
 
+// Flattened dispatch table: one lookup resolves an instruction to its final
+// handler and op info, instead of hopping through the RunTableX trampolines
+// and then walking the subtables a second time for the cycle count.
+struct GekkoDispatchEntry
+{
+  Interpreter::Instruction function;
+  GekkoOPInfo* opinfo;
+};
+
+constexpr size_t FLATTENED_TABLE_SIZE = 64 + 1024 + 1024 + 1024 + 32 + 1024;
+extern std::array<GekkoDispatchEntry, FLATTENED_TABLE_SIZE> m_dispatchTable;
+
+inline size_t FlattenedOpIndex(UGeckoInstruction inst)
+{
+  switch (inst.OPCD)
+  {
+  case 4:
+    return 64 + inst.SUBOP10;
+  case 19:
+    return 64 + 1024 + inst.SUBOP10;
+  case 31:
+    return 64 + 2048 + inst.SUBOP10;
+  case 59:
+    return 64 + 3072 + inst.SUBOP5;
+  case 63:
+    return 64 + 3072 + 32 + inst.SUBOP10;
+  default:
+    return inst.OPCD;
+  }
+}
+
 namespace PPCTables
 {
 GekkoOPInfo* GetOpInfo(UGeckoInstruction inst);
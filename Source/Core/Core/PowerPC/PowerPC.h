@@ -43,11 +43,20 @@ enum class CoreMode
   JIT,
 };
 
-// TLB cache
-constexpr size_t TLB_SIZE = 128;
+constexpr size_t HW_PAGE_SIZE = 4096;
+constexpr u32 HW_PAGE_INDEX_SHIFT = 12;
+
+// TLB cache. The real Gekko/Broadway data and instruction TLBs hold 128
+// entries each; we emulate much larger ones, which well-behaved PowerPC code
+// cannot observe (tlbie still invalidates the set covering its page) and
+// which saves most of the page table walks in titles that run with paging
+// enabled.
+constexpr size_t TLB_SIZE = 4096;
 constexpr size_t NUM_TLBS = 2;
 constexpr size_t TLB_WAYS = 2;
 
+constexpr u32 HW_PAGE_INDEX_MASK = static_cast<u32>(TLB_SIZE / TLB_WAYS) - 1;
+
 struct TLBEntry
 {
   static constexpr u32 INVALID_TAG = 0xffffffff;
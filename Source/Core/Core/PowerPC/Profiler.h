@@ -14,8 +14,9 @@ namespace Profiler
 {
 struct BlockStat
 {
-  BlockStat(u32 _addr, u64 c, u64 ticks, u64 run, u32 size)
-      : addr(_addr), cost(c), tick_counter(ticks), run_count(run), block_size(size)
+  BlockStat(u32 _addr, u64 c, u64 ticks, u64 run, u32 size, u32 instructions)
+      : addr(_addr), cost(c), tick_counter(ticks), run_count(run), block_size(size),
+        instruction_count(instructions)
   {
   }
   u32 addr;
@@ -23,6 +24,8 @@ struct BlockStat
   u64 tick_counter;
   u64 run_count;
   u32 block_size;
+  // Number of PPC instructions in the block, for per-opcode attribution.
+  u32 instruction_count;
 
   bool operator<(const BlockStat& other) const { return cost > other.cost; }
 };
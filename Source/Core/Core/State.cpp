@@ -4,6 +4,8 @@
 
 #include "Core/State.h"
 
+#include <algorithm>
+#include <atomic>
 #include <lzo/lzo1x.h>
 #include <map>
 #include <mutex>
@@ -12,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "Common/CPUDetect.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
@@ -56,8 +59,6 @@ static unsigned char __LZO_MMODEL out[OUT_LEN];
 #define HEAP_ALLOC(var, size)                                                                      \
   lzo_align_t __LZO_MMODEL var[((size) + (sizeof(lzo_align_t) - 1)) / sizeof(lzo_align_t)]
 
-static HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
-
 static std::string g_last_filename;
 
 static AfterLoadCallbackFunc s_on_after_load_callback;
@@ -74,7 +75,7 @@ static Common::Event g_compressAndDumpStateSyncEvent;
 static std::thread g_save_thread;
 
 // Don't forget to increase this after doing changes on the savestate system
-static const u32 STATE_VERSION = 105;  // Last changed in PR 7871
+static const u32 STATE_VERSION = 109;  // Last changed: IOS default replies are batched
 
 // Maps savestate versions to Dolphin versions.
 // Versions after 42 don't need to be added to this list,
@@ -216,15 +217,10 @@ void LoadFromBuffer(std::vector<u8>& buffer)
 void SaveToBuffer(std::vector<u8>& buffer)
 {
   Core::RunAsCPUThread([&] {
-    u8* ptr = nullptr;
-    PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-
-    DoState(p);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-    buffer.resize(buffer_size);
-
-    ptr = &buffer[0];
-    p.SetMode(PointerWrap::MODE_WRITE);
+    // Appending runs the DoState tree only once; the buffer keeps its
+    // allocation between saves, so steady-state saves don't reallocate.
+    buffer.clear();
+    PointerWrap p(&buffer);
     DoState(p);
   });
 }
@@ -344,32 +340,58 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 
   if (header.size != 0)  // non-zero header size means the state is compressed
   {
-    lzo_uint i = 0;
-    while (true)
+    // The chunks are compressed independently of each other, so they can be spread
+    // across the cores (each worker gets its own LZO work memory) and written out
+    // in order afterwards. The file format doesn't change.
+    const size_t num_chunks = buffer_size / IN_LEN + 1;  // the last chunk may be empty
+    const u32 num_threads = static_cast<u32>(
+        std::min<size_t>(std::min(std::max(cpu_info.num_cores, 1), 8), num_chunks));
+
+    struct CompressedChunk
     {
-      lzo_uint32 cur_len = 0;
-      lzo_uint out_len = 0;
+      std::vector<u8> data;
+      lzo_uint32 out_len = 0;
+    };
+    std::vector<CompressedChunk> chunks(num_chunks);
+    std::atomic<bool> error{false};
 
-      if ((i + IN_LEN) >= buffer_size)
-      {
-        cur_len = (lzo_uint32)(buffer_size - i);
-      }
-      else
+    const auto compress_chunks = [&](u32 thread_index) {
+      HEAP_ALLOC(wrkmem, LZO1X_1_MEM_COMPRESS);
+      unsigned char chunk_out[OUT_LEN];
+
+      for (size_t chunk = thread_index; chunk < num_chunks; chunk += num_threads)
       {
-        cur_len = IN_LEN;
+        const size_t offset = chunk * IN_LEN;
+        const lzo_uint32 cur_len =
+            static_cast<lzo_uint32>(std::min<size_t>(IN_LEN, buffer_size - offset));
+
+        lzo_uint out_len = 0;
+        if (lzo1x_1_compress(buffer_data + offset, cur_len, chunk_out, &out_len, wrkmem) !=
+            LZO_E_OK)
+        {
+          error = true;
+          return;
+        }
+        chunks[chunk].data.assign(chunk_out, chunk_out + out_len);
+        chunks[chunk].out_len = static_cast<lzo_uint32>(out_len);
       }
+    };
 
-      if (lzo1x_1_compress(buffer_data + i, cur_len, out, &out_len, wrkmem) != LZO_E_OK)
-        PanicAlertT("Internal LZO Error - compression failed");
-
-      // The size of the data to write is 'out_len'
-      f.WriteArray((lzo_uint32*)&out_len, 1);
-      f.WriteBytes(out, out_len);
+    std::vector<std::thread> threads;
+    for (u32 i = 1; i < num_threads; i++)
+      threads.emplace_back(compress_chunks, i);
+    compress_chunks(0);
+    for (std::thread& thread : threads)
+      thread.join();
 
-      if (cur_len != IN_LEN)
-        break;
+    if (error)
+      PanicAlertT("Internal LZO Error - compression failed");
 
-      i += cur_len;
+    for (const CompressedChunk& chunk : chunks)
+    {
+      // The size of the data to write is 'out_len'
+      f.WriteArray(&chunk.out_len, 1);
+      f.WriteBytes(chunk.data.data(), chunk.out_len);
     }
   }
   else  // uncompressed
@@ -384,22 +406,19 @@ static void CompressAndDumpState(CompressAndDumpState_args save_args)
 void SaveAs(const std::string& filename, bool wait)
 {
   Core::RunAsCPUThread([&] {
-    // Measure the size of the buffer.
-    u8* ptr = nullptr;
-    PointerWrap p(&ptr, PointerWrap::MODE_MEASURE);
-    DoState(p);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-    // Then actually do the write.
+    // Appending runs the DoState tree only once, instead of doing a
+    // measuring dry run first; the buffer keeps its allocation between
+    // saves, so steady-state saves don't reallocate either.
+    PointerWrap::Mode final_mode;
     {
       std::lock_guard<std::mutex> lk(g_cs_current_buffer);
-      g_current_buffer.resize(buffer_size);
-      ptr = &g_current_buffer[0];
-      p.SetMode(PointerWrap::MODE_WRITE);
+      g_current_buffer.clear();
+      PointerWrap p(&g_current_buffer);
       DoState(p);
+      final_mode = p.GetMode();
     }
 
-    if (p.GetMode() == PointerWrap::MODE_WRITE)
+    if (final_mode == PointerWrap::MODE_APPEND)
     {
       Core::DisplayMessage("Saving State...", 1000);
 
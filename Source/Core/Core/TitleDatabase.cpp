@@ -10,6 +10,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
@@ -47,10 +48,100 @@ static Map LoadMap(const std::string& file_path)
   return map;
 }
 
+// The databases are tens of thousands of lines of text, so the parsed result
+// is mirrored into a binary sidecar in the cache directory and reused as long
+// as the source file's size and modification time are unchanged.
+constexpr u32 TITLE_CACHE_MAGIC = 0x31424454;  // "TDB1"
+constexpr u32 TITLE_CACHE_VERSION = 1;
+
+struct TitleCacheHeader
+{
+  u32 magic;
+  u32 version;
+  u64 source_size;
+  u64 source_time;
+  u32 num_entries;
+};
+
+static bool LoadMapFromCache(const std::string& cache_path, const File::FileInfo& source_info,
+                             Map* map)
+{
+  File::IOFile file(cache_path, "rb");
+  if (!file)
+    return false;
+
+  TitleCacheHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != TITLE_CACHE_MAGIC ||
+      header.version != TITLE_CACHE_VERSION || header.source_size != source_info.GetSize() ||
+      header.source_time != source_info.GetModificationTime())
+  {
+    return false;
+  }
+
+  map->reserve(header.num_entries);
+  for (u32 i = 0; i < header.num_entries; ++i)
+  {
+    u32 lengths[2];
+    if (!file.ReadArray(lengths, 2) || lengths[0] > 0x100 || lengths[1] > 0x10000)
+    {
+      map->clear();
+      return false;
+    }
+    std::string game_id(lengths[0], '\0');
+    std::string title(lengths[1], '\0');
+    if (!file.ReadBytes(&game_id[0], game_id.size()) || !file.ReadBytes(&title[0], title.size()))
+    {
+      map->clear();
+      return false;
+    }
+    map->emplace(std::move(game_id), std::move(title));
+  }
+  return true;
+}
+
+static void SaveMapToCache(const std::string& cache_path, const File::FileInfo& source_info,
+                           const Map& map)
+{
+  File::IOFile file(cache_path, "wb");
+  if (!file)
+    return;
+
+  const TitleCacheHeader header{TITLE_CACHE_MAGIC, TITLE_CACHE_VERSION, source_info.GetSize(),
+                                source_info.GetModificationTime(), static_cast<u32>(map.size())};
+  file.WriteArray(&header, 1);
+  for (const auto& entry : map)
+  {
+    const u32 lengths[2] = {static_cast<u32>(entry.first.size()),
+                            static_cast<u32>(entry.second.size())};
+    file.WriteArray(lengths, 2);
+    file.WriteBytes(entry.first.data(), entry.first.size());
+    file.WriteBytes(entry.second.data(), entry.second.size());
+  }
+}
+
+static Map LoadMapWithCache(const std::string& file_path)
+{
+  const File::FileInfo source_info(file_path);
+  if (!source_info.IsFile())
+    return Map();
+
+  std::string name;
+  SplitPath(file_path, nullptr, &name, nullptr);
+  const std::string cache_path = File::GetUserPath(D_CACHE_IDX) + name + ".tdb";
+
+  Map map;
+  if (LoadMapFromCache(cache_path, source_info, &map))
+    return map;
+
+  map = LoadMap(file_path);
+  SaveMapToCache(cache_path, source_info, map);
+  return map;
+}
+
 void TitleDatabase::AddLazyMap(DiscIO::Language language, const std::string& language_code)
 {
   m_title_maps[language] = [language_code]() -> Map {
-    return LoadMap(File::GetSysDirectory() + "wiitdb-" + language_code + ".txt");
+    return LoadMapWithCache(File::GetSysDirectory() + "wiitdb-" + language_code + ".txt");
   };
 }
 
@@ -58,9 +149,9 @@ TitleDatabase::TitleDatabase()
 {
   // User database
   const std::string& load_directory = File::GetUserPath(D_LOAD_IDX);
-  m_user_title_map = LoadMap(load_directory + "wiitdb.txt");
+  m_user_title_map = LoadMapWithCache(load_directory + "wiitdb.txt");
   if (m_user_title_map.empty())
-    m_user_title_map = LoadMap(load_directory + "titles.txt");
+    m_user_title_map = LoadMapWithCache(load_directory + "titles.txt");
 
   // Pre-defined databases (one per language)
   AddLazyMap(DiscIO::Language::Japanese, "ja");
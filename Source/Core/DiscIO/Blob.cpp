@@ -82,10 +82,32 @@ const SectorReader::Cache* SectorReader::GetCacheLine(u64 block_num)
   Cache* cache = GetEmptyCacheLine();
   // We only read aligned chunks, this avoids duplicate overlapping entries.
   u64 chunk_idx = block_num / m_chunk_blocks;
-  u32 blocks_read = ReadChunk(cache->data.data(), chunk_idx);
+
+  // Consecutive misses mean a sequential scan (FMV/audio streaming), so grow the
+  // readahead window to amortize per-read latency over fewer, larger reads. Any
+  // other access pattern drops straight back to a single chunk.
+  if (chunk_idx == m_next_sequential_chunk)
+    m_readahead_chunks = std::min(m_readahead_chunks * 2, MAX_READAHEAD_CHUNKS);
+  else
+    m_readahead_chunks = 1;
+
+  cache->data.resize(static_cast<size_t>(m_readahead_chunks) * m_chunk_blocks * m_block_size);
+
+  u32 blocks_read = 0;
+  for (u32 i = 0; i < m_readahead_chunks; i++)
+  {
+    const u32 chunk_blocks =
+        ReadChunk(cache->data.data() + static_cast<size_t>(i) * m_chunk_blocks * m_block_size,
+                  chunk_idx + i);
+    blocks_read += chunk_blocks;
+    // A short chunk means the end of the disk (or a failed read); stop extending.
+    if (chunk_blocks < m_chunk_blocks)
+      break;
+  }
   if (!blocks_read)
     return nullptr;
   cache->Fill(chunk_idx * m_chunk_blocks, blocks_read);
+  m_next_sequential_chunk = chunk_idx + ((blocks_read + m_chunk_blocks - 1) / m_chunk_blocks);
 
   // Secondary check for out-of-bounds read.
   // If we got less than m_chunk_blocks, we may still have missed.
@@ -149,8 +149,13 @@ private:
   u32 ReadChunk(u8* buffer, u64 chunk_num);
 
   static constexpr int CACHE_LINES = 32;
+  // Upper bound on the sequential readahead window, in chunks.
+  static constexpr u32 MAX_READAHEAD_CHUNKS = 8;
   u32 m_block_size = 0;    // Bytes in a sector/block
   u32 m_chunk_blocks = 1;  // Number of sectors/blocks in a chunk
+  // Chunk that would continue the last faulted read; used to detect sequential scans.
+  u64 m_next_sequential_chunk = ~static_cast<u64>(0);
+  u32 m_readahead_chunks = 1;  // Current readahead window, in chunks
   std::array<Cache, CACHE_LINES> m_cache;
 };
 
@@ -13,10 +13,12 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <zlib.h>
 
+#include "Common/CPUDetect.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
 #include "Common/FileUtil.h"
@@ -56,6 +58,8 @@ CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string&
   // I still add some safety margin.
   const u32 zlib_buffer_size = m_header.block_size + 64;
   m_zlib_buffer.resize(zlib_buffer_size);
+
+  inflateInit(&m_z_stream);
 }
 
 std::unique_ptr<CompressedBlobReader> CompressedBlobReader::Create(File::IOFile file,
@@ -70,6 +74,7 @@ std::unique_ptr<CompressedBlobReader> CompressedBlobReader::Create(File::IOFile
 
 CompressedBlobReader::~CompressedBlobReader()
 {
+  inflateEnd(&m_z_stream);
 }
 
 // IMPORTANT: Calling this function invalidates all earlier pointers gotten from this function.
@@ -124,7 +129,8 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
   }
   else
   {
-    z_stream z = {};
+    z_stream& z = m_z_stream;
+    inflateReset(&z);
     z.next_in = m_zlib_buffer.data();
     z.avail_in = comp_block_size;
     if (z.avail_in > m_header.block_size)
@@ -133,7 +139,6 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
     }
     z.next_out = out_ptr;
     z.avail_out = m_header.block_size;
-    inflateInit(&z);
     int status = inflate(&z, Z_FULL_FLUSH);
     u32 uncomp_size = m_header.block_size - z.avail_out;
     if (status != Z_STREAM_END)
@@ -142,7 +147,6 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
       // to be sure, don't use compressed isos :P
       PanicAlert("Failure reading block %" PRIu64 " - out of data and not at end.", block_num);
     }
-    inflateEnd(&z);
     if (uncomp_size != m_header.block_size)
     {
       PanicAlert("Wrong block size");
@@ -193,10 +197,6 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
     scrubbing = true;
   }
 
-  z_stream z = {};
-  if (deflateInit(&z, 9) != Z_OK)
-    return false;
-
   callback(GetStringT("Files opened, ready to compress."), 0, arg);
 
   CompressedBlobHeader header;
@@ -210,8 +210,35 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
 
   std::vector<u64> offsets(header.num_blocks);
   std::vector<u32> hashes(header.num_blocks);
-  std::vector<u8> out_buf(block_size);
-  std::vector<u8> in_buf(block_size);
+
+  // Blocks compress independently of each other, so spread them over the available
+  // cores: each batch is read serially (the scrubber walks the image sequentially),
+  // compressed in parallel, then written out in order.
+  const u32 num_threads = static_cast<u32>(std::min(std::max(cpu_info.num_cores, 1), 8));
+  const u32 blocks_per_batch = num_threads * 32;
+
+  struct BlockResult
+  {
+    int comp_size;
+    bool store_uncompressed;
+  };
+  std::vector<std::vector<u8>> in_bufs(blocks_per_batch);
+  std::vector<std::vector<u8>> out_bufs(blocks_per_batch);
+  for (u32 i = 0; i < blocks_per_batch; i++)
+  {
+    in_bufs[i].resize(block_size);
+    out_bufs[i].resize(block_size);
+  }
+  std::vector<BlockResult> results(blocks_per_batch);
+
+  // One deflate stream per worker, reused across batches.
+  std::vector<z_stream> streams(num_threads);
+  for (z_stream& z : streams)
+  {
+    z = {};
+    if (deflateInit(&z, 9) != Z_OK)
+      return false;
+  }
 
   // seek past the header (we will write it at the end)
   outfile.Seek(sizeof(CompressedBlobHeader), SEEK_CUR);
@@ -224,87 +251,98 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
   u64 position = 0;
   int num_compressed = 0;
   int num_stored = 0;
-  int progress_monitor = std::max<int>(1, header.num_blocks / 1000);
   bool success = true;
 
-  for (u32 i = 0; i < header.num_blocks; i++)
-  {
-    if (i % progress_monitor == 0)
+  const auto compress_blocks = [&](u32 thread_index, u32 batch_blocks) {
+    z_stream& z = streams[thread_index];
+    for (u32 j = thread_index; j < batch_blocks; j += num_threads)
     {
-      const u64 inpos = infile.Tell();
-      int ratio = 0;
-      if (inpos != 0)
-        ratio = (int)(100 * position / inpos);
-
-      std::string temp =
-          StringFromFormat(GetStringT("%i of %i blocks. Compression ratio %i%%").c_str(), i,
-                           header.num_blocks, ratio);
-      bool was_cancelled = !callback(temp, (float)i / (float)header.num_blocks, arg);
-      if (was_cancelled)
-      {
-        success = false;
-        break;
-      }
+      deflateReset(&z);
+      z.next_in = in_bufs[j].data();
+      z.avail_in = header.block_size;
+      z.next_out = out_bufs[j].data();
+      z.avail_out = block_size;
+
+      // If deflate fails for any reason, the block simply gets stored uncompressed.
+      const int status = deflate(&z, Z_FINISH);
+      results[j].comp_size = block_size - z.avail_out;
+      results[j].store_uncompressed = (status != Z_STREAM_END) || (z.avail_out < 10);
     }
+  };
 
-    offsets[i] = position;
-
-    size_t read_bytes;
-    if (scrubbing)
-      read_bytes = disc_scrubber.GetNextBlock(infile, in_buf.data());
-    else
-      infile.ReadArray(in_buf.data(), header.block_size, &read_bytes);
-    if (read_bytes < header.block_size)
-      std::fill(in_buf.begin() + read_bytes, in_buf.begin() + header.block_size, 0);
-
-    int retval = deflateReset(&z);
-    z.next_in = in_buf.data();
-    z.avail_in = header.block_size;
-    z.next_out = out_buf.data();
-    z.avail_out = block_size;
-
-    if (retval != Z_OK)
+  for (u32 i = 0; i < header.num_blocks; i += blocks_per_batch)
+  {
+    const u64 inpos = infile.Tell();
+    int ratio = 0;
+    if (inpos != 0)
+      ratio = (int)(100 * position / inpos);
+
+    std::string temp =
+        StringFromFormat(GetStringT("%i of %i blocks. Compression ratio %i%%").c_str(), i,
+                         header.num_blocks, ratio);
+    bool was_cancelled = !callback(temp, (float)i / (float)header.num_blocks, arg);
+    if (was_cancelled)
     {
-      ERROR_LOG(DISCIO, "Deflate failed");
       success = false;
       break;
     }
 
-    int status = deflate(&z, Z_FINISH);
-    int comp_size = block_size - z.avail_out;
+    const u32 batch_blocks = std::min(blocks_per_batch, header.num_blocks - i);
 
-    u8* write_buf;
-    int write_size;
-    if ((status != Z_STREAM_END) || (z.avail_out < 10))
+    for (u32 j = 0; j < batch_blocks; j++)
     {
-      // PanicAlert("%i %i Store %i", i*block_size, position, comp_size);
-      // let's store uncompressed
-      write_buf = in_buf.data();
-      offsets[i] |= 0x8000000000000000ULL;
-      write_size = block_size;
-      num_stored++;
-    }
-    else
-    {
-      // let's store compressed
-      // PanicAlert("Comp %i to %i", block_size, comp_size);
-      write_buf = out_buf.data();
-      write_size = comp_size;
-      num_compressed++;
+      size_t read_bytes;
+      if (scrubbing)
+        read_bytes = disc_scrubber.GetNextBlock(infile, in_bufs[j].data());
+      else
+        infile.ReadArray(in_bufs[j].data(), header.block_size, &read_bytes);
+      if (read_bytes < header.block_size)
+        std::fill(in_bufs[j].begin() + read_bytes, in_bufs[j].begin() + header.block_size, 0);
     }
 
-    if (!outfile.WriteBytes(write_buf, write_size))
+    std::vector<std::thread> workers;
+    for (u32 t = 1; t < num_threads; t++)
+      workers.emplace_back(compress_blocks, t, batch_blocks);
+    compress_blocks(0, batch_blocks);
+    for (std::thread& worker : workers)
+      worker.join();
+
+    for (u32 j = 0; j < batch_blocks; j++)
     {
-      PanicAlertT("Failed to write the output file \"%s\".\n"
-                  "Check that you have enough space available on the target drive.",
-                  outfile_path.c_str());
-      success = false;
-      break;
-    }
+      offsets[i + j] = position;
+
+      u8* write_buf;
+      int write_size;
+      if (results[j].store_uncompressed)
+      {
+        write_buf = in_bufs[j].data();
+        offsets[i + j] |= 0x8000000000000000ULL;
+        write_size = block_size;
+        num_stored++;
+      }
+      else
+      {
+        write_buf = out_bufs[j].data();
+        write_size = results[j].comp_size;
+        num_compressed++;
+      }
 
-    position += write_size;
+      if (!outfile.WriteBytes(write_buf, write_size))
+      {
+        PanicAlertT("Failed to write the output file \"%s\".\n"
+                    "Check that you have enough space available on the target drive.",
+                    outfile_path.c_str());
+        success = false;
+        break;
+      }
+
+      position += write_size;
 
-    hashes[i] = Common::HashAdler32(write_buf, write_size);
+      hashes[i + j] = Common::HashAdler32(write_buf, write_size);
+    }
+
+    if (!success)
+      break;
   }
 
   header.compressed_data_size = position;
@@ -325,7 +363,8 @@ bool CompressFileToBlob(const std::string& infile_path, const std::string& outfi
   }
 
   // Cleanup
-  deflateEnd(&z);
+  for (z_stream& z : streams)
+    deflateEnd(&z);
 
   if (success)
   {
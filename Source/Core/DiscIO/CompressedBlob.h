@@ -16,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <zlib.h>
 
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
@@ -65,6 +66,9 @@ private:
   u64 m_file_size;
   std::vector<u8> m_zlib_buffer;
   std::string m_file_name;
+  // Reused across GetBlock() calls via inflateReset(), so the inflate state isn't
+  // reallocated for every 32K block.
+  z_stream m_z_stream = {};
 };
 
 }  // namespace
@@ -89,7 +89,27 @@ u64 DiscContent::GetSize() const
   return m_size;
 }
 
-bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
+File::IOFile* FileHandleCache::Open(const std::string& path)
+{
+  const auto it = std::find_if(m_cache.begin(), m_cache.end(),
+                               [&path](const auto& entry) { return entry.first == path; });
+  if (it != m_cache.end())
+  {
+    m_cache.splice(m_cache.begin(), m_cache, it);
+    return &m_cache.front().second;
+  }
+
+  File::IOFile file(path, "rb");
+  if (!file)
+    return nullptr;
+
+  if (m_cache.size() >= MAX_OPEN_FILES)
+    m_cache.pop_back();
+  m_cache.emplace_front(path, std::move(file));
+  return &m_cache.front().second;
+}
+
+bool DiscContent::Read(u64* offset, u64* length, u8** buffer, FileHandleCache* file_cache) const
 {
   if (m_size == 0)
     return true;
@@ -103,10 +123,15 @@ bool DiscContent::Read(u64* offset, u64* length, u8** buffer) const
 
     if (std::holds_alternative<std::string>(m_content_source))
     {
-      File::IOFile file(std::get<std::string>(m_content_source), "rb");
-      file.Seek(offset_in_content, SEEK_SET);
-      if (!file.ReadBytes(*buffer, bytes_to_read))
+      File::IOFile* const file = file_cache->Open(std::get<std::string>(m_content_source));
+      if (!file || !file->Seek(offset_in_content, SEEK_SET) ||
+          !file->ReadBytes(*buffer, bytes_to_read))
+      {
+        // Clear the error flag so that a failed read doesn't poison the cached handle
+        if (file)
+          file->Clear();
         return false;
+      }
     }
     else
     {
@@ -158,7 +183,7 @@ bool DiscContentContainer::Read(u64 offset, u64 length, u8* buffer) const
     // Zero fill to start of DiscContent data
     PadToAddress(it->GetOffset(), &offset, &length, &buffer);
 
-    if (!it->Read(&offset, &length, &buffer))
+    if (!it->Read(&offset, &length, &buffer, &m_file_cache))
       return false;
 
     ++it;
@@ -5,15 +5,18 @@
 #pragma once
 
 #include <cstddef>
+#include <list>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/File.h"
 #include "Common/FileUtil.h"
 #include "DiscIO/Blob.h"
 
@@ -30,6 +33,23 @@ enum class PartitionType : u32;
 // Returns true if the path is inside a DirectoryBlob and doesn't represent the DirectoryBlob itself
 bool ShouldHideFromGameList(const std::string& volume_path);
 
+// Keeps a bounded number of host files open across reads. Without it, every read of a
+// file-backed DiscContent pays an open/close syscall pair, which dominates the many
+// small reads games issue against extracted directories.
+class FileHandleCache
+{
+public:
+  // Returns an open handle for the path, or nullptr if it could not be opened.
+  // The handle stays valid until MAX_OPEN_FILES other paths have been opened.
+  File::IOFile* Open(const std::string& path);
+
+private:
+  static constexpr size_t MAX_OPEN_FILES = 16;
+
+  // Most recently used entries at the front.
+  std::list<std::pair<std::string, File::IOFile>> m_cache;
+};
+
 class DiscContent
 {
 public:
@@ -44,7 +64,7 @@ public:
   u64 GetOffset() const;
   u64 GetEndOffset() const;
   u64 GetSize() const;
-  bool Read(u64* offset, u64* length, u8** buffer) const;
+  bool Read(u64* offset, u64* length, u8** buffer, FileHandleCache* file_cache) const;
 
   bool operator==(const DiscContent& other) const { return GetEndOffset() == other.GetEndOffset(); }
   bool operator!=(const DiscContent& other) const { return !(*this == other); }
@@ -76,6 +96,7 @@ public:
 
 private:
   std::set<DiscContent> m_contents;
+  mutable FileHandleCache m_file_cache;
 };
 
 class DirectoryBlobPartition
@@ -0,0 +1,190 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "DiscIO/DiscDigest.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <mbedtls/sha1.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscScrubber.h"
+
+namespace DiscIO
+{
+constexpr u32 DIGEST_CHUNK_SIZE = 8 * 1024 * 1024;
+// Must be a factor of the 0x8000 cluster size so DiscScrubber can skip junk clusters
+constexpr u32 DIGEST_SCRUB_BLOCK_SIZE = 0x8000;
+constexpr u32 DIGEST_CACHE_MAGIC = 0x31434444;  // "DDC1"
+
+using ChunkDigest = std::array<u8, 20>;
+
+static std::string DigestCachePath(const std::string& file_path)
+{
+  u8 path_hash[20];
+  mbedtls_sha1(reinterpret_cast<const u8*>(file_path.data()), file_path.size(), path_hash);
+
+  std::string name;
+  for (u8 n : path_hash)
+    name += StringFromFormat("%02x", n);
+  return File::GetUserPath(D_CACHE_IDX) + name + ".digest";
+}
+
+static bool LoadCachedChunkDigests(const std::string& cache_path, u64 file_size, u64 file_mtime,
+                                   u32 num_chunks, std::vector<ChunkDigest>* digests)
+{
+  File::IOFile cache(cache_path, "rb");
+
+  u32 magic = 0;
+  u64 cached_size = 0;
+  u64 cached_mtime = 0;
+  u32 cached_chunks = 0;
+  if (!cache.ReadArray(&magic, 1) || !cache.ReadArray(&cached_size, 1) ||
+      !cache.ReadArray(&cached_mtime, 1) || !cache.ReadArray(&cached_chunks, 1))
+  {
+    return false;
+  }
+
+  if (magic != DIGEST_CACHE_MAGIC || cached_size != file_size || cached_mtime != file_mtime ||
+      cached_chunks != num_chunks)
+  {
+    return false;
+  }
+
+  digests->resize(num_chunks);
+  return cache.ReadArray(digests->data(), num_chunks);
+}
+
+// Best effort - a failed write just means the next verification hashes everything again
+static void SaveChunkDigests(const std::string& cache_path, u64 file_size, u64 file_mtime,
+                             const std::vector<ChunkDigest>& digests)
+{
+  File::IOFile cache(cache_path, "wb");
+  const u32 num_chunks = static_cast<u32>(digests.size());
+  cache.WriteArray(&DIGEST_CACHE_MAGIC, 1);
+  cache.WriteArray(&file_size, 1);
+  cache.WriteArray(&file_mtime, 1);
+  cache.WriteArray(&num_chunks, 1);
+  cache.WriteArray(digests.data(), digests.size());
+}
+
+static bool HashAllChunks(const std::string& file_path, BlobReader* blob, u64 data_size,
+                          u32 num_chunks, std::vector<ChunkDigest>* digests,
+                          std::function<bool(int)>& report_progress)
+{
+  // For plain Wii images, let the scrubber walk the image so junk clusters are
+  // zeroed (and their reads skipped) - this makes the digest independent of
+  // whether the copy was scrubbed. Compressed formats are read through the blob.
+  DiscScrubber scrubber;
+  File::IOFile file;
+  const bool use_scrubber = blob->GetBlobType() == BlobType::PLAIN &&
+                            scrubber.SetupScrub(file_path, DIGEST_SCRUB_BLOCK_SIZE) &&
+                            file.Open(file_path, "rb");
+
+  // One chunk per thread per batch: the reads happen serially (the scrubber and most
+  // blob readers are stateful), then the hashing fans out across the cores.
+  const u32 num_threads = static_cast<u32>(std::min(std::max(cpu_info.num_cores, 1), 8));
+  std::vector<std::vector<u8>> buffers(num_threads, std::vector<u8>(DIGEST_CHUNK_SIZE));
+  std::vector<size_t> chunk_sizes(num_threads);
+  std::vector<std::thread> threads;
+
+  digests->resize(num_chunks);
+
+  for (u32 chunk = 0; chunk < num_chunks; chunk += num_threads)
+  {
+    const u32 batch_chunks = std::min(num_threads, num_chunks - chunk);
+
+    for (u32 j = 0; j < batch_chunks; j++)
+    {
+      const u64 offset = static_cast<u64>(chunk + j) * DIGEST_CHUNK_SIZE;
+      const size_t chunk_size =
+          static_cast<size_t>(std::min<u64>(DIGEST_CHUNK_SIZE, data_size - offset));
+      chunk_sizes[j] = chunk_size;
+
+      if (use_scrubber)
+      {
+        size_t bytes_read = 0;
+        while (bytes_read < chunk_size)
+        {
+          const size_t block_bytes = scrubber.GetNextBlock(file, buffers[j].data() + bytes_read);
+          if (block_bytes == 0)
+            return false;
+          bytes_read += block_bytes;
+        }
+      }
+      else if (!blob->Read(offset, chunk_size, buffers[j].data()))
+      {
+        return false;
+      }
+    }
+
+    const auto hash_chunks = [&](u32 thread_index) {
+      for (u32 j = thread_index; j < batch_chunks; j += num_threads)
+        mbedtls_sha1(buffers[j].data(), chunk_sizes[j], (*digests)[chunk + j].data());
+    };
+
+    threads.clear();
+    for (u32 i = 1; i < num_threads; i++)
+      threads.emplace_back(hash_chunks, i);
+    hash_chunks(0);
+    for (std::thread& t : threads)
+      t.join();
+
+    const int progress = static_cast<int>(static_cast<u64>(chunk + batch_chunks) * 100 / num_chunks);
+    if (!report_progress(progress))
+      return false;
+  }
+
+  return true;
+}
+
+std::string ComputeDiscDigest(const std::string& file_path,
+                              std::function<bool(int)> report_progress)
+{
+  std::string output_string;
+
+  std::unique_ptr<BlobReader> blob(CreateBlobReader(file_path));
+  if (!blob)
+    return output_string;
+
+  const u64 data_size = blob->GetDataSize();
+  if (data_size == 0)
+    return output_string;
+  const u32 num_chunks = static_cast<u32>((data_size + DIGEST_CHUNK_SIZE - 1) / DIGEST_CHUNK_SIZE);
+
+  const File::FileInfo file_info(file_path);
+  const u64 file_mtime = file_info.GetModificationTime();
+  const std::string cache_path = DigestCachePath(file_path);
+
+  std::vector<ChunkDigest> chunk_digests;
+  if (!LoadCachedChunkDigests(cache_path, file_info.GetSize(), file_mtime, num_chunks,
+                              &chunk_digests))
+  {
+    if (!HashAllChunks(file_path, blob.get(), data_size, num_chunks, &chunk_digests,
+                       report_progress))
+    {
+      return output_string;
+    }
+    SaveChunkDigests(cache_path, file_info.GetSize(), file_mtime, chunk_digests);
+  }
+
+  u8 output[20];
+  mbedtls_sha1(chunk_digests[0].data(), chunk_digests.size() * sizeof(ChunkDigest), output);
+
+  for (u8 n : output)
+    output_string += StringFromFormat("%02x", n);
+
+  return output_string;
+}
+
+}  // namespace DiscIO
@@ -0,0 +1,26 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+namespace DiscIO
+{
+// Computes a hex SHA-1 digest identifying the meaningful contents of a disc image.
+//
+// The image is hashed in fixed-size chunks (in parallel across CPU cores), with junk
+// clusters of plain Wii images skipped via DiscScrubber, so scrubbed and unscrubbed
+// copies of the same disc produce the same digest. The per-chunk digests are cached
+// in the user's cache directory keyed by the image's size and modification time,
+// making re-verification of an unchanged image nearly instant. Note that the result
+// is a hash of the chunk hashes, not the SHA-1 of the raw file.
+//
+// report_progress is called with a percentage; returning false from it cancels the
+// computation. Returns an empty string on failure or cancellation.
+std::string ComputeDiscDigest(const std::string& file_path,
+                              std::function<bool(int)> report_progress);
+
+}  // namespace DiscIO
@@ -18,6 +18,7 @@ class PlainFileReader : public BlobReader
 {
 public:
   static std::unique_ptr<PlainFileReader> Create(File::IOFile file);
+  ~PlainFileReader();
 
   BlobType GetBlobType() const override { return BlobType::PLAIN; }
   u64 GetDataSize() const override { return m_size; }
@@ -27,8 +28,16 @@ public:
 private:
   PlainFileReader(File::IOFile file);
 
+  void MapFile();
+  void UnmapFile();
+
   File::IOFile m_file;
   s64 m_size;
+  // Read-only mapping of the image, when the platform gave us one.
+  u8* m_map = nullptr;
+#ifdef _WIN32
+  void* m_mapping_handle = nullptr;
+#endif
 };
 
 }  // namespace
@@ -6,10 +6,12 @@
 #include <cinttypes>
 #include <cstddef>
 #include <cstring>
+#include <locale>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonFuncs.h"
@@ -27,6 +29,13 @@ namespace DiscIO
 {
 constexpr u32 FST_ENTRY_SIZE = 4 * 3;  // An FST entry consists of three 32-bit integers
 
+static std::string ASCIIToLowercase(std::string str)
+{
+  std::transform(str.begin(), str.end(), str.begin(),
+                 [](char c) { return std::tolower(c, std::locale::classic()); });
+  return str;
+}
+
 // Set everything manually.
 FileInfoGCWii::FileInfoGCWii(const u8* fst, u8 offset_shift, u32 index, u32 total_file_infos)
     : m_fst(fst), m_offset_shift(offset_shift), m_index(index), m_total_file_infos(total_file_infos)
@@ -262,38 +271,55 @@ std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path)
   if (!IsValid())
     return nullptr;
 
-  return FindFileInfo(path, m_root);
+  // Build a cache (unless there already is one)
+  if (m_path_file_info_cache.empty())
+    BuildPathCache();
+
+  // Normalize the path the same way BuildPathCache builds its keys:
+  // leading, trailing and repeated slashes are skipped, and matching is
+  // case-insensitive (which in practice means ASCII-case-insensitive)
+  std::string normalized_path;
+  size_t name_start = path.find_first_not_of('/');
+  while (name_start != std::string::npos)
+  {
+    const size_t name_end = path.find('/', name_start);
+    if (!normalized_path.empty())
+      normalized_path += '/';
+    normalized_path += path.substr(name_start, name_end - name_start);
+    name_start = (name_end == std::string::npos) ? std::string::npos :
+                                                   path.find_first_not_of('/', name_end);
+  }
+
+  if (normalized_path.empty())
+    return m_root.clone();  // We're done
+
+  const auto it = m_path_file_info_cache.find(ASCIIToLowercase(std::move(normalized_path)));
+  if (it == m_path_file_info_cache.end())
+    return nullptr;
+  return std::make_unique<FileInfoGCWii>(m_root, it->second);
 }
 
-std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(const std::string& path,
-                                                        const FileInfo& file_info) const
+void FileSystemGCWii::BuildPathCache() const
 {
-  // Given a path like "directory1/directory2/fileA.bin", this function will
-  // find directory1 and then call itself to search for "directory2/fileA.bin".
-
-  const size_t name_start = path.find_first_not_of('/');
-  if (name_start == std::string::npos)
-    return file_info.clone();  // We're done
+  const u32 fst_entries = m_root.GetSize();
 
-  const size_t name_end = path.find('/', name_start);
-  const std::string name = path.substr(name_start, name_end - name_start);
-  const std::string rest_of_path = (name_end != std::string::npos) ? path.substr(name_end + 1) : "";
+  // The next FST index that is outside each directory we are currently inside,
+  // paired with that directory's path prefix. The root contains everything.
+  std::vector<std::pair<u32, std::string>> directory_stack{{fst_entries, ""}};
 
-  for (const FileInfo& child : file_info)
+  for (u32 i = 1; i < fst_entries; i++)
   {
-    if (!strcasecmp(child.GetName().c_str(), name.c_str()))
-    {
-      // A match is found. The rest of the path is passed on to finish the search.
-      std::unique_ptr<FileInfo> result = FindFileInfo(rest_of_path, child);
+    while (i >= directory_stack.back().first)
+      directory_stack.pop_back();
 
-      // If the search wasn't successful, the loop continues, just in case there's a second
-      // file info that matches searching_for (which probably won't happen in practice)
-      if (result)
-        return result;
-    }
-  }
+    const FileInfoGCWii file_info(m_root, i);
+    const std::string path = directory_stack.back().second + ASCIIToLowercase(file_info.GetName());
+    // If there are several file infos with the same path, the first one wins
+    m_path_file_info_cache.emplace(path, i);
 
-  return nullptr;
+    if (file_info.IsDirectory())
+      directory_stack.emplace_back(file_info.GetSize(), path + '/');
+  }
 }
 
 std::unique_ptr<FileInfo> FileSystemGCWii::FindFileInfo(u64 disc_offset) const
@@ -34,8 +34,7 @@
 namespace DiscIO
 {
 VolumeWii::VolumeWii(std::unique_ptr<BlobReader> reader)
-    : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE),
-      m_last_decrypted_block(UINT64_MAX)
+    : m_reader(std::move(reader)), m_game_partition(PARTITION_NONE)
 {
   ASSERT(m_reader);
 
@@ -161,8 +160,13 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
                                offset / BLOCK_DATA_SIZE * BLOCK_TOTAL_SIZE;
     u64 data_offset_in_block = offset % BLOCK_DATA_SIZE;
 
-    if (m_last_decrypted_block != block_offset_on_disc)
+    DecryptedBlock& cache_entry =
+        m_decrypted_block_cache[(block_offset_on_disc / BLOCK_TOTAL_SIZE) %
+                                NUM_DECRYPTED_BLOCK_CACHE_ENTRIES];
+    if (cache_entry.offset_on_disc != block_offset_on_disc)
     {
+      cache_entry.offset_on_disc = UINT64_MAX;
+
       // Read the current block
       if (!m_reader->Read(block_offset_on_disc, BLOCK_TOTAL_SIZE, read_buffer.data()))
         return false;
@@ -172,8 +176,8 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
       // but that won't affect anything, because we won't
       // use the content of read_buffer anymore after this
       mbedtls_aes_crypt_cbc(aes_context, MBEDTLS_AES_DECRYPT, BLOCK_DATA_SIZE, &read_buffer[0x3D0],
-                            &read_buffer[BLOCK_HEADER_SIZE], m_last_decrypted_block_data);
-      m_last_decrypted_block = block_offset_on_disc;
+                            &read_buffer[BLOCK_HEADER_SIZE], cache_entry.data);
+      cache_entry.offset_on_disc = block_offset_on_disc;
 
       // The only thing we currently use from the 0x000 - 0x3FF part
       // of the block is the IV (at 0x3D0), but it also contains SHA-1
@@ -183,8 +187,7 @@ bool VolumeWii::Read(u64 offset, u64 length, u8* buffer, const Partition& partit
 
     // Copy the decrypted data
     u64 copy_size = std::min(length, BLOCK_DATA_SIZE - data_offset_in_block);
-    memcpy(buffer, &m_last_decrypted_block_data[data_offset_in_block],
-           static_cast<size_t>(copy_size));
+    memcpy(buffer, &cache_entry.data[data_offset_in_block], static_cast<size_t>(copy_size));
 
     // Update offsets
     length -= copy_size;
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <mbedtls/aes.h>
 #include <memory>
@@ -87,8 +88,17 @@ private:
   Partition m_game_partition;
   bool m_encrypted;
 
-  mutable u64 m_last_decrypted_block;
-  mutable u8 m_last_decrypted_block_data[BLOCK_DATA_SIZE];
+  // Small direct-mapped cache of decrypted blocks. A single entry thrashes as soon
+  // as a game interleaves two streams (audio streaming plus file data), decrypting
+  // the same blocks over and over; mapping by block index keeps nearby streams in
+  // separate slots.
+  static constexpr size_t NUM_DECRYPTED_BLOCK_CACHE_ENTRIES = 8;
+  struct DecryptedBlock
+  {
+    u64 offset_on_disc = UINT64_MAX;
+    u8 data[BLOCK_DATA_SIZE];
+  };
+  mutable std::array<DecryptedBlock, NUM_DECRYPTED_BLOCK_CACHE_ENTRIES> m_decrypted_block_cache;
 };
 
 }  // namespace
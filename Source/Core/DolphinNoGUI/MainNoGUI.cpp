@@ -5,19 +5,28 @@
 #include "DolphinNoGUI/Platform.h"
 
 #include <OptionParser.h>
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <signal.h>
 #include <string>
+#include <thread>
+#include <variant>
+#include <vector>
 #ifndef _WIN32
 #include <unistd.h>
 #endif
 
+#include "Common/Timer.h"
 #include "Core/Analytics.h"
 #include "Core/Boot/Boot.h"
 #include "Core/BootManager.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
 #include "Core/Host.h"
 
 #include "UICommon/CommandLineParse.h"
@@ -120,6 +129,121 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+// Frame timestamps collected from the FifoPlayer callbacks while benchmarking.
+static std::vector<u64> s_benchmark_frame_times;
+static u32 s_benchmark_frames_played;
+static u32 s_benchmark_frames_target;
+static int s_benchmark_loops;
+
+static void BenchmarkFrameWritten()
+{
+  s_benchmark_frame_times.push_back(Common::Timer::GetTimeUs());
+  if (++s_benchmark_frames_played >= s_benchmark_frames_target)
+    s_platform->RequestShutdown();
+}
+
+// Plays each capture for the requested number of loops and prints one CSV row of
+// frame time statistics per capture, so runs can be diffed by scripts instead of
+// eyeballed. Per-frame times can additionally be dumped with --benchmark-output.
+static int RunFifoPlayerBenchmark(const optparse::Values& options,
+                                  const std::vector<std::string>& files)
+{
+  s_benchmark_loops = std::max(1, static_cast<int>(options.get("benchmark_loops")));
+
+  std::ofstream frame_output;
+  if (options.is_set("benchmark_output"))
+  {
+    frame_output.open(static_cast<const char*>(options.get("benchmark_output")));
+    if (!frame_output)
+    {
+      std::fprintf(stderr, "Could not open benchmark output file\n");
+      return 1;
+    }
+    frame_output << "capture,frame,frame_time_us" << std::endl;
+  }
+
+  // The benchmark relies on playback looping until the target frame count is hit.
+  SConfig::GetInstance().bLoopFifoReplay = true;
+
+  FifoPlayer& player = FifoPlayer::GetInstance();
+  player.SetFrameWrittenCallback(BenchmarkFrameWritten);
+  player.SetFileLoadedCallback([] {
+    const FifoDataFile* file = FifoPlayer::GetInstance().GetFile();
+    if (file)
+      s_benchmark_frames_target = s_benchmark_loops * file->GetFrameCount();
+  });
+
+  std::printf("capture,frames,loops,total_ms,avg_ms,min_ms,max_ms\n");
+
+  for (size_t i = 0; i < files.size(); ++i)
+  {
+    std::unique_ptr<BootParameters> boot = BootParameters::GenerateFromFile(files[i]);
+    if (!boot || !std::holds_alternative<BootParameters::DFF>(boot->parameters))
+    {
+      std::fprintf(stderr, "%s is not a fifo log\n", files[i].c_str());
+      return 1;
+    }
+
+    s_benchmark_frames_played = 0;
+    s_benchmark_frames_target = 0;
+    s_benchmark_frame_times.clear();
+
+    if (!BootManager::BootCore(std::move(boot), s_platform->GetWindowSystemInfo()))
+    {
+      std::fprintf(stderr, "Could not play %s\n", files[i].c_str());
+      return 1;
+    }
+
+    // Start loading the next capture while this one renders.
+    if (i + 1 < files.size())
+      player.PreloadFile(files[i + 1]);
+
+    s_platform->MainLoop();
+    Core::Stop();
+
+    // Wait for emulation to be fully torn down before booting the next capture.
+    while (Core::GetState() != Core::State::Uninitialized)
+    {
+      Core::HostDispatchJobs();
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    if (s_benchmark_frame_times.size() > 1)
+    {
+      u64 min_time = ~u64(0);
+      u64 max_time = 0;
+      for (size_t frame = 1; frame < s_benchmark_frame_times.size(); ++frame)
+      {
+        const u64 frame_time = s_benchmark_frame_times[frame] - s_benchmark_frame_times[frame - 1];
+        min_time = std::min(min_time, frame_time);
+        max_time = std::max(max_time, frame_time);
+        if (frame_output)
+          frame_output << files[i] << ',' << frame << ',' << frame_time << std::endl;
+      }
+      const u64 total_time = s_benchmark_frame_times.back() - s_benchmark_frame_times.front();
+      const size_t num_frames = s_benchmark_frame_times.size() - 1;
+      std::printf("%s,%zu,%d,%.2f,%.3f,%.3f,%.3f\n", files[i].c_str(), num_frames,
+                  s_benchmark_loops, total_time / 1000.0, total_time / 1000.0 / num_frames,
+                  min_time / 1000.0, max_time / 1000.0);
+      std::fflush(stdout);
+    }
+
+    // The platform's running flag is spent after a shutdown; replace it for the
+    // next capture.
+    if (i + 1 < files.size())
+    {
+      s_platform = GetPlatform(options);
+      if (!s_platform || !s_platform->Init())
+      {
+        std::fprintf(stderr, "Failed to reinitialize platform.\n");
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
+
 int main(int argc, char* argv[])
 {
   auto parser = CommandLineParse::CreateParser(CommandLineParse::ParserOptions::OmitGUIOptions);
@@ -133,12 +257,34 @@ int main(int argc, char* argv[])
             "x11"
 #endif
       });
+  parser->add_option("--benchmark")
+      .action("store_true")
+      .help("Play back the given fifo logs as a benchmark and print frame time statistics");
+  parser->add_option("--benchmark-loops")
+      .action("store")
+      .type("int")
+      .set_default(1)
+      .help("Number of times to loop each capture in benchmark mode [default: %default]");
+  parser->add_option("--benchmark-output")
+      .action("store")
+      .help("File to write per-frame benchmark timings to (CSV)");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
 
+  const bool benchmark = options.is_set("benchmark");
+
   std::unique_ptr<BootParameters> boot;
-  if (options.is_set("exec"))
+  if (benchmark)
+  {
+    if (args.empty())
+    {
+      fprintf(stderr, "No fifo logs specified\n");
+      parser->print_help();
+      return 1;
+    }
+  }
+  else if (options.is_set("exec"))
   {
     const std::list<std::string> paths_list = options.all("exec");
     const std::vector<std::string> paths{std::make_move_iterator(std::begin(paths_list)),
@@ -197,22 +343,31 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance()->ReportDolphinStart("nogui");
 
-  if (!BootManager::BootCore(std::move(boot), s_platform->GetWindowSystemInfo()))
+  int ret_code = 0;
+  if (benchmark)
   {
-    fprintf(stderr, "Could not boot the specified file\n");
-    return 1;
+    ret_code = RunFifoPlayerBenchmark(options, args);
+    Core::Stop();
   }
+  else
+  {
+    if (!BootManager::BootCore(std::move(boot), s_platform->GetWindowSystemInfo()))
+    {
+      fprintf(stderr, "Could not boot the specified file\n");
+      return 1;
+    }
 
 #ifdef USE_DISCORD_PRESENCE
-  Discord::UpdateDiscordPresence();
+    Discord::UpdateDiscordPresence();
 #endif
 
-  s_platform->MainLoop();
-  Core::Stop();
+    s_platform->MainLoop();
+    Core::Stop();
+  }
 
   Core::Shutdown();
   s_platform.reset();
   UICommon::Shutdown();
 
-  return 0;
+  return ret_code;
 }
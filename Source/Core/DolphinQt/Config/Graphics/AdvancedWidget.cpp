@@ -112,8 +112,10 @@ void AdvancedWidget::CreateWidgets()
 
   m_defer_efb_access_invalidation =
       new GraphicsBool(tr("Defer EFB Cache Invalidation"), Config::GFX_HACK_EFB_DEFER_INVALIDATION);
+  m_cpu_cull = new GraphicsBool(tr("Cull Vertices on the CPU"), Config::GFX_CPU_CULL);
 
   experimental_layout->addWidget(m_defer_efb_access_invalidation, 0, 0);
+  experimental_layout->addWidget(m_cpu_cull, 0, 1);
 
   main_layout->addWidget(debugging_box);
   main_layout->addWidget(utility_box);
@@ -210,6 +212,11 @@ void AdvancedWidget::AddDescriptions()
                  "is executed. If disabled, the cache will be invalidated with every draw call. "
                  "May improve performance in some games which rely on CPU EFB Access at the cost "
                  "of stability.\n\nIf unsure, leave this unchecked.");
+  static const char TR_CPU_CULL_DESCRIPTION[] =
+      QT_TR_NOOP("Transforms vertices on the CPU and skips draws where every triangle lands "
+                 "outside the view frustum. May improve performance in games which submit a lot "
+                 "of off-screen geometry, at the cost of CPU time per draw.\n\nIf unsure, leave "
+                 "this unchecked.");
 
 #ifdef _WIN32
   static const char TR_BORDERLESS_FULLSCREEN_DESCRIPTION[] = QT_TR_NOOP(
@@ -241,4 +248,5 @@ void AdvancedWidget::AddDescriptions()
   AddDescription(m_borderless_fullscreen, TR_BORDERLESS_FULLSCREEN_DESCRIPTION);
 #endif
   AddDescription(m_defer_efb_access_invalidation, TR_DEFER_EFB_ACCESS_INVALIDATION_DESCRIPTION);
+  AddDescription(m_cpu_cull, TR_CPU_CULL_DESCRIPTION);
 }
@@ -49,4 +49,5 @@ private:
 
   // Experimental
   QCheckBox* m_defer_efb_access_invalidation;
+  QCheckBox* m_cpu_cull;
 };
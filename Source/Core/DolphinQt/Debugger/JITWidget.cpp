@@ -161,10 +161,12 @@ void JITWidget::Update()
   if (analyzer.Analyze(ppc_addr, &code_block, &code_buffer, code_buffer.size()) != 0xFFFFFFFF)
   {
     std::ostringstream ppc_disasm;
+    std::string opcode;
     for (u32 i = 0; i < code_block.m_num_instructions; i++)
     {
       const PPCAnalyst::CodeOp& op = code_buffer[i];
-      const std::string opcode = Common::GekkoDisassembler::Disassemble(op.inst.hex, op.address);
+      opcode.clear();
+      Common::GekkoDisassembler::Disassemble(op.inst.hex, op.address, &opcode);
       ppc_disasm << std::setfill('0') << std::setw(8) << std::hex << op.address;
       ppc_disasm << " " << opcode << std::endl;
     }
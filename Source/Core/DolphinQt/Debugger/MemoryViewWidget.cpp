@@ -10,11 +10,14 @@
 #include <QMenu>
 #include <QMouseEvent>
 #include <QScrollBar>
+#include <QTimer>
 
 #include <cctype>
 #include <cmath>
+#include <cstring>
 
 #include "Core/Core.h"
+#include "Core/HW/Memmap.h"
 #include "Core/PowerPC/BreakPoints.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
@@ -35,8 +38,18 @@ MemoryViewWidget::MemoryViewWidget(QWidget* parent) : QTableWidget(parent)
 
   setFont(Settings::Instance().GetDebugFont());
 
+  // Periodically refresh from a fresh snapshot while the core runs; the
+  // capture never blocks the CPU thread, so an open memory view costs only
+  // GUI time.
+  m_auto_refresh_timer = new QTimer(this);
+  m_auto_refresh_timer->setInterval(100);
+  connect(m_auto_refresh_timer, &QTimer::timeout, this, &MemoryViewWidget::Update);
+
   connect(&Settings::Instance(), &Settings::DebugFontChanged, this, &QWidget::setFont);
-  connect(&Settings::Instance(), &Settings::EmulationStateChanged, this, [this] { Update(); });
+  connect(&Settings::Instance(), &Settings::EmulationStateChanged, this, [this] {
+    UpdateAutoRefresh();
+    Update();
+  });
   connect(this, &MemoryViewWidget::customContextMenuRequested, this,
           &MemoryViewWidget::OnContextMenu);
   connect(&Settings::Instance(), &Settings::ThemeChanged, this, &MemoryViewWidget::Update);
@@ -63,6 +76,97 @@ static int GetColumnCount(MemoryViewWidget::Type type)
   }
 }
 
+// Captures the bytes behind the visible rows into the front buffer, moving the
+// previous capture into the back buffer for diffing. While the core is running
+// the copy comes straight out of the emulated RAM mappings so the CPU thread is
+// never stalled; those reads can tear, but the buffer is only used for display.
+// When paused, reads go through the MMU so translated addresses also resolve.
+void MemoryViewWidget::CaptureSnapshot(u32 base_address, u32 size)
+{
+  m_prev_snapshot = std::move(m_snapshot);
+  m_prev_snapshot_valid = std::move(m_snapshot_valid);
+  m_prev_snapshot_base = m_snapshot_base;
+
+  m_snapshot.assign(size, 0);
+  m_snapshot_valid.assign(size, false);
+  m_snapshot_base = base_address;
+
+  const Core::State state = Core::GetState();
+  if (state == Core::State::Paused)
+  {
+    for (u32 i = 0; i < size; i++)
+    {
+      const u32 address = base_address + i;
+      if (PowerPC::HostIsRAMAddress(address))
+      {
+        m_snapshot[i] = PowerPC::HostRead_U8(address);
+        m_snapshot_valid[i] = true;
+      }
+    }
+  }
+  else if (state == Core::State::Running)
+  {
+    for (u32 i = 0; i < size; i++)
+    {
+      const u32 address = base_address + i;
+      if (Memory::m_pRAM && address >= 0x80000000 && address < 0x80000000 + Memory::RAM_SIZE)
+      {
+        m_snapshot[i] = Memory::m_pRAM[address & Memory::RAM_MASK];
+        m_snapshot_valid[i] = true;
+      }
+      else if (Memory::m_pEXRAM && address >= 0x90000000 &&
+               address < 0x90000000 + Memory::EXRAM_SIZE)
+      {
+        m_snapshot[i] = Memory::m_pEXRAM[address & Memory::EXRAM_MASK];
+        m_snapshot_valid[i] = true;
+      }
+    }
+  }
+}
+
+bool MemoryViewWidget::SnapshotBytes(u32 address, u32 size, u8* dest) const
+{
+  if (address < m_snapshot_base || address - m_snapshot_base + size > m_snapshot.size())
+    return false;
+
+  const u32 offset = address - m_snapshot_base;
+  for (u32 i = 0; i < size; i++)
+  {
+    if (!m_snapshot_valid[offset + i])
+      return false;
+    dest[i] = m_snapshot[offset + i];
+  }
+  return true;
+}
+
+bool MemoryViewWidget::SnapshotChanged(u32 address, u32 size) const
+{
+  if (address < m_prev_snapshot_base ||
+      address - m_prev_snapshot_base + size > m_prev_snapshot.size())
+  {
+    return false;
+  }
+
+  const u32 offset = address - m_snapshot_base;
+  const u32 prev_offset = address - m_prev_snapshot_base;
+  for (u32 i = 0; i < size; i++)
+  {
+    if (!m_prev_snapshot_valid[prev_offset + i])
+      return false;
+    if (m_snapshot[offset + i] != m_prev_snapshot[prev_offset + i])
+      return true;
+  }
+  return false;
+}
+
+void MemoryViewWidget::UpdateAutoRefresh()
+{
+  if (isVisible() && Core::GetState() == Core::State::Running)
+    m_auto_refresh_timer->start();
+  else
+    m_auto_refresh_timer->stop();
+}
+
 void MemoryViewWidget::Update()
 {
   clearSelection();
@@ -79,6 +183,9 @@ void MemoryViewWidget::Update()
 
   setRowCount(rows);
 
+  const u32 start_address = m_address - ((rows / 2) * 16);
+  CaptureSnapshot(start_address, rows * 16);
+
   for (int i = 0; i < rows; i++)
   {
     setRowHeight(i, 24);
@@ -101,7 +208,8 @@ void MemoryViewWidget::Update()
     if (addr == m_address)
       addr_item->setSelected(true);
 
-    if (Core::GetState() != Core::State::Paused || !PowerPC::HostIsRAMAddress(addr))
+    u8 row_probe[16];
+    if (!SnapshotBytes(addr, 16, row_probe))
     {
       for (int c = 2; c < columnCount(); c++)
       {
@@ -125,24 +233,31 @@ void MemoryViewWidget::Update()
 
     bool row_breakpoint = true;
 
+    const u32 elem_size = 16 / GetColumnCount(m_type);
+
     auto update_values = [&](auto value_to_string) {
       for (int c = 0; c < GetColumnCount(m_type); c++)
       {
         auto* hex_item = new QTableWidgetItem;
         hex_item->setFlags(Qt::ItemIsEnabled | Qt::ItemIsSelectable);
-        const u32 address = addr + c * (16 / GetColumnCount(m_type));
+        const u32 address = addr + c * elem_size;
 
-        if (PowerPC::memchecks.OverlapsMemcheck(address, 16 / GetColumnCount(m_type)))
+        if (PowerPC::memchecks.OverlapsMemcheck(address, elem_size))
           hex_item->setBackground(Qt::red);
         else
           row_breakpoint = false;
 
         setItem(i, 2 + c, hex_item);
 
-        if (PowerPC::HostIsRAMAddress(address))
+        u8 bytes[4];
+        if (SnapshotBytes(address, elem_size, bytes))
         {
-          hex_item->setText(value_to_string(address));
+          hex_item->setText(value_to_string(bytes));
           hex_item->setData(Qt::UserRole, address);
+
+          // Highlight values that changed since the previous snapshot.
+          if (SnapshotChanged(address, elem_size))
+            hex_item->setForeground(Qt::red);
         }
         else
         {
@@ -155,31 +270,35 @@ void MemoryViewWidget::Update()
     switch (m_type)
     {
     case Type::U8:
-      update_values([](u32 address) {
-        const u8 value = PowerPC::HostRead_U8(address);
-        return QStringLiteral("%1").arg(value, 2, 16, QLatin1Char('0'));
+      update_values([](const u8* bytes) {
+        return QStringLiteral("%1").arg(bytes[0], 2, 16, QLatin1Char('0'));
       });
       break;
     case Type::ASCII:
-      update_values([](u32 address) {
-        const char value = PowerPC::HostRead_U8(address);
+      update_values([](const u8* bytes) {
+        const char value = static_cast<char>(bytes[0]);
         return std::isprint(value) ? QString{QChar::fromLatin1(value)} : QStringLiteral(".");
       });
       break;
     case Type::U16:
-      update_values([](u32 address) {
-        const u16 value = PowerPC::HostRead_U16(address);
+      update_values([](const u8* bytes) {
+        const u16 value = (bytes[0] << 8) | bytes[1];
         return QStringLiteral("%1").arg(value, 4, 16, QLatin1Char('0'));
       });
       break;
     case Type::U32:
-      update_values([](u32 address) {
-        const u32 value = PowerPC::HostRead_U32(address);
+      update_values([](const u8* bytes) {
+        const u32 value = (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
         return QStringLiteral("%1").arg(value, 8, 16, QLatin1Char('0'));
       });
       break;
     case Type::Float32:
-      update_values([](u32 address) { return QString::number(PowerPC::HostRead_F32(address)); });
+      update_values([](const u8* bytes) {
+        const u32 value = (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+        float float_value;
+        std::memcpy(&float_value, &value, sizeof(float_value));
+        return QString::number(float_value);
+      });
       break;
     }
 
@@ -235,6 +354,19 @@ void MemoryViewWidget::resizeEvent(QResizeEvent*)
   Update();
 }
 
+void MemoryViewWidget::showEvent(QShowEvent* event)
+{
+  QTableWidget::showEvent(event);
+  UpdateAutoRefresh();
+  Update();
+}
+
+void MemoryViewWidget::hideEvent(QHideEvent* event)
+{
+  QTableWidget::hideEvent(event);
+  UpdateAutoRefresh();
+}
+
 void MemoryViewWidget::keyPressEvent(QKeyEvent* event)
 {
   switch (event->key())
@@ -4,10 +4,14 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QTableWidget>
 
 #include "Common/CommonTypes.h"
 
+class QTimer;
+
 class MemoryViewWidget : public QTableWidget
 {
   Q_OBJECT
@@ -46,6 +50,8 @@ public:
   void keyPressEvent(QKeyEvent* event) override;
   void mousePressEvent(QMouseEvent* event) override;
   void wheelEvent(QWheelEvent* event) override;
+  void showEvent(QShowEvent* event) override;
+  void hideEvent(QHideEvent* event) override;
 
 signals:
   void BreakpointsChanged();
@@ -56,9 +62,27 @@ private:
   void OnCopyAddress();
   void OnCopyHex();
 
+  void CaptureSnapshot(u32 base_address, u32 size);
+  bool SnapshotBytes(u32 address, u32 size, u8* dest) const;
+  bool SnapshotChanged(u32 address, u32 size) const;
+  void UpdateAutoRefresh();
+
   Type m_type = Type::U8;
   BPType m_bp_type = BPType::ReadWrite;
   bool m_do_log = true;
   u32 m_context_address;
   u32 m_address = 0;
+
+  QTimer* m_auto_refresh_timer;
+
+  // Double-buffered snapshot of the visible range. The front buffer backs the
+  // cell contents so the table never reads emulated memory directly; the back
+  // buffer is the previous capture, used to highlight bytes that changed
+  // between refreshes.
+  std::vector<u8> m_snapshot;
+  std::vector<bool> m_snapshot_valid;
+  std::vector<u8> m_prev_snapshot;
+  std::vector<bool> m_prev_snapshot_valid;
+  u32 m_snapshot_base = 0;
+  u32 m_prev_snapshot_base = 0;
 };
@@ -73,14 +73,20 @@ QVariant GameListModel::data(const QModelIndex& index, int role) const
   case COL_BANNER:
     if (role == Qt::DecorationRole)
     {
-      // GameCube banners are 96x32, but Wii banners are 192x64.
-      QPixmap banner = ToQPixmap(game.GetBannerImage());
+      // The view asks for decorations on every paint, so decode the banner
+      // once per row instead of rebuilding the pixmap while scrolling.
+      QPixmap& banner = m_banners[index.row()];
       if (banner.isNull())
-        banner = Resources::GetMisc(Resources::MiscID::BannerMissing);
-
-      banner.setDevicePixelRatio(
-          std::max(static_cast<qreal>(banner.width()) / GAMECUBE_BANNER_SIZE.width(),
-                   static_cast<qreal>(banner.height()) / GAMECUBE_BANNER_SIZE.height()));
+      {
+        // GameCube banners are 96x32, but Wii banners are 192x64.
+        banner = ToQPixmap(game.GetBannerImage());
+        if (banner.isNull())
+          banner = Resources::GetMisc(Resources::MiscID::BannerMissing);
+
+        banner.setDevicePixelRatio(
+            std::max(static_cast<qreal>(banner.width()) / GAMECUBE_BANNER_SIZE.width(),
+                     static_cast<qreal>(banner.height()) / GAMECUBE_BANNER_SIZE.height()));
+      }
 
       return banner;
     }
@@ -284,6 +290,7 @@ void GameListModel::AddGame(const std::shared_ptr<const UICommon::GameFile>& gam
 {
   beginInsertRows(QModelIndex(), m_games.size(), m_games.size());
   m_games.push_back(game);
+  m_banners.push_back(QPixmap());
   endInsertRows();
 }
 
@@ -297,6 +304,7 @@ void GameListModel::UpdateGame(const std::shared_ptr<const UICommon::GameFile>&
   else
   {
     m_games[index] = game;
+    m_banners[index] = QPixmap();
     emit dataChanged(createIndex(index, 0), createIndex(index + 1, columnCount(QModelIndex())));
   }
 }
@@ -309,6 +317,7 @@ void GameListModel::RemoveGame(const std::string& path)
 
   beginRemoveRows(QModelIndex(), entry, entry);
   m_games.removeAt(entry);
+  m_banners.removeAt(entry);
   endRemoveRows();
 }
 
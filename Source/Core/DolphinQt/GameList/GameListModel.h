@@ -9,6 +9,7 @@
 
 #include <QAbstractTableModel>
 #include <QMap>
+#include <QPixmap>
 #include <QString>
 #include <QStringList>
 #include <QVariant>
@@ -89,6 +90,9 @@ private:
 
   GameTracker m_tracker;
   QList<std::shared_ptr<const UICommon::GameFile>> m_games;
+  // Lazily decoded banner pixmaps, kept parallel to m_games. Mutable so
+  // data() can fill them in on first paint.
+  mutable QList<QPixmap> m_banners;
   Core::TitleDatabase m_title_database;
   QString m_term;
   float m_scale = 1.0;
@@ -7,6 +7,7 @@
 #include <QImage>
 #include <QPainter>
 #include <QPixmap>
+#include <QPixmapCache>
 #include <QSize>
 
 #include "DolphinQt/GameList/GameListModel.h"
@@ -21,6 +22,10 @@ GridProxyModel::GridProxyModel(QObject* parent) : QSortFilterProxyModel(parent)
 {
   setSortCaseSensitivity(Qt::CaseInsensitive);
   sort(GameListModel::COL_TITLE);
+
+  // The default 10MB pixmap cache only holds a few dozen scaled covers;
+  // give the whole library room so scrolling doesn't re-decode.
+  QPixmapCache::setCacheLimit(64 * 1024);
 }
 
 QVariant GridProxyModel::data(const QModelIndex& i, int role) const
@@ -60,11 +65,28 @@ QVariant GridProxyModel::data(const QModelIndex& i, int role) const
     }
     else
     {
-      pixmap = QPixmap::fromImage(QImage::fromData(
-          reinterpret_cast<const unsigned char*>(&buffer[0]), static_cast<int>(buffer.size())));
-
-      return pixmap.scaled(QSize(160, 224) * model->GetScale() * pixmap.devicePixelRatio(),
-                           Qt::KeepAspectRatio, Qt::SmoothTransformation);
+      // Decoding and smooth-scaling the cover PNG is by far the most
+      // expensive part of painting the grid, and data() is called for every
+      // repaint, so memoize the scaled result. The buffer size in the key
+      // invalidates the entry if the cover file changes.
+      const auto& game = *model->GetGameFile(source_index.row());
+      const QString key = QStringLiteral("gamecover/%1/%2/%3")
+                              .arg(QString::fromStdString(game.GetFilePath()))
+                              .arg(buffer.size())
+                              .arg(model->GetScale());
+
+      QPixmap cover;
+      if (!QPixmapCache::find(key, &cover))
+      {
+        cover = QPixmap::fromImage(QImage::fromData(
+            reinterpret_cast<const unsigned char*>(&buffer[0]), static_cast<int>(buffer.size())));
+
+        cover = cover.scaled(QSize(160, 224) * model->GetScale() * cover.devicePixelRatio(),
+                             Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        QPixmapCache::insert(key, cover);
+      }
+
+      return cover;
     }
   }
   return QVariant();
@@ -142,11 +142,14 @@ void HotkeyScheduler::Run()
 
     if (Core::GetState() != Core::State::Stopping)
     {
-      HotkeyManagerEmu::GetStatus();
-
       if (!Core::IsRunningAndStarted())
         continue;
 
+      // Skip the whole dispatch body while no hotkey is down; every IsHotkey
+      // check below would return false anyway.
+      if (!HotkeyManagerEmu::GetStatus())
+        continue;
+
       if (IsHotkey(HK_OPEN))
         emit Open();
 
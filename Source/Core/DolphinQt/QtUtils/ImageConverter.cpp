@@ -21,11 +21,15 @@ QPixmap ToQPixmap(const std::vector<u32>& buffer, int width, int height)
   QImage image(width, height, QImage::Format_RGB888);
   for (int y = 0; y < height; y++)
   {
+    // Write scanlines directly; setPixel re-derives the scanline and
+    // pixel layout for every single pixel.
+    uchar* line = image.scanLine(y);
     for (int x = 0; x < width; x++)
     {
       const u32 color = buffer[y * width + x];
-      image.setPixel(
-          x, y, qRgb((color & 0xFF0000) >> 16, (color & 0x00FF00) >> 8, (color & 0x0000FF) >> 0));
+      *line++ = (color & 0xFF0000) >> 16;
+      *line++ = (color & 0x00FF00) >> 8;
+      *line++ = (color & 0x0000FF) >> 0;
     }
   }
 
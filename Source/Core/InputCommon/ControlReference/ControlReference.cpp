@@ -31,6 +31,15 @@ void ControlReference::UpdateReference(const ciface::Core::DeviceContainer& devi
   ControlFinder finder(devices, default_device, IsInput());
   if (m_parsed_expression)
     m_parsed_expression->UpdateReferences(finder);
+
+  // Re-flatten now that control pointers are bound. Expressions that don't
+  // flatten (or blow the evaluation stack) keep using the AST walk.
+  m_compiled_expression.Clear();
+  if (m_parsed_expression && IsInput())
+  {
+    if (!m_parsed_expression->Flatten(&m_compiled_expression) || !m_compiled_expression.IsValid())
+      m_compiled_expression.Clear();
+  }
 }
 
 int ControlReference::BoundCount() const
@@ -55,6 +64,8 @@ void ControlReference::SetExpression(std::string expr)
 {
   m_expression = std::move(expr);
   std::tie(m_parse_status, m_parsed_expression) = ParseExpression(m_expression);
+  // Stale until the next UpdateReference binds the new expression's controls.
+  m_compiled_expression.Clear();
 }
 
 ControlReference::ControlReference() : range(1), m_parsed_expression(nullptr)
@@ -88,7 +99,11 @@ bool OutputReference::IsInput() const
 //
 ControlState InputReference::State(const ControlState ignore)
 {
-  if (m_parsed_expression && InputGateOn())
+  if (!InputGateOn())
+    return 0.0;
+  if (!m_compiled_expression.Empty())
+    return m_compiled_expression.Evaluate() * range;
+  if (m_parsed_expression)
     return m_parsed_expression->GetValue() * range;
   return 0.0;
 }
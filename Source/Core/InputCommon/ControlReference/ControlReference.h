@@ -41,6 +41,9 @@ protected:
   ControlReference();
   std::string m_expression;
   std::unique_ptr<ciface::ExpressionParser::Expression> m_parsed_expression;
+  // Flattened form of m_parsed_expression, rebuilt by UpdateReference. Input
+  // state queries evaluate this when it is valid instead of walking the AST.
+  ciface::ExpressionParser::CompiledExpression m_compiled_expression;
   ciface::ExpressionParser::ParseStatus m_parse_status;
 };
 
@@ -208,6 +208,78 @@ public:
   }
 };
 
+void CompiledExpression::EmitControl(Device::Input* input)
+{
+  m_ops.push_back({OpType::PushControl, input});
+}
+
+void CompiledExpression::EmitOp(OpType type)
+{
+  m_ops.push_back({type, nullptr});
+}
+
+bool CompiledExpression::IsValid() const
+{
+  if (m_ops.empty())
+    return false;
+
+  int depth = 0;
+  for (const Op& op : m_ops)
+  {
+    switch (op.type)
+    {
+    case OpType::PushControl:
+      if (static_cast<std::size_t>(++depth) > MAX_STACK_DEPTH)
+        return false;
+      break;
+    case OpType::Not:
+      if (depth < 1)
+        return false;
+      break;
+    default:
+      if (depth < 2)
+        return false;
+      depth--;
+      break;
+    }
+  }
+  return depth == 1;
+}
+
+ControlState CompiledExpression::Evaluate() const
+{
+  ControlState stack[MAX_STACK_DEPTH];
+  std::size_t sp = 0;
+
+  for (const Op& op : m_ops)
+  {
+    switch (op.type)
+    {
+    case OpType::PushControl:
+      // Unbound controls read as 0; negative values (opposing inputs) are
+      // clamped off, matching ControlExpression::GetValue.
+      stack[sp++] = op.input ? std::max(0.0, op.input->GetState()) : 0.0;
+      break;
+    case OpType::And:
+      sp--;
+      stack[sp - 1] = std::min(stack[sp - 1], stack[sp]);
+      break;
+    case OpType::Or:
+      sp--;
+      stack[sp - 1] = std::max(stack[sp - 1], stack[sp]);
+      break;
+    case OpType::Add:
+      sp--;
+      stack[sp - 1] = std::min(stack[sp - 1] + stack[sp], 1.0);
+      break;
+    case OpType::Not:
+      stack[sp - 1] = 1.0 - stack[sp - 1];
+      break;
+    }
+  }
+  return stack[0];
+}
+
 class ControlExpression : public Expression
 {
 public:
@@ -241,6 +313,11 @@ public:
     m_device = finder.FindDevice(qualifier);
     control = finder.FindControl(qualifier);
   }
+  bool Flatten(CompiledExpression* program) const override
+  {
+    program->EmitControl(control ? control->ToInput() : nullptr);
+    return true;
+  }
   operator std::string() const override { return "`" + static_cast<std::string>(qualifier) + "`"; }
 };
 
@@ -294,6 +371,27 @@ public:
     rhs->UpdateReferences(finder);
   }
 
+  bool Flatten(CompiledExpression* program) const override
+  {
+    if (!lhs->Flatten(program) || !rhs->Flatten(program))
+      return false;
+
+    switch (op)
+    {
+    case TOK_AND:
+      program->EmitOp(CompiledExpression::OpType::And);
+      return true;
+    case TOK_OR:
+      program->EmitOp(CompiledExpression::OpType::Or);
+      return true;
+    case TOK_ADD:
+      program->EmitOp(CompiledExpression::OpType::Add);
+      return true;
+    default:
+      return false;
+    }
+  }
+
   operator std::string() const override
   {
     return OpName(op) + "(" + (std::string)(*lhs) + ", " + (std::string)(*rhs) + ")";
@@ -338,6 +436,14 @@ public:
 
   int CountNumControls() const override { return inner->CountNumControls(); }
   void UpdateReferences(ControlFinder& finder) override { inner->UpdateReferences(finder); }
+  bool Flatten(CompiledExpression* program) const override
+  {
+    if (!inner->Flatten(program) || op != TOK_NOT)
+      return false;
+
+    program->EmitOp(CompiledExpression::OpType::Not);
+    return true;
+  }
   operator std::string() const override { return OpName(op) + "(" + (std::string)(*inner) + ")"; }
 };
 
@@ -367,6 +473,14 @@ public:
     m_rhs->UpdateReferences(finder);
   }
 
+  // The choice of child depends on which controls are bound, so this must be
+  // recompiled whenever references are updated - which is when callers
+  // recompile anyway.
+  bool Flatten(CompiledExpression* program) const override
+  {
+    return GetActiveChild()->Flatten(program);
+  }
+
 private:
   const std::unique_ptr<Expression>& GetActiveChild() const
   {
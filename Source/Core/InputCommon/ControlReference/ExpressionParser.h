@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include "InputCommon/ControllerInterface/Device.h"
 
 namespace ciface
@@ -47,6 +49,42 @@ private:
   bool is_input;
 };
 
+// A parsed expression flattened into a postfix program over a small value
+// stack, so input queries run a tight loop over a flat array instead of a
+// virtual AST walk per mapping, per frame.
+class CompiledExpression
+{
+public:
+  enum class OpType
+  {
+    PushControl,  // push the (clamped) state of an input, or 0.0 if unbound
+    And,          // min of the top two values
+    Or,           // max of the top two values
+    Add,          // sum of the top two values, clamped to 1.0
+    Not,          // 1.0 minus the top value
+  };
+
+  struct Op
+  {
+    OpType type;
+    Core::Device::Input* input = nullptr;
+  };
+
+  static constexpr std::size_t MAX_STACK_DEPTH = 32;
+
+  void EmitControl(Core::Device::Input* input);
+  void EmitOp(OpType type);
+  void Clear() { m_ops.clear(); }
+  bool Empty() const { return m_ops.empty(); }
+  // True when the program is non-empty, stays within the fixed evaluation
+  // stack and leaves exactly one value on it.
+  bool IsValid() const;
+  ControlState Evaluate() const;
+
+private:
+  std::vector<Op> m_ops;
+};
+
 class Expression
 {
 public:
@@ -55,6 +93,9 @@ public:
   virtual void SetValue(ControlState state) = 0;
   virtual int CountNumControls() const = 0;
   virtual void UpdateReferences(ControlFinder& finder) = 0;
+  // Appends this node's postfix ops to the program. Returns false for nodes
+  // that cannot be flattened, in which case the caller falls back to GetValue.
+  virtual bool Flatten(CompiledExpression* program) const { return false; }
   virtual operator std::string() const = 0;
 };
 
@@ -5,8 +5,10 @@
 #include "InputCommon/ControllerInterface/ControllerInterface.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "Common/Logging/Log.h"
+#include "Common/Thread.h"
 
 #ifdef CIFACE_USE_XINPUT
 #include "InputCommon/ControllerInterface/XInput/XInput.h"
@@ -76,6 +78,9 @@ void ControllerInterface::Initialize(const WindowSystemInfo& wsi)
 #endif
 
   RefreshDevices();
+
+  m_polling_thread_running.Set();
+  m_polling_thread = std::thread(&ControllerInterface::PollingThreadFunc, this);
 }
 
 void ControllerInterface::ChangeWindow(void* hwnd)
@@ -143,6 +148,12 @@ void ControllerInterface::Shutdown()
   // Prevent additional devices from being added during shutdown.
   m_is_init = false;
 
+  if (m_polling_thread_running.TestAndClear())
+  {
+    m_polling_event.Set();
+    m_polling_thread.join();
+  }
+
   {
     std::lock_guard<std::mutex> lk(m_devices_mutex);
 
@@ -238,6 +249,16 @@ void ControllerInterface::RemoveDevice(std::function<bool(const ciface::Core::De
 // Update input for all devices if lock can be acquired without waiting.
 void ControllerInterface::UpdateInput()
 {
+  // While the polling thread runs it owns the device walk; just nudge it so a
+  // poll happens promptly and let callers read the state the last walk left
+  // behind. A backend stalling on broken hardware then only delays the poll
+  // thread, never the caller.
+  if (m_polling_thread_running.IsSet())
+  {
+    m_polling_event.Set();
+    return;
+  }
+
   // Don't block the UI or CPU thread (to avoid a short but noticeable frame drop)
   if (m_devices_mutex.try_lock())
   {
@@ -247,6 +268,24 @@ void ControllerInterface::UpdateInput()
   }
 }
 
+void ControllerInterface::PollingThreadFunc()
+{
+  Common::SetCurrentThreadName("ControllerInterface Polling Thread");
+
+  while (m_polling_thread_running.IsSet())
+  {
+    {
+      std::lock_guard<std::mutex> lk(m_devices_mutex);
+      for (const auto& d : m_devices)
+        d->UpdateInput();
+    }
+
+    // Keep polling at roughly SI rate even when no one asks, so hotkeys and
+    // the UI stay fresh between nudges.
+    m_polling_event.WaitFor(std::chrono::milliseconds(5));
+  }
+}
+
 // Register a callback to be called when a device is added or removed (as from the input backends'
 // hotplug thread), or when devices are refreshed
 // Returns a handle for later removing the callback.
@@ -9,7 +9,10 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <thread>
 
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/WindowSystemInfo.h"
 #include "InputCommon/ControllerInterface/Device.h"
 
@@ -57,11 +60,19 @@ public:
   void InvokeDevicesChangedCallbacks() const;
 
 private:
+  void PollingThreadFunc();
+
   std::list<std::function<void()>> m_devices_changed_callbacks;
   mutable std::mutex m_callbacks_mutex;
   std::atomic<bool> m_is_init;
   std::atomic<bool> m_is_populating_devices{false};
   WindowSystemInfo m_wsi;
+
+  // Dedicated thread that walks the devices so backend I/O never runs on the
+  // CPU thread's SI poll.
+  std::thread m_polling_thread;
+  Common::Event m_polling_event;
+  Common::Flag m_polling_thread_running;
 };
 
 extern ControllerInterface g_controller_interface;
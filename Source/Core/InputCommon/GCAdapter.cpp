@@ -10,6 +10,7 @@
 #include "Common/Flag.h"
 #include "Common/Logging/Log.h"
 #include "Common/Thread.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -37,9 +38,22 @@ static u8 s_controller_rumble[4];
 
 static std::mutex s_mutex;
 static u8 s_controller_payload[37];
-static u8 s_controller_payload_swap[37];
 
 static std::atomic<int> s_controller_payload_size = {0};
+// Host time at which the last complete input frame arrived.
+static std::atomic<u64> s_controller_payload_time_us{0};
+
+// Interrupt transfers kept in flight so the host controller always has a
+// buffer queued for the adapter's next report; the old blocking read loop
+// left a resubmission gap after every transfer.
+constexpr int NUM_INPUT_TRANSFERS = 2;
+static libusb_transfer* s_input_transfers[NUM_INPUT_TRANSFERS];
+static u8 s_input_transfer_buffers[NUM_INPUT_TRANSFERS][37];
+static std::atomic<int> s_input_transfers_in_flight{0};
+
+// Adapter report-rate telemetry, maintained by the transfer callback.
+static u64 s_input_rate_window_start_us = 0;
+static u32 s_input_rate_frame_count = 0;
 
 static std::thread s_adapter_input_thread;
 static std::thread s_adapter_output_thread;
@@ -69,21 +83,74 @@ static u8 s_endpoint_out = 0;
 
 static u64 s_last_init = 0;
 
-static void Read()
+static void LIBUSB_CALL InputTransferCallback(libusb_transfer* transfer)
 {
-  int payload_size = 0;
-  while (s_adapter_thread_running.IsSet())
+  if (transfer->status == LIBUSB_TRANSFER_COMPLETED)
   {
-    libusb_interrupt_transfer(s_handle, s_endpoint_in, s_controller_payload_swap,
-                              sizeof(s_controller_payload_swap), &payload_size, 16);
-
+    const u64 now_us = Common::Timer::GetTimeUs();
     {
       std::lock_guard<std::mutex> lk(s_mutex);
-      std::swap(s_controller_payload_swap, s_controller_payload);
-      s_controller_payload_size.store(payload_size);
+      std::copy(transfer->buffer, transfer->buffer + transfer->actual_length, s_controller_payload);
+      s_controller_payload_size.store(transfer->actual_length);
+    }
+    s_controller_payload_time_us.store(now_us);
+
+    // The adapter reports at 125Hz stock; log the observed rate so stalls and
+    // overclocked adapters show up in the logs.
+    s_input_rate_frame_count++;
+    if (now_us - s_input_rate_window_start_us >= 10 * 1000000)
+    {
+      INFO_LOG(SERIALINTERFACE, "GC Adapter reporting at %.1f Hz",
+               s_input_rate_frame_count * 1000000.0 / (now_us - s_input_rate_window_start_us));
+      s_input_rate_window_start_us = now_us;
+      s_input_rate_frame_count = 0;
     }
+  }
 
-    Common::YieldCPU();
+  // Resubmit so a transfer is always pending; drop out on shutdown or errors.
+  if (s_adapter_thread_running.IsSet() && transfer->status != LIBUSB_TRANSFER_CANCELLED &&
+      libusb_submit_transfer(transfer) == 0)
+  {
+    return;
+  }
+  s_input_transfers_in_flight--;
+}
+
+static void Read()
+{
+  s_input_rate_window_start_us = Common::Timer::GetTimeUs();
+  s_input_rate_frame_count = 0;
+
+  for (int i = 0; i < NUM_INPUT_TRANSFERS; i++)
+  {
+    s_input_transfers[i] = libusb_alloc_transfer(0);
+    libusb_fill_interrupt_transfer(s_input_transfers[i], s_handle, s_endpoint_in,
+                                   s_input_transfer_buffers[i],
+                                   sizeof(s_input_transfer_buffers[i]), InputTransferCallback,
+                                   nullptr, 0);
+    s_input_transfers_in_flight++;
+    if (libusb_submit_transfer(s_input_transfers[i]) != 0)
+      s_input_transfers_in_flight--;
+  }
+
+  while (s_adapter_thread_running.IsSet())
+  {
+    timeval tv = {0, 16000};
+    libusb_handle_events_timeout(s_libusb_context, &tv);
+  }
+
+  // Cancel the in-flight transfers and drain their callbacks before freeing.
+  for (libusb_transfer* transfer : s_input_transfers)
+    libusb_cancel_transfer(transfer);
+  while (s_input_transfers_in_flight.load() > 0)
+  {
+    timeval tv = {0, 16000};
+    libusb_handle_events_timeout(s_libusb_context, &tv);
+  }
+  for (libusb_transfer*& transfer : s_input_transfers)
+  {
+    libusb_free_transfer(transfer);
+    transfer = nullptr;
   }
 }
 
@@ -480,6 +547,11 @@ GCPadStatus Input(int chan)
   return pad;
 }
 
+u64 GetLastFrameTimeUs()
+{
+  return s_controller_payload_time_us.load();
+}
+
 bool DeviceConnected(int chan)
 {
   return s_controller_type[chan] != ControllerTypes::CONTROLLER_NONE;
@@ -25,6 +25,9 @@ void SetAdapterCallback(std::function<void(void)> func);
 void StartScanThread();
 void StopScanThread();
 GCPadStatus Input(int chan);
+// Host time (in microseconds) at which the adapter delivered the frame that
+// Input() currently returns, so SI-side consumers can judge its freshness.
+u64 GetLastFrameTimeUs();
 void Output(int chan, u8 rumble_command);
 bool IsDetected();
 bool IsDriverDetected();
@@ -5,16 +5,19 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "Common/CPUDetect.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/File.h"
@@ -132,17 +135,43 @@ bool GameFileCache::Update(
 
   // Now that the previous loop has run, game_paths only contains paths that
   // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
-  {
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
+  // Constructing a GameFile opens the image and reads banners and metadata,
+  // which dominates a cold scan, so fan the construction out over a few
+  // threads. Paths vary wildly in cost (a .dol vs. a disc image), so the
+  // workers just grab the next unprocessed path. The callbacks still run on
+  // this thread afterwards.
+  const std::vector<std::string> new_paths(game_paths.begin(), game_paths.end());
+  std::vector<std::shared_ptr<GameFile>> new_files(new_paths.size());
+  const u32 num_threads = static_cast<u32>(std::min<size_t>(
+      std::min(std::max(cpu_info.num_cores, 1), 8), std::max<size_t>(new_paths.size(), 1)));
+  std::atomic<size_t> next_path{0};
+  const auto construct_worker = [&] {
+    size_t i;
+    while ((i = next_path.fetch_add(1)) < new_paths.size())
     {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
-
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+      auto file = std::make_shared<GameFile>(new_paths[i]);
+      if (file->IsValid())
+        new_files[i] = std::move(file);
     }
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (u32 i = 1; i < num_threads; i++)
+    threads.emplace_back(construct_worker);
+  construct_worker();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  for (std::shared_ptr<GameFile>& file : new_files)
+  {
+    if (!file)
+      continue;
+
+    if (game_added_to_cache)
+      game_added_to_cache(file);
+
+    cache_changed = true;
+    m_cached_files.push_back(std::move(file));
   }
 
   return cache_changed;
@@ -153,6 +182,36 @@ bool GameFileCache::UpdateAdditionalMetadata(
 {
   bool cache_changed = false;
 
+  // Fetch missing covers with a few worker threads before the serial metadata
+  // pass below; each download is network-bound and they used to run one at a
+  // time. Deduplicate by GameTDB ID so two discs of the same game can't write
+  // the same cover file concurrently.
+  {
+    std::vector<std::shared_ptr<GameFile>> to_download;
+    std::unordered_set<std::string> gametdb_ids;
+    for (const std::shared_ptr<GameFile>& file : m_cached_files)
+    {
+      if (gametdb_ids.insert(file->GetGameTDBID()).second)
+        to_download.push_back(file);
+    }
+
+    const size_t num_threads =
+        std::min<size_t>(4, std::max<size_t>(1, std::thread::hardware_concurrency()));
+    std::atomic<size_t> next_file{0};
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++)
+    {
+      threads.emplace_back([&] {
+        size_t index;
+        while ((index = next_file.fetch_add(1)) < to_download.size())
+          to_download[index]->DownloadDefaultCover();
+      });
+    }
+    for (std::thread& thread : threads)
+      thread.join();
+  }
+
   for (std::shared_ptr<GameFile>& file : m_cached_files)
   {
     const bool updated = UpdateAdditionalMetadata(&file);
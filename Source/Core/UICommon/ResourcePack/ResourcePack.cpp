@@ -5,9 +5,14 @@
 #include "UICommon/ResourcePack/ResourcePack.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #include <minizip/unzip.h>
+#include <zlib.h>
 
+#include "Common/File.h"
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
@@ -49,6 +54,29 @@ static bool ReadCurrentFileUnlimited(unzFile file, std::vector<char>& destinatio
   return true;
 }
 
+// Returns true if the file at path already has the exact contents of the given
+// zip entry, so extraction can be skipped when re-installing an updated pack.
+static bool ExistingFileMatches(const std::string& path, const unz_file_info& info)
+{
+  File::IOFile existing(path, "rb");
+  if (!existing || existing.GetSize() != info.uncompressed_size)
+    return false;
+
+  uLong crc = crc32(0L, Z_NULL, 0);
+  std::vector<char> buffer(65535);
+  u64 bytes_left = info.uncompressed_size;
+  while (bytes_left > 0)
+  {
+    const size_t chunk = static_cast<size_t>(std::min<u64>(bytes_left, buffer.size()));
+    if (!existing.ReadBytes(buffer.data(), chunk))
+      return false;
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(buffer.data()), static_cast<uInt>(chunk));
+    bytes_left -= chunk;
+  }
+
+  return crc == info.crc;
+}
+
 ResourcePack::ResourcePack(const std::string& path) : m_path(path)
 {
   auto file = unzOpen(path.c_str());
@@ -178,13 +206,12 @@ bool ResourcePack::Install(const std::string& path)
     return false;
   }
 
-  auto file = unzOpen(m_path.c_str());
-
+  // Filter out textures that a higher priority pack already provides, don't overwrite them
+  std::vector<std::string> to_install;
   for (const auto& texture : m_textures)
   {
     bool provided_by_other_pack = false;
 
-    // Check if a higher priority pack already provides a given texture, don't overwrite it
     for (const auto& pack : GetHigherPriorityPacks(*this))
     {
       if (std::find(pack->GetTextures().begin(), pack->GetTextures().end(), texture) !=
@@ -195,51 +222,100 @@ bool ResourcePack::Install(const std::string& path)
       }
     }
 
-    if (provided_by_other_pack)
-      continue;
+    if (!provided_by_other_pack)
+      to_install.push_back(texture);
+  }
 
-    if (unzLocateFile(file, ("textures/" + texture).c_str(), 0) != UNZ_OK)
+  // Extract with a few workers, each with its own handle on the zip since a
+  // minizip handle can't be shared between threads. Entries whose on-disk
+  // file already matches the entry's size and CRC are skipped, so installing
+  // an updated pack only writes the textures that actually changed.
+  const size_t num_threads =
+      std::min<size_t>(4, std::max<size_t>(1, std::thread::hardware_concurrency()));
+  std::atomic<size_t> next_texture{0};
+  std::atomic<bool> failed{false};
+  std::mutex error_mutex;
+  std::string error;
+
+  const auto set_error = [&](const std::string& message) {
+    std::lock_guard<std::mutex> lock(error_mutex);
+    if (error.empty())
+      error = message;
+    failed.store(true);
+  };
+
+  const auto extract_worker = [&] {
+    auto file = unzOpen(m_path.c_str());
+    if (file == nullptr)
     {
-      m_error = "Failed to locate texture " + texture;
-      return false;
+      set_error("Failed to open resource pack");
+      return;
     }
 
-    std::string m_full_dir;
+    size_t index;
+    while (!failed.load() && (index = next_texture.fetch_add(1)) < to_install.size())
+    {
+      const std::string& texture = to_install[index];
 
-    SplitPath(path + TEXTURE_PATH + texture, &m_full_dir, nullptr, nullptr);
+      if (unzLocateFile(file, ("textures/" + texture).c_str(), 0) != UNZ_OK)
+      {
+        set_error("Failed to locate texture " + texture);
+        break;
+      }
 
-    if (!File::CreateFullPath(m_full_dir))
-    {
-      m_error = "Failed to create full path " + m_full_dir;
-      return false;
-    }
+      unz_file_info texture_info;
 
-    unz_file_info texture_info;
+      unzGetCurrentFileInfo(file, &texture_info, nullptr, 0, nullptr, 0, nullptr, 0);
 
-    unzGetCurrentFileInfo(file, &texture_info, nullptr, 0, nullptr, 0, nullptr, 0);
+      if (ExistingFileMatches(path + TEXTURE_PATH + texture, texture_info))
+        continue;
 
-    std::vector<char> data;
-    data.resize(texture_info.uncompressed_size);
+      std::string full_dir;
 
-    if (!ReadCurrentFileUnlimited(file, data))
-    {
-      m_error = "Failed to read texture " + texture;
-      return false;
-    }
+      SplitPath(path + TEXTURE_PATH + texture, &full_dir, nullptr, nullptr);
 
-    std::ofstream out(path + TEXTURE_PATH + texture, std::ios::trunc | std::ios::binary);
+      if (!File::CreateFullPath(full_dir))
+      {
+        set_error("Failed to create full path " + full_dir);
+        break;
+      }
 
-    if (!out.good())
-    {
-      m_error = "Failed to write " + texture;
-      return false;
+      std::vector<char> data;
+      data.resize(texture_info.uncompressed_size);
+
+      if (!ReadCurrentFileUnlimited(file, data))
+      {
+        set_error("Failed to read texture " + texture);
+        break;
+      }
+
+      std::ofstream out(path + TEXTURE_PATH + texture, std::ios::trunc | std::ios::binary);
+
+      if (!out.good())
+      {
+        set_error("Failed to write " + texture);
+        break;
+      }
+
+      out.write(data.data(), data.size());
+      out.flush();
     }
 
-    out.write(data.data(), data.size());
-    out.flush();
-  }
+    unzClose(file);
+  };
 
-  unzClose(file);
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; i++)
+    threads.emplace_back(extract_worker);
+  for (std::thread& thread : threads)
+    thread.join();
+
+  if (failed.load())
+  {
+    m_error = error;
+    return false;
+  }
 
   SetInstalled(*this, true);
 
@@ -4,8 +4,11 @@
 
 #include "UpdaterCommon/UpdaterCommon.h"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <optional>
+#include <thread>
 
 #include <OptionParser.h>
 #include <ed25519/ed25519.h>
@@ -71,12 +74,6 @@ struct TodoList
   void Log() const;
 };
 
-bool ProgressCallback(double total, double now, double, double)
-{
-  UI::SetCurrentProgress(static_cast<int>(now), static_cast<int>(total));
-  return true;
-}
-
 std::string HexEncode(const u8* buffer, size_t size)
 {
   std::string out(size * 2, '\0');
@@ -213,66 +210,91 @@ void TodoList::Log() const
   }
 }
 
-bool DownloadContent(const std::vector<TodoList::DownloadOp>& to_download,
-                     const std::string& content_base_url, const std::string& temp_path)
+// Downloads, decompresses and verifies one content file into the temp dir.
+bool DownloadSingleContent(Common::HttpRequest* req, const TodoList::DownloadOp& download,
+                           const std::string& content_base_url, const std::string& temp_path)
 {
-  Common::HttpRequest req(std::chrono::seconds(30), ProgressCallback);
-
-  UI::SetTotalMarquee(false);
-
-  for (size_t i = 0; i < to_download.size(); i++)
-  {
-    UI::SetTotalProgress(static_cast<int>(i + 1), static_cast<int>(to_download.size()));
-
-    auto& download = to_download[i];
+  std::string hash_filename = HexEncode(download.hash.data(), download.hash.size());
 
-    std::string hash_filename = HexEncode(download.hash.data(), download.hash.size());
+  // File already exists, skipping
+  if (File::Exists(temp_path + DIR_SEP + hash_filename))
+    return true;
 
-    // File already exists, skipping
-    if (File::Exists(temp_path + DIR_SEP + hash_filename))
-      continue;
-
-    UI::SetDescription("Downloading " + download.filename + "... (File " + std::to_string(i + 1) +
-                       " of " + std::to_string(to_download.size()) + ")");
-    UI::SetCurrentMarquee(false);
-
-    // Add slashes where needed.
-    std::string content_store_path = hash_filename;
-    content_store_path.insert(4, "/");
-    content_store_path.insert(2, "/");
+  // Add slashes where needed.
+  std::string content_store_path = hash_filename;
+  content_store_path.insert(4, "/");
+  content_store_path.insert(2, "/");
 
-    std::string url = content_base_url + content_store_path;
-    fprintf(log_fp, "Downloading %s ...\n", url.c_str());
+  std::string url = content_base_url + content_store_path;
+  fprintf(log_fp, "Downloading %s ...\n", url.c_str());
 
-    auto resp = req.Get(url);
-    if (!resp)
-      return false;
+  auto resp = req->Get(url);
+  if (!resp)
+    return false;
 
-    UI::SetCurrentMarquee(true);
-    UI::SetDescription("Verifying " + download.filename + "...");
+  std::string contents(reinterpret_cast<char*>(resp->data()), resp->size());
+  std::optional<std::string> maybe_decompressed = GzipInflate(contents);
+  if (!maybe_decompressed)
+    return false;
+  std::string decompressed = std::move(*maybe_decompressed);
 
-    std::string contents(reinterpret_cast<char*>(resp->data()), resp->size());
-    std::optional<std::string> maybe_decompressed = GzipInflate(contents);
-    if (!maybe_decompressed)
-      return false;
-    std::string decompressed = std::move(*maybe_decompressed);
+  // Check that the downloaded contents have the right hash.
+  Manifest::Hash contents_hash = ComputeHash(decompressed);
+  if (contents_hash != download.hash)
+  {
+    fprintf(log_fp, "Wrong hash on downloaded content %s.\n", url.c_str());
+    return false;
+  }
 
-    // Check that the downloaded contents have the right hash.
-    Manifest::Hash contents_hash = ComputeHash(decompressed);
-    if (contents_hash != download.hash)
-    {
-      fprintf(log_fp, "Wrong hash on downloaded content %s.\n", url.c_str());
-      return false;
-    }
+  std::string out = temp_path + DIR_SEP + hash_filename;
+  if (!File::WriteStringToFile(decompressed, out))
+  {
+    fprintf(log_fp, "Could not write cache file %s.\n", out.c_str());
+    return false;
+  }
+  return true;
+}
 
-    std::string out = temp_path + DIR_SEP + hash_filename;
-    if (!File::WriteStringToFile(decompressed, out))
+bool DownloadContent(const std::vector<TodoList::DownloadOp>& to_download,
+                     const std::string& content_base_url, const std::string& temp_path)
+{
+  UI::SetTotalMarquee(false);
+  UI::SetCurrentMarquee(true);
+
+  // The content files are small and the store serves them all from one host,
+  // so a handful of overlapping transfers hides the per-request latency that
+  // dominates on slow links. Verification happens on the worker that did the
+  // download; completion order doesn't matter as files land under their hash.
+  const size_t num_threads = std::min<size_t>(4, std::max<size_t>(to_download.size(), 1));
+  std::atomic<size_t> next_op{0};
+  std::atomic<size_t> num_completed{0};
+  std::atomic<bool> failed{false};
+
+  const auto download_worker = [&] {
+    Common::HttpRequest req(std::chrono::seconds(30));
+    size_t i;
+    while (!failed && (i = next_op.fetch_add(1)) < to_download.size())
     {
-      fprintf(log_fp, "Could not write cache file %s.\n", out.c_str());
-      return false;
+      if (!DownloadSingleContent(&req, to_download[i], content_base_url, temp_path))
+      {
+        failed = true;
+        return;
+      }
+      const size_t completed = num_completed.fetch_add(1) + 1;
+      UI::SetTotalProgress(static_cast<int>(completed), static_cast<int>(to_download.size()));
+      UI::SetDescription("Downloading... (File " + std::to_string(completed) + " of " +
+                         std::to_string(to_download.size()) + ")");
     }
-  }
-  return true;
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (size_t i = 1; i < num_threads; i++)
+    threads.emplace_back(download_worker);
+  download_worker();
+  for (std::thread& thread : threads)
+    thread.join();
+
+  return !failed;
 }
 
 TodoList ComputeActionsToDo(Manifest this_manifest, Manifest next_manifest)
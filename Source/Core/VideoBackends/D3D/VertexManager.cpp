@@ -74,17 +74,21 @@ bool VertexManager::Initialize()
   if (!VertexManagerBase::Initialize())
     return false;
 
-  CD3D11_BUFFER_DESC bufdesc((VERTEX_STREAM_BUFFER_SIZE + INDEX_STREAM_BUFFER_SIZE) / BUFFER_COUNT,
-                             D3D11_BIND_INDEX_BUFFER | D3D11_BIND_VERTEX_BUFFER,
-                             D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+  const CD3D11_BUFFER_DESC vtx_desc(VERTEX_STREAM_BUFFER_SIZE, D3D11_BIND_VERTEX_BUFFER,
+                                    D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+  CHECK(SUCCEEDED(D3D::device->CreateBuffer(&vtx_desc, nullptr, &m_vertex_buffer)),
+        "Failed to create vertex buffer.");
+  if (!m_vertex_buffer)
+    return false;
+  D3DCommon::SetDebugObjectName(m_vertex_buffer.Get(), "Vertex buffer of VertexManager");
 
-  for (int i = 0; i < BUFFER_COUNT; i++)
-  {
-    CHECK(SUCCEEDED(D3D::device->CreateBuffer(&bufdesc, nullptr, &m_buffers[i])),
-          "Failed to create buffer.");
-    if (m_buffers[i])
-      D3DCommon::SetDebugObjectName(m_buffers[i].Get(), "Buffer of VertexManager");
-  }
+  const CD3D11_BUFFER_DESC idx_desc(INDEX_STREAM_BUFFER_SIZE, D3D11_BIND_INDEX_BUFFER,
+                                    D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+  CHECK(SUCCEEDED(D3D::device->CreateBuffer(&idx_desc, nullptr, &m_index_buffer)),
+        "Failed to create index buffer.");
+  if (!m_index_buffer)
+    return false;
+  D3DCommon::SetDebugObjectName(m_index_buffer.Get(), "Index buffer of VertexManager");
 
   m_vertex_constant_buffer = AllocateConstantBuffer(sizeof(VertexShaderConstants));
   m_geometry_constant_buffer = AllocateConstantBuffer(sizeof(GeometryShaderConstants));
@@ -207,55 +211,62 @@ bool VertexManager::UploadTexelBuffer(const void* data, u32 data_size, TexelBuff
 
 void VertexManager::ResetBuffer(u32 vertex_stride)
 {
-  m_base_buffer_pointer = m_cpu_vertex_buffer.data();
-  m_cur_buffer_pointer = m_base_buffer_pointer;
-  m_end_buffer_pointer = m_base_buffer_pointer + m_cpu_vertex_buffer.size();
-  IndexGenerator::Start(m_cpu_index_buffer.data());
-}
-
-void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_indices,
-                                 u32* out_base_vertex, u32* out_base_index)
-{
-  D3D11_MAPPED_SUBRESOURCE map;
-
-  u32 vertexBufferSize = Common::AlignUp(num_vertices * vertex_stride, sizeof(u16));
-  u32 indexBufferSize = num_indices * sizeof(u16);
-  u32 totalBufferSize = vertexBufferSize + indexBufferSize;
+  // Align the cursor so the start of the allocation can be expressed as a base vertex.
+  u32 vertex_cursor = m_vertex_buffer_cursor;
+  if (vertex_stride > 0)
+    vertex_cursor = Common::AlignUp(vertex_cursor, vertex_stride);
 
-  u32 cursor = m_buffer_cursor;
-  u32 padding = vertex_stride > 0 ? (m_buffer_cursor % vertex_stride) : 0;
-  if (padding)
+  D3D11_MAP vertex_map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+  if (vertex_cursor + MAXVBUFFERSIZE > VERTEX_STREAM_BUFFER_SIZE)
   {
-    cursor += vertex_stride - padding;
+    // Wrap around
+    vertex_cursor = 0;
+    vertex_map_type = D3D11_MAP_WRITE_DISCARD;
   }
+  m_vertex_buffer_cursor = vertex_cursor;
 
-  D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
-  if (cursor + totalBufferSize >= BUFFER_SIZE)
+  D3D11_MAP index_map_type = D3D11_MAP_WRITE_NO_OVERWRITE;
+  if (m_index_buffer_cursor + MAXIBUFFERSIZE * sizeof(u16) > INDEX_STREAM_BUFFER_SIZE)
   {
     // Wrap around
-    m_current_buffer = (m_current_buffer + 1) % BUFFER_COUNT;
-    cursor = 0;
-    MapType = D3D11_MAP_WRITE_DISCARD;
+    m_index_buffer_cursor = 0;
+    index_map_type = D3D11_MAP_WRITE_DISCARD;
   }
 
-  *out_base_vertex = vertex_stride > 0 ? (cursor / vertex_stride) : 0;
-  *out_base_index = (cursor + vertexBufferSize) / sizeof(u16);
+  // The vertex loaders decode straight into the mapped buffers; CommitBuffer() unmaps them
+  // before anything is drawn. Flush() commits before loading textures, so no other draw can
+  // happen while the buffers are mapped.
+  D3D11_MAPPED_SUBRESOURCE map;
+  D3D::context->Map(m_vertex_buffer.Get(), 0, vertex_map_type, 0, &map);
+  m_base_buffer_pointer = reinterpret_cast<u8*>(map.pData) + vertex_cursor;
+  m_cur_buffer_pointer = m_base_buffer_pointer;
+  m_end_buffer_pointer = m_base_buffer_pointer + MAXVBUFFERSIZE;
+
+  D3D::context->Map(m_index_buffer.Get(), 0, index_map_type, 0, &map);
+  IndexGenerator::Start(
+      reinterpret_cast<u16*>(reinterpret_cast<u8*>(map.pData) + m_index_buffer_cursor));
+}
+
+void VertexManager::CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_indices,
+                                 u32* out_base_vertex, u32* out_base_index)
+{
+  const u32 vertexBufferSize = num_vertices * vertex_stride;
+  const u32 indexBufferSize = num_indices * sizeof(u16);
+
+  *out_base_vertex = vertex_stride > 0 ? (m_vertex_buffer_cursor / vertex_stride) : 0;
+  *out_base_index = m_index_buffer_cursor / sizeof(u16);
 
-  D3D::context->Map(m_buffers[m_current_buffer].Get(), 0, MapType, 0, &map);
-  u8* mappedData = reinterpret_cast<u8*>(map.pData);
-  if (vertexBufferSize > 0)
-    std::memcpy(mappedData + cursor, m_base_buffer_pointer, vertexBufferSize);
-  if (indexBufferSize > 0)
-    std::memcpy(mappedData + cursor + vertexBufferSize, m_cpu_index_buffer.data(), indexBufferSize);
-  D3D::context->Unmap(m_buffers[m_current_buffer].Get(), 0);
+  D3D::context->Unmap(m_vertex_buffer.Get(), 0);
+  D3D::context->Unmap(m_index_buffer.Get(), 0);
 
-  m_buffer_cursor = cursor + totalBufferSize;
+  m_vertex_buffer_cursor += vertexBufferSize;
+  m_index_buffer_cursor += indexBufferSize;
 
   ADDSTAT(stats.thisFrame.bytesVertexStreamed, vertexBufferSize);
   ADDSTAT(stats.thisFrame.bytesIndexStreamed, indexBufferSize);
 
-  D3D::stateman->SetVertexBuffer(m_buffers[m_current_buffer].Get(), vertex_stride, 0);
-  D3D::stateman->SetIndexBuffer(m_buffers[m_current_buffer].Get());
+  D3D::stateman->SetVertexBuffer(m_vertex_buffer.Get(), vertex_stride, 0);
+  D3D::stateman->SetIndexBuffer(m_index_buffer.Get());
 }
 
 void VertexManager::UploadUniforms()
@@ -0,0 +1,157 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/BoundingBox.h"
+
+#include <cstring>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "Common/MsgHandler.h"
+
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/Renderer.h"
+#include "VideoBackends/D3D12/StreamBuffer.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DX12
+{
+static const u32 NUM_BBOX_VALUES = 4;
+static const u32 BBOX_BUFFER_SIZE = NUM_BBOX_VALUES * sizeof(s32);
+
+static ComPtr<ID3D12Resource> s_bbox_buffer;
+static ComPtr<ID3D12Resource> s_bbox_readback_buffer;
+static std::unique_ptr<StreamBuffer> s_bbox_upload_buffer;
+static DescriptorHandle s_bbox_uav_descriptor;
+static D3D12_RESOURCE_STATES s_bbox_state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+static void TransitionTo(D3D12_RESOURCE_STATES state)
+{
+  if (s_bbox_state == state)
+    return;
+
+  const D3D12_RESOURCE_BARRIER barrier = {
+      D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+      D3D12_RESOURCE_BARRIER_FLAG_NONE,
+      {{s_bbox_buffer.Get(), D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, s_bbox_state, state}}};
+  g_dx_context->GetCommandList()->ResourceBarrier(1, &barrier);
+  s_bbox_state = state;
+}
+
+const DescriptorHandle& BBox::GetUAVDescriptor()
+{
+  return s_bbox_uav_descriptor;
+}
+
+void BBox::Init()
+{
+  if (!g_ActiveConfig.backend_info.bSupportsBBox)
+    return;
+
+  static const D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_DEFAULT};
+  D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
+                                       0,
+                                       BBOX_BUFFER_SIZE,
+                                       1,
+                                       1,
+                                       1,
+                                       DXGI_FORMAT_UNKNOWN,
+                                       {1, 0},
+                                       D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                       D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS};
+  HRESULT hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc,
+      D3D12_RESOURCE_STATE_UNORDERED_ACCESS, nullptr, IID_PPV_ARGS(&s_bbox_buffer));
+  CHECK(SUCCEEDED(hr), "Create BoundingBox Buffer.");
+  s_bbox_state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+  static const D3D12_HEAP_PROPERTIES readback_heap_properties = {D3D12_HEAP_TYPE_READBACK};
+  resource_desc.Flags = D3D12_RESOURCE_FLAG_NONE;
+  hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &readback_heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc,
+      D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&s_bbox_readback_buffer));
+  CHECK(SUCCEEDED(hr), "Create BoundingBox Readback Buffer.");
+
+  s_bbox_upload_buffer = std::make_unique<StreamBuffer>();
+  if (!s_bbox_upload_buffer->AllocateBuffer(BBOX_BUFFER_SIZE * 128))
+  {
+    PanicAlert("Create BoundingBox Upload Buffer.");
+    return;
+  }
+
+  // Typed UAVs can't be root descriptors, so it goes through a table.
+  if (!g_dx_context->GetDescriptorHeapManager().Allocate(&s_bbox_uav_descriptor))
+  {
+    PanicAlert("Create BoundingBox UAV.");
+    return;
+  }
+
+  D3D12_UNORDERED_ACCESS_VIEW_DESC uav_desc = {};
+  uav_desc.Format = DXGI_FORMAT_R32_SINT;
+  uav_desc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
+  uav_desc.Buffer.NumElements = NUM_BBOX_VALUES;
+  g_dx_context->GetDevice()->CreateUnorderedAccessView(s_bbox_buffer.Get(), nullptr, &uav_desc,
+                                                       s_bbox_uav_descriptor.cpu_handle);
+}
+
+void BBox::Shutdown()
+{
+  if (s_bbox_uav_descriptor)
+  {
+    g_dx_context->GetDescriptorHeapManager().Free(s_bbox_uav_descriptor);
+    s_bbox_uav_descriptor = {};
+  }
+
+  s_bbox_upload_buffer.reset();
+  s_bbox_readback_buffer.Reset();
+  s_bbox_buffer.Reset();
+}
+
+void BBox::Set(int index, int value)
+{
+  if (!s_bbox_upload_buffer->ReserveMemory(sizeof(s32), sizeof(s32)))
+  {
+    Renderer::GetInstance()->ExecuteCommandList(false);
+    if (!s_bbox_upload_buffer->ReserveMemory(sizeof(s32), sizeof(s32)))
+    {
+      PanicAlert("Failed to allocate bbox upload space");
+      return;
+    }
+  }
+
+  const u32 upload_offset = s_bbox_upload_buffer->GetCurrentOffset();
+  std::memcpy(s_bbox_upload_buffer->GetCurrentHostPointer(), &value, sizeof(s32));
+  s_bbox_upload_buffer->CommitMemory(sizeof(s32));
+
+  TransitionTo(D3D12_RESOURCE_STATE_COPY_DEST);
+  g_dx_context->GetCommandList()->CopyBufferRegion(s_bbox_buffer.Get(), index * sizeof(s32),
+                                                   s_bbox_upload_buffer->GetBuffer(),
+                                                   upload_offset, sizeof(s32));
+  TransitionTo(D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+}
+
+int BBox::Get(int index)
+{
+  TransitionTo(D3D12_RESOURCE_STATE_COPY_SOURCE);
+  g_dx_context->GetCommandList()->CopyBufferRegion(s_bbox_readback_buffer.Get(), 0,
+                                                   s_bbox_buffer.Get(), 0, BBOX_BUFFER_SIZE);
+  TransitionTo(D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+  // We can't know the value without waiting for the copy to complete.
+  Renderer::GetInstance()->ExecuteCommandList(true);
+
+  static const D3D12_RANGE read_range = {0, BBOX_BUFFER_SIZE};
+  s32 value = 0;
+  void* mapped_ptr;
+  HRESULT hr = s_bbox_readback_buffer->Map(0, &read_range, &mapped_ptr);
+  if (SUCCEEDED(hr))
+  {
+    std::memcpy(&value, static_cast<const u8*>(mapped_ptr) + index * sizeof(s32), sizeof(s32));
+    static const D3D12_RANGE write_range = {};
+    s_bbox_readback_buffer->Unmap(0, &write_range);
+  }
+
+  return value;
+}
+};  // namespace DX12
@@ -0,0 +1,24 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoBackends/D3D12/DescriptorHeapManager.h"
+
+namespace DX12
+{
+class BBox
+{
+public:
+  static const DescriptorHandle& GetUAVDescriptor();
+
+  static void Init();
+  static void Shutdown();
+
+  static void Set(int index, int value);
+  static int Get(int index);
+};
+};  // namespace DX12
@@ -0,0 +1,25 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <d3d12.h>
+#include <wrl/client.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+#include "Common/MsgHandler.h"
+
+namespace DX12
+{
+using Microsoft::WRL::ComPtr;
+
+#define CHECK(cond, Message, ...)                                                                  \
+  if (!(cond))                                                                                     \
+  {                                                                                                \
+    PanicAlert("%s failed in %s at line %d: " Message, __func__, __FILE__, __LINE__,               \
+               ##__VA_ARGS__);                                                                     \
+  }
+
+}  // namespace DX12
@@ -0,0 +1,593 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/DXContext.h"
+
+#include <dxgi1_2.h>
+
+#include "Common/Assert.h"
+#include "Common/CommonFuncs.h"
+#include "Common/DynamicLibrary.h"
+#include "Common/File.h"
+#include "Common/FileUtil.h"
+#include "Common/StringUtil.h"
+
+#include "VideoBackends/D3DCommon/Common.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DX12
+{
+std::unique_ptr<DXContext> g_dx_context;
+
+static Common::DynamicLibrary s_d3d12_library;
+static PFN_D3D12_CREATE_DEVICE s_d3d12_create_device;
+static PFN_D3D12_GET_DEBUG_INTERFACE s_d3d12_get_debug_interface;
+static PFN_D3D12_SERIALIZE_ROOT_SIGNATURE s_d3d12_serialize_root_signature;
+
+static bool LoadD3D12Library()
+{
+  if (s_d3d12_library.IsOpen())
+    return true;
+
+  if (!s_d3d12_library.Open("d3d12.dll") ||
+      !s_d3d12_library.GetSymbol("D3D12CreateDevice", &s_d3d12_create_device) ||
+      !s_d3d12_library.GetSymbol("D3D12GetDebugInterface", &s_d3d12_get_debug_interface) ||
+      !s_d3d12_library.GetSymbol("D3D12SerializeRootSignature", &s_d3d12_serialize_root_signature))
+  {
+    PanicAlertT("d3d12.dll could not be loaded.");
+    s_d3d12_library.Close();
+    return false;
+  }
+
+  return true;
+}
+
+static void UnloadD3D12Library()
+{
+  s_d3d12_serialize_root_signature = nullptr;
+  s_d3d12_get_debug_interface = nullptr;
+  s_d3d12_create_device = nullptr;
+  s_d3d12_library.Close();
+}
+
+static std::string GetPipelineLibraryFileName()
+{
+  return File::GetUserPath(D_SHADERCACHE_IDX) + "dx12-pipeline-library.bin";
+}
+
+DXContext::DXContext() = default;
+
+DXContext::~DXContext()
+{
+  if (m_fence)
+    WaitForFence(m_current_fence_value);
+
+  SavePipelineLibrary();
+
+  if (m_fence_event)
+    CloseHandle(m_fence_event);
+}
+
+std::vector<std::string> DXContext::GetAdapterNames()
+{
+  return D3DCommon::GetAdapterNames();
+}
+
+bool DXContext::Create(u32 adapter_index, bool enable_debug_layer)
+{
+  ASSERT(!g_dx_context);
+  if (!D3DCommon::LoadLibraries() || !LoadD3D12Library())
+    return false;
+
+  g_dx_context.reset(new DXContext());
+  if (!g_dx_context->CreateDXGIFactory(enable_debug_layer) ||
+      !g_dx_context->CreateDevice(adapter_index, enable_debug_layer) ||
+      !g_dx_context->CreateCommandQueues() || !g_dx_context->CreateFence() ||
+      !g_dx_context->CreateDescriptorHeaps() || !g_dx_context->CreateRootSignatures() ||
+      !g_dx_context->CreateTextureUploadBuffer() || !g_dx_context->CreateCommandLists())
+  {
+    Destroy();
+    return false;
+  }
+
+  g_dx_context->LoadPipelineLibrary();
+  return true;
+}
+
+void DXContext::Destroy()
+{
+  g_dx_context.reset();
+  UnloadD3D12Library();
+  D3DCommon::UnloadLibraries();
+}
+
+bool DXContext::CreateDXGIFactory(bool enable_debug_layer)
+{
+  m_dxgi_factory = D3DCommon::CreateDXGIFactory(enable_debug_layer);
+  return m_dxgi_factory != nullptr;
+}
+
+bool DXContext::CreateDevice(u32 adapter_index, bool enable_debug_layer)
+{
+  ComPtr<IDXGIAdapter> adapter;
+  HRESULT hr = m_dxgi_factory->EnumAdapters(adapter_index, &adapter);
+  if (FAILED(hr))
+  {
+    WARN_LOG(VIDEO, "Adapter %u not found, using default", adapter_index);
+    adapter = nullptr;
+  }
+
+  if (enable_debug_layer)
+  {
+    hr = s_d3d12_get_debug_interface(IID_PPV_ARGS(&m_debug_interface));
+    if (SUCCEEDED(hr))
+      m_debug_interface->EnableDebugLayer();
+    else
+      WARN_LOG(VIDEO, "Debug layer requested but not available.");
+  }
+
+  // Create the actual device.
+  hr = s_d3d12_create_device(adapter.Get(), D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&m_device));
+  CHECK(SUCCEEDED(hr), "Create D3D12 device");
+  if (FAILED(hr))
+    return false;
+
+  // D3DCommon's shader compilation targets are selected by feature level.
+  static constexpr std::array<D3D_FEATURE_LEVEL, 3> requested_levels = {
+      {D3D_FEATURE_LEVEL_12_0, D3D_FEATURE_LEVEL_11_1, D3D_FEATURE_LEVEL_11_0}};
+  D3D12_FEATURE_DATA_FEATURE_LEVELS levels = {};
+  levels.NumFeatureLevels = static_cast<UINT>(requested_levels.size());
+  levels.pFeatureLevelsRequested = requested_levels.data();
+  if (SUCCEEDED(
+          m_device->CheckFeatureSupport(D3D12_FEATURE_FEATURE_LEVELS, &levels, sizeof(levels))))
+  {
+    m_feature_level = levels.MaxSupportedFeatureLevel;
+  }
+
+  return true;
+}
+
+bool DXContext::CreateCommandQueues()
+{
+  static constexpr D3D12_COMMAND_QUEUE_DESC queue_desc = {D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                          D3D12_COMMAND_QUEUE_PRIORITY_NORMAL,
+                                                          D3D12_COMMAND_QUEUE_FLAG_NONE};
+  HRESULT hr = m_device->CreateCommandQueue(&queue_desc, IID_PPV_ARGS(&m_command_queue));
+  CHECK(SUCCEEDED(hr), "Create command queue");
+  if (FAILED(hr))
+    return false;
+
+  static constexpr D3D12_COMMAND_QUEUE_DESC copy_queue_desc = {D3D12_COMMAND_LIST_TYPE_COPY,
+                                                               D3D12_COMMAND_QUEUE_PRIORITY_NORMAL,
+                                                               D3D12_COMMAND_QUEUE_FLAG_NONE};
+  hr = m_device->CreateCommandQueue(&copy_queue_desc, IID_PPV_ARGS(&m_copy_queue));
+  CHECK(SUCCEEDED(hr), "Create copy queue");
+  return SUCCEEDED(hr);
+}
+
+bool DXContext::CreateFence()
+{
+  HRESULT hr = m_device->CreateFence(m_completed_fence_value, D3D12_FENCE_FLAG_NONE,
+                                     IID_PPV_ARGS(&m_fence));
+  CHECK(SUCCEEDED(hr), "Create fence");
+  if (FAILED(hr))
+    return false;
+
+  hr = m_device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_copy_fence));
+  CHECK(SUCCEEDED(hr), "Create copy fence");
+  if (FAILED(hr))
+    return false;
+
+  m_fence_event = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+  CHECK(m_fence_event != NULL, "Create fence event");
+  if (!m_fence_event)
+    return false;
+
+  return true;
+}
+
+bool DXContext::CreateDescriptorHeaps()
+{
+  static constexpr size_t MAX_SRVS = 16384;
+  static constexpr size_t MAX_RTVS = 8192;
+  static constexpr size_t MAX_DSVS = 128;
+
+  if (!m_descriptor_heap_manager.Create(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+                                        MAX_SRVS) ||
+      !m_rtv_heap_manager.Create(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_RTV, MAX_RTVS) ||
+      !m_dsv_heap_manager.Create(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_DSV, MAX_DSVS))
+  {
+    return false;
+  }
+
+  return true;
+}
+
+static bool BuildRootSignature(ID3D12Device* device, ID3D12RootSignature** sig_ptr,
+                               const D3D12_ROOT_PARAMETER* params, u32 num_params)
+{
+  D3D12_ROOT_SIGNATURE_DESC desc = {};
+  desc.pParameters = params;
+  desc.NumParameters = num_params;
+  desc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
+
+  ComPtr<ID3DBlob> root_signature_blob;
+  ComPtr<ID3DBlob> root_signature_error_blob;
+
+  HRESULT hr = s_d3d12_serialize_root_signature(&desc, D3D_ROOT_SIGNATURE_VERSION_1,
+                                                &root_signature_blob, &root_signature_error_blob);
+  if (FAILED(hr))
+  {
+    PanicAlert("Failed to serialize root signature: %s",
+               root_signature_error_blob ?
+                   static_cast<const char*>(root_signature_error_blob->GetBufferPointer()) :
+                   "no error message");
+    return false;
+  }
+
+  hr = device->CreateRootSignature(0, root_signature_blob->GetBufferPointer(),
+                                   root_signature_blob->GetBufferSize(), IID_PPV_ARGS(sig_ptr));
+  CHECK(SUCCEEDED(hr), "Create root signature");
+  return SUCCEEDED(hr);
+}
+
+bool DXContext::CreateRootSignatures()
+{
+  // The same graphics root signature is used for GX and utility draws; the
+  // shader generators use the same register assignments for both (textures in
+  // t0-t7, samplers in s0-s7, uniforms in b0, bounding box UAV in u2).
+  {
+    std::array<D3D12_ROOT_PARAMETER, NUM_ROOT_PARAMETERS> params{};
+
+    static constexpr D3D12_DESCRIPTOR_RANGE srv_range = {D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 8, 0, 0,
+                                                         0};
+    params[ROOT_PARAMETER_PS_SRV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    params[ROOT_PARAMETER_PS_SRV].DescriptorTable.NumDescriptorRanges = 1;
+    params[ROOT_PARAMETER_PS_SRV].DescriptorTable.pDescriptorRanges = &srv_range;
+    params[ROOT_PARAMETER_PS_SRV].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+    static constexpr D3D12_DESCRIPTOR_RANGE sampler_range = {D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, 8,
+                                                             0, 0, 0};
+    params[ROOT_PARAMETER_PS_SAMPLERS].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    params[ROOT_PARAMETER_PS_SAMPLERS].DescriptorTable.NumDescriptorRanges = 1;
+    params[ROOT_PARAMETER_PS_SAMPLERS].DescriptorTable.pDescriptorRanges = &sampler_range;
+    params[ROOT_PARAMETER_PS_SAMPLERS].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+    params[ROOT_PARAMETER_PS_CBV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+    params[ROOT_PARAMETER_PS_CBV].Descriptor.RegisterSpace = 0;
+    params[ROOT_PARAMETER_PS_CBV].Descriptor.ShaderRegister = 0;
+    params[ROOT_PARAMETER_PS_CBV].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+    params[ROOT_PARAMETER_VS_CBV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+    params[ROOT_PARAMETER_VS_CBV].Descriptor.RegisterSpace = 0;
+    params[ROOT_PARAMETER_VS_CBV].Descriptor.ShaderRegister = 0;
+    params[ROOT_PARAMETER_VS_CBV].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX;
+
+    params[ROOT_PARAMETER_GS_CBV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+    params[ROOT_PARAMETER_GS_CBV].Descriptor.RegisterSpace = 0;
+    params[ROOT_PARAMETER_GS_CBV].Descriptor.ShaderRegister = 0;
+    params[ROOT_PARAMETER_GS_CBV].ShaderVisibility = D3D12_SHADER_VISIBILITY_GEOMETRY;
+
+    // The bounding box UAV is a typed buffer (RWBuffer<int>), which can't be
+    // a root descriptor, so it gets a one-entry table.
+    static constexpr D3D12_DESCRIPTOR_RANGE uav_range = {D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 2, 0,
+                                                         0};
+    params[ROOT_PARAMETER_PS_UAV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    params[ROOT_PARAMETER_PS_UAV].DescriptorTable.NumDescriptorRanges = 1;
+    params[ROOT_PARAMETER_PS_UAV].DescriptorTable.pDescriptorRanges = &uav_range;
+    params[ROOT_PARAMETER_PS_UAV].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
+
+    if (!BuildRootSignature(m_device.Get(), &m_gx_root_signature, params.data(),
+                            static_cast<u32>(params.size())))
+    {
+      return false;
+    }
+  }
+
+  {
+    std::array<D3D12_ROOT_PARAMETER, NUM_CS_ROOT_PARAMETERS> params{};
+
+    static constexpr D3D12_DESCRIPTOR_RANGE srv_range = {D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 8, 0, 0,
+                                                         0};
+    params[CS_ROOT_PARAMETER_SRV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    params[CS_ROOT_PARAMETER_SRV].DescriptorTable.NumDescriptorRanges = 1;
+    params[CS_ROOT_PARAMETER_SRV].DescriptorTable.pDescriptorRanges = &srv_range;
+    params[CS_ROOT_PARAMETER_SRV].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+    static constexpr D3D12_DESCRIPTOR_RANGE sampler_range = {D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, 8,
+                                                             0, 0, 0};
+    params[CS_ROOT_PARAMETER_SAMPLERS].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    params[CS_ROOT_PARAMETER_SAMPLERS].DescriptorTable.NumDescriptorRanges = 1;
+    params[CS_ROOT_PARAMETER_SAMPLERS].DescriptorTable.pDescriptorRanges = &sampler_range;
+    params[CS_ROOT_PARAMETER_SAMPLERS].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+    params[CS_ROOT_PARAMETER_CBV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+    params[CS_ROOT_PARAMETER_CBV].Descriptor.RegisterSpace = 0;
+    params[CS_ROOT_PARAMETER_CBV].Descriptor.ShaderRegister = 0;
+    params[CS_ROOT_PARAMETER_CBV].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+    static constexpr D3D12_DESCRIPTOR_RANGE uav_range = {D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 1, 0, 0,
+                                                         0};
+    params[CS_ROOT_PARAMETER_UAV].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+    params[CS_ROOT_PARAMETER_UAV].DescriptorTable.NumDescriptorRanges = 1;
+    params[CS_ROOT_PARAMETER_UAV].DescriptorTable.pDescriptorRanges = &uav_range;
+    params[CS_ROOT_PARAMETER_UAV].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
+    if (!BuildRootSignature(m_device.Get(), &m_compute_root_signature, params.data(),
+                            static_cast<u32>(params.size())))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool DXContext::CreateTextureUploadBuffer()
+{
+  return m_texture_upload_buffer.AllocateBuffer(TEXTURE_UPLOAD_BUFFER_SIZE);
+}
+
+bool DXContext::CreateCommandLists()
+{
+  static constexpr size_t MAX_DRAWS_PER_FRAME = 8192;
+  static constexpr size_t TEMPORARY_SLOTS = MAX_DRAWS_PER_FRAME * 8;
+  static constexpr size_t MAX_SAMPLERS = 1024;
+
+  for (u32 i = 0; i < NUM_COMMAND_LISTS; i++)
+  {
+    CommandListResources& res = m_command_lists[i];
+    HRESULT hr = m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                  IID_PPV_ARGS(&res.command_allocator));
+    CHECK(SUCCEEDED(hr), "Create command allocator");
+    if (FAILED(hr))
+      return false;
+
+    hr = m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, res.command_allocator.Get(),
+                                     nullptr, IID_PPV_ARGS(&res.command_list));
+    CHECK(SUCCEEDED(hr), "Create command list");
+    if (FAILED(hr))
+      return false;
+
+    // Close the command list, since the first thing we do is reset it.
+    hr = res.command_list->Close();
+    CHECK(SUCCEEDED(hr), "Close command list after creation");
+    if (FAILED(hr))
+      return false;
+
+    hr = m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY,
+                                          IID_PPV_ARGS(&res.copy_command_allocator));
+    CHECK(SUCCEEDED(hr), "Create copy command allocator");
+    if (FAILED(hr))
+      return false;
+
+    hr = m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY,
+                                     res.copy_command_allocator.Get(), nullptr,
+                                     IID_PPV_ARGS(&res.copy_command_list));
+    CHECK(SUCCEEDED(hr), "Create copy command list");
+    if (FAILED(hr))
+      return false;
+
+    hr = res.copy_command_list->Close();
+    CHECK(SUCCEEDED(hr), "Close copy command list after creation");
+    if (FAILED(hr))
+      return false;
+
+    if (!res.descriptor_allocator.Create(m_device.Get(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+                                         TEMPORARY_SLOTS) ||
+        !res.sampler_allocator.Create(m_device.Get(), MAX_SAMPLERS))
+    {
+      return false;
+    }
+  }
+
+  MoveToNextCommandList();
+  return true;
+}
+
+void DXContext::MoveToNextCommandList()
+{
+  m_current_command_list = (m_current_command_list + 1) % NUM_COMMAND_LISTS;
+  m_current_fence_value++;
+
+  // We may have to wait if this command list hasn't finished on the GPU.
+  CommandListResources& res = m_command_lists[m_current_command_list];
+  WaitForFence(res.ready_fence_value);
+
+  // Begin command list.
+  res.command_allocator->Reset();
+  res.command_list->Reset(res.command_allocator.Get(), nullptr);
+  res.copy_command_allocator->Reset();
+  res.descriptor_allocator.Reset();
+  if (res.sampler_allocator.ShouldReset())
+    res.sampler_allocator.Reset();
+  res.ready_fence_value = m_current_fence_value;
+
+  // We don't need to bind all the state, only the descriptor heaps, since
+  // the remaining state is applied by the renderer on the next draw anyway.
+  ID3D12DescriptorHeap* heaps[2] = {res.descriptor_allocator.GetDescriptorHeap(),
+                                    res.sampler_allocator.GetDescriptorHeap()};
+  res.command_list->SetDescriptorHeaps(static_cast<UINT>(ArraySize(heaps)), heaps);
+
+  DestroyPendingResources(res);
+}
+
+void DXContext::ExecuteCommandList(bool wait_for_completion)
+{
+  CommandListResources& res = m_command_lists[m_current_command_list];
+
+  // If the copy queue picked up any uploads, submit them first, and make the
+  // direct queue wait for their completion before it starts consuming them.
+  if (m_copy_list_open)
+    ExecuteCopyQueue();
+  if (m_copy_fence_value > m_waited_copy_fence_value)
+  {
+    m_command_queue->Wait(m_copy_fence.Get(), m_copy_fence_value);
+    m_waited_copy_fence_value = m_copy_fence_value;
+  }
+
+  // Close and queue command list.
+  HRESULT hr = res.command_list->Close();
+  CHECK(SUCCEEDED(hr), "Close command list");
+  ID3D12CommandList* const execute_lists[] = {res.command_list.Get()};
+  m_command_queue->ExecuteCommandLists(static_cast<UINT>(ArraySize(execute_lists)), execute_lists);
+
+  // Update fence when GPU has completed.
+  hr = m_command_queue->Signal(m_fence.Get(), m_current_fence_value);
+  CHECK(SUCCEEDED(hr), "Signal fence");
+
+  MoveToNextCommandList();
+  if (wait_for_completion)
+    WaitForFence(res.ready_fence_value);
+}
+
+ID3D12GraphicsCommandList* DXContext::GetCopyCommandList()
+{
+  CommandListResources& res = m_command_lists[m_current_command_list];
+  if (!m_copy_list_open)
+  {
+    res.copy_command_list->Reset(res.copy_command_allocator.Get(), nullptr);
+    m_copy_list_open = true;
+  }
+
+  return res.copy_command_list.Get();
+}
+
+void DXContext::ExecuteCopyQueue()
+{
+  CommandListResources& res = m_command_lists[m_current_command_list];
+  HRESULT hr = res.copy_command_list->Close();
+  CHECK(SUCCEEDED(hr), "Close copy command list");
+
+  ID3D12CommandList* const execute_lists[] = {res.copy_command_list.Get()};
+  m_copy_queue->ExecuteCommandLists(static_cast<UINT>(ArraySize(execute_lists)), execute_lists);
+  m_copy_queue->Signal(m_copy_fence.Get(), ++m_copy_fence_value);
+  m_copy_list_open = false;
+}
+
+void DXContext::WaitForFence(u64 fence)
+{
+  if (m_completed_fence_value >= fence)
+    return;
+
+  if (m_fence->GetCompletedValue() < fence)
+  {
+    HRESULT hr = m_fence->SetEventOnCompletion(fence, m_fence_event);
+    CHECK(SUCCEEDED(hr), "Fence SetEventOnCompletion");
+    WaitForSingleObject(m_fence_event, INFINITE);
+  }
+
+  m_completed_fence_value = m_fence->GetCompletedValue();
+
+  // Release resources for as many command lists which have completed.
+  for (u32 i = 0; i < NUM_COMMAND_LISTS; i++)
+  {
+    CommandListResources& res = m_command_lists[i];
+    if (i != m_current_command_list && res.ready_fence_value <= m_completed_fence_value)
+      DestroyPendingResources(res);
+  }
+}
+
+void DXContext::DeferResourceDestruction(IUnknown* resource)
+{
+  resource->AddRef();
+  m_command_lists[m_current_command_list].pending_resources.push_back(resource);
+}
+
+void DXContext::DeferDescriptorDestruction(DescriptorHeapManager& manager, u32 index)
+{
+  m_command_lists[m_current_command_list].pending_descriptors.emplace_back(&manager, index);
+}
+
+void DXContext::DestroyPendingResources(CommandListResources& cmdlist)
+{
+  for (const auto& dd : cmdlist.pending_descriptors)
+    dd.first->Free(dd.second);
+  cmdlist.pending_descriptors.clear();
+
+  for (IUnknown* res : cmdlist.pending_resources)
+    res->Release();
+  cmdlist.pending_resources.clear();
+}
+
+void DXContext::ResetSamplerAllocators()
+{
+  for (CommandListResources& res : m_command_lists)
+    res.sampler_allocator.Reset();
+}
+
+HRESULT DXContext::CreateGraphicsPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc,
+                                          u64 cache_key, ID3D12PipelineState** out_pso)
+{
+  std::lock_guard<std::mutex> guard(m_pipeline_library_mutex);
+
+  if (m_pipeline_library)
+  {
+    const std::wstring name = UTF8ToUTF16(StringFromFormat("%016llx", cache_key));
+    HRESULT hr = m_pipeline_library->LoadGraphicsPipeline(name.c_str(), &desc,
+                                                          IID_PPV_ARGS(out_pso));
+    if (SUCCEEDED(hr))
+      return hr;
+
+    hr = m_device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(out_pso));
+    if (SUCCEEDED(hr))
+    {
+      // Storing can fail if a pipeline with the same name already exists;
+      // that just means a hash collision or a stale entry, so ignore it.
+      m_pipeline_library->StorePipeline(name.c_str(), *out_pso);
+    }
+
+    return hr;
+  }
+
+  return m_device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(out_pso));
+}
+
+void DXContext::LoadPipelineLibrary()
+{
+  ComPtr<ID3D12Device1> device1;
+  if (FAILED(m_device.As(&device1)))
+  {
+    INFO_LOG(VIDEO, "Runtime does not support pipeline libraries.");
+    return;
+  }
+
+  // The serialized blob has to stay alive as long as the library itself.
+  File::IOFile file(GetPipelineLibraryFileName(), "rb");
+  if (file)
+  {
+    m_pipeline_library_data.resize(file.GetSize());
+    if (!file.ReadBytes(m_pipeline_library_data.data(), m_pipeline_library_data.size()))
+      m_pipeline_library_data.clear();
+  }
+
+  HRESULT hr =
+      device1->CreatePipelineLibrary(m_pipeline_library_data.data(),
+                                     m_pipeline_library_data.size(),
+                                     IID_PPV_ARGS(&m_pipeline_library));
+  if (FAILED(hr) && !m_pipeline_library_data.empty())
+  {
+    // Library from a previous run is incompatible (driver or OS update).
+    m_pipeline_library_data.clear();
+    hr = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&m_pipeline_library));
+  }
+
+  if (FAILED(hr))
+    WARN_LOG(VIDEO, "Creating pipeline library failed, PSOs will be rebuilt every run.");
+}
+
+void DXContext::SavePipelineLibrary()
+{
+  if (!m_pipeline_library)
+    return;
+
+  std::vector<u8> data(m_pipeline_library->GetSerializedSize());
+  if (FAILED(m_pipeline_library->Serialize(data.data(), data.size())))
+    return;
+
+  File::IOFile file(GetPipelineLibraryFileName(), "wb");
+  if (file)
+    file.WriteBytes(data.data(), data.size());
+}
+}  // namespace DX12
@@ -0,0 +1,196 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <d3d12.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoBackends/D3D12/DescriptorHeapManager.h"
+#include "VideoBackends/D3D12/StreamBuffer.h"
+
+struct IDXGIFactory2;
+
+namespace DX12
+{
+// Vertex/Pixel shader root parameters
+enum ROOT_PARAMETER
+{
+  ROOT_PARAMETER_PS_SRV,
+  ROOT_PARAMETER_PS_SAMPLERS,
+  ROOT_PARAMETER_PS_CBV,
+  ROOT_PARAMETER_VS_CBV,
+  ROOT_PARAMETER_GS_CBV,
+  ROOT_PARAMETER_PS_UAV,
+  NUM_ROOT_PARAMETERS
+};
+// Compute shader root parameters
+enum CS_ROOT_PARAMETERS
+{
+  CS_ROOT_PARAMETER_SRV,
+  CS_ROOT_PARAMETER_SAMPLERS,
+  CS_ROOT_PARAMETER_CBV,
+  CS_ROOT_PARAMETER_UAV,
+  NUM_CS_ROOT_PARAMETERS,
+};
+
+class DXContext
+{
+public:
+  ~DXContext();
+
+  // Returns a list of D3D12-compatible GPUs.
+  static std::vector<std::string> GetAdapterNames();
+
+  // Creates new device and context.
+  static bool Create(u32 adapter_index, bool enable_debug_layer);
+
+  // Destroys active context.
+  static void Destroy();
+
+  IDXGIFactory2* GetDXGIFactory() const { return m_dxgi_factory.Get(); }
+  ID3D12Device* GetDevice() const { return m_device.Get(); }
+  ID3D12CommandQueue* GetCommandQueue() const { return m_command_queue.Get(); }
+
+  // Returns the current command list, commands can be recorded directly.
+  ID3D12GraphicsCommandList* GetCommandList() const
+  {
+    return m_command_lists[m_current_command_list].command_list.Get();
+  }
+  DescriptorAllocator* GetDescriptorAllocator()
+  {
+    return &m_command_lists[m_current_command_list].descriptor_allocator;
+  }
+  SamplerAllocator* GetSamplerAllocator()
+  {
+    return &m_command_lists[m_current_command_list].sampler_allocator;
+  }
+
+  // The copy queue is only used for uploads of resources which are still in
+  // the COMMON state (i.e. freshly-created textures); the direct queue waits
+  // on the copy fence before the next batch of rendering commands executes.
+  ID3D12GraphicsCommandList* GetCopyCommandList();
+  StreamBuffer& GetTextureUploadBuffer() { return m_texture_upload_buffer; }
+
+  // Descriptor manager access.
+  DescriptorHeapManager& GetDescriptorHeapManager() { return m_descriptor_heap_manager; }
+  DescriptorHeapManager& GetRTVHeapManager() { return m_rtv_heap_manager; }
+  DescriptorHeapManager& GetDSVHeapManager() { return m_dsv_heap_manager; }
+
+  // Root signature access.
+  ID3D12RootSignature* GetGXRootSignature() const { return m_gx_root_signature.Get(); }
+  ID3D12RootSignature* GetComputeRootSignature() const { return m_compute_root_signature.Get(); }
+
+  // Fence value for the command list currently being recorded.
+  u64 GetCurrentFenceValue() const { return m_current_fence_value; }
+
+  // Last "completed" fence.
+  u64 GetCompletedFenceValue() const { return m_completed_fence_value; }
+
+  // Feature level to use when compiling shaders.
+  D3D_FEATURE_LEVEL GetFeatureLevel() const { return m_feature_level; }
+
+  // Creates a PSO, either from the pipeline library if it was seen in a
+  // previous run, or from scratch, storing it back to the library.
+  HRESULT CreateGraphicsPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, u64 cache_key,
+                                 ID3D12PipelineState** out_pso);
+
+  // Executes the current command list.
+  void ExecuteCommandList(bool wait_for_completion);
+
+  // Waits for a specific fence.
+  void WaitForFence(u64 fence);
+
+  // Defers destruction of a D3D object (associates it with the current list).
+  void DeferResourceDestruction(IUnknown* resource);
+
+  // Defers destruction of a descriptor handle (associates it with the current list).
+  void DeferDescriptorDestruction(DescriptorHeapManager& manager, u32 index);
+
+  // Clears all samplers from the per-frame allocators.
+  void ResetSamplerAllocators();
+
+private:
+  // Number of command lists. One is being built while the other(s) are executed.
+  static constexpr u32 NUM_COMMAND_LISTS = 3;
+
+  // Textures that don't fit into this buffer will be uploaded with a staging buffer.
+  static constexpr u32 TEXTURE_UPLOAD_BUFFER_SIZE = 32 * 1024 * 1024;
+
+  struct CommandListResources
+  {
+    ComPtr<ID3D12CommandAllocator> command_allocator;
+    ComPtr<ID3D12GraphicsCommandList> command_list;
+    ComPtr<ID3D12CommandAllocator> copy_command_allocator;
+    ComPtr<ID3D12GraphicsCommandList> copy_command_list;
+    DescriptorAllocator descriptor_allocator;
+    SamplerAllocator sampler_allocator;
+    std::vector<IUnknown*> pending_resources;
+    std::vector<std::pair<DescriptorHeapManager*, u32>> pending_descriptors;
+    u64 ready_fence_value = 0;
+  };
+
+  DXContext();
+
+  bool CreateDXGIFactory(bool enable_debug_layer);
+  bool CreateDevice(u32 adapter_index, bool enable_debug_layer);
+  bool CreateCommandQueues();
+  bool CreateFence();
+  bool CreateDescriptorHeaps();
+  bool CreateRootSignatures();
+  bool CreateTextureUploadBuffer();
+  bool CreateCommandLists();
+  void MoveToNextCommandList();
+  void DestroyPendingResources(CommandListResources& cmdlist);
+  void ExecuteCopyQueue();
+  void LoadPipelineLibrary();
+  void SavePipelineLibrary();
+
+  ComPtr<IDXGIFactory2> m_dxgi_factory;
+  ComPtr<ID3D12Debug> m_debug_interface;
+  ComPtr<ID3D12Device> m_device;
+  ComPtr<ID3D12CommandQueue> m_command_queue;
+  ComPtr<ID3D12CommandQueue> m_copy_queue;
+
+  ComPtr<ID3D12Fence> m_fence;
+  HANDLE m_fence_event = {};
+  u64 m_current_fence_value = 0;
+  u64 m_completed_fence_value = 0;
+
+  ComPtr<ID3D12Fence> m_copy_fence;
+  u64 m_copy_fence_value = 0;
+  u64 m_waited_copy_fence_value = 0;
+  bool m_copy_list_open = false;
+
+  std::array<CommandListResources, NUM_COMMAND_LISTS> m_command_lists;
+  u32 m_current_command_list = NUM_COMMAND_LISTS - 1;
+
+  DescriptorHeapManager m_descriptor_heap_manager;
+  DescriptorHeapManager m_rtv_heap_manager;
+  DescriptorHeapManager m_dsv_heap_manager;
+
+  ComPtr<ID3D12RootSignature> m_gx_root_signature;
+  ComPtr<ID3D12RootSignature> m_compute_root_signature;
+
+  // Pipeline library, when supported by the runtime (ID3D12Device1). Created
+  // pipelines are stored back keyed on a hash of their configuration, which
+  // makes PSO creation on subsequent runs a memcpy instead of a compile.
+  ComPtr<ID3D12PipelineLibrary> m_pipeline_library;
+  std::vector<u8> m_pipeline_library_data;
+  std::mutex m_pipeline_library_mutex;
+
+  StreamBuffer m_texture_upload_buffer;
+
+  D3D_FEATURE_LEVEL m_feature_level = D3D_FEATURE_LEVEL_11_0;
+};
+
+extern std::unique_ptr<DXContext> g_dx_context;
+
+}  // namespace DX12
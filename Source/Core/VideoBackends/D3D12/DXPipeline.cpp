@@ -0,0 +1,222 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/DXPipeline.h"
+
+#include <array>
+#include <cstring>
+
+#include "Common/Assert.h"
+#include "Common/Hash.h"
+
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/DXShader.h"
+#include "VideoBackends/D3D12/VertexManager.h"
+#include "VideoBackends/D3DCommon/Common.h"
+
+namespace DX12
+{
+DXPipeline::DXPipeline(ID3D12PipelineState* pipeline, ID3D12RootSignature* root_signature,
+                       AbstractPipelineUsage usage, D3D12_PRIMITIVE_TOPOLOGY primitive_topology,
+                       bool use_integer_rtv)
+    : m_pipeline(pipeline), m_root_signature(root_signature), m_usage(usage),
+      m_primitive_topology(primitive_topology), m_use_integer_rtv(use_integer_rtv)
+{
+}
+
+DXPipeline::~DXPipeline()
+{
+  // The PSO may still be referenced by an in-flight command list.
+  g_dx_context->DeferResourceDestruction(m_pipeline.Get());
+}
+
+static void GetD3DRasterizerDesc(D3D12_RASTERIZER_DESC* desc, const RasterizationState& rs_state)
+{
+  static constexpr std::array<D3D12_CULL_MODE, 4> cull_modes = {
+      {D3D12_CULL_MODE_NONE, D3D12_CULL_MODE_BACK, D3D12_CULL_MODE_FRONT, D3D12_CULL_MODE_BACK}};
+
+  desc->FillMode = D3D12_FILL_MODE_SOLID;
+  desc->CullMode = cull_modes[rs_state.cullmode];
+  desc->MultisampleEnable = TRUE;
+}
+
+static void GetD3DDepthDesc(D3D12_DEPTH_STENCIL_DESC* desc, const DepthState& ds_state)
+{
+  // Less/greater are swapped due to inverted depth.
+  static constexpr std::array<D3D12_COMPARISON_FUNC, 8> compare_funcs = {
+      {D3D12_COMPARISON_FUNC_NEVER, D3D12_COMPARISON_FUNC_GREATER, D3D12_COMPARISON_FUNC_EQUAL,
+       D3D12_COMPARISON_FUNC_GREATER_EQUAL, D3D12_COMPARISON_FUNC_LESS,
+       D3D12_COMPARISON_FUNC_NOT_EQUAL, D3D12_COMPARISON_FUNC_LESS_EQUAL,
+       D3D12_COMPARISON_FUNC_ALWAYS}};
+
+  if (ds_state.testenable)
+  {
+    desc->DepthEnable = TRUE;
+    desc->DepthWriteMask =
+        ds_state.updateenable ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
+    desc->DepthFunc = compare_funcs[ds_state.func];
+  }
+  else
+  {
+    // If the test is disabled, write is disabled too.
+    desc->DepthEnable = FALSE;
+    desc->DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ZERO;
+    desc->DepthFunc = D3D12_COMPARISON_FUNC_ALWAYS;
+  }
+}
+
+static void GetD3DBlendDesc(D3D12_BLEND_DESC* desc, const BlendingState& bs_state)
+{
+  D3D12_RENDER_TARGET_BLEND_DESC* rtblend = &desc->RenderTarget[0];
+  if (bs_state.colorupdate)
+  {
+    rtblend->RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_RED |
+                                     D3D12_COLOR_WRITE_ENABLE_GREEN |
+                                     D3D12_COLOR_WRITE_ENABLE_BLUE;
+  }
+  if (bs_state.alphaupdate)
+    rtblend->RenderTargetWriteMask |= D3D12_COLOR_WRITE_ENABLE_ALPHA;
+
+  // blend takes precedence over logic op
+  rtblend->BlendEnable = bs_state.blendenable;
+  if (bs_state.blendenable)
+  {
+    const bool use_dual_source = bs_state.usedualsrc;
+    const std::array<D3D12_BLEND, 8> src_factors = {
+        {D3D12_BLEND_ZERO, D3D12_BLEND_ONE, D3D12_BLEND_DEST_COLOR, D3D12_BLEND_INV_DEST_COLOR,
+         use_dual_source ? D3D12_BLEND_SRC1_ALPHA : D3D12_BLEND_SRC_ALPHA,
+         use_dual_source ? D3D12_BLEND_INV_SRC1_ALPHA : D3D12_BLEND_INV_SRC_ALPHA,
+         D3D12_BLEND_DEST_ALPHA, D3D12_BLEND_INV_DEST_ALPHA}};
+    const std::array<D3D12_BLEND, 8> dst_factors = {
+        {D3D12_BLEND_ZERO, D3D12_BLEND_ONE, D3D12_BLEND_SRC_COLOR, D3D12_BLEND_INV_SRC_COLOR,
+         use_dual_source ? D3D12_BLEND_SRC1_ALPHA : D3D12_BLEND_SRC_ALPHA,
+         use_dual_source ? D3D12_BLEND_INV_SRC1_ALPHA : D3D12_BLEND_INV_SRC_ALPHA,
+         D3D12_BLEND_DEST_ALPHA, D3D12_BLEND_INV_DEST_ALPHA}};
+
+    rtblend->SrcBlend = src_factors[bs_state.srcfactor];
+    rtblend->SrcBlendAlpha = src_factors[bs_state.srcfactoralpha];
+    rtblend->DestBlend = dst_factors[bs_state.dstfactor];
+    rtblend->DestBlendAlpha = dst_factors[bs_state.dstfactoralpha];
+    rtblend->BlendOp =
+        bs_state.subtract ? D3D12_BLEND_OP_REV_SUBTRACT : D3D12_BLEND_OP_ADD;
+    rtblend->BlendOpAlpha =
+        bs_state.subtractAlpha ? D3D12_BLEND_OP_REV_SUBTRACT : D3D12_BLEND_OP_ADD;
+  }
+  else if (bs_state.logicopenable)
+  {
+    static constexpr std::array<D3D12_LOGIC_OP, 16> logic_ops = {
+        {D3D12_LOGIC_OP_CLEAR, D3D12_LOGIC_OP_AND, D3D12_LOGIC_OP_AND_REVERSE, D3D12_LOGIC_OP_COPY,
+         D3D12_LOGIC_OP_AND_INVERTED, D3D12_LOGIC_OP_NOOP, D3D12_LOGIC_OP_XOR, D3D12_LOGIC_OP_OR,
+         D3D12_LOGIC_OP_NOR, D3D12_LOGIC_OP_EQUIV, D3D12_LOGIC_OP_INVERT,
+         D3D12_LOGIC_OP_OR_REVERSE, D3D12_LOGIC_OP_COPY_INVERTED, D3D12_LOGIC_OP_OR_INVERTED,
+         D3D12_LOGIC_OP_NAND, D3D12_LOGIC_OP_SET}};
+    rtblend->LogicOpEnable = TRUE;
+    rtblend->LogicOp = logic_ops[bs_state.logicmode];
+  }
+}
+
+static D3D12_PRIMITIVE_TOPOLOGY GetD3DTopology(const RasterizationState& state)
+{
+  static constexpr std::array<D3D12_PRIMITIVE_TOPOLOGY, 4> primitive_topologies = {
+      {D3D_PRIMITIVE_TOPOLOGY_POINTLIST, D3D_PRIMITIVE_TOPOLOGY_LINELIST,
+       D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST, D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP}};
+  return primitive_topologies[static_cast<u32>(state.primitive.Value())];
+}
+
+static D3D12_PRIMITIVE_TOPOLOGY_TYPE GetD3DTopologyType(const RasterizationState& state)
+{
+  static constexpr std::array<D3D12_PRIMITIVE_TOPOLOGY_TYPE, 4> primitive_topology_types = {
+      {D3D12_PRIMITIVE_TOPOLOGY_TYPE_POINT, D3D12_PRIMITIVE_TOPOLOGY_TYPE_LINE,
+       D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE, D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE}};
+  return primitive_topology_types[static_cast<u32>(state.primitive.Value())];
+}
+
+// Identifies a pipeline in the pipeline library. Shaders are hashed by their
+// bytecode, not pointer, so the key is stable across runs.
+static u64 GetPipelineCacheKey(const AbstractPipelineConfig& config)
+{
+  struct KeyData
+  {
+    u32 rasterization_state;
+    u32 depth_state;
+    u32 blending_state;
+    u32 framebuffer_state;
+    u32 usage;
+    u32 vertex_decl_hash;
+    u64 vs_hash;
+    u64 gs_hash;
+    u64 ps_hash;
+  };
+
+  const auto shader_hash = [](const AbstractShader* shader) -> u64 {
+    if (!shader)
+      return 0;
+    const auto& bytecode = static_cast<const DXShader*>(shader)->GetByteCode();
+    return Common::GetHash64(bytecode.data(), static_cast<u32>(bytecode.size()), 64);
+  };
+
+  KeyData key = {};
+  key.rasterization_state = config.rasterization_state.hex;
+  key.depth_state = config.depth_state.hex;
+  key.blending_state = config.blending_state.hex;
+  key.framebuffer_state = config.framebuffer_state.hex;
+  key.usage = static_cast<u32>(config.usage);
+  if (config.vertex_format)
+  {
+    const PortableVertexDeclaration& decl = config.vertex_format->GetVertexDeclaration();
+    key.vertex_decl_hash = Common::HashAdler32(reinterpret_cast<const u8*>(&decl), sizeof(decl));
+  }
+  key.vs_hash = shader_hash(config.vertex_shader);
+  key.gs_hash = shader_hash(config.geometry_shader);
+  key.ps_hash = shader_hash(config.pixel_shader);
+
+  return Common::GetHash64(reinterpret_cast<const u8*>(&key), sizeof(key), 64);
+}
+
+std::unique_ptr<DXPipeline> DXPipeline::Create(const AbstractPipelineConfig& config)
+{
+  ASSERT(config.vertex_shader && config.pixel_shader);
+
+  D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = {};
+  desc.pRootSignature = g_dx_context->GetGXRootSignature();
+  desc.VS = static_cast<const DXShader*>(config.vertex_shader)->GetD3DByteCode();
+  desc.PS = static_cast<const DXShader*>(config.pixel_shader)->GetD3DByteCode();
+  if (config.geometry_shader)
+    desc.GS = static_cast<const DXShader*>(config.geometry_shader)->GetD3DByteCode();
+
+  GetD3DBlendDesc(&desc.BlendState, config.blending_state);
+  desc.SampleMask = 0xFFFFFFFF;
+  GetD3DRasterizerDesc(&desc.RasterizerState, config.rasterization_state);
+  GetD3DDepthDesc(&desc.DepthStencilState, config.depth_state);
+  if (config.vertex_format)
+    desc.InputLayout = static_cast<const DXVertexFormat*>(config.vertex_format)
+                           ->GetInputLayoutDesc();
+  desc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
+  desc.PrimitiveTopologyType = GetD3DTopologyType(config.rasterization_state);
+
+  const bool use_integer_rtv =
+      !config.blending_state.blendenable && config.blending_state.logicopenable;
+  if (config.framebuffer_state.color_texture_format != AbstractTextureFormat::Undefined)
+  {
+    desc.NumRenderTargets = 1;
+    desc.RTVFormats[0] = D3DCommon::GetRTVFormatForAbstractFormat(
+        config.framebuffer_state.color_texture_format, use_integer_rtv);
+  }
+  if (config.framebuffer_state.depth_texture_format != AbstractTextureFormat::Undefined)
+    desc.DSVFormat =
+        D3DCommon::GetDSVFormatForAbstractFormat(config.framebuffer_state.depth_texture_format);
+  desc.SampleDesc.Count = config.framebuffer_state.samples;
+  desc.NodeMask = 1;
+
+  ComPtr<ID3D12PipelineState> pso;
+  HRESULT hr =
+      g_dx_context->CreateGraphicsPipeline(desc, GetPipelineCacheKey(config), &pso);
+  CHECK(SUCCEEDED(hr), "Creating graphics pipeline failed");
+  if (FAILED(hr))
+    return nullptr;
+
+  return std::make_unique<DXPipeline>(pso.Get(), desc.pRootSignature, config.usage,
+                                      GetD3DTopology(config.rasterization_state), use_integer_rtv);
+}
+}  // namespace DX12
@@ -0,0 +1,37 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoCommon/AbstractPipeline.h"
+
+namespace DX12
+{
+class DXPipeline final : public AbstractPipeline
+{
+public:
+  DXPipeline(ID3D12PipelineState* pipeline, ID3D12RootSignature* root_signature,
+             AbstractPipelineUsage usage, D3D12_PRIMITIVE_TOPOLOGY primitive_topology,
+             bool use_integer_rtv);
+  ~DXPipeline() override;
+
+  ID3D12PipelineState* GetPipeline() const { return m_pipeline.Get(); }
+  ID3D12RootSignature* GetRootSignature() const { return m_root_signature; }
+  AbstractPipelineUsage GetUsage() const { return m_usage; }
+  D3D12_PRIMITIVE_TOPOLOGY GetPrimitiveTopology() const { return m_primitive_topology; }
+  bool UseIntegerRTV() const { return m_use_integer_rtv; }
+
+  static std::unique_ptr<DXPipeline> Create(const AbstractPipelineConfig& config);
+
+private:
+  ComPtr<ID3D12PipelineState> m_pipeline;
+  ID3D12RootSignature* m_root_signature;
+  AbstractPipelineUsage m_usage;
+  D3D12_PRIMITIVE_TOPOLOGY m_primitive_topology;
+  bool m_use_integer_rtv;
+};
+}  // namespace DX12
@@ -0,0 +1,688 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/DXTexture.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/Align.h"
+#include "Common/Assert.h"
+#include "Common/CommonTypes.h"
+
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/Renderer.h"
+#include "VideoBackends/D3D12/StreamBuffer.h"
+#include "VideoBackends/D3DCommon/Common.h"
+
+namespace DX12
+{
+static D3D12_RESOURCE_FLAGS GetD3DResourceFlags(const TextureConfig& config)
+{
+  D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE;
+  if (config.IsRenderTarget())
+  {
+    flags |= IsDepthFormat(config.format) ? D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL :
+                                            D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+  }
+  if (config.IsComputeImage())
+    flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+  return flags;
+}
+
+DXTexture::DXTexture(const TextureConfig& config, ID3D12Resource* resource,
+                     D3D12_RESOURCE_STATES state)
+    : AbstractTexture(config), m_resource(resource), m_state(state)
+{
+}
+
+DXTexture::~DXTexture()
+{
+  DestroyResource();
+}
+
+std::unique_ptr<DXTexture> DXTexture::Create(const TextureConfig& config)
+{
+  // Use typeless to create the texture when it's a render target, so we can alias it with an
+  // integer format (for EFB).
+  const DXGI_FORMAT tex_format =
+      D3DCommon::GetDXGIFormatForAbstractFormat(config.format, config.IsRenderTarget());
+
+  static const D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_DEFAULT};
+  const D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+                                             0,
+                                             config.width,
+                                             config.height,
+                                             static_cast<u16>(config.layers),
+                                             static_cast<u16>(config.levels),
+                                             tex_format,
+                                             {config.samples, 0},
+                                             D3D12_TEXTURE_LAYOUT_UNKNOWN,
+                                             GetD3DResourceFlags(config)};
+
+  D3D12_CLEAR_VALUE optimized_clear_value = {};
+  if (config.IsRenderTarget())
+  {
+    optimized_clear_value.Format = IsDepthFormat(config.format) ?
+                                       D3DCommon::GetDSVFormatForAbstractFormat(config.format) :
+                                       D3DCommon::GetRTVFormatForAbstractFormat(config.format,
+                                                                                false);
+    if (IsDepthFormat(config.format))
+      optimized_clear_value.DepthStencil.Depth = 0.0f;
+  }
+
+  // Start the texture off in the COMMON state, so the first upload can go
+  // through the copy queue (state promotion/decay only applies there).
+  ComPtr<ID3D12Resource> resource;
+  HRESULT hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_COMMON,
+      config.IsRenderTarget() ? &optimized_clear_value : nullptr, IID_PPV_ARGS(&resource));
+  if (FAILED(hr))
+  {
+    PanicAlert("Failed to create %ux%ux%u D3D backing texture", config.width, config.height,
+               config.layers);
+    return nullptr;
+  }
+
+  std::unique_ptr<DXTexture> tex(
+      new DXTexture(config, resource.Get(), D3D12_RESOURCE_STATE_COMMON));
+  if (!tex->CreateSRVDescriptor() || (config.IsComputeImage() && !tex->CreateUAVDescriptor()))
+    return nullptr;
+
+  return tex;
+}
+
+std::unique_ptr<DXTexture> DXTexture::CreateAdopted(ID3D12Resource* resource)
+{
+  const D3D12_RESOURCE_DESC desc = resource->GetDesc();
+  const AbstractTextureFormat format = D3DCommon::GetAbstractFormatForDXGIFormat(desc.Format);
+  if (desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D ||
+      format == AbstractTextureFormat::Undefined)
+  {
+    PanicAlert("Unknown format for adopted texture");
+    return nullptr;
+  }
+
+  TextureConfig config(static_cast<u32>(desc.Width), desc.Height, desc.MipLevels,
+                       desc.DepthOrArraySize, desc.SampleDesc.Count, format, 0);
+  if (desc.Flags &
+      (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL))
+  {
+    config.flags |= AbstractTextureFlag_RenderTarget;
+  }
+
+  std::unique_ptr<DXTexture> tex(
+      new DXTexture(config, resource, D3D12_RESOURCE_STATE_COMMON));
+  if (!(desc.Flags & D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE) && !tex->CreateSRVDescriptor())
+    return nullptr;
+
+  return tex;
+}
+
+bool DXTexture::CreateSRVDescriptor()
+{
+  if (!g_dx_context->GetDescriptorHeapManager().Allocate(&m_srv_descriptor))
+  {
+    PanicAlert("Failed to allocate SRV descriptor");
+    return false;
+  }
+
+  D3D12_SHADER_RESOURCE_VIEW_DESC desc = {};
+  desc.Format = D3DCommon::GetSRVFormatForAbstractFormat(m_config.format);
+  desc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+  if (m_config.IsMultisampled())
+  {
+    desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY;
+    desc.Texture2DMSArray.ArraySize = m_config.layers;
+  }
+  else
+  {
+    desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+    desc.Texture2DArray.MipLevels = m_config.levels;
+    desc.Texture2DArray.ArraySize = m_config.layers;
+  }
+
+  g_dx_context->GetDevice()->CreateShaderResourceView(m_resource.Get(), &desc,
+                                                      m_srv_descriptor.cpu_handle);
+  return true;
+}
+
+bool DXTexture::CreateUAVDescriptor()
+{
+  if (!g_dx_context->GetDescriptorHeapManager().Allocate(&m_uav_descriptor))
+  {
+    PanicAlert("Failed to allocate UAV descriptor");
+    return false;
+  }
+
+  D3D12_UNORDERED_ACCESS_VIEW_DESC desc = {};
+  desc.Format = D3DCommon::GetSRVFormatForAbstractFormat(m_config.format);
+  desc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY;
+  desc.Texture2DArray.ArraySize = m_config.layers;
+
+  g_dx_context->GetDevice()->CreateUnorderedAccessView(m_resource.Get(), nullptr, &desc,
+                                                       m_uav_descriptor.cpu_handle);
+  return true;
+}
+
+void DXTexture::Load(u32 level, u32 width, u32 height, u32 row_length, const u8* buffer,
+                     size_t buffer_size)
+{
+  // Textures greater than 1024*1024 will be put in staging textures that are released after the
+  // upload completes, instead of going through the texture upload ring buffer.
+  static constexpr u32 STAGING_BUFFER_UPLOAD_THRESHOLD = 1024 * 1024 * 4;
+
+  const u32 copy_pitch = static_cast<u32>(
+      Common::AlignUp(CalculateStrideForFormat(m_config.format, row_length),
+                      D3D12_TEXTURE_DATA_PITCH_ALIGNMENT));
+  const u32 upload_stride = static_cast<u32>(CalculateStrideForFormat(m_config.format, row_length));
+  const u32 block_size = std::max(GetBlockSizeForFormat(m_config.format), 1u);
+  const u32 num_rows = Common::AlignUp(height, block_size) / block_size;
+  const u32 upload_size = copy_pitch * num_rows;
+
+  // Both paths need the data laid out with the aligned pitch.
+  ComPtr<ID3D12Resource> staging_buffer;
+  StreamBuffer& upload_buffer = g_dx_context->GetTextureUploadBuffer();
+  ID3D12Resource* copy_src_resource;
+  u64 copy_src_offset;
+  u8* dst_ptr;
+  if (upload_size >= STAGING_BUFFER_UPLOAD_THRESHOLD)
+  {
+    static const D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_UPLOAD};
+    const D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
+                                               0,
+                                               upload_size,
+                                               1,
+                                               1,
+                                               1,
+                                               DXGI_FORMAT_UNKNOWN,
+                                               {1, 0},
+                                               D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                               D3D12_RESOURCE_FLAG_NONE};
+    HRESULT hr = g_dx_context->GetDevice()->CreateCommittedResource(
+        &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr, IID_PPV_ARGS(&staging_buffer));
+    CHECK(SUCCEEDED(hr), "Create temporary texture upload buffer");
+    if (FAILED(hr))
+      return;
+
+    static const D3D12_RANGE read_range = {};
+    hr = staging_buffer->Map(0, &read_range, reinterpret_cast<void**>(&dst_ptr));
+    CHECK(SUCCEEDED(hr), "Map temporary texture upload buffer");
+    if (FAILED(hr))
+      return;
+
+    copy_src_resource = staging_buffer.Get();
+    copy_src_offset = 0;
+  }
+  else
+  {
+    if (!upload_buffer.ReserveMemory(upload_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
+    {
+      // Executing the command list causes the upload to happen before the copy below is recorded,
+      // since the copy queue is flushed as part of the submit.
+      WARN_LOG(VIDEO, "Executing command list while waiting for space in texture upload buffer");
+      Renderer::GetInstance()->ExecuteCommandList(false);
+      if (!upload_buffer.ReserveMemory(upload_size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT))
+      {
+        PanicAlert("Failed to allocate texture upload memory");
+        return;
+      }
+    }
+
+    copy_src_resource = upload_buffer.GetBuffer();
+    copy_src_offset = upload_buffer.GetCurrentOffset();
+    dst_ptr = upload_buffer.GetCurrentHostPointer();
+  }
+
+  // Copy in, slow path if the pitch differs.
+  if (upload_stride != copy_pitch)
+  {
+    const u8* src_ptr = buffer;
+    const u32 copy_size = std::min(upload_stride, copy_pitch);
+    for (u32 i = 0; i < num_rows; i++)
+    {
+      std::memcpy(dst_ptr, src_ptr, copy_size);
+      dst_ptr += copy_pitch;
+      src_ptr += upload_stride;
+    }
+  }
+  else
+  {
+    std::memcpy(dst_ptr, buffer, std::min<size_t>(buffer_size, upload_size));
+  }
+
+  if (staging_buffer)
+  {
+    const D3D12_RANGE written_range = {0, upload_size};
+    staging_buffer->Unmap(0, &written_range);
+  }
+  else
+  {
+    upload_buffer.CommitMemory(upload_size);
+  }
+
+  // Issue the copy. If the texture is still in the COMMON state (i.e. it was just created and
+  // hasn't been drawn with yet), it can go through the copy queue, overlapping the upload with
+  // rendering. The state implicitly promotes to COPY_DEST for the copy, and decays back to
+  // COMMON when the copy queue's submission completes.
+  const bool use_copy_queue = m_state == D3D12_RESOURCE_STATE_COMMON;
+  ID3D12GraphicsCommandList* list =
+      use_copy_queue ? g_dx_context->GetCopyCommandList() : g_dx_context->GetCommandList();
+  if (!use_copy_queue)
+    TransitionToState(D3D12_RESOURCE_STATE_COPY_DEST);
+
+  D3D12_TEXTURE_COPY_LOCATION dst_location;
+  dst_location.pResource = m_resource.Get();
+  dst_location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  dst_location.SubresourceIndex = CalcSubresource(level, 0);
+
+  D3D12_TEXTURE_COPY_LOCATION src_location;
+  src_location.pResource = copy_src_resource;
+  src_location.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+  src_location.PlacedFootprint.Offset = copy_src_offset;
+  src_location.PlacedFootprint.Footprint.Format =
+      D3DCommon::GetDXGIFormatForAbstractFormat(m_config.format, false);
+  src_location.PlacedFootprint.Footprint.Width = width;
+  src_location.PlacedFootprint.Footprint.Height = height;
+  src_location.PlacedFootprint.Footprint.Depth = 1;
+  src_location.PlacedFootprint.Footprint.RowPitch = copy_pitch;
+
+  list->CopyTextureRegion(&dst_location, 0, 0, 0, &src_location, nullptr);
+
+  if (!use_copy_queue)
+    TransitionToState(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+  // Release the temporary buffer when the GPU is done with it.
+  if (staging_buffer)
+    g_dx_context->DeferResourceDestruction(staging_buffer.Get());
+}
+
+void DXTexture::CopyRectangleFromTexture(const AbstractTexture* src,
+                                         const MathUtil::Rectangle<int>& src_rect, u32 src_layer,
+                                         u32 src_level, const MathUtil::Rectangle<int>& dst_rect,
+                                         u32 dst_layer, u32 dst_level)
+{
+  const DXTexture* src_tex = static_cast<const DXTexture*>(src);
+  ASSERT(src_rect.GetWidth() == dst_rect.GetWidth() &&
+         src_rect.GetHeight() == dst_rect.GetHeight());
+
+  const D3D12_RESOURCE_STATES old_src_state = src_tex->m_state;
+  src_tex->TransitionToState(D3D12_RESOURCE_STATE_COPY_SOURCE);
+  const D3D12_RESOURCE_STATES old_state = m_state;
+  TransitionToState(D3D12_RESOURCE_STATE_COPY_DEST);
+
+  D3D12_TEXTURE_COPY_LOCATION dst_location;
+  dst_location.pResource = m_resource.Get();
+  dst_location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  dst_location.SubresourceIndex = CalcSubresource(dst_level, dst_layer);
+
+  D3D12_TEXTURE_COPY_LOCATION src_location;
+  src_location.pResource = src_tex->m_resource.Get();
+  src_location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  src_location.SubresourceIndex = src_tex->CalcSubresource(src_level, src_layer);
+
+  const D3D12_BOX src_box = {static_cast<UINT>(src_rect.left), static_cast<UINT>(src_rect.top), 0,
+                             static_cast<UINT>(src_rect.right), static_cast<UINT>(src_rect.bottom),
+                             1};
+  g_dx_context->GetCommandList()->CopyTextureRegion(&dst_location, dst_rect.left, dst_rect.top, 0,
+                                                    &src_location, &src_box);
+
+  // Only restore the source layout. Destination is restored by FinishedRendering().
+  src_tex->TransitionToState(old_src_state);
+  if (old_state != D3D12_RESOURCE_STATE_COMMON)
+    TransitionToState(old_state);
+  else
+    TransitionToState(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+}
+
+void DXTexture::ResolveFromTexture(const AbstractTexture* src, const MathUtil::Rectangle<int>& rect,
+                                   u32 layer, u32 level)
+{
+  const DXTexture* src_tex = static_cast<const DXTexture*>(src);
+  DEBUG_ASSERT(src_tex->GetConfig().samples > 1 && m_config.samples == 1);
+
+  const D3D12_RESOURCE_STATES old_src_state = src_tex->m_state;
+  src_tex->TransitionToState(D3D12_RESOURCE_STATE_RESOLVE_SOURCE);
+  const D3D12_RESOURCE_STATES old_state = m_state;
+  TransitionToState(D3D12_RESOURCE_STATE_RESOLVE_DEST);
+
+  g_dx_context->GetCommandList()->ResolveSubresource(
+      m_resource.Get(), CalcSubresource(level, layer), src_tex->m_resource.Get(),
+      src_tex->CalcSubresource(level, layer),
+      D3DCommon::GetDXGIFormatForAbstractFormat(m_config.format, false));
+
+  src_tex->TransitionToState(old_src_state);
+  TransitionToState(old_state != D3D12_RESOURCE_STATE_COMMON ?
+                        old_state :
+                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+}
+
+void DXTexture::TransitionToState(D3D12_RESOURCE_STATES state) const
+{
+  if (m_state == state)
+    return;
+
+  // COMMON -> anything is a promotion the API does for us on the first access,
+  // but recording an explicit barrier keeps the tracking simple and is legal.
+  const D3D12_RESOURCE_BARRIER barrier = {
+      D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+      D3D12_RESOURCE_BARRIER_FLAG_NONE,
+      {{m_resource.Get(), D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES, m_state, state}}};
+  g_dx_context->GetCommandList()->ResourceBarrier(1, &barrier);
+  m_state = state;
+}
+
+void DXTexture::DestroyResource()
+{
+  if (m_uav_descriptor)
+    g_dx_context->DeferDescriptorDestruction(g_dx_context->GetDescriptorHeapManager(),
+                                             m_uav_descriptor.index);
+  if (m_srv_descriptor)
+    g_dx_context->DeferDescriptorDestruction(g_dx_context->GetDescriptorHeapManager(),
+                                             m_srv_descriptor.index);
+  if (m_resource)
+    g_dx_context->DeferResourceDestruction(m_resource.Get());
+
+  m_srv_descriptor = {};
+  m_uav_descriptor = {};
+  m_resource.Reset();
+}
+
+DXStagingTexture::DXStagingTexture(StagingTextureType type, const TextureConfig& config,
+                                   ID3D12Resource* resource, u32 stride, u32 buffer_size)
+    : AbstractStagingTexture(type, config), m_resource(resource), m_buffer_size(buffer_size)
+{
+  m_map_stride = stride;
+}
+
+DXStagingTexture::~DXStagingTexture()
+{
+  if (IsMapped())
+    DXStagingTexture::Unmap();
+
+  g_dx_context->DeferResourceDestruction(m_resource.Get());
+}
+
+std::unique_ptr<DXStagingTexture> DXStagingTexture::Create(StagingTextureType type,
+                                                           const TextureConfig& config)
+{
+  // Readback and mutable share the readback heap; upload uses the upload heap.
+  const bool readback = type != StagingTextureType::Upload;
+  const u32 stride = static_cast<u32>(
+      Common::AlignUp(config.GetStride(), D3D12_TEXTURE_DATA_PITCH_ALIGNMENT));
+  const u32 buffer_size = stride * config.height;
+
+  const D3D12_HEAP_PROPERTIES heap_properties = {
+      readback ? D3D12_HEAP_TYPE_READBACK : D3D12_HEAP_TYPE_UPLOAD};
+  const D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
+                                             0,
+                                             buffer_size,
+                                             1,
+                                             1,
+                                             1,
+                                             DXGI_FORMAT_UNKNOWN,
+                                             {1, 0},
+                                             D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                             D3D12_RESOURCE_FLAG_NONE};
+
+  ComPtr<ID3D12Resource> resource;
+  HRESULT hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc,
+      readback ? D3D12_RESOURCE_STATE_COPY_DEST : D3D12_RESOURCE_STATE_GENERIC_READ, nullptr,
+      IID_PPV_ARGS(&resource));
+  CHECK(SUCCEEDED(hr), "Create staging texture buffer");
+  if (FAILED(hr))
+    return nullptr;
+
+  return std::unique_ptr<DXStagingTexture>(
+      new DXStagingTexture(type, config, resource.Get(), stride, buffer_size));
+}
+
+void DXStagingTexture::CopyFromTexture(const AbstractTexture* src,
+                                       const MathUtil::Rectangle<int>& src_rect, u32 src_layer,
+                                       u32 src_level, const MathUtil::Rectangle<int>& dst_rect)
+{
+  const DXTexture* src_tex = static_cast<const DXTexture*>(src);
+  ASSERT(m_type == StagingTextureType::Readback || m_type == StagingTextureType::Mutable);
+  ASSERT(src_rect.GetWidth() == dst_rect.GetWidth() &&
+         src_rect.GetHeight() == dst_rect.GetHeight());
+  ASSERT(src_rect.left >= 0 && static_cast<u32>(src_rect.right) <= src->GetWidth() &&
+         src_rect.top >= 0 && static_cast<u32>(src_rect.bottom) <= src->GetHeight());
+  ASSERT(dst_rect.left >= 0 && static_cast<u32>(dst_rect.right) <= m_config.width &&
+         dst_rect.top >= 0 && static_cast<u32>(dst_rect.bottom) <= m_config.height);
+
+  const D3D12_RESOURCE_STATES old_state = src_tex->GetState();
+  src_tex->TransitionToState(D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+  // Can't copy to buffers at non-zero y offsets; the offset is baked into the footprint instead.
+  D3D12_TEXTURE_COPY_LOCATION dst_location;
+  dst_location.pResource = m_resource.Get();
+  dst_location.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+  dst_location.PlacedFootprint.Offset =
+      static_cast<u64>(dst_rect.top) * m_map_stride +
+      static_cast<u64>(dst_rect.left) * AbstractTexture::GetTexelSizeForFormat(m_config.format);
+  dst_location.PlacedFootprint.Footprint.Format =
+      D3DCommon::GetDXGIFormatForAbstractFormat(m_config.format, false);
+  dst_location.PlacedFootprint.Footprint.Width = m_config.width;
+  dst_location.PlacedFootprint.Footprint.Height = m_config.height;
+  dst_location.PlacedFootprint.Footprint.Depth = 1;
+  dst_location.PlacedFootprint.Footprint.RowPitch = static_cast<u32>(m_map_stride);
+
+  D3D12_TEXTURE_COPY_LOCATION src_location;
+  src_location.pResource = src_tex->GetResource();
+  src_location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  src_location.SubresourceIndex = src_tex->CalcSubresource(src_level, src_layer);
+
+  const D3D12_BOX src_box = {static_cast<UINT>(src_rect.left), static_cast<UINT>(src_rect.top), 0,
+                             static_cast<UINT>(src_rect.right), static_cast<UINT>(src_rect.bottom),
+                             1};
+  g_dx_context->GetCommandList()->CopyTextureRegion(&dst_location, 0, 0, 0, &src_location,
+                                                    &src_box);
+
+  src_tex->TransitionToState(old_state);
+
+  // Data is ready once the current command list completes.
+  m_needs_flush = true;
+  m_completed_fence = g_dx_context->GetCurrentFenceValue();
+}
+
+void DXStagingTexture::CopyToTexture(const MathUtil::Rectangle<int>& src_rect,
+                                     AbstractTexture* dst,
+                                     const MathUtil::Rectangle<int>& dst_rect, u32 dst_layer,
+                                     u32 dst_level)
+{
+  DXTexture* dst_tex = static_cast<DXTexture*>(dst);
+  ASSERT(m_type == StagingTextureType::Upload || m_type == StagingTextureType::Mutable);
+  ASSERT(src_rect.GetWidth() == dst_rect.GetWidth() &&
+         src_rect.GetHeight() == dst_rect.GetHeight());
+
+  const D3D12_RESOURCE_STATES old_state = dst_tex->GetState();
+  dst_tex->TransitionToState(D3D12_RESOURCE_STATE_COPY_DEST);
+
+  D3D12_TEXTURE_COPY_LOCATION src_location;
+  src_location.pResource = m_resource.Get();
+  src_location.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+  src_location.PlacedFootprint.Offset =
+      static_cast<u64>(src_rect.top) * m_map_stride +
+      static_cast<u64>(src_rect.left) * AbstractTexture::GetTexelSizeForFormat(m_config.format);
+  src_location.PlacedFootprint.Footprint.Format =
+      D3DCommon::GetDXGIFormatForAbstractFormat(m_config.format, false);
+  src_location.PlacedFootprint.Footprint.Width = m_config.width;
+  src_location.PlacedFootprint.Footprint.Height = m_config.height;
+  src_location.PlacedFootprint.Footprint.Depth = 1;
+  src_location.PlacedFootprint.Footprint.RowPitch = static_cast<u32>(m_map_stride);
+
+  D3D12_TEXTURE_COPY_LOCATION dst_location;
+  dst_location.pResource = dst_tex->GetResource();
+  dst_location.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+  dst_location.SubresourceIndex = dst_tex->CalcSubresource(dst_level, dst_layer);
+
+  const D3D12_BOX src_box = {static_cast<UINT>(src_rect.left), static_cast<UINT>(src_rect.top), 0,
+                             static_cast<UINT>(src_rect.right), static_cast<UINT>(src_rect.bottom),
+                             1};
+  g_dx_context->GetCommandList()->CopyTextureRegion(&dst_location, dst_rect.left, dst_rect.top, 0,
+                                                    &src_location, &src_box);
+
+  dst_tex->TransitionToState(old_state != D3D12_RESOURCE_STATE_COMMON ?
+                                 old_state :
+                                 D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+  m_needs_flush = true;
+  m_completed_fence = g_dx_context->GetCurrentFenceValue();
+}
+
+bool DXStagingTexture::Map()
+{
+  if (m_map_pointer)
+    return true;
+
+  const D3D12_RANGE read_range = {0, m_type == StagingTextureType::Upload ? 0 : m_buffer_size};
+  HRESULT hr = m_resource->Map(0, &read_range, reinterpret_cast<void**>(&m_map_pointer));
+  CHECK(SUCCEEDED(hr), "Map staging texture");
+  return SUCCEEDED(hr);
+}
+
+void DXStagingTexture::Unmap()
+{
+  if (!m_map_pointer)
+    return;
+
+  const D3D12_RANGE written_range = {0,
+                                     m_type == StagingTextureType::Readback ? 0 : m_buffer_size};
+  m_resource->Unmap(0, &written_range);
+  m_map_pointer = nullptr;
+}
+
+void DXStagingTexture::Flush()
+{
+  if (!m_needs_flush)
+    return;
+
+  // If the completed fence is the same as the current command list fence, we need to execute
+  // the current list and kick a new one, otherwise we'd be waiting forever.
+  if (m_completed_fence == g_dx_context->GetCurrentFenceValue())
+    Renderer::GetInstance()->ExecuteCommandList(false);
+
+  g_dx_context->WaitForFence(m_completed_fence);
+  m_needs_flush = false;
+}
+
+DXFramebuffer::DXFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment,
+                             AbstractTextureFormat color_format, AbstractTextureFormat depth_format,
+                             u32 width, u32 height, u32 layers, u32 samples)
+    : AbstractFramebuffer(color_attachment, depth_attachment, color_format, depth_format, width,
+                          height, layers, samples)
+{
+}
+
+DXFramebuffer::~DXFramebuffer()
+{
+  if (m_int_rtv_descriptor)
+    g_dx_context->DeferDescriptorDestruction(g_dx_context->GetRTVHeapManager(),
+                                             m_int_rtv_descriptor.index);
+  if (m_rtv_descriptor)
+    g_dx_context->DeferDescriptorDestruction(g_dx_context->GetRTVHeapManager(),
+                                             m_rtv_descriptor.index);
+  if (m_dsv_descriptor)
+    g_dx_context->DeferDescriptorDestruction(g_dx_context->GetDSVHeapManager(),
+                                             m_dsv_descriptor.index);
+}
+
+std::unique_ptr<DXFramebuffer> DXFramebuffer::Create(DXTexture* color_attachment,
+                                                     DXTexture* depth_attachment)
+{
+  if (!ValidateConfig(color_attachment, depth_attachment))
+    return nullptr;
+
+  const AbstractTextureFormat color_format =
+      color_attachment ? color_attachment->GetFormat() : AbstractTextureFormat::Undefined;
+  const AbstractTextureFormat depth_format =
+      depth_attachment ? depth_attachment->GetFormat() : AbstractTextureFormat::Undefined;
+  const DXTexture* either_attachment = color_attachment ? color_attachment : depth_attachment;
+  const u32 width = either_attachment->GetWidth();
+  const u32 height = either_attachment->GetHeight();
+  const u32 layers = either_attachment->GetLayers();
+  const u32 samples = either_attachment->GetSamples();
+
+  std::unique_ptr<DXFramebuffer> fb(new DXFramebuffer(color_attachment, depth_attachment,
+                                                      color_format, depth_format, width, height,
+                                                      layers, samples));
+  if ((color_attachment && !fb->CreateRTVDescriptor()) ||
+      (depth_attachment && !fb->CreateDSVDescriptor()))
+  {
+    return nullptr;
+  }
+
+  return fb;
+}
+
+bool DXFramebuffer::CreateRTVDescriptor()
+{
+  if (!g_dx_context->GetRTVHeapManager().Allocate(&m_rtv_descriptor))
+  {
+    PanicAlert("Failed to allocate RTV descriptor");
+    return false;
+  }
+
+  const bool multisampled = m_samples > 1;
+  D3D12_RENDER_TARGET_VIEW_DESC rtv_desc = {};
+  rtv_desc.Format = D3DCommon::GetRTVFormatForAbstractFormat(m_color_format, false);
+  if (multisampled)
+  {
+    rtv_desc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY;
+    rtv_desc.Texture2DMSArray.ArraySize = m_layers;
+  }
+  else
+  {
+    rtv_desc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2DARRAY;
+    rtv_desc.Texture2DArray.ArraySize = m_layers;
+  }
+
+  g_dx_context->GetDevice()->CreateRenderTargetView(
+      static_cast<DXTexture*>(m_color_attachment)->GetResource(), &rtv_desc,
+      m_rtv_descriptor.cpu_handle);
+
+  // We only need the integer variant for alpha-test/logic-op, which don't make sense with MSAA.
+  const DXGI_FORMAT integer_format =
+      D3DCommon::GetRTVFormatForAbstractFormat(m_color_format, true);
+  if (integer_format != rtv_desc.Format)
+  {
+    if (!g_dx_context->GetRTVHeapManager().Allocate(&m_int_rtv_descriptor))
+      return false;
+
+    rtv_desc.Format = integer_format;
+    g_dx_context->GetDevice()->CreateRenderTargetView(
+        static_cast<DXTexture*>(m_color_attachment)->GetResource(), &rtv_desc,
+        m_int_rtv_descriptor.cpu_handle);
+  }
+
+  return true;
+}
+
+bool DXFramebuffer::CreateDSVDescriptor()
+{
+  if (!g_dx_context->GetDSVHeapManager().Allocate(&m_dsv_descriptor))
+  {
+    PanicAlert("Failed to allocate DSV descriptor");
+    return false;
+  }
+
+  const bool multisampled = m_samples > 1;
+  D3D12_DEPTH_STENCIL_VIEW_DESC dsv_desc = {
+      D3DCommon::GetDSVFormatForAbstractFormat(m_depth_format),
+      multisampled ? D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY : D3D12_DSV_DIMENSION_TEXTURE2DARRAY,
+      D3D12_DSV_FLAG_NONE};
+  if (multisampled)
+    dsv_desc.Texture2DMSArray.ArraySize = m_layers;
+  else
+    dsv_desc.Texture2DArray.ArraySize = m_layers;
+
+  g_dx_context->GetDevice()->CreateDepthStencilView(
+      static_cast<DXTexture*>(m_depth_attachment)->GetResource(), &dsv_desc,
+      m_dsv_descriptor.cpu_handle);
+  return true;
+}
+
+}  // namespace DX12
@@ -0,0 +1,214 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/DescriptorHeapManager.h"
+
+#include "Common/Assert.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DX12
+{
+DescriptorHeapManager::DescriptorHeapManager() = default;
+DescriptorHeapManager::~DescriptorHeapManager() = default;
+
+bool DescriptorHeapManager::Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
+                                   u32 num_descriptors)
+{
+  D3D12_DESCRIPTOR_HEAP_DESC desc = {type, num_descriptors, D3D12_DESCRIPTOR_HEAP_FLAG_NONE};
+  HRESULT hr = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&m_descriptor_heap));
+  CHECK(SUCCEEDED(hr), "Create descriptor heap");
+  if (FAILED(hr))
+    return false;
+
+  // These heaps are CPU-visible only (RTVs, DSVs, staging SRVs), so there is
+  // no GPU handle to query.
+  m_heap_base_cpu = m_descriptor_heap->GetCPUDescriptorHandleForHeapStart();
+  m_num_descriptors = num_descriptors;
+  m_descriptor_increment_size = device->GetDescriptorHandleIncrementSize(type);
+
+  // Set all slots to unallocated (1)
+  const u32 bitset_count = num_descriptors / BITSET_SIZE + (((num_descriptors % BITSET_SIZE) != 0) ? 1 : 0);
+  m_free_slots.resize(bitset_count);
+  for (BitSet64& bs : m_free_slots)
+    bs.m_val = ~u64(0);
+
+  return true;
+}
+
+bool DescriptorHeapManager::Allocate(DescriptorHandle* handle)
+{
+  for (u32 group = 0; group < m_free_slots.size(); group++)
+  {
+    BitSet64& bs = m_free_slots[group];
+    if (bs.m_val == 0)
+      continue;
+
+    const u32 bit = *bs.begin();
+    bs.m_val &= ~(u64(1) << bit);
+
+    const u32 index = group * BITSET_SIZE + bit;
+    handle->index = index;
+    handle->cpu_handle.ptr = m_heap_base_cpu.ptr + index * m_descriptor_increment_size;
+    handle->gpu_handle.ptr = 0;
+    return true;
+  }
+
+  PanicAlert("Out of fixed descriptors");
+  return false;
+}
+
+void DescriptorHeapManager::Free(u32 index)
+{
+  ASSERT(index < m_num_descriptors);
+
+  const u32 group = index / BITSET_SIZE;
+  const u32 bit = index % BITSET_SIZE;
+  m_free_slots[group].m_val |= u64(1) << bit;
+}
+
+void DescriptorHeapManager::Free(const DescriptorHandle& handle)
+{
+  Free(handle.index);
+}
+
+DescriptorAllocator::DescriptorAllocator() = default;
+DescriptorAllocator::~DescriptorAllocator() = default;
+
+bool DescriptorAllocator::Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type,
+                                 u32 num_descriptors)
+{
+  const D3D12_DESCRIPTOR_HEAP_DESC desc = {type, static_cast<UINT>(num_descriptors),
+                                           D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE};
+  HRESULT hr = device->CreateDescriptorHeap(&desc, IID_PPV_ARGS(&m_descriptor_heap));
+  CHECK(SUCCEEDED(hr), "Creating descriptor heap for linear allocator failed");
+  if (FAILED(hr))
+    return false;
+
+  m_heap_base_cpu = m_descriptor_heap->GetCPUDescriptorHandleForHeapStart();
+  m_heap_base_gpu = m_descriptor_heap->GetGPUDescriptorHandleForHeapStart();
+  m_num_descriptors = num_descriptors;
+  m_descriptor_increment_size = device->GetDescriptorHandleIncrementSize(type);
+  return true;
+}
+
+bool DescriptorAllocator::Allocate(u32 num_handles, DescriptorHandle* out_base_handle)
+{
+  if ((m_current_offset + num_handles) > m_num_descriptors)
+    return false;
+
+  out_base_handle->index = m_current_offset;
+  out_base_handle->cpu_handle.ptr =
+      m_heap_base_cpu.ptr + m_current_offset * m_descriptor_increment_size;
+  out_base_handle->gpu_handle.ptr =
+      m_heap_base_gpu.ptr + m_current_offset * m_descriptor_increment_size;
+  m_current_offset += num_handles;
+  return true;
+}
+
+void DescriptorAllocator::Reset()
+{
+  m_current_offset = 0;
+}
+
+bool SamplerAllocator::Create(ID3D12Device* device, u32 num_descriptors)
+{
+  if (!DescriptorAllocator::Create(device, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, num_descriptors))
+    return false;
+
+  m_device = device;
+  return true;
+}
+
+static void GetD3DSamplerDesc(D3D12_SAMPLER_DESC* desc, const SamplerState& state)
+{
+  if (state.mipmap_filter == SamplerState::Filter::Linear)
+  {
+    if (state.min_filter == SamplerState::Filter::Linear)
+      desc->Filter = (state.mag_filter == SamplerState::Filter::Linear) ?
+                         D3D12_FILTER_MIN_MAG_MIP_LINEAR :
+                         D3D12_FILTER_MIN_LINEAR_MAG_POINT_MIP_LINEAR;
+    else
+      desc->Filter = (state.mag_filter == SamplerState::Filter::Linear) ?
+                         D3D12_FILTER_MIN_POINT_MAG_MIP_LINEAR :
+                         D3D12_FILTER_MIN_MAG_POINT_MIP_LINEAR;
+  }
+  else
+  {
+    if (state.min_filter == SamplerState::Filter::Linear)
+      desc->Filter = (state.mag_filter == SamplerState::Filter::Linear) ?
+                         D3D12_FILTER_MIN_MAG_LINEAR_MIP_POINT :
+                         D3D12_FILTER_MIN_LINEAR_MAG_MIP_POINT;
+    else
+      desc->Filter = (state.mag_filter == SamplerState::Filter::Linear) ?
+                         D3D12_FILTER_MIN_POINT_MAG_LINEAR_MIP_POINT :
+                         D3D12_FILTER_MIN_MAG_MIP_POINT;
+  }
+
+  static constexpr std::array<D3D12_TEXTURE_ADDRESS_MODE, 3> address_modes = {
+      {D3D12_TEXTURE_ADDRESS_MODE_CLAMP, D3D12_TEXTURE_ADDRESS_MODE_WRAP,
+       D3D12_TEXTURE_ADDRESS_MODE_MIRROR}};
+  desc->AddressU = address_modes[static_cast<u32>(state.wrap_u.Value())];
+  desc->AddressV = address_modes[static_cast<u32>(state.wrap_v.Value())];
+  desc->AddressW = D3D12_TEXTURE_ADDRESS_MODE_CLAMP;
+  desc->MaxLOD = state.max_lod / 16.f;
+  desc->MinLOD = state.min_lod / 16.f;
+  desc->MipLODBias = static_cast<s32>(state.lod_bias) / 256.f;
+  desc->ComparisonFunc = D3D12_COMPARISON_FUNC_ALWAYS;
+  desc->MaxAnisotropy = 1;
+
+  if (state.anisotropic_filtering)
+  {
+    desc->Filter = D3D12_FILTER_ANISOTROPIC;
+    desc->MaxAnisotropy = 1u << g_ActiveConfig.iMaxAnisotropy;
+  }
+}
+
+bool SamplerAllocator::GetGroupHandle(const std::array<SamplerState, 8>& states, u32 num_states,
+                                      D3D12_GPU_DESCRIPTOR_HANDLE* out_handle)
+{
+  std::array<u64, 8> key{};
+  for (u32 i = 0; i < num_states; i++)
+    key[i] = states[i].hex;
+
+  auto it = m_sampler_map.find(key);
+  if (it != m_sampler_map.end())
+  {
+    *out_handle = it->second;
+    return true;
+  }
+
+  // Allocate a group of descriptors.
+  DescriptorHandle allocation;
+  if (!Allocate(num_states, &allocation))
+    return false;
+
+  // Lookup sampler descriptors for each state.
+  for (u32 i = 0; i < num_states; i++)
+  {
+    D3D12_SAMPLER_DESC desc = {};
+    GetD3DSamplerDesc(&desc, states[i]);
+
+    const D3D12_CPU_DESCRIPTOR_HANDLE dst_handle = {
+        allocation.cpu_handle.ptr + i * m_descriptor_increment_size};
+    m_device->CreateSampler(&desc, dst_handle);
+  }
+
+  m_sampler_map.emplace(key, allocation.gpu_handle);
+  *out_handle = allocation.gpu_handle;
+  return true;
+}
+
+bool SamplerAllocator::ShouldReset() const
+{
+  // We only reset the sampler heap if more than half of the descriptors are used.
+  // This saves the expense of switching descriptor heaps every frame.
+  return m_current_offset >= (m_num_descriptors / 2);
+}
+
+void SamplerAllocator::Reset()
+{
+  DescriptorAllocator::Reset();
+  m_sampler_map.clear();
+}
+}  // namespace DX12
@@ -0,0 +1,99 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <vector>
+
+#include "Common/BitSet.h"
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoCommon/RenderState.h"
+
+namespace DX12
+{
+// A descriptor handle combines the CPU and GPU views of the same slot in a
+// descriptor heap, and the slot index for freeing it again.
+struct DescriptorHandle final
+{
+  D3D12_CPU_DESCRIPTOR_HANDLE cpu_handle{};
+  D3D12_GPU_DESCRIPTOR_HANDLE gpu_handle{};
+  u32 index = 0;
+
+  operator bool() const { return cpu_handle.ptr != 0; }
+};
+
+// Manages a small descriptor heap with persistent allocations (e.g. RTVs,
+// DSVs, and the CPU-side SRVs which get copied into the shader-visible ring
+// at bind time). Allocations are tracked in a free bitmap.
+class DescriptorHeapManager final
+{
+public:
+  DescriptorHeapManager();
+  ~DescriptorHeapManager();
+
+  ID3D12DescriptorHeap* GetDescriptorHeap() const { return m_descriptor_heap.Get(); }
+
+  bool Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, u32 num_descriptors);
+
+  bool Allocate(DescriptorHandle* handle);
+  void Free(const DescriptorHandle& handle);
+  void Free(u32 index);
+
+private:
+  ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
+  u32 m_num_descriptors = 0;
+  u32 m_descriptor_increment_size = 0;
+
+  D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu{};
+
+  static constexpr u32 BITSET_SIZE = 64;
+  std::vector<BitSet64> m_free_slots;
+};
+
+// Linear allocator into a shader-visible heap; reset once the command list
+// using the descriptors has been submitted.
+class DescriptorAllocator final
+{
+public:
+  DescriptorAllocator();
+  ~DescriptorAllocator();
+
+  ID3D12DescriptorHeap* GetDescriptorHeap() const { return m_descriptor_heap.Get(); }
+  u32 GetDescriptorIncrementSize() const { return m_descriptor_increment_size; }
+
+  bool Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, u32 num_descriptors);
+
+  bool Allocate(u32 num_handles, DescriptorHandle* out_base_handle);
+  virtual void Reset();
+
+protected:
+  ComPtr<ID3D12DescriptorHeap> m_descriptor_heap;
+  u32 m_descriptor_increment_size = 0;
+  u32 m_num_descriptors = 0;
+  u32 m_current_offset = 0;
+
+  D3D12_CPU_DESCRIPTOR_HANDLE m_heap_base_cpu{};
+  D3D12_GPU_DESCRIPTOR_HANDLE m_heap_base_gpu{};
+};
+
+// Sampler heaps are small (D3D12 limits them to 2048 descriptors), so
+// allocated samplers are looked up by SamplerState and only created once.
+// When the heap fills up, it is reset and the lookup map cleared, which
+// forces a GPU sync first - in practice games use a handful of samplers.
+class SamplerAllocator final : public DescriptorAllocator
+{
+public:
+  bool Create(ID3D12Device* device, u32 num_descriptors);
+  bool GetGroupHandle(const std::array<SamplerState, 8>& states, u32 num_states,
+                      D3D12_GPU_DESCRIPTOR_HANDLE* out_handle);
+  bool ShouldReset() const;
+  void Reset() override;
+
+private:
+  std::map<std::array<u64, 8>, D3D12_GPU_DESCRIPTOR_HANDLE> m_sampler_map;
+  ID3D12Device* m_device = nullptr;
+};
+}  // namespace DX12
@@ -0,0 +1,203 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/PerfQuery.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/CommonFuncs.h"
+#include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
+
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/Renderer.h"
+#include "VideoCommon/RenderBase.h"
+
+namespace DX12
+{
+PerfQuery::PerfQuery() = default;
+
+PerfQuery::~PerfQuery() = default;
+
+bool PerfQuery::Initialize()
+{
+  const D3D12_QUERY_HEAP_DESC desc = {D3D12_QUERY_HEAP_TYPE_OCCLUSION, PERF_QUERY_BUFFER_SIZE};
+  HRESULT hr = g_dx_context->GetDevice()->CreateQueryHeap(&desc, IID_PPV_ARGS(&m_query_heap));
+  CHECK(SUCCEEDED(hr), "Create query heap");
+  if (FAILED(hr))
+    return false;
+
+  static const D3D12_HEAP_PROPERTIES heap_properties = {D3D12_HEAP_TYPE_READBACK};
+  const D3D12_RESOURCE_DESC resource_desc = {D3D12_RESOURCE_DIMENSION_BUFFER,
+                                             0,
+                                             PERF_QUERY_BUFFER_SIZE * sizeof(u64),
+                                             1,
+                                             1,
+                                             1,
+                                             DXGI_FORMAT_UNKNOWN,
+                                             {1, 0},
+                                             D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+                                             D3D12_RESOURCE_FLAG_NONE};
+  hr = g_dx_context->GetDevice()->CreateCommittedResource(
+      &heap_properties, D3D12_HEAP_FLAG_NONE, &resource_desc, D3D12_RESOURCE_STATE_COPY_DEST,
+      nullptr, IID_PPV_ARGS(&m_query_readback_buffer));
+  CHECK(SUCCEEDED(hr), "Create query readback buffer");
+  if (FAILED(hr))
+    return false;
+
+  ResetQuery();
+  return true;
+}
+
+void PerfQuery::EnableQuery(PerfQueryGroup type)
+{
+  // Is this sane?
+  if (m_query_count > m_query_buffer.size() / 2)
+    WeakFlush();
+
+  if (m_query_buffer.size() == m_query_count)
+  {
+    FlushOne();
+    ERROR_LOG(VIDEO, "Flushed query buffer early!");
+  }
+
+  // start query
+  if (type == PQG_ZCOMP_ZCOMPLOC || type == PQG_ZCOMP)
+  {
+    const u32 index = (m_query_read_pos + m_query_count) % PERF_QUERY_BUFFER_SIZE;
+    auto& entry = m_query_buffer[index];
+
+    g_dx_context->GetCommandList()->BeginQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_OCCLUSION,
+                                               index);
+    entry.query_type = type;
+    entry.has_value = false;
+
+    ++m_query_count;
+  }
+}
+
+void PerfQuery::DisableQuery(PerfQueryGroup type)
+{
+  // stop query
+  if (type == PQG_ZCOMP_ZCOMPLOC || type == PQG_ZCOMP)
+  {
+    const u32 index =
+        (m_query_read_pos + m_query_count + PERF_QUERY_BUFFER_SIZE - 1) % PERF_QUERY_BUFFER_SIZE;
+    auto& entry = m_query_buffer[index];
+
+    // Resolve the result straight into this query's slot of the readback
+    // buffer; it's valid once the current command list's fence is reached.
+    ID3D12GraphicsCommandList* list = g_dx_context->GetCommandList();
+    list->EndQuery(m_query_heap.Get(), D3D12_QUERY_TYPE_OCCLUSION, index);
+    list->ResolveQueryData(m_query_heap.Get(), D3D12_QUERY_TYPE_OCCLUSION, index, 1,
+                           m_query_readback_buffer.Get(), index * sizeof(u64));
+    entry.fence_value = g_dx_context->GetCurrentFenceValue();
+    entry.has_value = true;
+  }
+}
+
+void PerfQuery::ResetQuery()
+{
+  m_query_count = 0;
+  m_query_read_pos = 0;
+  std::fill_n(m_results, ArraySize(m_results), 0);
+  for (auto& entry : m_query_buffer)
+    entry.has_value = false;
+}
+
+u32 PerfQuery::GetQueryResult(PerfQueryType type)
+{
+  u32 result = 0;
+
+  if (type == PQ_ZCOMP_INPUT_ZCOMPLOC || type == PQ_ZCOMP_OUTPUT_ZCOMPLOC)
+    result = m_results[PQG_ZCOMP_ZCOMPLOC];
+  else if (type == PQ_ZCOMP_INPUT || type == PQ_ZCOMP_OUTPUT)
+    result = m_results[PQG_ZCOMP];
+  else if (type == PQ_BLEND_INPUT)
+    result = m_results[PQG_ZCOMP] + m_results[PQG_ZCOMP_ZCOMPLOC];
+  else if (type == PQ_EFB_COPY_CLOCKS)
+    result = m_results[PQG_EFB_COPY_CLOCKS];
+
+  return result;
+}
+
+void PerfQuery::AccumulateQueriesFromBuffer(u32 query_count)
+{
+  // The range of completed queries can wrap around the end of the buffer, so
+  // just map the whole thing; mapping a readback heap is cheap.
+  const D3D12_RANGE read_range = {0, PERF_QUERY_BUFFER_SIZE * sizeof(u64)};
+  u8* mapped_ptr;
+  HRESULT hr = m_query_readback_buffer->Map(0, &read_range,
+                                            reinterpret_cast<void**>(&mapped_ptr));
+  CHECK(SUCCEEDED(hr), "Map query readback buffer");
+  if (FAILED(hr))
+    return;
+
+  for (u32 i = 0; i < query_count; i++)
+  {
+    auto& entry = m_query_buffer[m_query_read_pos];
+
+    u64 result;
+    std::memcpy(&result, mapped_ptr + m_query_read_pos * sizeof(u64), sizeof(result));
+
+    // NOTE: Reported pixel metrics should be referenced to native resolution
+    m_results[entry.query_type] +=
+        static_cast<u32>(result * EFB_WIDTH / g_renderer->GetTargetWidth() * EFB_HEIGHT /
+                         g_renderer->GetTargetHeight());
+
+    entry.has_value = false;
+    m_query_read_pos = (m_query_read_pos + 1) % PERF_QUERY_BUFFER_SIZE;
+    --m_query_count;
+  }
+
+  static const D3D12_RANGE write_range = {};
+  m_query_readback_buffer->Unmap(0, &write_range);
+}
+
+void PerfQuery::FlushOne()
+{
+  auto& entry = m_query_buffer[m_query_read_pos];
+  if (!entry.has_value)
+    return;
+
+  // The query result lands in the readback buffer when the command list that
+  // contained the resolve completes; submit it if it hasn't been yet.
+  if (entry.fence_value == g_dx_context->GetCurrentFenceValue())
+    Renderer::GetInstance()->ExecuteCommandList(false);
+
+  g_dx_context->WaitForFence(entry.fence_value);
+  AccumulateQueriesFromBuffer(1);
+}
+
+void PerfQuery::FlushResults()
+{
+  while (!IsFlushed())
+    FlushOne();
+}
+
+void PerfQuery::WeakFlush()
+{
+  u32 completed_queries = 0;
+  u32 index = m_query_read_pos;
+  for (u32 i = 0; i < m_query_count; i++)
+  {
+    const auto& entry = m_query_buffer[index];
+    if (!entry.has_value || entry.fence_value > g_dx_context->GetCompletedFenceValue())
+      break;
+
+    completed_queries++;
+    index = (index + 1) % PERF_QUERY_BUFFER_SIZE;
+  }
+
+  if (completed_queries > 0)
+    AccumulateQueriesFromBuffer(completed_queries);
+}
+
+bool PerfQuery::IsFlushed() const
+{
+  return m_query_count == 0;
+}
+
+}  // namespace DX12
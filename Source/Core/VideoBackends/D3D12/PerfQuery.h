@@ -0,0 +1,60 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoCommon/PerfQueryBase.h"
+
+namespace DX12
+{
+class PerfQuery final : public PerfQueryBase
+{
+public:
+  PerfQuery();
+  ~PerfQuery() override;
+
+  static PerfQuery* GetInstance() { return static_cast<PerfQuery*>(g_perf_query.get()); }
+
+  bool Initialize();
+
+  void EnableQuery(PerfQueryGroup type) override;
+  void DisableQuery(PerfQueryGroup type) override;
+  void ResetQuery() override;
+  u32 GetQueryResult(PerfQueryType type) override;
+  void FlushResults() override;
+  bool IsFlushed() const override;
+
+private:
+  struct ActiveQuery
+  {
+    u64 fence_value;
+    PerfQueryGroup query_type;
+    bool has_value;
+  };
+
+  void AccumulateQueriesFromBuffer(u32 query_count);
+
+  // Partial flush of completed queries; avoids a wait.
+  void WeakFlush();
+
+  // Only use when non-empty.
+  void FlushOne();
+
+  // when testing in SMS: 64 was too small, 128 was ok
+  static const int PERF_QUERY_BUFFER_SIZE = 512;
+
+  ComPtr<ID3D12QueryHeap> m_query_heap;
+
+  // Each query's result is resolved into its slot of this readback buffer as
+  // soon as it is disabled, so reading back is just a map.
+  ComPtr<ID3D12Resource> m_query_readback_buffer;
+
+  std::array<ActiveQuery, PERF_QUERY_BUFFER_SIZE> m_query_buffer = {};
+  int m_query_read_pos = 0;
+};
+
+}  // namespace DX12
@@ -0,0 +1,584 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/Renderer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/MsgHandler.h"
+
+#include "VideoBackends/D3D12/BoundingBox.h"
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/DXPipeline.h"
+#include "VideoBackends/D3D12/DXShader.h"
+#include "VideoBackends/D3D12/DXTexture.h"
+#include "VideoBackends/D3D12/SwapChain.h"
+
+#include "VideoCommon/VideoConfig.h"
+
+namespace DX12
+{
+Renderer::Renderer(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale)
+    : ::Renderer(swap_chain ? swap_chain->GetWidth() : 0, swap_chain ? swap_chain->GetHeight() : 0,
+                 backbuffer_scale,
+                 swap_chain ? swap_chain->GetFormat() : AbstractTextureFormat::Undefined),
+      m_swap_chain(std::move(swap_chain))
+{
+}
+
+Renderer::~Renderer()
+{
+  if (m_null_srv_descriptor)
+    g_dx_context->GetDescriptorHeapManager().Free(m_null_srv_descriptor);
+}
+
+bool Renderer::IsHeadless() const
+{
+  return !m_swap_chain;
+}
+
+bool Renderer::Initialize()
+{
+  if (!::Renderer::Initialize())
+    return false;
+
+  // Create a null SRV to fill unbound texture slots with.
+  if (!g_dx_context->GetDescriptorHeapManager().Allocate(&m_null_srv_descriptor))
+    return false;
+
+  D3D12_SHADER_RESOURCE_VIEW_DESC null_srv_desc = {};
+  null_srv_desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+  null_srv_desc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+  null_srv_desc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+  null_srv_desc.Texture2DArray.MipLevels = 1;
+  null_srv_desc.Texture2DArray.ArraySize = 1;
+  g_dx_context->GetDevice()->CreateShaderResourceView(nullptr, &null_srv_desc,
+                                                      m_null_srv_descriptor.cpu_handle);
+  for (auto& handle : m_state.textures)
+    handle = m_null_srv_descriptor.cpu_handle;
+
+  return true;
+}
+
+std::unique_ptr<AbstractTexture> Renderer::CreateTexture(const TextureConfig& config)
+{
+  return DXTexture::Create(config);
+}
+
+std::unique_ptr<AbstractStagingTexture> Renderer::CreateStagingTexture(StagingTextureType type,
+                                                                       const TextureConfig& config)
+{
+  return DXStagingTexture::Create(type, config);
+}
+
+std::unique_ptr<AbstractFramebuffer> Renderer::CreateFramebuffer(AbstractTexture* color_attachment,
+                                                                 AbstractTexture* depth_attachment)
+{
+  return DXFramebuffer::Create(static_cast<DXTexture*>(color_attachment),
+                               static_cast<DXTexture*>(depth_attachment));
+}
+
+std::unique_ptr<AbstractShader> Renderer::CreateShaderFromSource(ShaderStage stage,
+                                                                 const char* source, size_t length)
+{
+  return DXShader::CreateFromSource(stage, source, length);
+}
+
+std::unique_ptr<AbstractShader> Renderer::CreateShaderFromBinary(ShaderStage stage,
+                                                                 const void* data, size_t length)
+{
+  return DXShader::CreateFromBytecode(stage, DXShader::CreateByteCode(data, length));
+}
+
+std::unique_ptr<AbstractPipeline> Renderer::CreatePipeline(const AbstractPipelineConfig& config)
+{
+  return DXPipeline::Create(config);
+}
+
+u16 Renderer::BBoxRead(int index)
+{
+  return static_cast<u16>(BBox::Get(index));
+}
+
+void Renderer::BBoxWrite(int index, u16 value)
+{
+  BBox::Set(index, value);
+}
+
+void Renderer::Flush()
+{
+  ExecuteCommandList(false);
+}
+
+void Renderer::WaitForGPUIdle()
+{
+  ExecuteCommandList(true);
+}
+
+void Renderer::BindBackbuffer(const ClearColor& clear_color)
+{
+  CheckForSwapChainChanges();
+  SetAndClearFramebuffer(m_swap_chain->GetCurrentFramebuffer(), clear_color);
+}
+
+void Renderer::PresentBackbuffer()
+{
+  m_swap_chain->GetCurrentTexture()->TransitionToState(D3D12_RESOURCE_STATE_PRESENT);
+  m_current_framebuffer = nullptr;
+
+  // The Present() call is queued behind the command list on the same queue,
+  // so submitting before presenting gives the correct ordering.
+  ExecuteCommandList(false);
+  m_swap_chain->Present();
+}
+
+void Renderer::OnConfigChanged(u32 bits)
+{
+  // Quad-buffer changes require swap chain recreation.
+  if (bits & CONFIG_CHANGE_BIT_STEREO_MODE && m_swap_chain)
+  {
+    ExecuteCommandList(true);
+    m_swap_chain->SetStereo(SwapChain::WantsStereo());
+  }
+}
+
+void Renderer::CheckForSwapChainChanges()
+{
+  const bool surface_changed = m_surface_changed.TestAndClear();
+  const bool surface_resized =
+      m_surface_resized.TestAndClear() || m_swap_chain->CheckForFullscreenChange();
+  if (!surface_changed && !surface_resized)
+    return;
+
+  // The swap chain buffers are still in use; finish all work before releasing them.
+  ExecuteCommandList(true);
+  if (surface_changed)
+  {
+    m_swap_chain->ChangeSurface(m_new_surface_handle);
+    m_new_surface_handle = nullptr;
+  }
+  else
+  {
+    m_swap_chain->ResizeSwapChain();
+  }
+
+  m_backbuffer_width = m_swap_chain->GetWidth();
+  m_backbuffer_height = m_swap_chain->GetHeight();
+}
+
+void Renderer::SetFullscreen(bool enable_fullscreen)
+{
+  if (m_swap_chain)
+    m_swap_chain->SetFullscreen(enable_fullscreen);
+}
+
+bool Renderer::IsFullscreen() const
+{
+  return m_swap_chain && m_swap_chain->GetFullscreen();
+}
+
+void Renderer::SetPipeline(const AbstractPipeline* pipeline)
+{
+  if (m_current_pipeline == pipeline)
+    return;
+
+  m_current_pipeline = pipeline;
+  m_state.dirty_bits |= DIRTY_FLAG_PIPELINE | DIRTY_FLAG_PRIMITIVE_TOPOLOGY;
+
+  // If the integer RTV flag changed, the framebuffer needs rebinding.
+  const DXPipeline* dx_pipeline = static_cast<const DXPipeline*>(pipeline);
+  if (dx_pipeline && dx_pipeline->UseIntegerRTV() != m_state.using_integer_rtv)
+  {
+    m_state.using_integer_rtv = dx_pipeline->UseIntegerRTV();
+    m_state.dirty_bits |= DIRTY_FLAG_FRAMEBUFFER;
+  }
+}
+
+void Renderer::SetFramebuffer(AbstractFramebuffer* framebuffer)
+{
+  if (m_current_framebuffer == framebuffer)
+    return;
+
+  m_current_framebuffer = framebuffer;
+  m_state.dirty_bits |= DIRTY_FLAG_FRAMEBUFFER;
+}
+
+void Renderer::SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer)
+{
+  SetFramebuffer(framebuffer);
+}
+
+void Renderer::SetAndClearFramebuffer(AbstractFramebuffer* framebuffer,
+                                      const ClearColor& color_value, float depth_value)
+{
+  SetFramebuffer(framebuffer);
+
+  DXFramebuffer* fb = static_cast<DXFramebuffer*>(framebuffer);
+  BindFramebuffer(fb);
+  m_state.dirty_bits &= ~DIRTY_FLAG_FRAMEBUFFER;
+
+  if (fb->HasColorBuffer())
+  {
+    g_dx_context->GetCommandList()->ClearRenderTargetView(fb->GetRTVDescriptor().cpu_handle,
+                                                          color_value.data(), 0, nullptr);
+  }
+  if (fb->HasDepthBuffer())
+  {
+    g_dx_context->GetCommandList()->ClearDepthStencilView(
+        fb->GetDSVDescriptor().cpu_handle, D3D12_CLEAR_FLAG_DEPTH, depth_value, 0, 0, nullptr);
+  }
+}
+
+void Renderer::SetScissorRect(const MathUtil::Rectangle<int>& rc)
+{
+  if (m_state.scissor.left == rc.left && m_state.scissor.top == rc.top &&
+      m_state.scissor.right == rc.right && m_state.scissor.bottom == rc.bottom)
+  {
+    return;
+  }
+
+  m_state.scissor = {rc.left, rc.top, std::max(rc.right, rc.left + 1),
+                     std::max(rc.bottom, rc.top + 1)};
+  m_state.dirty_bits |= DIRTY_FLAG_SCISSOR;
+}
+
+void Renderer::SetViewport(float x, float y, float width, float height, float near_depth,
+                           float far_depth)
+{
+  if (m_state.viewport.TopLeftX == x && m_state.viewport.TopLeftY == y &&
+      m_state.viewport.Width == width && m_state.viewport.Height == height &&
+      m_state.viewport.MinDepth == near_depth && m_state.viewport.MaxDepth == far_depth)
+  {
+    return;
+  }
+
+  m_state.viewport = {x, y, width, height, near_depth, far_depth};
+  m_state.dirty_bits |= DIRTY_FLAG_VIEWPORT;
+}
+
+void Renderer::SetTexture(u32 index, const AbstractTexture* texture)
+{
+  const DXTexture* dx_texture = static_cast<const DXTexture*>(texture);
+  const D3D12_CPU_DESCRIPTOR_HANDLE handle =
+      dx_texture ? dx_texture->GetSRVDescriptor().cpu_handle : m_null_srv_descriptor.cpu_handle;
+  if (m_state.textures[index].ptr == handle.ptr)
+    return;
+
+  if (dx_texture)
+    dx_texture->TransitionToState(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+  m_state.textures[index] = handle;
+  m_state.dirty_bits |= DIRTY_FLAG_TEXTURES;
+}
+
+void Renderer::SetTextureDescriptor(u32 index, D3D12_CPU_DESCRIPTOR_HANDLE handle)
+{
+  if (m_state.textures[index].ptr == handle.ptr)
+    return;
+
+  m_state.textures[index] = handle;
+  m_state.dirty_bits |= DIRTY_FLAG_TEXTURES;
+}
+
+void Renderer::SetSamplerState(u32 index, const SamplerState& state)
+{
+  if (m_state.samplers[index].hex == state.hex)
+    return;
+
+  m_state.samplers[index] = state;
+  m_state.dirty_bits |= DIRTY_FLAG_SAMPLERS;
+}
+
+void Renderer::SetComputeImageTexture(AbstractTexture* texture, bool read, bool write)
+{
+  const DXTexture* dx_texture = static_cast<const DXTexture*>(texture);
+  if (m_state.compute_image_texture == dx_texture)
+    return;
+
+  m_state.compute_image_texture = dx_texture;
+}
+
+void Renderer::UnbindTexture(const AbstractTexture* texture)
+{
+  const D3D12_CPU_DESCRIPTOR_HANDLE handle =
+      static_cast<const DXTexture*>(texture)->GetSRVDescriptor().cpu_handle;
+  for (u32 i = 0; i < MAX_TEXTURES; i++)
+  {
+    if (m_state.textures[i].ptr != handle.ptr)
+      continue;
+
+    m_state.textures[i] = m_null_srv_descriptor.cpu_handle;
+    m_state.dirty_bits |= DIRTY_FLAG_TEXTURES;
+  }
+}
+
+void Renderer::SetConstantBuffer(u32 index, D3D12_GPU_VIRTUAL_ADDRESS address)
+{
+  if (m_state.constant_buffers[index] == address)
+    return;
+
+  m_state.constant_buffers[index] = address;
+  m_state.dirty_bits |= DIRTY_FLAG_PS_CBV << index;
+}
+
+void Renderer::SetVertexBuffer(D3D12_GPU_VIRTUAL_ADDRESS address, u32 stride, u32 size)
+{
+  if (m_state.vertex_buffer.BufferLocation == address &&
+      m_state.vertex_buffer.StrideInBytes == stride && m_state.vertex_buffer.SizeInBytes == size)
+  {
+    return;
+  }
+
+  m_state.vertex_buffer = {address, size, stride};
+  m_state.dirty_bits |= DIRTY_FLAG_VERTEX_BUFFER;
+}
+
+void Renderer::SetIndexBuffer(D3D12_GPU_VIRTUAL_ADDRESS address, u32 size, DXGI_FORMAT format)
+{
+  if (m_state.index_buffer.BufferLocation == address && m_state.index_buffer.SizeInBytes == size &&
+      m_state.index_buffer.Format == format)
+  {
+    return;
+  }
+
+  m_state.index_buffer = {address, size, format};
+  m_state.dirty_bits |= DIRTY_FLAG_INDEX_BUFFER;
+}
+
+void Renderer::Draw(u32 base_vertex, u32 num_vertices)
+{
+  if (!ApplyState())
+    return;
+
+  g_dx_context->GetCommandList()->DrawInstanced(num_vertices, 1, base_vertex, 0);
+}
+
+void Renderer::DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex)
+{
+  if (!ApplyState())
+    return;
+
+  g_dx_context->GetCommandList()->DrawIndexedInstanced(num_indices, 1, base_index, base_vertex, 0);
+}
+
+void Renderer::DispatchComputeShader(const AbstractShader* shader, u32 groups_x, u32 groups_y,
+                                     u32 groups_z)
+{
+  // The graphics and compute root signatures differ, so the tables have to be
+  // rebuilt for the compute bind points, and the graphics ones are rebound on
+  // the next draw.
+  ID3D12GraphicsCommandList* cmdlist = g_dx_context->GetCommandList();
+  cmdlist->SetComputeRootSignature(g_dx_context->GetComputeRootSignature());
+  cmdlist->SetPipelineState(static_cast<const DXShader*>(shader)->GetComputePipeline());
+
+  DescriptorHandle srv_handle;
+  DescriptorHandle uav_handle;
+  D3D12_GPU_DESCRIPTOR_HANDLE sampler_handle;
+  if (!g_dx_context->GetDescriptorAllocator()->Allocate(MAX_TEXTURES, &srv_handle) ||
+      !g_dx_context->GetDescriptorAllocator()->Allocate(1, &uav_handle) ||
+      !g_dx_context->GetSamplerAllocator()->GetGroupHandle(m_state.samplers, MAX_TEXTURES,
+                                                           &sampler_handle))
+  {
+    // Ran out of descriptors halfway through - submit and try again on the fresh heap.
+    ExecuteCommandList(false);
+    DispatchComputeShader(shader, groups_x, groups_y, groups_z);
+    return;
+  }
+
+  ID3D12Device* device = g_dx_context->GetDevice();
+  for (u32 i = 0; i < MAX_TEXTURES; i++)
+  {
+    const D3D12_CPU_DESCRIPTOR_HANDLE dst = {srv_handle.cpu_handle.ptr +
+                                             i * g_dx_context->GetDescriptorAllocator()
+                                                     ->GetDescriptorIncrementSize()};
+    device->CopyDescriptorsSimple(1, dst, m_state.textures[i],
+                                  D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  }
+  if (m_state.compute_image_texture)
+  {
+    m_state.compute_image_texture->TransitionToState(D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    device->CopyDescriptorsSimple(1, uav_handle.cpu_handle,
+                                  m_state.compute_image_texture->GetUAVDescriptor().cpu_handle,
+                                  D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  }
+
+  cmdlist->SetComputeRootDescriptorTable(CS_ROOT_PARAMETER_SRV, srv_handle.gpu_handle);
+  cmdlist->SetComputeRootDescriptorTable(CS_ROOT_PARAMETER_SAMPLERS, sampler_handle);
+  cmdlist->SetComputeRootConstantBufferView(CS_ROOT_PARAMETER_CBV, m_state.constant_buffers[0]);
+  cmdlist->SetComputeRootDescriptorTable(CS_ROOT_PARAMETER_UAV, uav_handle.gpu_handle);
+  cmdlist->Dispatch(groups_x, groups_y, groups_z);
+
+  // Compute shaders rendezvous through UAV barriers, and the state tracker
+  // must rebind everything the dispatch disturbed.
+  m_state.dirty_bits |=
+      DIRTY_FLAG_ROOT_SIGNATURE | DIRTY_FLAG_PIPELINE | DIRTY_FLAG_TEXTURES | DIRTY_FLAG_SAMPLERS;
+}
+
+void Renderer::ExecuteCommandList(bool wait_for_completion)
+{
+  g_dx_context->ExecuteCommandList(wait_for_completion);
+  InvalidateCachedState();
+}
+
+void Renderer::InvalidateCachedState()
+{
+  // The current framebuffer/pipeline pointers stay valid across a submit, so
+  // they are kept; marking everything dirty makes the next draw rebind them.
+  m_state.dirty_bits = DIRTY_FLAG_ALL;
+}
+
+void Renderer::BindFramebuffer(DXFramebuffer* fb)
+{
+  if (fb->GetColorAttachment())
+  {
+    static_cast<DXTexture*>(fb->GetColorAttachment())
+        ->TransitionToState(D3D12_RESOURCE_STATE_RENDER_TARGET);
+  }
+  if (fb->GetDepthAttachment())
+  {
+    static_cast<DXTexture*>(fb->GetDepthAttachment())
+        ->TransitionToState(D3D12_RESOURCE_STATE_DEPTH_WRITE);
+  }
+
+  const bool use_integer_rtv = m_state.using_integer_rtv && fb->GetIntRTVDescriptor();
+  g_dx_context->GetCommandList()->OMSetRenderTargets(
+      fb->GetRTVDescriptorCount(),
+      use_integer_rtv ? fb->GetIntRTVDescriptorArray() : fb->GetRTVDescriptorArray(), FALSE,
+      fb->GetDSVDescriptorArray());
+}
+
+bool Renderer::UpdateSRVDescriptorTable()
+{
+  DescriptorHandle base_handle;
+  if (!g_dx_context->GetDescriptorAllocator()->Allocate(MAX_TEXTURES, &base_handle))
+    return false;
+
+  // The contiguous-copy variant of CopyDescriptors can't be used here, since
+  // the source descriptors aren't contiguous in the staging heap.
+  ID3D12Device* device = g_dx_context->GetDevice();
+  const u32 increment = g_dx_context->GetDescriptorAllocator()->GetDescriptorIncrementSize();
+  for (u32 i = 0; i < MAX_TEXTURES; i++)
+  {
+    const D3D12_CPU_DESCRIPTOR_HANDLE dst = {base_handle.cpu_handle.ptr + i * increment};
+    device->CopyDescriptorsSimple(1, dst, m_state.textures[i],
+                                  D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  }
+
+  m_state.srv_descriptor_base = base_handle.gpu_handle;
+  return true;
+}
+
+bool Renderer::UpdateSamplerDescriptorTable()
+{
+  return g_dx_context->GetSamplerAllocator()->GetGroupHandle(m_state.samplers, MAX_TEXTURES,
+                                                             &m_state.sampler_descriptor_base);
+}
+
+bool Renderer::UpdateUAVDescriptorTable()
+{
+  // The bounding box UAV lives in the staging heap; like the SRVs it has to be
+  // copied into the shader-visible ring for this command list.
+  DescriptorHandle handle;
+  if (!g_dx_context->GetDescriptorAllocator()->Allocate(1, &handle))
+    return false;
+
+  g_dx_context->GetDevice()->CopyDescriptorsSimple(1, handle.cpu_handle,
+                                                   BBox::GetUAVDescriptor().cpu_handle,
+                                                   D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+  m_state.uav_descriptor_base = handle.gpu_handle;
+  return true;
+}
+
+bool Renderer::ApplyState()
+{
+  const DXPipeline* pipeline = static_cast<const DXPipeline*>(m_current_pipeline);
+  if (!pipeline)
+    return false;
+
+  // Allocate descriptor groups first; if the allocator is full, submit the
+  // command list (which resets it) and let the caller's state be rebuilt.
+  u32 dirty_bits = m_state.dirty_bits;
+  if (dirty_bits & DIRTY_FLAG_TEXTURES && !UpdateSRVDescriptorTable())
+  {
+    ExecuteCommandList(false);
+    dirty_bits = m_state.dirty_bits;
+    if (!UpdateSRVDescriptorTable())
+    {
+      PanicAlert("Failed to allocate SRV descriptors after submit");
+      return false;
+    }
+  }
+  if (dirty_bits & DIRTY_FLAG_SAMPLERS && !UpdateSamplerDescriptorTable())
+  {
+    ExecuteCommandList(false);
+    dirty_bits = m_state.dirty_bits;
+    if (!UpdateSRVDescriptorTable() || !UpdateSamplerDescriptorTable())
+    {
+      PanicAlert("Failed to allocate sampler descriptors after submit");
+      return false;
+    }
+  }
+  const bool needs_uav = g_ActiveConfig.bBBoxEnable && pipeline->GetUsage() ==
+                                                           AbstractPipelineUsage::GX;
+  if (needs_uav && dirty_bits & DIRTY_FLAG_PS_UAV && !UpdateUAVDescriptorTable())
+  {
+    ExecuteCommandList(false);
+    dirty_bits = m_state.dirty_bits;
+    if (!UpdateSRVDescriptorTable() || !UpdateSamplerDescriptorTable() ||
+        !UpdateUAVDescriptorTable())
+    {
+      PanicAlert("Failed to allocate UAV descriptors after submit");
+      return false;
+    }
+  }
+
+  ID3D12GraphicsCommandList* cmdlist = g_dx_context->GetCommandList();
+  if (dirty_bits & DIRTY_FLAG_ROOT_SIGNATURE)
+    cmdlist->SetGraphicsRootSignature(pipeline->GetRootSignature());
+  if (dirty_bits & DIRTY_FLAG_PIPELINE)
+    cmdlist->SetPipelineState(pipeline->GetPipeline());
+  if (dirty_bits & DIRTY_FLAG_PRIMITIVE_TOPOLOGY)
+    cmdlist->IASetPrimitiveTopology(pipeline->GetPrimitiveTopology());
+  if (dirty_bits & DIRTY_FLAG_FRAMEBUFFER)
+    BindFramebuffer(static_cast<DXFramebuffer*>(m_current_framebuffer));
+  if (dirty_bits & DIRTY_FLAG_VERTEX_BUFFER)
+    cmdlist->IASetVertexBuffers(0, 1, &m_state.vertex_buffer);
+  if (dirty_bits & DIRTY_FLAG_INDEX_BUFFER)
+    cmdlist->IASetIndexBuffer(&m_state.index_buffer);
+  if (dirty_bits & DIRTY_FLAG_VIEWPORT)
+    cmdlist->RSSetViewports(1, &m_state.viewport);
+  if (dirty_bits & DIRTY_FLAG_SCISSOR)
+    cmdlist->RSSetScissorRects(1, &m_state.scissor);
+
+  if (dirty_bits & DIRTY_FLAG_TEXTURES)
+    cmdlist->SetGraphicsRootDescriptorTable(ROOT_PARAMETER_PS_SRV, m_state.srv_descriptor_base);
+  if (dirty_bits & DIRTY_FLAG_SAMPLERS)
+  {
+    cmdlist->SetGraphicsRootDescriptorTable(ROOT_PARAMETER_PS_SAMPLERS,
+                                            m_state.sampler_descriptor_base);
+  }
+  if (dirty_bits & DIRTY_FLAG_PS_CBV)
+  {
+    cmdlist->SetGraphicsRootConstantBufferView(ROOT_PARAMETER_PS_CBV,
+                                               m_state.constant_buffers[0]);
+  }
+  if (dirty_bits & DIRTY_FLAG_VS_CBV)
+  {
+    cmdlist->SetGraphicsRootConstantBufferView(ROOT_PARAMETER_VS_CBV,
+                                               m_state.constant_buffers[1]);
+  }
+  if (dirty_bits & DIRTY_FLAG_GS_CBV)
+  {
+    cmdlist->SetGraphicsRootConstantBufferView(ROOT_PARAMETER_GS_CBV,
+                                               m_state.constant_buffers[2]);
+  }
+  if (needs_uav && dirty_bits & DIRTY_FLAG_PS_UAV)
+    cmdlist->SetGraphicsRootDescriptorTable(ROOT_PARAMETER_PS_UAV, m_state.uav_descriptor_base);
+
+  m_state.dirty_bits = 0;
+  return true;
+}
+}  // namespace DX12
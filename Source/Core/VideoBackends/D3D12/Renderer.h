@@ -0,0 +1,150 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoBackends/D3D12/DescriptorHeapManager.h"
+#include "VideoCommon/RenderBase.h"
+
+namespace DX12
+{
+class DXFramebuffer;
+class DXPipeline;
+class DXShader;
+class DXTexture;
+class SwapChain;
+
+class Renderer final : public ::Renderer
+{
+public:
+  Renderer(std::unique_ptr<SwapChain> swap_chain, float backbuffer_scale);
+  ~Renderer() override;
+
+  static Renderer* GetInstance() { return static_cast<Renderer*>(g_renderer.get()); }
+
+  bool IsHeadless() const override;
+  bool Initialize() override;
+
+  std::unique_ptr<AbstractTexture> CreateTexture(const TextureConfig& config) override;
+  std::unique_ptr<AbstractStagingTexture>
+  CreateStagingTexture(StagingTextureType type, const TextureConfig& config) override;
+  std::unique_ptr<AbstractShader> CreateShaderFromSource(ShaderStage stage, const char* source,
+                                                         size_t length) override;
+  std::unique_ptr<AbstractShader> CreateShaderFromBinary(ShaderStage stage, const void* data,
+                                                         size_t length) override;
+  std::unique_ptr<NativeVertexFormat>
+  CreateNativeVertexFormat(const PortableVertexDeclaration& vtx_decl) override;
+  std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config) override;
+  std::unique_ptr<AbstractFramebuffer>
+  CreateFramebuffer(AbstractTexture* color_attachment, AbstractTexture* depth_attachment) override;
+
+  void SetPipeline(const AbstractPipeline* pipeline) override;
+  void SetFramebuffer(AbstractFramebuffer* framebuffer) override;
+  void SetAndDiscardFramebuffer(AbstractFramebuffer* framebuffer) override;
+  void SetAndClearFramebuffer(AbstractFramebuffer* framebuffer, const ClearColor& color_value = {},
+                              float depth_value = 0.0f) override;
+  void SetScissorRect(const MathUtil::Rectangle<int>& rc) override;
+  void SetTexture(u32 index, const AbstractTexture* texture) override;
+  void SetSamplerState(u32 index, const SamplerState& state) override;
+  void SetComputeImageTexture(AbstractTexture* texture, bool read, bool write) override;
+  void UnbindTexture(const AbstractTexture* texture) override;
+  void SetViewport(float x, float y, float width, float height, float near_depth,
+                   float far_depth) override;
+  void Draw(u32 base_vertex, u32 num_vertices) override;
+  void DrawIndexed(u32 base_index, u32 num_indices, u32 base_vertex) override;
+  void DispatchComputeShader(const AbstractShader* shader, u32 groups_x, u32 groups_y,
+                             u32 groups_z) override;
+  void BindBackbuffer(const ClearColor& clear_color = {}) override;
+  void PresentBackbuffer() override;
+  void SetFullscreen(bool enable_fullscreen) override;
+  bool IsFullscreen() const override;
+
+  u16 BBoxRead(int index) override;
+  void BBoxWrite(int index, u16 value) override;
+
+  void Flush() override;
+  void WaitForGPUIdle() override;
+
+  void OnConfigChanged(u32 bits) override;
+
+  // Binding state updates, called by the vertex manager and bounding box.
+  // Constant buffer indices are 0 = PS, 1 = VS, 2 = GS, matching the root
+  // signature layout.
+  void SetConstantBuffer(u32 index, D3D12_GPU_VIRTUAL_ADDRESS address);
+  void SetTextureDescriptor(u32 index, D3D12_CPU_DESCRIPTOR_HANDLE handle);
+  void SetVertexBuffer(D3D12_GPU_VIRTUAL_ADDRESS address, u32 stride, u32 size);
+  void SetIndexBuffer(D3D12_GPU_VIRTUAL_ADDRESS address, u32 size, DXGI_FORMAT format);
+
+  // Executes the current command list, and marks all cached binding state
+  // dirty, since the new list starts out empty.
+  void ExecuteCommandList(bool wait_for_completion);
+
+private:
+  static const u32 MAX_TEXTURES = 8;
+
+  enum DIRTY_FLAG : u32
+  {
+    DIRTY_FLAG_PS_CBV = (1 << 0),
+    DIRTY_FLAG_VS_CBV = (1 << 1),
+    DIRTY_FLAG_GS_CBV = (1 << 2),
+    DIRTY_FLAG_TEXTURES = (1 << 3),
+    DIRTY_FLAG_SAMPLERS = (1 << 4),
+    DIRTY_FLAG_VERTEX_BUFFER = (1 << 5),
+    DIRTY_FLAG_INDEX_BUFFER = (1 << 6),
+    DIRTY_FLAG_VIEWPORT = (1 << 7),
+    DIRTY_FLAG_SCISSOR = (1 << 8),
+    DIRTY_FLAG_PIPELINE = (1 << 9),
+    DIRTY_FLAG_PRIMITIVE_TOPOLOGY = (1 << 10),
+    DIRTY_FLAG_ROOT_SIGNATURE = (1 << 11),
+    DIRTY_FLAG_PS_UAV = (1 << 12),
+    DIRTY_FLAG_FRAMEBUFFER = (1 << 13),
+
+    DIRTY_FLAG_ALL = 0xFFFFFFFF,
+  };
+
+  void CheckForSwapChainChanges();
+  void InvalidateCachedState();
+
+  // Applies all dirty state to the command list; returns false if a descriptor
+  // allocation failed and the caller should submit and retry.
+  bool ApplyState();
+  void BindFramebuffer(DXFramebuffer* fb);
+  bool UpdateSRVDescriptorTable();
+  bool UpdateSamplerDescriptorTable();
+  bool UpdateUAVDescriptorTable();
+
+  std::unique_ptr<SwapChain> m_swap_chain;
+
+  // Null SRV, used in unbound texture slots (descriptor tables must be fully
+  // populated on some hardware).
+  DescriptorHandle m_null_srv_descriptor = {};
+
+  // Cached bindings for the current command list.
+  struct
+  {
+    u32 dirty_bits = DIRTY_FLAG_ALL;
+
+    std::array<D3D12_GPU_VIRTUAL_ADDRESS, 3> constant_buffers{};
+    std::array<D3D12_CPU_DESCRIPTOR_HANDLE, MAX_TEXTURES> textures{};
+    std::array<SamplerState, MAX_TEXTURES> samplers{};
+    const DXTexture* compute_image_texture = nullptr;
+
+    D3D12_VERTEX_BUFFER_VIEW vertex_buffer{};
+    D3D12_INDEX_BUFFER_VIEW index_buffer{};
+
+    D3D12_VIEWPORT viewport{};
+    D3D12_RECT scissor{};
+
+    D3D12_GPU_DESCRIPTOR_HANDLE srv_descriptor_base{};
+    D3D12_GPU_DESCRIPTOR_HANDLE sampler_descriptor_base{};
+    D3D12_GPU_DESCRIPTOR_HANDLE uav_descriptor_base{};
+
+    bool using_integer_rtv = false;
+  } m_state;
+};
+}  // namespace DX12
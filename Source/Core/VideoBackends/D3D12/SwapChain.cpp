@@ -0,0 +1,78 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include "VideoBackends/D3D12/SwapChain.h"
+
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/DXTexture.h"
+
+namespace DX12
+{
+SwapChain::SwapChain(const WindowSystemInfo& wsi, IDXGIFactory2* dxgi_factory,
+                     ID3D12CommandQueue* d3d_command_queue)
+    : D3DCommon::SwapChain(wsi, dxgi_factory, d3d_command_queue)
+{
+}
+
+SwapChain::~SwapChain() = default;
+
+std::unique_ptr<SwapChain> SwapChain::Create(const WindowSystemInfo& wsi)
+{
+  // D3D12 swap chains are created against the command queue, not the device.
+  std::unique_ptr<SwapChain> swap_chain = std::make_unique<SwapChain>(
+      wsi, g_dx_context->GetDXGIFactory(), g_dx_context->GetCommandQueue());
+  if (!swap_chain->CreateSwapChain(WantsStereo()))
+    return nullptr;
+
+  return swap_chain;
+}
+
+bool SwapChain::Present()
+{
+  if (!D3DCommon::SwapChain::Present())
+    return false;
+
+  MoveToNextBuffer();
+  return true;
+}
+
+bool SwapChain::CreateSwapChainBuffers()
+{
+  for (u32 i = 0; i < SWAP_CHAIN_BUFFER_COUNT; i++)
+  {
+    ComPtr<ID3D12Resource> resource;
+    HRESULT hr = m_swap_chain->GetBuffer(i, IID_PPV_ARGS(&resource));
+    CHECK(SUCCEEDED(hr), "Get swap chain buffer %u", i);
+    if (FAILED(hr))
+      return false;
+
+    BufferResources buffer;
+    buffer.texture = DXTexture::CreateAdopted(resource.Get());
+    if (!buffer.texture)
+      return false;
+
+    buffer.framebuffer = DXFramebuffer::Create(buffer.texture.get(), nullptr);
+    if (!buffer.framebuffer)
+      return false;
+
+    m_buffers[i] = std::move(buffer);
+  }
+
+  m_current_buffer = 0;
+  return true;
+}
+
+void SwapChain::DestroySwapChainBuffers()
+{
+  for (BufferResources& buffer : m_buffers)
+  {
+    buffer.framebuffer.reset();
+    buffer.texture.reset();
+  }
+
+  // ResizeBuffers() requires all references to the buffers to be released, and
+  // texture destruction above is deferred, so wait for the GPU and flush it.
+  g_dx_context->ExecuteCommandList(true);
+}
+}  // namespace DX12
@@ -0,0 +1,57 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "Common/CommonTypes.h"
+#include "Common/WindowSystemInfo.h"
+#include "VideoBackends/D3D12/Common.h"
+#include "VideoBackends/D3DCommon/SwapChain.h"
+
+namespace DX12
+{
+class DXTexture;
+class DXFramebuffer;
+
+class SwapChain : public D3DCommon::SwapChain
+{
+public:
+  SwapChain(const WindowSystemInfo& wsi, IDXGIFactory2* dxgi_factory,
+            ID3D12CommandQueue* d3d_command_queue);
+  ~SwapChain() override;
+
+  static std::unique_ptr<SwapChain> Create(const WindowSystemInfo& wsi);
+
+  bool Present() override;
+
+  DXTexture* GetCurrentTexture() const { return m_buffers[m_current_buffer].texture.get(); }
+  DXFramebuffer* GetCurrentFramebuffer() const
+  {
+    return m_buffers[m_current_buffer].framebuffer.get();
+  }
+
+  // Call at the end of a frame, to move to the buffer the next present targets.
+  void MoveToNextBuffer() { m_current_buffer = (m_current_buffer + 1) % SWAP_CHAIN_BUFFER_COUNT; }
+
+protected:
+  bool CreateSwapChainBuffers() override;
+  void DestroySwapChainBuffers() override;
+
+private:
+  // Unlike D3D11, the runtime does not rename buffers for us, so we wrap each
+  // buffer of the swap chain individually.
+  struct BufferResources
+  {
+    std::unique_ptr<DXTexture> texture;
+    std::unique_ptr<DXFramebuffer> framebuffer;
+  };
+
+  std::array<BufferResources, SWAP_CHAIN_BUFFER_COUNT> m_buffers;
+  u32 m_current_buffer = 0;
+};
+
+}  // namespace DX12
@@ -0,0 +1,70 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include "VideoBackends/D3D12/DescriptorHeapManager.h"
+#include "VideoBackends/D3D12/StreamBuffer.h"
+#include "VideoCommon/NativeVertexFormat.h"
+#include "VideoCommon/VertexManagerBase.h"
+
+namespace DX12
+{
+class DXVertexFormat : public NativeVertexFormat
+{
+public:
+  DXVertexFormat(const PortableVertexDeclaration& vtx_decl);
+
+  D3D12_INPUT_LAYOUT_DESC GetInputLayoutDesc() const
+  {
+    return D3D12_INPUT_LAYOUT_DESC{m_elems.data(), m_num_elems};
+  }
+
+private:
+  std::array<D3D12_INPUT_ELEMENT_DESC, 32> m_elems{};
+  UINT m_num_elems = 0;
+};
+
+class VertexManager final : public VertexManagerBase
+{
+public:
+  VertexManager();
+  ~VertexManager() override;
+
+  bool Initialize() override;
+
+  void UploadUtilityUniforms(const void* uniforms, u32 uniforms_size) override;
+  bool UploadTexelBuffer(const void* data, u32 data_size, TexelBufferFormat format,
+                         u32* out_offset) override;
+  bool UploadTexelBuffer(const void* data, u32 data_size, TexelBufferFormat format, u32* out_offset,
+                         const void* palette_data, u32 palette_size,
+                         TexelBufferFormat palette_format, u32* out_palette_offset) override;
+
+protected:
+  void ResetBuffer(u32 vertex_stride) override;
+  void CommitBuffer(u32 num_vertices, u32 vertex_stride, u32 num_indices, u32* out_base_vertex,
+                    u32* out_base_index) override;
+  void UploadUniforms() override;
+
+private:
+  void UpdateVertexShaderConstants();
+  void UpdateGeometryShaderConstants();
+  void UpdatePixelShaderConstants();
+  bool ReserveConstantStorage();
+  void UploadAllConstants();
+
+  StreamBuffer m_vertex_stream_buffer;
+  StreamBuffer m_index_stream_buffer;
+  StreamBuffer m_uniform_stream_buffer;
+  StreamBuffer m_texel_stream_buffer;
+
+  // One descriptor covering the whole texel buffer for each format; the
+  // returned offset is in elements, added by the shader.
+  std::array<DescriptorHandle, NUM_TEXEL_BUFFER_FORMATS> m_texel_buffer_views{};
+};
+
+}  // namespace DX12
@@ -0,0 +1,161 @@
+// Copyright 2019 Dolphin Emulator Project
+// Licensed under GPLv2+
+// Refer to the license.txt file included.
+
+#include <memory>
+#include <string>
+
+#include "Common/Common.h"
+#include "Common/CommonTypes.h"
+#include "Common/MsgHandler.h"
+
+#include "VideoBackends/D3D12/BoundingBox.h"
+#include "VideoBackends/D3D12/DXContext.h"
+#include "VideoBackends/D3D12/PerfQuery.h"
+#include "VideoBackends/D3D12/Renderer.h"
+#include "VideoBackends/D3D12/SwapChain.h"
+#include "VideoBackends/D3D12/VertexManager.h"
+#include "VideoBackends/D3D12/VideoBackend.h"
+
+#include "VideoCommon/FramebufferManager.h"
+#include "VideoCommon/ShaderCache.h"
+#include "VideoCommon/TextureCacheBase.h"
+#include "VideoCommon/VideoCommon.h"
+#include "VideoCommon/VideoConfig.h"
+
+namespace DX12
+{
+std::string VideoBackend::GetName() const
+{
+  return "D3D12";
+}
+
+std::string VideoBackend::GetDisplayName() const
+{
+  return _trans("Direct3D 12");
+}
+
+static std::vector<u32> GetAAModes(ID3D12Device* device)
+{
+  std::vector<u32> aa_modes;
+  for (u32 samples = 1; samples < D3D12_MAX_MULTISAMPLE_SAMPLE_COUNT; samples++)
+  {
+    D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS multisample_quality_levels = {};
+    multisample_quality_levels.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    multisample_quality_levels.SampleCount = samples;
+    device->CheckFeatureSupport(D3D12_FEATURE_MULTISAMPLE_QUALITY_LEVELS,
+                                &multisample_quality_levels, sizeof(multisample_quality_levels));
+    if (multisample_quality_levels.NumQualityLevels > 0)
+      aa_modes.push_back(samples);
+  }
+
+  return aa_modes;
+}
+
+void VideoBackend::InitBackendInfo()
+{
+  // A full device is needed to query MSAA support, since there is no
+  // equivalent of D3D11's feature-level queries.
+  if (!DXContext::Create(g_Config.iAdapter, false))
+    return;
+
+  FillBackendInfo();
+  DXContext::Destroy();
+}
+
+void VideoBackend::FillBackendInfo()
+{
+  g_Config.backend_info.api_type = APIType::D3D;
+  g_Config.backend_info.MaxTextureSize = D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+  g_Config.backend_info.bUsesLowerLeftOrigin = false;
+  g_Config.backend_info.bSupportsExclusiveFullscreen = true;
+  g_Config.backend_info.bSupportsDualSourceBlend = true;
+  g_Config.backend_info.bSupportsPrimitiveRestart = true;
+  g_Config.backend_info.bSupportsOversizedViewports = false;
+  g_Config.backend_info.bSupportsGeometryShaders = true;
+  g_Config.backend_info.bSupportsComputeShaders = true;
+  g_Config.backend_info.bSupports3DVision = false;
+  g_Config.backend_info.bSupportsPostProcessing = true;
+  g_Config.backend_info.bSupportsPaletteConversion = true;
+  g_Config.backend_info.bSupportsClipControl = true;
+  g_Config.backend_info.bSupportsDepthClamp = true;
+  g_Config.backend_info.bSupportsReversedDepthRange = false;
+  g_Config.backend_info.bSupportsLogicOp = true;
+  g_Config.backend_info.bSupportsMultithreading = false;
+  g_Config.backend_info.bSupportsGPUTextureDecoding = true;
+  g_Config.backend_info.bSupportsCopyToVram = true;
+  g_Config.backend_info.bSupportsLargePoints = false;
+  g_Config.backend_info.bSupportsPartialDepthCopies = false;
+  g_Config.backend_info.bSupportsBitfield = false;
+  g_Config.backend_info.bSupportsDynamicSamplerIndexing = false;
+  g_Config.backend_info.bSupportsFramebufferFetch = false;
+  g_Config.backend_info.bSupportsBackgroundCompiling = true;
+  g_Config.backend_info.bSupportsST3CTextures = true;
+  g_Config.backend_info.bSupportsBPTCTextures = true;
+  g_Config.backend_info.bSupportsEarlyZ = true;
+  g_Config.backend_info.bSupportsBBox = true;
+  g_Config.backend_info.bSupportsFragmentStoresAndAtomics = true;
+  g_Config.backend_info.bSupportsGSInstancing = true;
+  g_Config.backend_info.bSupportsSSAA = true;
+
+  g_Config.backend_info.Adapters = DXContext::GetAdapterNames();
+  g_Config.backend_info.AAModes = GetAAModes(g_dx_context->GetDevice());
+}
+
+bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
+{
+  if (!DXContext::Create(g_Config.iAdapter, g_Config.bEnableValidationLayer))
+    return false;
+
+  FillBackendInfo();
+  InitializeShared();
+
+  std::unique_ptr<SwapChain> swap_chain;
+  if (wsi.render_surface && !(swap_chain = SwapChain::Create(wsi)))
+  {
+    PanicAlertT("Failed to create D3D swap chain");
+    ShutdownShared();
+    DXContext::Destroy();
+    return false;
+  }
+
+  g_renderer = std::make_unique<Renderer>(std::move(swap_chain), wsi.render_surface_scale);
+  g_vertex_manager = std::make_unique<VertexManager>();
+  g_shader_cache = std::make_unique<VideoCommon::ShaderCache>();
+  g_framebuffer_manager = std::make_unique<FramebufferManager>();
+  g_texture_cache = std::make_unique<TextureCacheBase>();
+  g_perf_query = std::make_unique<PerfQuery>();
+  if (!g_renderer->Initialize() || !g_vertex_manager->Initialize() ||
+      !g_shader_cache->Initialize() || !g_framebuffer_manager->Initialize() ||
+      !g_texture_cache->Initialize() || !PerfQuery::GetInstance()->Initialize())
+  {
+    Shutdown();
+    return false;
+  }
+
+  BBox::Init();
+  g_shader_cache->InitializeShaderCache();
+  return true;
+}
+
+void VideoBackend::Shutdown()
+{
+  // Keep the GPU out of the destructors' way.
+  g_dx_context->ExecuteCommandList(true);
+
+  g_shader_cache->Shutdown();
+  g_renderer->Shutdown();
+
+  BBox::Shutdown();
+
+  g_perf_query.reset();
+  g_texture_cache.reset();
+  g_framebuffer_manager.reset();
+  g_shader_cache.reset();
+  g_vertex_manager.reset();
+  g_renderer.reset();
+
+  ShutdownShared();
+  DXContext::Destroy();
+}
+}  // namespace DX12
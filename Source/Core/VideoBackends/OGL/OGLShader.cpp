@@ -3,6 +3,9 @@
 // Refer to the license.txt file included.
 
 #include "VideoBackends/OGL/OGLShader.h"
+
+#include "Common/Hash.h"
+
 #include "VideoBackends/OGL/ProgramShaderCache.h"
 
 namespace OGL
@@ -24,9 +27,9 @@ static GLenum GetGLShaderTypeForStage(ShaderStage stage)
   }
 }
 
-OGLShader::OGLShader(ShaderStage stage, GLenum gl_type, GLuint gl_id)
-    : AbstractShader(stage), m_id(ProgramShaderCache::GenerateShaderID()), m_type(gl_type),
-      m_gl_id(gl_id)
+OGLShader::OGLShader(ShaderStage stage, GLenum gl_type, GLuint gl_id, u64 source_hash)
+    : AbstractShader(stage), m_id(ProgramShaderCache::GenerateShaderID()),
+      m_source_hash(source_hash), m_type(gl_type), m_gl_id(gl_id)
 {
 }
 
@@ -66,7 +69,11 @@ std::unique_ptr<OGLShader> OGLShader::CreateFromSource(ShaderStage stage, const
     if (!shader_id)
       return nullptr;
 
-    return std::make_unique<OGLShader>(stage, shader_type, shader_id);
+    // The source hash is used to content-address linked program binaries, so
+    // that they survive across runs where the shader objects do not.
+    const u64 source_hash =
+        Common::GetHash64(reinterpret_cast<const u8*>(source), static_cast<u32>(length), 0);
+    return std::make_unique<OGLShader>(stage, shader_type, shader_id, source_hash);
   }
 
   // Compute shaders.
@@ -16,11 +16,12 @@ namespace OGL
 class OGLShader final : public AbstractShader
 {
 public:
-  explicit OGLShader(ShaderStage stage, GLenum gl_type, GLuint gl_id);
+  explicit OGLShader(ShaderStage stage, GLenum gl_type, GLuint gl_id, u64 source_hash);
   explicit OGLShader(GLuint gl_compute_program_id);
   ~OGLShader() override;
 
   u64 GetID() const { return m_id; }
+  u64 GetSourceHash() const { return m_source_hash; }
   GLenum GetGLShaderType() const { return m_type; }
   GLuint GetGLShaderID() const { return m_gl_id; }
   GLuint GetGLComputeProgramID() const { return m_gl_compute_program_id; }
@@ -32,6 +33,7 @@ public:
 
 private:
   u64 m_id;
+  u64 m_source_hash = 0;
   GLenum m_type;
   GLuint m_gl_id = 0;
   GLuint m_gl_compute_program_id = 0;
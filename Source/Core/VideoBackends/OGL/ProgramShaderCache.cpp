@@ -5,15 +5,21 @@
 #include "VideoBackends/OGL/ProgramShaderCache.h"
 
 #include <atomic>
+#include <cinttypes>
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Common/Align.h"
 #include "Common/Assert.h"
+#include "Common/CommonPaths.h"
 #include "Common/CommonTypes.h"
 #include "Common/FileUtil.h"
 #include "Common/GL/GLContext.h"
+#include "Common/Hash.h"
+#include "Common/LinearDiskCache.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/StringUtil.h"
@@ -32,6 +38,7 @@
 #include "VideoCommon/GeometryShaderManager.h"
 #include "VideoCommon/ImageWrite.h"
 #include "VideoCommon/PixelShaderManager.h"
+#include "VideoCommon/ShaderGenCommon.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexShaderManager.h"
@@ -55,6 +62,21 @@ static std::string s_glsl_header = "";
 static std::atomic<u64> s_shader_counter{0};
 static thread_local bool s_is_shared_context = false;
 
+// Two-tier cache of linked program binaries, keyed by a hash of the sources
+// the program was built from. The shared tier (typically a directory on a
+// network mount, populated by an identical machine) is read-only; programs
+// linked locally are appended to the per-user tier.
+struct ProgramBinary
+{
+  GLenum format;
+  std::vector<u8> data;
+};
+static std::map<u64, ProgramBinary> s_program_binaries;
+static LinearDiskCache<u64, u8> s_program_binary_disk_cache;
+static std::mutex s_program_binary_lock;
+static bool s_program_binary_cache_active = false;
+static u64 s_glsl_header_hash = 0;
+
 static std::string GetGLSLVersionString()
 {
   GlslVersion v = g_ogl_config.eSupportedGLSLVersion;
@@ -84,6 +106,142 @@ static std::string GetGLSLVersionString()
   }
 }
 
+static u64 HashString(const std::string& str)
+{
+  return Common::GetHash64(reinterpret_cast<const u8*>(str.data()), static_cast<u32>(str.size()),
+                           0);
+}
+
+static u64 GetProgramBinaryKey(u64 vertex_hash, u64 geometry_hash, u64 pixel_hash, u64 compute_hash)
+{
+  // Content-addressed: any change to the generated sources or to the GLSL
+  // header produces a different key. Unused stages hash as zero.
+  const u64 parts[] = {s_glsl_header_hash, vertex_hash, geometry_hash, pixel_hash, compute_hash};
+  return Common::GetHash64(reinterpret_cast<const u8*>(parts), static_cast<u32>(sizeof(parts)), 0);
+}
+
+static std::string GetProgramBinaryCacheType()
+{
+  // Program binaries are only usable on the driver/GPU combination which
+  // produced them, so a fingerprint of the driver is part of the file name.
+  // After a driver update the old file simply stops matching and is replaced.
+  const std::string fingerprint = StringFromFormat(
+      "%s-%s-%s", g_ogl_config.gl_vendor, g_ogl_config.gl_renderer, g_ogl_config.gl_version);
+  return StringFromFormat("Programs-%016" PRIX64, HashString(fingerprint));
+}
+
+class ProgramBinaryCacheReader : public LinearDiskCacheReader<u64, u8>
+{
+public:
+  void Read(const u64& key, const u8* value, u32 value_size) override
+  {
+    // Values are a GLenum binary format followed by the binary itself.
+    if (value_size <= sizeof(GLenum))
+      return;
+
+    ProgramBinary& binary = s_program_binaries[key];
+    std::memcpy(&binary.format, value, sizeof(GLenum));
+    binary.data.assign(value + sizeof(GLenum), value + value_size);
+  }
+};
+
+static bool CreateProgramFromBinary(SHADER& shader, u64 key)
+{
+  std::lock_guard<std::mutex> guard(s_program_binary_lock);
+  auto iter = s_program_binaries.find(key);
+  if (iter == s_program_binaries.end())
+    return false;
+
+  shader.glprogid = glCreateProgram();
+  glProgramBinary(shader.glprogid, iter->second.format, iter->second.data.data(),
+                  static_cast<GLsizei>(iter->second.data.size()));
+
+  // The driver rejects binaries produced by an incompatible driver or GPU,
+  // in which case we fall back to compiling from source.
+  GLint link_status = GL_FALSE;
+  glGetProgramiv(shader.glprogid, GL_LINK_STATUS, &link_status);
+  if (link_status != GL_TRUE)
+  {
+    WARN_LOG(VIDEO, "Cached program binary was rejected by the driver, compiling from source.");
+    glDeleteProgram(shader.glprogid);
+    shader.glprogid = 0;
+    return false;
+  }
+
+  return true;
+}
+
+static void SaveProgramBinary(const SHADER& shader, u64 key)
+{
+  GLint binary_size = 0;
+  glGetProgramiv(shader.glprogid, GL_PROGRAM_BINARY_LENGTH, &binary_size);
+  if (binary_size <= 0)
+    return;
+
+  ProgramBinary binary;
+  binary.format = 0;
+  binary.data.resize(binary_size);
+  GLsizei data_size = 0;
+  glGetProgramBinary(shader.glprogid, binary_size, &data_size, &binary.format, binary.data.data());
+  if (data_size <= 0 || data_size > binary_size)
+    return;
+  binary.data.resize(data_size);
+
+  std::lock_guard<std::mutex> guard(s_program_binary_lock);
+
+  // A worker thread may have linked and stored the same program already.
+  if (s_program_binaries.find(key) != s_program_binaries.end())
+    return;
+
+  std::vector<u8> value(sizeof(GLenum) + binary.data.size());
+  std::memcpy(value.data(), &binary.format, sizeof(GLenum));
+  std::memcpy(value.data() + sizeof(GLenum), binary.data.data(), binary.data.size());
+  s_program_binary_disk_cache.Append(key, value.data(), static_cast<u32>(value.size()));
+  s_program_binary_disk_cache.Sync();
+
+  s_program_binaries.emplace(key, std::move(binary));
+}
+
+static void LoadProgramBinaryCache()
+{
+  s_program_binary_cache_active = g_ogl_config.bSupportsGLSLCache && g_ActiveConfig.bShaderCache;
+  if (!s_program_binary_cache_active)
+    return;
+
+  // The texture cache normally selects the hash function, but it is created
+  // after us.
+  Common::SetHash64Function();
+  s_glsl_header_hash = HashString(s_glsl_header);
+
+  ProgramBinaryCacheReader reader;
+
+  // Read the shared tier first, so that programs linked locally take
+  // precedence over (identical) shared entries. The file name matches the
+  // per-user one, so a user's cache directory can be published to the share
+  // as-is.
+  if (!g_ActiveConfig.sSharedShaderCachePath.empty())
+  {
+    const std::string shared_filename = g_ActiveConfig.sSharedShaderCachePath + DIR_SEP "OpenGL-" +
+                                        GetProgramBinaryCacheType() + ".cache";
+    LinearDiskCache<u64, u8> shared_cache;
+    const u32 shared_entries = shared_cache.OpenAndReadReadOnly(shared_filename, reader);
+    INFO_LOG(VIDEO, "Read %u program binaries from the shared cache tier.", shared_entries);
+  }
+
+  const std::string filename = GetDiskShaderCacheFileName(
+      APIType::OpenGL, GetProgramBinaryCacheType().c_str(), false, false);
+  const u32 entries = s_program_binary_disk_cache.OpenAndRead(filename, reader);
+  INFO_LOG(VIDEO, "Read %u program binaries from the user cache tier.", entries);
+}
+
+static void CloseProgramBinaryCache()
+{
+  s_program_binary_disk_cache.Sync();
+  s_program_binary_disk_cache.Close();
+  s_program_binaries.clear();
+  s_program_binary_cache_active = false;
+}
+
 void SHADER::SetProgramVariables()
 {
   if (g_ActiveConfig.backend_info.bSupportsBindingLayout)
@@ -218,37 +376,101 @@ u32 ProgramShaderCache::GetUniformBufferAlignment()
   return s_ubo_align;
 }
 
+// Last seen restart count of the uniform stream buffer, to detect when ranges
+// still bound from earlier uploads are about to be rewritten.
+static u32 s_last_ubo_restarts = 0;
+
 void ProgramShaderCache::UploadConstants()
 {
-  if (PixelShaderManager::dirty || VertexShaderManager::dirty || GeometryShaderManager::dirty)
+  // A stream buffer restart (ring rollover or orphaning) means regions from
+  // earlier Maps will be rewritten, and the fences only protect in-flight
+  // draws, not standing bindings. Re-upload everything in that case, even
+  // blocks whose CPU-side copy didn't change.
+  const u32 restarts = s_buffer->GetNumBufferRestarts();
+  if (restarts != s_last_ubo_restarts)
   {
-    auto buffer = s_buffer->Map(s_ubo_buffer_size, s_ubo_align);
+    s_last_ubo_restarts = restarts;
+    PixelShaderManager::dirty = true;
+    VertexShaderManager::dirty = true;
+    GeometryShaderManager::dirty = true;
+  }
 
-    memcpy(buffer.first, &PixelShaderManager::constants, sizeof(PixelShaderConstants));
+  if (!s_buffer->SupportsSparseMappings())
+  {
+    // The fallback streaming methods upload at offset zero every time or
+    // orphan the storage, so ranges from separate Maps can't stay bound side
+    // by side: upload all three blocks in one go whenever any of them changed.
+    if (PixelShaderManager::dirty || VertexShaderManager::dirty || GeometryShaderManager::dirty)
+    {
+      const u32 ps_size =
+          static_cast<u32>(Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align));
+      const u32 vs_size =
+          static_cast<u32>(Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align));
+
+      auto buffer = s_buffer->Map(s_ubo_buffer_size, s_ubo_align);
+
+      memcpy(buffer.first, &PixelShaderManager::constants, sizeof(PixelShaderConstants));
+      memcpy(buffer.first + ps_size, &VertexShaderManager::constants,
+             sizeof(VertexShaderConstants));
+      memcpy(buffer.first + ps_size + vs_size, &GeometryShaderManager::constants,
+             sizeof(GeometryShaderConstants));
+
+      s_buffer->Unmap(s_ubo_buffer_size);
 
-    memcpy(buffer.first + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align),
-           &VertexShaderManager::constants, sizeof(VertexShaderConstants));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second,
+                        sizeof(PixelShaderConstants));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer, buffer.second + ps_size,
+                        sizeof(VertexShaderConstants));
+      glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer, buffer.second + ps_size + vs_size,
+                        sizeof(GeometryShaderConstants));
 
-    memcpy(buffer.first + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) +
-               Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align),
-           &GeometryShaderManager::constants, sizeof(GeometryShaderConstants));
+      PixelShaderManager::dirty = false;
+      VertexShaderManager::dirty = false;
+      GeometryShaderManager::dirty = false;
 
-    s_buffer->Unmap(s_ubo_buffer_size);
+      ADDSTAT(stats.thisFrame.bytesUniformStreamed, s_ubo_buffer_size);
+    }
+    return;
+  }
+
+  // Upload each block separately, so a change to one set of constants doesn't
+  // re-stream the others. Clean blocks stay bound at the offset of their last
+  // upload, which consecutive draws then share.
+  if (PixelShaderManager::dirty)
+  {
+    const u32 size = static_cast<u32>(Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align));
+    auto buffer = s_buffer->Map(size, s_ubo_align);
+    memcpy(buffer.first, &PixelShaderManager::constants, sizeof(PixelShaderConstants));
+    s_buffer->Unmap(size);
     glBindBufferRange(GL_UNIFORM_BUFFER, 1, s_buffer->m_buffer, buffer.second,
                       sizeof(PixelShaderConstants));
-    glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer,
-                      buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align),
-                      sizeof(VertexShaderConstants));
-    glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer,
-                      buffer.second + Common::AlignUp(sizeof(PixelShaderConstants), s_ubo_align) +
-                          Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align),
-                      sizeof(GeometryShaderConstants));
-
     PixelShaderManager::dirty = false;
+    ADDSTAT(stats.thisFrame.bytesUniformStreamed, size);
+  }
+
+  if (VertexShaderManager::dirty)
+  {
+    const u32 size = static_cast<u32>(Common::AlignUp(sizeof(VertexShaderConstants), s_ubo_align));
+    auto buffer = s_buffer->Map(size, s_ubo_align);
+    memcpy(buffer.first, &VertexShaderManager::constants, sizeof(VertexShaderConstants));
+    s_buffer->Unmap(size);
+    glBindBufferRange(GL_UNIFORM_BUFFER, 2, s_buffer->m_buffer, buffer.second,
+                      sizeof(VertexShaderConstants));
     VertexShaderManager::dirty = false;
-    GeometryShaderManager::dirty = false;
+    ADDSTAT(stats.thisFrame.bytesUniformStreamed, size);
+  }
 
-    ADDSTAT(stats.thisFrame.bytesUniformStreamed, s_ubo_buffer_size);
+  if (GeometryShaderManager::dirty)
+  {
+    const u32 size =
+        static_cast<u32>(Common::AlignUp(sizeof(GeometryShaderConstants), s_ubo_align));
+    auto buffer = s_buffer->Map(size, s_ubo_align);
+    memcpy(buffer.first, &GeometryShaderManager::constants, sizeof(GeometryShaderConstants));
+    s_buffer->Unmap(size);
+    glBindBufferRange(GL_UNIFORM_BUFFER, 3, s_buffer->m_buffer, buffer.second,
+                      sizeof(GeometryShaderConstants));
+    GeometryShaderManager::dirty = false;
+    ADDSTAT(stats.thisFrame.bytesUniformStreamed, size);
   }
 }
 
@@ -290,6 +512,18 @@ bool ProgramShaderCache::CompileShader(SHADER& shader, const std::string& vcode,
   }
 #endif
 
+  u64 binary_key = 0;
+  if (s_program_binary_cache_active)
+  {
+    binary_key = GetProgramBinaryKey(HashString(vcode), gcode.empty() ? 0 : HashString(gcode),
+                                     HashString(pcode), 0);
+    if (CreateProgramFromBinary(shader, binary_key))
+    {
+      shader.SetProgramVariables();
+      return true;
+    }
+  }
+
   shader.vsid = CompileSingleShader(GL_VERTEX_SHADER, vcode);
   shader.psid = CompileSingleShader(GL_FRAGMENT_SHADER, pcode);
 
@@ -326,6 +560,9 @@ bool ProgramShaderCache::CompileShader(SHADER& shader, const std::string& vcode,
     return false;
   }
 
+  if (s_program_binary_cache_active)
+    SaveProgramBinary(shader, binary_key);
+
   // For drivers that don't support binding layout, we need to bind it here.
   shader.SetProgramVariables();
 
@@ -346,12 +583,26 @@ bool ProgramShaderCache::CompileComputeShader(SHADER& shader, const std::string&
   }
 
   std::string full_code = header + code;
+
+  u64 binary_key = 0;
+  if (s_program_binary_cache_active)
+  {
+    binary_key = GetProgramBinaryKey(0, 0, 0, HashString(full_code));
+    if (CreateProgramFromBinary(shader, binary_key))
+    {
+      shader.SetProgramVariables();
+      return true;
+    }
+  }
+
   GLuint shader_id = CompileSingleShader(GL_COMPUTE_SHADER, full_code);
   if (!shader_id)
     return false;
 
   shader.glprogid = glCreateProgram();
   glAttachShader(shader.glprogid, shader_id);
+  if (g_ogl_config.bSupportsGLSLCache)
+    glProgramParameteri(shader.glprogid, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
   shader.SetProgramBindings(true);
   glLinkProgram(shader.glprogid);
 
@@ -364,6 +615,9 @@ bool ProgramShaderCache::CompileComputeShader(SHADER& shader, const std::string&
     return false;
   }
 
+  if (s_program_binary_cache_active)
+    SaveProgramBinary(shader, binary_key);
+
   shader.SetProgramVariables();
   return true;
 }
@@ -499,12 +753,15 @@ void ProgramShaderCache::Init()
 
   CreateHeader();
   CreateAttributelessVAO();
+  LoadProgramBinaryCache();
 
   CurrentProgram = 0;
 }
 
 void ProgramShaderCache::Shutdown()
 {
+  CloseProgramBinaryCache();
+
   s_buffer.reset();
 
   glBindVertexArray(0);
@@ -580,39 +837,60 @@ const PipelineProgram* ProgramShaderCache::GetPipelineProgram(const GLVertexForm
     }
   }
 
-  // We temporarily change the vertex array to the pipeline's vertex format.
-  // This can prevent the NVIDIA OpenGL driver from recompiling on first use.
-  GLuint vao = vertex_format ? vertex_format->VAO : s_attributeless_VAO;
-  if (s_is_shared_context || vao != s_last_VAO)
-    glBindVertexArray(vao);
-
   std::unique_ptr<PipelineProgram> prog = std::make_unique<PipelineProgram>();
   prog->key = key;
 
-  // Attach shaders.
   ASSERT(vertex_shader && vertex_shader->GetStage() == ShaderStage::Vertex);
   ASSERT(pixel_shader && pixel_shader->GetStage() == ShaderStage::Pixel);
-  prog->shader.glprogid = glCreateProgram();
-  glAttachShader(prog->shader.glprogid, vertex_shader->GetGLShaderID());
-  glAttachShader(prog->shader.glprogid, pixel_shader->GetGLShaderID());
   if (geometry_shader)
-  {
     ASSERT(geometry_shader->GetStage() == ShaderStage::Geometry);
-    glAttachShader(prog->shader.glprogid, geometry_shader->GetGLShaderID());
-  }
-
-  // Link program.
-  prog->shader.SetProgramBindings(false);
-  glLinkProgram(prog->shader.glprogid);
 
-  // Restore VAO binding after linking.
-  if (!s_is_shared_context && vao != s_last_VAO)
-    glBindVertexArray(s_last_VAO);
+  // A content-addressed binary from a previous run (possibly on another
+  // machine) saves both the link and the driver's internal compilation.
+  u64 binary_key = 0;
+  bool loaded_from_binary = false;
+  if (s_program_binary_cache_active)
+  {
+    binary_key = GetProgramBinaryKey(vertex_shader->GetSourceHash(),
+                                     geometry_shader ? geometry_shader->GetSourceHash() : 0,
+                                     pixel_shader->GetSourceHash(), 0);
+    loaded_from_binary = CreateProgramFromBinary(prog->shader, binary_key);
+  }
 
-  if (!ProgramShaderCache::CheckProgramLinkResult(prog->shader.glprogid, {}, {}, {}))
+  if (!loaded_from_binary)
   {
-    prog->shader.Destroy();
-    return nullptr;
+    // We temporarily change the vertex array to the pipeline's vertex format.
+    // This can prevent the NVIDIA OpenGL driver from recompiling on first use.
+    GLuint vao = vertex_format ? vertex_format->VAO : s_attributeless_VAO;
+    if (s_is_shared_context || vao != s_last_VAO)
+      glBindVertexArray(vao);
+
+    // Attach shaders.
+    prog->shader.glprogid = glCreateProgram();
+    glAttachShader(prog->shader.glprogid, vertex_shader->GetGLShaderID());
+    glAttachShader(prog->shader.glprogid, pixel_shader->GetGLShaderID());
+    if (geometry_shader)
+      glAttachShader(prog->shader.glprogid, geometry_shader->GetGLShaderID());
+
+    if (g_ogl_config.bSupportsGLSLCache)
+      glProgramParameteri(prog->shader.glprogid, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+    // Link program.
+    prog->shader.SetProgramBindings(false);
+    glLinkProgram(prog->shader.glprogid);
+
+    // Restore VAO binding after linking.
+    if (!s_is_shared_context && vao != s_last_VAO)
+      glBindVertexArray(s_last_VAO);
+
+    if (!ProgramShaderCache::CheckProgramLinkResult(prog->shader.glprogid, {}, {}, {}))
+    {
+      prog->shader.Destroy();
+      return nullptr;
+    }
+
+    if (s_program_binary_cache_active)
+      SaveProgramBinary(prog->shader, binary_key);
   }
 
   // Lock to insert. A duplicate program may have been created in the meantime.
@@ -486,6 +486,8 @@ Renderer::Renderer(std::unique_ptr<GLContext> main_gl_context, float backbuffer_
       GLExtensions::Supports("GL_ARB_texture_storage_multisample");
   g_ogl_config.bSupportsImageLoadStore = GLExtensions::Supports("GL_ARB_shader_image_load_store");
   g_ogl_config.bSupportsConservativeDepth = GLExtensions::Supports("GL_ARB_conservative_depth");
+  // glBindTextureUnit is only loaded for 4.5 contexts, not for the extension.
+  g_ogl_config.bSupportsBindTextureUnit = GLExtensions::Version() >= 450;
   g_ogl_config.bSupportsAniso = GLExtensions::Supports("GL_EXT_texture_filter_anisotropic");
   g_Config.backend_info.bSupportsComputeShaders = GLExtensions::Supports("GL_ARB_compute_shader");
   g_Config.backend_info.bSupportsST3CTextures =
@@ -1266,11 +1268,20 @@ void Renderer::SetTexture(u32 index, const AbstractTexture* texture)
   if (m_bound_textures[index] == gl_texture)
     return;
 
-  glActiveTexture(GL_TEXTURE0 + index);
-  if (gl_texture)
-    glBindTexture(gl_texture->GetGLTarget(), gl_texture->GetGLTextureId());
+  if (g_ogl_config.bSupportsBindTextureUnit)
+  {
+    // Half the driver calls of the selector-based path below. Texture re-binds happen
+    // for the majority of draws, so this is one of our most frequent GL calls.
+    glBindTextureUnit(index, gl_texture ? gl_texture->GetGLTextureId() : 0);
+  }
   else
-    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  {
+    glActiveTexture(GL_TEXTURE0 + index);
+    if (gl_texture)
+      glBindTexture(gl_texture->GetGLTarget(), gl_texture->GetGLTextureId());
+    else
+      glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  }
   m_bound_textures[index] = gl_texture;
 }
 
@@ -1305,8 +1316,15 @@ void Renderer::UnbindTexture(const AbstractTexture* texture)
     if (m_bound_textures[i] != texture)
       continue;
 
-    glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + i));
-    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    if (g_ogl_config.bSupportsBindTextureUnit)
+    {
+      glBindTextureUnit(static_cast<GLuint>(i), 0);
+    }
+    else
+    {
+      glActiveTexture(static_cast<GLenum>(GL_TEXTURE0 + i));
+      glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    }
     m_bound_textures[i] = nullptr;
   }
 
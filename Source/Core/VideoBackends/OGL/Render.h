@@ -69,6 +69,7 @@ struct VideoConfig
   bool bSupportsAniso;
   bool bSupportsBitfield;
   bool bSupportsTextureSubImage;
+  bool bSupportsBindTextureUnit;
   EsFbFetchType SupportedFramebufferFetch;
   bool bSupportsShaderThreadShuffleNV;
 
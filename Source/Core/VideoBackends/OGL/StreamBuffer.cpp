@@ -108,6 +108,8 @@ void StreamBuffer::AllocMemory(u32 size)
   // if buffer is full
   if (m_iterator + size >= m_size)
   {
+    m_num_restarts++;
+
     // insert waiting slots in unused space at the end of the buffer
     for (int i = Slot(m_used_iterator); i < SYNC_POINTS; i++)
     {
@@ -139,6 +141,9 @@ class MapAndOrphan : public StreamBuffer
 public:
   MapAndOrphan(u32 type, u32 size) : StreamBuffer(type, size)
   {
+    // Orphaning invalidates everything uploaded to the old storage, so ranges
+    // from older Maps can't stay bound across it.
+    m_sparse_mappings = false;
     glBindBuffer(m_buffertype, m_buffer);
     glBufferData(m_buffertype, m_size, nullptr, GL_STREAM_DRAW);
   }
@@ -148,6 +153,7 @@ public:
   {
     if (m_iterator + size >= m_size)
     {
+      m_num_restarts++;
       glBufferData(m_buffertype, m_size, nullptr, GL_STREAM_DRAW);
       m_iterator = 0;
     }
@@ -311,6 +317,7 @@ class BufferSubData : public StreamBuffer
 public:
   BufferSubData(u32 type, u32 size) : StreamBuffer(type, size)
   {
+    m_sparse_mappings = false;
     glBindBuffer(m_buffertype, m_buffer);
     glBufferData(m_buffertype, size, nullptr, GL_STATIC_DRAW);
     m_pointer = new u8[m_size];
@@ -332,6 +339,7 @@ class BufferData : public StreamBuffer
 public:
   BufferData(u32 type, u32 size) : StreamBuffer(type, size)
   {
+    m_sparse_mappings = false;
     glBindBuffer(m_buffertype, m_buffer);
     m_pointer = new u8[m_size];
   }
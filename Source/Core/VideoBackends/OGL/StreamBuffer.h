@@ -23,6 +23,17 @@ public:
   u32 GetSize() const { return m_size; }
   u32 GetCurrentOffset() const { return m_iterator; }
 
+  // Incremented whenever previously returned regions become invalid or are
+  // about to be rewritten (ring buffer rollover, orphaning). Users that keep
+  // ranges from older Maps bound have to re-upload them when this changes.
+  u32 GetNumBufferRestarts() const { return m_num_restarts; }
+
+  // False for the fallback streaming methods whose Map always returns offset
+  // zero (glBufferSubData/glBufferData) or which orphan the storage: there,
+  // every upload clobbers or invalidates the previous one, so ranges from
+  // separate Maps can never be bound at the same time.
+  bool SupportsSparseMappings() const { return m_sparse_mappings; }
+
   /* This mapping function will return a pair of:
    * - the pointer to the mapped buffer
    * - the offset into the real GPU buffer (always multiple of stride)
@@ -58,6 +69,8 @@ protected:
   u32 m_iterator;
   u32 m_used_iterator;
   u32 m_free_iterator;
+  u32 m_num_restarts = 0;
+  bool m_sparse_mappings = true;
 
 private:
   static constexpr int SYNC_POINTS = 16;
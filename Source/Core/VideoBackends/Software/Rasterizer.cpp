@@ -29,6 +29,9 @@ static s32 vertex0Y;
 static float vertexOffsetX;
 static float vertexOffsetY;
 
+// Constant over a triangle, hoisted out of the per-pixel loop.
+static bool earlyZEnabled;
+
 static Tev tev;
 static RasterBlock rasterBlock;
 
@@ -79,7 +82,7 @@ static void Draw(s32 x, s32 y, s32 xi, s32 yi)
 
   s32 z = (s32)MathUtil::Clamp<float>(ZSlope.GetValue(dx, dy), 0.0f, 16777215.0f);
 
-  if (bpmem.UseEarlyDepthTest() && g_ActiveConfig.bZComploc)
+  if (earlyZEnabled)
   {
     // TODO: Test if perf regs are incremented even if test is disabled
     EfbInterface::IncPerfCounterQuadCount(PQ_ZCOMP_INPUT_ZCOMPLOC);
@@ -371,6 +374,8 @@ void DrawTriangleFrontFace(const OutputVertexData* v0, const OutputVertexData* v
                 v2->texCoords[i][comp] * w[2], fltdx31, fltdx12, fltdy12, fltdy31);
   }
 
+  earlyZEnabled = bpmem.UseEarlyDepthTest() && g_ActiveConfig.bZComploc;
+
   // Half-edge constants
   s32 C1 = DY12 * X1 - DX12 * Y1;
   s32 C2 = DY23 * X2 - DX23 * Y2;
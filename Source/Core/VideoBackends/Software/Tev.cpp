@@ -224,6 +224,13 @@ void Tev::SetRasColor(int colorChan, int swaptable)
 
 void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const InputRegType inputs[4])
 {
+  // Hoisted out of the loop; the compiler can't do it itself, as the LUTs
+  // could alias the register file being written.
+  const s32 lshift = m_ScaleLShiftLUT[cc.shift];
+  const s32 rshift = m_ScaleRShiftLUT[cc.shift];
+  const s32 round = (cc.shift == 3) ? 0 : (cc.op == 1) ? 127 : 128;
+  const s32 bias = m_BiasLUT[cc.bias];
+
   for (int i = 0; i < 3; i++)
   {
     const InputRegType& InputReg = inputs[BLU_C + i];
@@ -231,13 +238,13 @@ void Tev::DrawColorRegular(const TevStageCombiner::ColorCombiner& cc, const Inpu
     const u16 c = InputReg.c + (InputReg.c >> 7);
 
     s32 temp = InputReg.a * (256 - c) + (InputReg.b * c);
-    temp <<= m_ScaleLShiftLUT[cc.shift];
-    temp += (cc.shift == 3) ? 0 : (cc.op == 1) ? 127 : 128;
+    temp <<= lshift;
+    temp += round;
     temp >>= 8;
     temp = cc.op ? -temp : temp;
 
-    s32 result = ((InputReg.d + m_BiasLUT[cc.bias]) << m_ScaleLShiftLUT[cc.shift]) + temp;
-    result = result >> m_ScaleRShiftLUT[cc.shift];
+    s32 result = ((InputReg.d + bias) << lshift) + temp;
+    result = result >> rshift;
 
     Reg[cc.dest][BLU_C + i] = result;
   }
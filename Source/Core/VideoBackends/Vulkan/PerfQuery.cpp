@@ -50,6 +50,7 @@ void PerfQuery::EnableQuery(PerfQueryGroup type)
     ActiveQuery& entry = m_query_buffer[m_query_next_pos];
     DEBUG_ASSERT(!entry.has_value);
     entry.has_value = true;
+    entry.query_type = type;
 
     // Use precise queries if supported, otherwise boolean (which will be incorrect).
     VkQueryControlFlags flags =
@@ -67,6 +68,11 @@ void PerfQuery::DisableQuery(PerfQueryGroup type)
   if (type == PQG_ZCOMP_ZCOMPLOC || type == PQG_ZCOMP)
   {
     vkCmdEndQuery(g_command_buffer_mgr->GetCurrentCommandBuffer(), m_query_pool, m_query_next_pos);
+
+    // The result becomes readable once the current command buffer's fence signals.
+    m_query_buffer[m_query_next_pos].fence_counter =
+        g_command_buffer_mgr->GetCurrentFenceCounter();
+
     m_query_next_pos = (m_query_next_pos + 1) % PERF_QUERY_BUFFER_SIZE;
     m_query_count++;
   }
@@ -241,6 +241,7 @@ void StateTracker::InvalidateCachedState()
   m_gx_descriptor_sets.fill(VK_NULL_HANDLE);
   m_utility_descriptor_sets.fill(VK_NULL_HANDLE);
   m_compute_descriptor_set = VK_NULL_HANDLE;
+  m_sampler_descriptor_set_cache.clear();
   m_dirty_flags |= DIRTY_FLAG_ALL_DESCRIPTORS | DIRTY_FLAG_VIEWPORT | DIRTY_FLAG_SCISSOR |
                    DIRTY_FLAG_PIPELINE | DIRTY_FLAG_COMPUTE_SHADER | DIRTY_FLAG_DESCRIPTOR_SETS |
                    DIRTY_FLAG_COMPUTE_DESCRIPTOR_SET;
@@ -499,21 +500,31 @@ bool StateTracker::UpdateGXDescriptorSet()
 
   if (m_dirty_flags & DIRTY_FLAG_GX_SAMPLERS || m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
   {
-    m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
-        g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
-    if (m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
-      return false;
+    // Re-use a set written earlier in this command buffer if the bindings match.
+    const auto cache_iter = m_sampler_descriptor_set_cache.find(m_bindings.samplers);
+    if (cache_iter != m_sampler_descriptor_set_cache.end())
+    {
+      m_gx_descriptor_sets[1] = cache_iter->second;
+    }
+    else
+    {
+      m_gx_descriptor_sets[1] = g_command_buffer_mgr->AllocateDescriptorSet(
+          g_object_cache->GetDescriptorSetLayout(DESCRIPTOR_SET_LAYOUT_STANDARD_SAMPLERS));
+      if (m_gx_descriptor_sets[1] == VK_NULL_HANDLE)
+        return false;
 
-    writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                            nullptr,
-                            m_gx_descriptor_sets[1],
-                            0,
-                            0,
-                            static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
-                            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-                            m_bindings.samplers.data(),
-                            nullptr,
-                            nullptr};
+      writes[num_writes++] = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                              nullptr,
+                              m_gx_descriptor_sets[1],
+                              0,
+                              0,
+                              static_cast<u32>(NUM_PIXEL_SHADER_SAMPLERS),
+                              VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                              m_bindings.samplers.data(),
+                              nullptr,
+                              nullptr};
+      m_sampler_descriptor_set_cache.emplace(m_bindings.samplers, m_gx_descriptor_sets[1]);
+    }
     m_dirty_flags = (m_dirty_flags & ~DIRTY_FLAG_GX_SAMPLERS) | DIRTY_FLAG_DESCRIPTOR_SETS;
   }
 
@@ -6,6 +6,7 @@
 
 #include <array>
 #include <cstddef>
+#include <map>
 #include <memory>
 
 #include "Common/CommonTypes.h"
@@ -152,6 +153,28 @@ private:
   std::array<VkDescriptorSet, NUM_UTILITY_DESCRIPTOR_SETS> m_utility_descriptor_sets = {};
   VkDescriptorSet m_compute_descriptor_set = VK_NULL_HANDLE;
 
+  // Cache of sampler descriptor sets, keyed on the bound sampler/view tuple. Avoids
+  // allocating and writing a new set for every texture change when the same combination
+  // of bindings recurs within a frame. The sets are allocated from the current command
+  // buffer's descriptor pool, so the cache is emptied when the state is invalidated at
+  // command buffer submission time, before the pool is recycled.
+  using SamplerBindings = std::array<VkDescriptorImageInfo, NUM_PIXEL_SHADER_SAMPLERS>;
+  struct SamplerBindingsLess
+  {
+    bool operator()(const SamplerBindings& lhs, const SamplerBindings& rhs) const
+    {
+      for (size_t i = 0; i < NUM_PIXEL_SHADER_SAMPLERS; i++)
+      {
+        if (lhs[i].sampler != rhs[i].sampler)
+          return lhs[i].sampler < rhs[i].sampler;
+        if (lhs[i].imageView != rhs[i].imageView)
+          return lhs[i].imageView < rhs[i].imageView;
+      }
+      return false;
+    }
+  };
+  std::map<SamplerBindings, VkDescriptorSet, SamplerBindingsLess> m_sampler_descriptor_set_cache;
+
   // rasterization
   VkViewport m_viewport = {0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f};
   VkRect2D m_scissor = {{0, 0}, {1, 1}};
@@ -12,6 +12,8 @@ namespace Vulkan
 class VideoBackend : public VideoBackendBase
 {
 public:
+  ~VideoBackend() override;
+
   bool Initialize(const WindowSystemInfo& wsi) override;
   void Shutdown() override;
 
@@ -29,6 +29,49 @@
 
 namespace Vulkan
 {
+// The device (and the instance it was created from) is kept alive across
+// backend shutdowns, and handed back to the next Initialize() if the
+// configuration still matches. This turns a renderer restart into swapchain
+// and framebuffer recreation, instead of a multi-second device rebuild with
+// full pipeline recompilation. The retained device holds no surface or
+// swapchain references at this point, so it is safe to present to a new
+// window with it later.
+static std::unique_ptr<VulkanContext> s_retained_context;
+static WindowSystemType s_retained_wsi_type = WindowSystemType::Headless;
+static int s_retained_adapter_index = 0;
+static bool s_retained_validation_layer = false;
+static bool s_retained_debug_reports = false;
+
+static std::unique_ptr<VulkanContext> TakeRetainedContext(const WindowSystemInfo& wsi,
+                                                          bool enable_debug_reports,
+                                                          bool enable_validation_layer)
+{
+  if (!s_retained_context)
+    return nullptr;
+
+  // Anything which affects instance or device creation forces a full rebuild.
+  if (s_retained_wsi_type != wsi.type || s_retained_adapter_index != g_Config.iAdapter ||
+      s_retained_validation_layer != enable_validation_layer ||
+      s_retained_debug_reports != enable_debug_reports)
+  {
+    s_retained_context.reset();
+    return nullptr;
+  }
+
+  return std::move(s_retained_context);
+}
+
+VideoBackend::~VideoBackend()
+{
+  // Destroy any retained device at application exit, while the library is
+  // still loaded.
+  if (s_retained_context)
+  {
+    s_retained_context.reset();
+    UnloadVulkanLibrary();
+  }
+}
+
 void VideoBackend::InitBackendInfo()
 {
   VulkanContext::PopulateBackendInfo(&g_Config);
@@ -68,7 +111,9 @@ void VideoBackend::InitBackendInfo()
       PanicAlert("Failed to create Vulkan instance.");
     }
 
-    UnloadVulkanLibrary();
+    // Any retained device still needs the library.
+    if (!s_retained_context)
+      UnloadVulkanLibrary();
   }
   else
   {
@@ -113,8 +158,15 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   // We use this instance to fill in backend info, then re-use it for the actual device.
   bool enable_surface = wsi.type != WindowSystemType::Headless;
   bool enable_debug_reports = ShouldEnableDebugReports(enable_validation_layer);
-  VkInstance instance =
-      VulkanContext::CreateVulkanInstance(wsi.type, enable_debug_reports, enable_validation_layer);
+
+  // Re-use the device from the previous run when the configuration allows it;
+  // only the surface, swapchain and size-dependent objects are recreated.
+  std::unique_ptr<VulkanContext> retained_context =
+      TakeRetainedContext(wsi, enable_debug_reports, enable_validation_layer);
+  VkInstance instance = retained_context ?
+                            retained_context->GetVulkanInstance() :
+                            VulkanContext::CreateVulkanInstance(wsi.type, enable_debug_reports,
+                                                                enable_validation_layer);
   if (instance == VK_NULL_HANDLE)
   {
     PanicAlert("Failed to create Vulkan instance.");
@@ -126,7 +178,10 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   if (!LoadVulkanInstanceFunctions(instance))
   {
     PanicAlert("Failed to load Vulkan instance functions.");
-    vkDestroyInstance(instance, nullptr);
+    if (retained_context)
+      retained_context.reset();
+    else
+      vkDestroyInstance(instance, nullptr);
     UnloadVulkanLibrary();
     return false;
   }
@@ -137,7 +192,10 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
   if (gpu_list.empty())
   {
     PanicAlert("No Vulkan physical devices available.");
-    vkDestroyInstance(instance, nullptr);
+    if (retained_context)
+      retained_context.reset();
+    else
+      vkDestroyInstance(instance, nullptr);
     UnloadVulkanLibrary();
     return false;
   }
@@ -154,7 +212,10 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
     if (surface == VK_NULL_HANDLE)
     {
       PanicAlert("Failed to create Vulkan surface.");
-      vkDestroyInstance(instance, nullptr);
+      if (retained_context)
+        retained_context.reset();
+      else
+        vkDestroyInstance(instance, nullptr);
       UnloadVulkanLibrary();
       return false;
     }
@@ -169,16 +230,57 @@ bool VideoBackend::Initialize(const WindowSystemInfo& wsi)
     selected_adapter_index = 0;
   }
 
-  // Now we can create the Vulkan device. VulkanContext takes ownership of the instance and surface.
-  g_vulkan_context = VulkanContext::Create(instance, gpu_list[selected_adapter_index], surface,
-                                           enable_debug_reports, enable_validation_layer);
-  if (!g_vulkan_context)
+  if (retained_context)
   {
-    PanicAlert("Failed to create Vulkan device");
-    UnloadVulkanLibrary();
-    return false;
+    // The new surface must be presentable from the queue family the retained
+    // device was created with; fall back to a full rebuild if it is not.
+    VkBool32 present_supported = VK_TRUE;
+    if (surface != VK_NULL_HANDLE &&
+        (vkGetPhysicalDeviceSurfaceSupportKHR(retained_context->GetPhysicalDevice(),
+                                              retained_context->GetPresentQueueFamilyIndex(),
+                                              surface, &present_supported) != VK_SUCCESS ||
+         !present_supported))
+    {
+      WARN_LOG(VIDEO, "Retained Vulkan device cannot present to the new surface, recreating.");
+      vkDestroySurfaceKHR(instance, surface, nullptr);
+      retained_context.reset();
+      return Initialize(wsi);
+    }
+
+    // Device function pointers may have been reset by an intervening
+    // InitBackendInfo(), so load them again.
+    g_vulkan_context = std::move(retained_context);
+    if (!LoadVulkanDeviceFunctions(g_vulkan_context->GetDevice()))
+    {
+      PanicAlert("Failed to load Vulkan device functions.");
+      if (surface != VK_NULL_HANDLE)
+        vkDestroySurfaceKHR(instance, surface, nullptr);
+      g_vulkan_context.reset();
+      UnloadVulkanLibrary();
+      return false;
+    }
+  }
+  else
+  {
+    // Now we can create the Vulkan device. VulkanContext takes ownership of the instance and
+    // surface.
+    g_vulkan_context = VulkanContext::Create(instance, gpu_list[selected_adapter_index], surface,
+                                             enable_debug_reports, enable_validation_layer);
+    if (!g_vulkan_context)
+    {
+      PanicAlert("Failed to create Vulkan device");
+      UnloadVulkanLibrary();
+      return false;
+    }
   }
 
+  // Remember what the device was created with, so the next Initialize() can
+  // tell whether it is re-usable.
+  s_retained_wsi_type = wsi.type;
+  s_retained_adapter_index = g_Config.iAdapter;
+  s_retained_validation_layer = enable_validation_layer;
+  s_retained_debug_reports = enable_debug_reports;
+
   // Since VulkanContext maintains a copy of the device features and properties, we can use this
   // to initialize the backend information, so that we don't need to enumerate everything again.
   VulkanContext::PopulateBackendInfoFeatures(&g_Config, g_vulkan_context->GetPhysicalDevice(),
@@ -272,9 +374,16 @@ void VideoBackend::Shutdown()
   g_object_cache.reset();
   StateTracker::DestroyInstance();
   g_command_buffer_mgr.reset();
-  g_vulkan_context.reset();
+
+  // Keep the device (and instance) alive for the next Initialize(); every
+  // object created from it has been destroyed by this point. It is released
+  // for real when the backend object goes away, or when the next
+  // Initialize() runs with an incompatible configuration.
+  s_retained_context = std::move(g_vulkan_context);
+
   ShutdownShared();
-  UnloadVulkanLibrary();
+  if (!s_retained_context)
+    UnloadVulkanLibrary();
 }
 
 void VideoBackend::PrepareWindow(const WindowSystemInfo& wsi)
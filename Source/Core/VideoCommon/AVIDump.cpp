@@ -193,6 +193,11 @@ bool AVIDump::CreateVideoFile()
   s_codec_context->gop_size = 1;
   s_codec_context->pix_fmt = g_Config.bUseFFV1 ? AV_PIX_FMT_BGR0 : AV_PIX_FMT_YUV420P;
 
+  // Let the encoder spread work across cores; codecs pick frame or slice threading
+  // as supported. Without this the whole encode runs on the dump thread, and once the
+  // GPU thread is a frame ahead it ends up waiting for it in FinishFrameData().
+  s_codec_context->thread_count = 0;
+
   if (output_format->flags & AVFMT_GLOBALHEADER)
     s_codec_context->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
 
@@ -368,11 +373,19 @@ static void HandleDelayedPackets()
 {
   AVPacket pkt;
 
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57, 37, 100)
+  // Signal end-of-stream so frames still buffered by threaded encoders are flushed.
+  // The old API flushes implicitly when encoding with a null frame in ReceivePacket.
+  avcodec_send_frame(s_codec_context, nullptr);
+#endif
+
   while (true)
   {
     PreparePacket(&pkt);
     int got_packet;
     int error = ReceivePacket(s_codec_context, &pkt, &got_packet);
+    if (error == AVERROR_EOF)
+      break;
     if (error)
     {
       ERROR_LOG(VIDEO, "Error while stopping video: %d", error);
@@ -2,9 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
-#include <mutex>
-
 #include "VideoCommon/AsyncRequests.h"
+#include "VideoCommon/BoundingBox.h"
 #include "VideoCommon/Fifo.h"
 #include "VideoCommon/RenderBase.h"
 #include "VideoCommon/Statistics.h"
@@ -22,92 +21,114 @@ void AsyncRequests::PullEventsInternal()
   // So just flush the pipeline to get accurate results.
   g_vertex_manager->Flush();
 
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_empty.Set();
-
-  while (!m_queue.empty())
+  Event events[DRAIN_BATCH_SIZE];
+  size_t count;
+  while ((count = m_queue.PopMultiple(events, DRAIN_BATCH_SIZE)) != 0)
   {
-    Event e = m_queue.front();
-
-    // try to merge as many efb pokes as possible
-    // it's a bit hacky, but some games render a complete frame in this way
-    if ((e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z))
+    size_t i = 0;
+    while (i < count)
     {
-      m_merged_efb_pokes.clear();
-      Event first_event = m_queue.front();
-      const auto t = first_event.type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor :
-                                                                 EFBAccessType::PokeZ;
+      const Event& e = events[i];
 
-      do
+      // try to merge as many efb pokes as possible
+      // it's a bit hacky, but some games render a complete frame in this way
+      if (e.type == Event::EFB_POKE_COLOR || e.type == Event::EFB_POKE_Z)
       {
-        e = m_queue.front();
-
-        EfbPokeData d;
-        d.data = e.efb_poke.data;
-        d.x = e.efb_poke.x;
-        d.y = e.efb_poke.y;
-        m_merged_efb_pokes.push_back(d);
-
-        m_queue.pop();
-      } while (!m_queue.empty() && m_queue.front().type == first_event.type);
-
-      lock.unlock();
-      g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
-      lock.lock();
-      continue;
+        const auto t =
+            e.type == Event::EFB_POKE_COLOR ? EFBAccessType::PokeColor : EFBAccessType::PokeZ;
+
+        m_merged_efb_pokes.clear();
+        do
+        {
+          EfbPokeData d;
+          d.data = events[i].efb_poke.data;
+          d.x = events[i].efb_poke.x;
+          d.y = events[i].efb_poke.y;
+          m_merged_efb_pokes.push_back(d);
+          i++;
+        } while (i < count && events[i].type == e.type);
+
+        g_renderer->PokeEFB(t, m_merged_efb_pokes.data(), m_merged_efb_pokes.size());
+        continue;
+      }
+
+      HandleEvent(e);
+      i++;
     }
-
-    lock.unlock();
-    HandleEvent(e);
-    lock.lock();
-
-    m_queue.pop();
   }
 
-  if (m_wake_me_up_again)
-  {
-    m_wake_me_up_again = false;
-    m_cond.notify_all();
-  }
+  if (m_waiting.TestAndClear())
+    m_drained.Set();
 }
 
 void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-
-  if (m_passthrough)
+  if (m_passthrough.IsSet())
   {
     HandleEvent(event);
     return;
   }
 
-  m_empty.Clear();
-  m_wake_me_up_again |= blocking;
-
-  if (!m_enable)
+  if (!m_enable.IsSet())
     return;
 
-  m_queue.push(event);
+  while (!m_queue.Push(event))
+  {
+    // The ring is full, so the GPU thread is far behind. Wait for it to drain
+    // before trying again; this also provides the necessary backpressure.
+    // The flag has to be armed before the push is retried: the GPU thread's
+    // only signal point is right after a drain, so if it drained between the
+    // failed push and the Set, the signal has already passed and waiting
+    // would deadlock. Retrying after arming catches exactly that window.
+    m_waiting.Set();
+    if (m_queue.Push(event))
+    {
+      m_waiting.Clear();
+      break;
+    }
+    Fifo::RunGpu();
+    m_drained.WaitWithSpin();
+
+    if (!m_enable.IsSet())
+      return;
+  }
 
   Fifo::RunGpu();
   if (blocking)
   {
-    m_cond.wait(lock, [this] { return m_queue.empty(); });
+    // m_waiting has to be re-armed on every iteration: the GPU thread clears
+    // it whenever it signals a drain, even one that raced with our push. As
+    // above, it also has to be armed before the queue is checked, and a
+    // drain that raced with the Set means there is nothing left to wait for.
+    while (m_enable.IsSet())
+    {
+      m_waiting.Set();
+      if (m_queue.Empty())
+      {
+        m_waiting.Clear();
+        break;
+      }
+      Fifo::RunGpu();
+      m_drained.WaitWithSpin();
+    }
   }
 }
 
 void AsyncRequests::SetEnable(bool enable)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_enable = enable;
+  m_enable.Set(enable);
 
   if (!enable)
   {
     // flush the queue on disabling
-    while (!m_queue.empty())
-      m_queue.pop();
-    if (m_wake_me_up_again)
-      m_cond.notify_all();
+    Event events[DRAIN_BATCH_SIZE];
+    while (m_queue.PopMultiple(events, DRAIN_BATCH_SIZE) != 0)
+    {
+    }
+
+    // Release a possibly blocked pusher; its wait predicate checks m_enable.
+    m_waiting.TestAndClear();
+    m_drained.Set();
   }
 }
 
@@ -149,7 +170,7 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
     break;
 
   case Event::BBOX_READ:
-    *e.bbox.data = g_renderer->BBoxRead(e.bbox.index);
+    *e.bbox.data = BoundingBox::Get(e.bbox.index);
     break;
 
   case Event::PERF_QUERY:
@@ -160,6 +181,5 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 
 void AsyncRequests::SetPassthrough(bool enable)
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
-  m_passthrough = enable;
+  m_passthrough.Set(enable);
 }
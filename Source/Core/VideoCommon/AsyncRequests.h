@@ -4,13 +4,12 @@
 
 #pragma once
 
-#include <condition_variable>
-#include <mutex>
-#include <queue>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Event.h"
 #include "Common/Flag.h"
+#include "Common/SPSCQueue.h"
 
 struct EfbPokeData;
 
@@ -71,7 +70,7 @@ public:
 
   void PullEvents()
   {
-    if (!m_empty.IsSet())
+    if (!m_queue.Empty())
       PullEventsInternal();
   }
   void PushEvent(const Event& event, bool blocking = false);
@@ -81,19 +80,28 @@ public:
   static AsyncRequests* GetInstance() { return &s_singleton; }
 
 private:
+  // Big enough that titles doing full-frame CPU EFB pokes don't hit the
+  // producer-side backpressure path during normal operation.
+  static constexpr size_t QUEUE_CAPACITY = 8192;
+  // How many events the GPU thread pops per drain iteration.
+  static constexpr size_t DRAIN_BATCH_SIZE = 128;
+
   void PullEventsInternal();
   void HandleEvent(const Event& e);
 
   static AsyncRequests s_singleton;
 
-  Common::Flag m_empty;
-  std::queue<Event> m_queue;
-  std::mutex m_mutex;
-  std::condition_variable m_cond;
+  // All pushes happen on the CPU thread and all pops on the GPU thread, so a
+  // single producer, single consumer ring replaces the old mutex+condvar
+  // queue without any locks on either side.
+  Common::SPSCRingQueue<Event, QUEUE_CAPACITY> m_queue;
+
+  // Set by the GPU thread after draining the queue while m_waiting is set.
+  Common::Event m_drained;
+  Common::Flag m_waiting;
 
-  bool m_wake_me_up_again = false;
-  bool m_enable = false;
-  bool m_passthrough = true;
+  Common::Flag m_enable;
+  Common::Flag m_passthrough{true};
 
   std::vector<EfbPokeData> m_merged_efb_pokes;
 };
@@ -36,6 +36,26 @@ void AsyncShaderCompiler::QueueWorkItem(WorkItemPtr item, u32 priority)
   }
 }
 
+bool AsyncShaderCompiler::RaiseWorkItemPriority(const WorkItem* item, u32 priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  for (auto iter = m_pending_work.begin(); iter != m_pending_work.end(); ++iter)
+  {
+    if (iter->second.get() != item)
+      continue;
+
+    if (priority < iter->first)
+    {
+      WorkItemPtr ptr = std::move(iter->second);
+      m_pending_work.erase(iter);
+      m_pending_work.emplace(priority, std::move(ptr));
+    }
+    return true;
+  }
+
+  return false;
+}
+
 void AsyncShaderCompiler::RetrieveWorkItems()
 {
   std::deque<WorkItemPtr> completed_work;
@@ -57,6 +77,14 @@ bool AsyncShaderCompiler::HasPendingWork()
   return !m_pending_work.empty() || m_busy_workers.load() != 0;
 }
 
+void AsyncShaderCompiler::ClearPendingWorkItems()
+{
+  // The dropped work items are expected to clean up after themselves when destroyed, the same
+  // as any work which is still pending at shutdown.
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  m_pending_work.clear();
+}
+
 bool AsyncShaderCompiler::HasCompletedWork()
 {
   std::lock_guard<std::mutex> guard(m_completed_work_lock);
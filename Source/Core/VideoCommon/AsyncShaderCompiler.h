@@ -46,10 +46,21 @@ public:
   // Queues a new work item to the compiler threads. The lower the priority, the sooner
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
+
+  // Moves an already-queued work item to a new priority. Does nothing when
+  // the new priority is not sooner (lower) than the current one. Returns
+  // false if the item is no longer pending, i.e. a worker thread has already
+  // picked it up; the caller should stop referring to it in that case.
+  bool RaiseWorkItemPriority(const WorkItem* item, u32 priority);
+
   void RetrieveWorkItems();
   bool HasPendingWork();
   bool HasCompletedWork();
 
+  // Drops any work items which have not yet begun compiling. Items currently being compiled
+  // by a worker thread are unaffected, and will still end up in the completed queue.
+  void ClearPendingWorkItems();
+
   // Simpler version without progress updates.
   void WaitUntilCompletion();
 
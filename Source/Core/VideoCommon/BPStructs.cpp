@@ -426,6 +426,7 @@ static void BPWritten(const BPCmd& bp)
 
     if (g_ActiveConfig.backend_info.bSupportsBBox && g_ActiveConfig.bBBoxEnable)
     {
+      BoundingBox::Invalidate();
       g_renderer->BBoxWrite(offset, bp.newvalue & 0x3ff);
       g_renderer->BBoxWrite(offset + 1, bp.newvalue >> 10);
     }
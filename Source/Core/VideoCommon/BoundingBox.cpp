@@ -5,6 +5,7 @@
 #include "VideoCommon/BoundingBox.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "VideoCommon/RenderBase.h"
 
 namespace BoundingBox
 {
@@ -12,11 +13,35 @@ namespace BoundingBox
 bool active = false;
 u16 coords[4] = {0x80, 0xA0, 0x80, 0xA0};
 
+// Readback cache, owned by the video thread.
+static bool s_cache_valid = false;
+static u16 s_cache[4];
+
+u16 Get(int index)
+{
+  if (!s_cache_valid)
+  {
+    for (int i = 0; i < 4; i++)
+      s_cache[i] = g_renderer->BBoxRead(i);
+    s_cache_valid = true;
+  }
+
+  return s_cache[index];
+}
+
+void Invalidate()
+{
+  s_cache_valid = false;
+}
+
 // Save state
 void DoState(PointerWrap& p)
 {
   p.Do(active);
   p.Do(coords);
+
+  // The GPU-side box may differ after loading, so drop the cached values.
+  s_cache_valid = false;
 }
 
 }  // namespace BoundingBox
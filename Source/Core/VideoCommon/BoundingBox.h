@@ -25,6 +25,15 @@ enum
   BOTTOM = 3
 };
 
+// Reads a coordinate from the backend, caching all four values until the next draw or guest
+// write can change them. The guest reads the four PE registers in succession, and every
+// uncached read costs a full GPU synchronization, so this turns four syncs per query into one.
+// Must only be called from the video thread, with bounding box support enabled.
+u16 Get(int index);
+
+// Invalidates the cached coordinates. Called when a draw or a guest write may move the box.
+void Invalidate();
+
 // Save state
 void DoState(PointerWrap& p);
 
@@ -12,6 +12,7 @@
 #include "Common/BlockingLoop.h"
 #include "Common/ChunkFile.h"
 #include "Common/Event.h"
+#include "Common/EventTracer.h"
 #include "Common/FPURoundMode.h"
 #include "Common/MemoryUtil.h"
 #include "Common/MsgHandler.h"
@@ -222,9 +223,8 @@ void* PopFifoAuxBuffer(size_t size)
 }
 
 // Description: RunGpuLoop() sends data through this function.
-static void ReadDataFromFifo(u32 readPtr)
+static void ReadDataFromFifo(u32 readPtr, size_t len)
 {
-  size_t len = 32;
   if (len > (size_t)(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
   {
     size_t existing_len = s_video_buffer_write_ptr - s_video_buffer_read_ptr;
@@ -292,6 +292,8 @@ void ResetVideoBuffer()
 // Purpose: Keep the Core HW updated about the CPU-GPU distance
 void RunGpuLoop()
 {
+  TRACE_EVENT_THREAD("GPU");
+
   AsyncRequests::GetInstance()->SetEnable(true);
   AsyncRequests::GetInstance()->SetPassthrough(false);
 
@@ -313,9 +315,15 @@ void RunGpuLoop()
           // See comment in SyncGPU
           if (write_ptr > seen_ptr)
           {
+            TRACE_EVENT_ZONE("Fifo::RunGpu");
             s_video_buffer_read_ptr =
                 OpcodeDecoder::Run(DataReader(s_video_buffer_read_ptr, write_ptr), nullptr, false);
             s_video_buffer_seen_ptr = write_ptr;
+
+            // In lockstep mode the CPU thread may be blocked on our decode
+            // lag; tell it to re-check.
+            if (param.bSyncGPU)
+              s_sync_wakeup_event.Set();
           }
         }
         else
@@ -333,26 +341,47 @@ void RunGpuLoop()
             if (param.bSyncGPU && s_sync_ticks.load() < param.iSyncGpuMinDistance)
               break;
 
+            TRACE_EVENT_ZONE("Fifo::RunGpu");
+
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer;
-            ReadDataFromFifo(readPtr);
 
-            if (readPtr == fifo.CPEnd)
+            // Run several 32 byte blocks through the opcode decoder per
+            // iteration. The per-block bookkeeping (CP status updates, async
+            // requests, atomics) costs more than decoding the block itself on
+            // draw-heavy streams, and a draw command larger than one block
+            // would otherwise be rescanned once per block until its payload
+            // has fully arrived.
+            u32 blocks = std::min(fifo.CPReadWriteDistance / 32, 16u);
+            // Stay contiguous in guest memory: the read pointer wraps after
+            // the block at CPEnd.
+            if (readPtr <= fifo.CPEnd)
+              blocks = std::min(blocks, (fifo.CPEnd - readPtr) / 32 + 1);
+            // Never read past the FIFO breakpoint; the loop condition stops
+            // us once the read pointer reaches it.
+            if (fifo.bFF_BPEnable && fifo.CPBreakpoint > readPtr &&
+                (fifo.CPBreakpoint - readPtr) / 32 < blocks)
+              blocks = (fifo.CPBreakpoint - readPtr) / 32;
+
+            const u32 len = blocks * 32;
+            ReadDataFromFifo(readPtr, len);
+
+            if (readPtr + len - 32 == fifo.CPEnd)
               readPtr = fifo.CPBase;
             else
-              readPtr += 32;
+              readPtr += len;
 
-            ASSERT_MSG(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - 32 >= 0,
+            ASSERT_MSG(COMMANDPROCESSOR, (s32)fifo.CPReadWriteDistance - (s32)len >= 0,
                        "Negative fifo.CPReadWriteDistance = %i in FIFO Loop !\nThat can produce "
                        "instability in the game. Please report it.",
-                       fifo.CPReadWriteDistance - 32);
+                       fifo.CPReadWriteDistance - len);
 
             u8* write_ptr = s_video_buffer_write_ptr;
             s_video_buffer_read_ptr = OpcodeDecoder::Run(
                 DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted, false);
 
             Common::AtomicStore(fifo.CPReadPointer, readPtr);
-            Common::AtomicAdd(fifo.CPReadWriteDistance, static_cast<u32>(-32));
+            Common::AtomicAdd(fifo.CPReadWriteDistance, static_cast<u32>(-len));
             if ((write_ptr - s_video_buffer_read_ptr) == 0)
               Common::AtomicStore(fifo.SafeCPReadPointer, fifo.CPReadPointer);
 
@@ -457,7 +486,7 @@ static int RunGpuOnCpu(int ticks)
         FPURoundMode::LoadDefaultSIMDState();
         reset_simd_state = true;
       }
-      ReadDataFromFifo(fifo.CPReadPointer);
+      ReadDataFromFifo(fifo.CPReadPointer, 32);
       u32 cycles = 0;
       s_video_buffer_read_ptr = OpcodeDecoder::Run(
           DataReader(s_video_buffer_read_ptr, s_video_buffer_write_ptr), &cycles, false);
@@ -560,16 +589,34 @@ static int WaitForGpuThread(int ticks)
   return GPU_TIME_SLOT_SIZE;
 }
 
+// The lockstep variant for the deterministic GPU thread: all emulated state
+// is advanced on the CPU thread at these fixed event boundaries already, so
+// blocking here cannot change emulation - it only bounds how many copied FIFO
+// bytes the decode worker may still be behind, keeping frame output in step
+// with the CPU within a configurable window.
+static void WaitForDeterministicGpuThread()
+{
+  const ptrdiff_t max_lag = SConfig::GetInstance().iSyncGpuLockstepDistance;
+  while (s_gpu_mainloop.IsRunning() &&
+         s_video_buffer_write_ptr.load() - s_video_buffer_seen_ptr.load() > max_lag)
+  {
+    s_sync_wakeup_event.Wait();
+  }
+}
+
 static void SyncGPUCallback(u64 ticks, s64 cyclesLate)
 {
+  const SConfig& param = SConfig::GetInstance();
   ticks += cyclesLate;
   int next = -1;
 
-  if (!SConfig::GetInstance().bCPUThread || s_use_deterministic_gpu_thread)
+  if (!param.bCPUThread || s_use_deterministic_gpu_thread)
   {
     next = RunGpuOnCpu((int)ticks);
+    if (param.bCPUThread && s_use_deterministic_gpu_thread && param.bSyncGPU)
+      WaitForDeterministicGpuThread();
   }
-  else if (SConfig::GetInstance().bSyncGPU)
+  else if (param.bSyncGPU)
   {
     next = WaitForGpuThread((int)ticks);
   }
@@ -374,6 +374,8 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
     PopulateEFBCache(false, tile_index);
 
+  m_efb_color_cache.accessed_this_frame = true;
+
   u32 value;
   m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
   return value;
@@ -389,6 +391,8 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
     PopulateEFBCache(true, tile_index);
 
+  m_efb_depth_cache.accessed_this_frame = true;
+
   float value;
   m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
   return value;
@@ -437,6 +441,39 @@ void FramebufferManager::FlagPeekCacheAsOutOfDate()
     InvalidatePeekCache();
 }
 
+void FramebufferManager::RefreshPeekCache()
+{
+  // If a game reads back EFB values every frame, repopulate any tiles it read at the end of the
+  // frame, instead of stalling mid-frame the next time they are peeked. The copies are issued
+  // without waiting for them; by the time the values are peeked next frame, the GPU will have
+  // finished, and the flush in ReadTexel() completes without blocking. This makes the peek
+  // results up to a frame stale, which is already the case with deferred invalidation.
+  if (!g_ActiveConfig.bEFBAccessDeferInvalidation)
+    return;
+
+  for (bool depth : {false, true})
+  {
+    EFBCacheData& data = depth ? m_efb_depth_cache : m_efb_color_cache;
+    const bool accessed = data.accessed_this_frame;
+    data.accessed_this_frame = false;
+    if (!accessed || !data.valid || !data.out_of_date)
+      continue;
+
+    if (IsUsingTiledEFBCache())
+    {
+      for (u32 i = 0; i < static_cast<u32>(data.tiles.size()); i++)
+      {
+        if (data.tiles[i])
+          PopulateEFBCache(depth, i, true);
+      }
+    }
+    else
+    {
+      PopulateEFBCache(depth, 0, true);
+    }
+  }
+}
+
 bool FramebufferManager::CompileReadbackPipelines()
 {
   AbstractPipelineConfig config = {};
@@ -548,7 +585,7 @@ void FramebufferManager::DestroyReadbackFramebuffer()
   DestroyCache(m_efb_depth_cache);
 }
 
-void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
+void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool async)
 {
   g_vertex_manager->OnCPUEFBAccess();
 
@@ -601,8 +638,10 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
     data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
 
-  // Wait until the copy is complete.
-  data.readback_texture->Flush();
+  // Wait until the copy is complete. When populating asynchronously, the flush is deferred
+  // until the texel data is first read, by which point the copy has likely completed anyway.
+  if (!async)
+    data.readback_texture->Flush();
   data.valid = true;
   data.out_of_date = false;
   if (IsUsingTiledEFBCache())
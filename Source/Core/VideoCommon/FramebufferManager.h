@@ -90,6 +90,11 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void FlagPeekCacheAsOutOfDate();
 
+  // Repopulates out-of-date peek cache tiles which were accessed this frame, so that the next
+  // frame's peeks do not stall mid-frame. Only does anything with deferred EFB cache invalidation
+  // enabled, as the refreshed values are up to a frame stale. Called at the end of a frame.
+  void RefreshPeekCache();
+
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
   void PokeEFBColor(u32 x, u32 y, u32 color);
   void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -114,6 +119,7 @@ protected:
     std::vector<bool> tiles;
     bool out_of_date;
     bool valid;
+    bool accessed_this_frame;
   };
 
   bool CreateEFBFramebuffer();
@@ -137,7 +143,7 @@ protected:
   bool IsUsingTiledEFBCache() const;
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
-  void PopulateEFBCache(bool depth, u32 tile_index);
+  void PopulateEFBCache(bool depth, u32 tile_index, bool async = false);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -5,6 +5,7 @@
 #include "VideoCommon/HiresTextures.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
 #include <cstring>
 #include <memory>
@@ -134,19 +135,41 @@ void HiresTexture::Prefetch()
 {
   Common::SetCurrentThreadName("Prefetcher");
 
-  size_t size_sum = 0;
   size_t sys_mem = Common::MemPhysical();
   size_t recommended_min_mem = 2 * size_t(1024 * 1024 * 1024);
   // keep 2GB memory for system stability if system RAM is 4GB+ - use half of memory in other cases
   size_t max_mem =
       (sys_mem / 2 < recommended_min_mem) ? (sys_mem / 2) : (sys_mem - recommended_min_mem);
   u32 starttime = Common::Timer::GetTimeMs();
+
+  // Gather the base textures up front, so the loads can be divided between workers.
+  std::vector<const std::string*> base_filenames;
+  base_filenames.reserve(s_textureMap.size());
   for (const auto& entry : s_textureMap)
   {
-    const std::string& base_filename = entry.first;
+    if (entry.first.find("_mip") == std::string::npos)
+      base_filenames.push_back(&entry.first);
+  }
 
-    if (base_filename.find("_mip") == std::string::npos)
+  // Image decoding is CPU-bound, so loading with multiple workers cuts the prefetch time on
+  // large packs nearly linearly. Leave a couple of cores for the emulator itself.
+  const u32 cpu_count = std::thread::hardware_concurrency();
+  const u32 worker_count = cpu_count > 2 ? cpu_count - 2 : 1;
+  std::atomic<size_t> next_index{0};
+  std::atomic<size_t> size_sum{0};
+  std::atomic<bool> out_of_memory{false};
+
+  const auto worker = [&]() {
+    for (;;)
     {
+      if (s_textureCacheAbortLoading.IsSet() || out_of_memory.load())
+        return;
+
+      const size_t index = next_index.fetch_add(1);
+      if (index >= base_filenames.size())
+        return;
+
+      const std::string& base_filename = *base_filenames[index];
       std::unique_lock<std::mutex> lk(s_textureCacheMutex);
 
       auto iter = s_textureCache.find(base_filename);
@@ -165,31 +188,45 @@ void HiresTexture::Prefetch()
       }
       if (iter != s_textureCache.end())
       {
+        size_t texture_size = 0;
         for (const Level& l : iter->second->m_levels)
-          size_sum += l.data.size();
+          texture_size += l.data.size();
+
+        if (size_sum.fetch_add(texture_size) + texture_size > max_mem)
+          out_of_memory.store(true);
       }
     }
+  };
+
+  std::vector<std::thread> workers;
+  for (u32 i = 0; i + 1 < worker_count; i++)
+    workers.emplace_back([&worker]() {
+      Common::SetCurrentThreadName("Prefetcher");
+      worker();
+    });
+  worker();
+  for (std::thread& thread : workers)
+    thread.join();
+
+  if (s_textureCacheAbortLoading.IsSet())
+    return;
 
-    if (s_textureCacheAbortLoading.IsSet())
-    {
-      return;
-    }
+  if (out_of_memory.load())
+  {
+    Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
 
-    if (size_sum > max_mem)
-    {
-      Config::SetCurrent(Config::GFX_HIRES_TEXTURES, false);
-
-      OSD::AddMessage(
-          StringFromFormat(
-              "Custom Textures prefetching after %.1f MB aborted, not enough RAM available",
-              size_sum / (1024.0 * 1024.0)),
-          10000);
-      return;
-    }
+    OSD::AddMessage(
+        StringFromFormat(
+            "Custom Textures prefetching after %.1f MB aborted, not enough RAM available",
+            size_sum.load() / (1024.0 * 1024.0)),
+        10000);
+    return;
   }
+
   u32 stoptime = Common::Timer::GetTimeMs();
   OSD::AddMessage(StringFromFormat("Custom Textures loaded, %.1f MB in %.1f s",
-                                   size_sum / (1024.0 * 1024.0), (stoptime - starttime) / 1000.0),
+                                   size_sum.load() / (1024.0 * 1024.0),
+                                   (stoptime - starttime) / 1000.0),
                   10000);
 }
 
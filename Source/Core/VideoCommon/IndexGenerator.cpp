@@ -7,6 +7,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Compiler.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/OpcodeDecoding.h"
@@ -64,6 +65,27 @@ void IndexGenerator::AddExternalIndices(const u16* indices, u32 num_indices, u32
   base_index += num_vertices;
 }
 
+// Writes num_indices consecutive indices starting at index. This is the inner loop of points,
+// strips with primitive restart, and (with truncation) triangle lists without restart, so it is
+// worth vectorizing; SSE2 is part of the x64 baseline.
+static u16* WriteIncreasingIndices(u16* Iptr, u32 num_indices, u32 index)
+{
+  u32 i = 0;
+#if defined(_M_X86) || defined(_M_X86_64)
+  const __m128i eight = _mm_set1_epi16(8);
+  __m128i values = _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(index)),
+                                 _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7));
+  for (; i + 8 <= num_indices; i += 8)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(Iptr + i), values);
+    values = _mm_add_epi16(values, eight);
+  }
+#endif
+  for (; i < num_indices; ++i)
+    Iptr[i] = index + i;
+  return Iptr + num_indices;
+}
+
 // Triangles
 template <bool pr>
 DOLPHIN_FORCE_INLINE u16* IndexGenerator::WriteTriangle(u16* Iptr, u32 index1, u32 index2,
@@ -80,7 +102,30 @@ DOLPHIN_FORCE_INLINE u16* IndexGenerator::WriteTriangle(u16* Iptr, u32 index1, u
 template <bool pr>
 u16* IndexGenerator::AddList(u16* Iptr, u32 const numVerts, u32 index)
 {
-  for (u32 i = 2; i < numVerts; i += 3)
+  u32 i = 2;
+  if (!pr)
+  {
+    // Without primitive restart the output is simply 0,1,2,3,4,5,... truncated to whole
+    // triangles.
+    const u32 num_indices = numVerts - (numVerts % 3);
+    return WriteIncreasingIndices(Iptr, num_indices, index);
+  }
+#if defined(_M_X86) || defined(_M_X86_64)
+  // With primitive restart, two triangles produce eight indices: 0,1,2,R,3,4,5,R. ORing in the
+  // restart lanes after the add keeps them at 0xFFFF without a branch.
+  const __m128i offsets = _mm_setr_epi16(0, 1, 2, 0, 3, 4, 5, 0);
+  const __m128i restart_lanes = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+  const __m128i six = _mm_set1_epi16(6);
+  __m128i values =
+      _mm_or_si128(_mm_add_epi16(_mm_set1_epi16(static_cast<s16>(index)), offsets), restart_lanes);
+  for (; i + 4 <= numVerts; i += 6)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(Iptr), values);
+    values = _mm_or_si128(_mm_add_epi16(values, six), restart_lanes);
+    Iptr += 8;
+  }
+#endif
+  for (; i < numVerts; i += 3)
   {
     Iptr = WriteTriangle<pr>(Iptr, index + i - 2, index + i - 1, index + i);
   }
@@ -92,10 +137,7 @@ u16* IndexGenerator::AddStrip(u16* Iptr, u32 const numVerts, u32 index)
 {
   if (pr)
   {
-    for (u32 i = 0; i < numVerts; ++i)
-    {
-      *Iptr++ = index + i;
-    }
+    Iptr = WriteIncreasingIndices(Iptr, numVerts, index);
     *Iptr++ = s_primitive_restart;
   }
   else
@@ -244,11 +286,7 @@ u16* IndexGenerator::AddLineStrip(u16* Iptr, u32 numVerts, u32 index)
 // Points
 u16* IndexGenerator::AddPoints(u16* Iptr, u32 numVerts, u32 index)
 {
-  for (u32 i = 0; i != numVerts; ++i)
-  {
-    *Iptr++ = index + i;
-  }
-  return Iptr;
+  return WriteIncreasingIndices(Iptr, numVerts, index);
 }
 
 u32 IndexGenerator::GetRemainingIndices()
@@ -15,7 +15,12 @@
 // when they are called. The reason is that the vertex format affects the sizes of the vertices.
 
 #include "VideoCommon/OpcodeDecoding.h"
+
+#include <unordered_map>
+#include <vector>
+
 #include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/FifoPlayer/FifoRecorder.h"
@@ -36,6 +41,199 @@ namespace OpcodeDecoder
 {
 static bool s_bFifoErrorSeen = false;
 
+// Most titles call the same, unchanged display lists every frame. Lists which
+// only load state registers can be recorded once and replayed without going
+// through the decoder again; the content hash catches any modification. Lists
+// which draw primitives always decode, since their interpretation depends on
+// the current vertex formats and on the contents of the vertex arrays (see the
+// comment at the top of this file).
+struct CachedDisplayList
+{
+  struct Command
+  {
+    enum class Type : u8
+    {
+      CP,
+      XF,
+      IndexedXF,
+      BP,
+    };
+
+    Type type;
+    u8 cp_sub_cmd = 0;
+    u8 ref_array = 0;
+    u32 value = 0;  // CP/BP value, or the indexed-XF transfer word
+    u16 xf_address = 0;
+    std::vector<u8> xf_data;
+  };
+
+  u64 hash = 0;
+  u32 cycles = 0;
+  bool replayable = false;
+  std::vector<Command> commands;
+};
+
+static std::unordered_map<u64, CachedDisplayList> s_display_list_cache;
+
+// Games which generate display lists dynamically would otherwise grow the
+// cache without limit.
+constexpr size_t DL_CACHE_MAX_ENTRIES = 2048;
+
+static bool ScanDisplayList(DataReader src, CachedDisplayList* entry)
+{
+  u32 total_cycles = 0;
+  int refarray;
+  while (src.size())
+  {
+    const u8 cmd_byte = src.Read<u8>();
+    switch (cmd_byte)
+    {
+    case GX_NOP:
+    case GX_UNKNOWN_RESET:
+    case GX_CMD_UNKNOWN_METRICS:
+    case GX_CMD_INVL_VC:
+      total_cycles += 6;
+      break;
+
+    case GX_LOAD_CP_REG:
+    {
+      if (src.size() < 1 + 4)
+        return false;
+      total_cycles += 12;
+      CachedDisplayList::Command cmd;
+      cmd.type = CachedDisplayList::Command::Type::CP;
+      cmd.cp_sub_cmd = src.Read<u8>();
+      cmd.value = src.Read<u32>();
+      entry->commands.push_back(std::move(cmd));
+    }
+    break;
+
+    case GX_LOAD_XF_REG:
+    {
+      if (src.size() < 4)
+        return false;
+      const u32 cmd2 = src.Read<u32>();
+      const u32 transfer_size = ((cmd2 >> 16) & 15) + 1;
+      if (src.size() < transfer_size * sizeof(u32))
+        return false;
+      total_cycles += 18 + 6 * transfer_size;
+      CachedDisplayList::Command cmd;
+      cmd.type = CachedDisplayList::Command::Type::XF;
+      cmd.xf_address = cmd2 & 0xFFFF;
+      cmd.xf_data.assign(src.GetPointer(), src.GetPointer() + transfer_size * sizeof(u32));
+      src.Skip<u32>(transfer_size);
+      entry->commands.push_back(std::move(cmd));
+    }
+    break;
+
+    case GX_LOAD_INDX_A:  // used for position matrices
+      refarray = 0xC;
+      goto load_indx;
+    case GX_LOAD_INDX_B:  // used for normal matrices
+      refarray = 0xD;
+      goto load_indx;
+    case GX_LOAD_INDX_C:  // used for postmatrices
+      refarray = 0xE;
+      goto load_indx;
+    case GX_LOAD_INDX_D:  // used for lights
+      refarray = 0xF;
+      goto load_indx;
+    load_indx:
+    {
+      if (src.size() < 4)
+        return false;
+      total_cycles += 6;
+      // Indexed transfers read the XF array memory when executed, so replaying
+      // the command re-reads whatever the array holds at that time, exactly
+      // like decoding would.
+      CachedDisplayList::Command cmd;
+      cmd.type = CachedDisplayList::Command::Type::IndexedXF;
+      cmd.ref_array = static_cast<u8>(refarray);
+      cmd.value = src.Read<u32>();
+      entry->commands.push_back(std::move(cmd));
+    }
+    break;
+
+    case GX_LOAD_BP_REG:
+    {
+      if (src.size() < 4)
+        return false;
+      total_cycles += 12;
+      CachedDisplayList::Command cmd;
+      cmd.type = CachedDisplayList::Command::Type::BP;
+      cmd.value = src.Read<u32>();
+      entry->commands.push_back(std::move(cmd));
+    }
+    break;
+
+    default:
+      // Primitives, nested display lists and unknown opcodes are not
+      // replayable.
+      return false;
+    }
+  }
+
+  entry->cycles = total_cycles;
+  return true;
+}
+
+static u32 ReplayDisplayList(CachedDisplayList& entry)
+{
+  for (CachedDisplayList::Command& cmd : entry.commands)
+  {
+    switch (cmd.type)
+    {
+    case CachedDisplayList::Command::Type::CP:
+      LoadCPReg(cmd.cp_sub_cmd, cmd.value, false);
+      INCSTAT(stats.thisFrame.numCPLoads);
+      break;
+
+    case CachedDisplayList::Command::Type::XF:
+      LoadXFReg(static_cast<u32>(cmd.xf_data.size() / sizeof(u32)), cmd.xf_address,
+                DataReader(cmd.xf_data.data(), cmd.xf_data.data() + cmd.xf_data.size()));
+      INCSTAT(stats.thisFrame.numXFLoads);
+      break;
+
+    case CachedDisplayList::Command::Type::IndexedXF:
+      LoadIndexedXF(cmd.value, cmd.ref_array);
+      break;
+
+    case CachedDisplayList::Command::Type::BP:
+      LoadBPReg(cmd.value);
+      INCSTAT(stats.thisFrame.numBPLoads);
+      break;
+    }
+  }
+
+  return entry.cycles;
+}
+
+static CachedDisplayList* FindCachedDisplayList(u32 address, u32 size, u8* data)
+{
+  if (s_display_list_cache.size() >= DL_CACHE_MAX_ENTRIES)
+    s_display_list_cache.clear();
+
+  const u64 key = (static_cast<u64>(address) << 32) | size;
+  auto iter = s_display_list_cache.find(key);
+
+  // Geometry-heavy lists stay unreplayable whatever their content, so don't
+  // pay for hashing them on every call.
+  if (iter != s_display_list_cache.end() && !iter->second.replayable)
+    return nullptr;
+
+  const u64 hash = Common::GetHash64(data, size, 0);
+  if (iter != s_display_list_cache.end() && iter->second.hash == hash)
+    return &iter->second;
+
+  CachedDisplayList& entry = s_display_list_cache[key];
+  entry.hash = hash;
+  entry.commands.clear();
+  entry.replayable = ScanDisplayList(DataReader(data, data + size), &entry);
+  if (!entry.replayable)
+    entry.commands.clear();
+  return entry.replayable ? &entry : nullptr;
+}
+
 static u32 InterpretDisplayList(u32 address, u32 size)
 {
   u8* startAddress;
@@ -53,7 +251,14 @@ static u32 InterpretDisplayList(u32 address, u32 size)
     // temporarily swap dl and non-dl (small "hack" for the stats)
     Statistics::SwapDL();
 
-    Run(DataReader(startAddress, startAddress + size), &cycles, true);
+    // The FIFO recorder needs to see every command, so don't replay from the
+    // cache while recording.
+    CachedDisplayList* cached =
+        g_bRecordFifoData ? nullptr : FindCachedDisplayList(address, size, startAddress);
+    if (cached)
+      cycles = ReplayDisplayList(*cached);
+    else
+      Run(DataReader(startAddress, startAddress + size), &cycles, true);
     INCSTAT(stats.thisFrame.numDListsCalled);
 
     // un-swap
@@ -78,6 +283,7 @@ static void InterpretDisplayListPreprocess(u32 address, u32 size)
 void Init()
 {
   s_bFifoErrorSeen = false;
+  s_display_list_cache.clear();
 }
 
 template <bool is_preprocess>
@@ -110,6 +110,16 @@ static bool s_signal_finish_interrupt;
 
 static CoreTiming::EventType* et_SetTokenFinishOnMainThread;
 
+// How many emulated cycles a token may be deferred before its CoreTiming
+// event fires. Games using per-draw tokens post them in bursts while the GPU
+// thread catches up on the command stream; deferring the event lets a whole
+// burst collapse into a single CPU-thread synchronization, with the register
+// and the interrupt reflecting the last token of the burst - which is also
+// what happens today whenever tokens pile up behind a not-yet-fired event.
+// Kept well below a scanline so token latency stays invisible to games that
+// poll the register.
+static constexpr s64 TOKEN_DEFERRAL_CYCLES = 1500;
+
 enum
 {
   INT_CAUSE_PE_TOKEN = 0x200,   // GP Token
@@ -279,7 +289,7 @@ static void SetTokenFinish_OnMainThread(u64 userdata, s64 cyclesLate)
 // Raise the event handler above on the CPU thread.
 // s_token_finish_mutex must be locked.
 // THIS IS EXECUTED FROM VIDEO THREAD
-static void RaiseEvent()
+static void RaiseEvent(s64 cycles_into_future)
 {
   if (s_event_raised)
     return;
@@ -289,7 +299,7 @@ static void RaiseEvent()
   CoreTiming::FromThread from = CoreTiming::FromThread::NON_CPU;
   if (!SConfig::GetInstance().bCPUThread || Fifo::UseDeterministicGPUThread())
     from = CoreTiming::FromThread::CPU;
-  CoreTiming::ScheduleEvent(0, et_SetTokenFinishOnMainThread, 0, from);
+  CoreTiming::ScheduleEvent(cycles_into_future, et_SetTokenFinishOnMainThread, 0, from);
 }
 
 // SetToken
@@ -303,7 +313,7 @@ void SetToken(const u16 token, const bool interrupt)
   s_token_pending = token;
   s_token_interrupt_pending |= interrupt;
 
-  RaiseEvent();
+  RaiseEvent(TOKEN_DEFERRAL_CYCLES);
 }
 
 // SetFinish
@@ -316,7 +326,10 @@ void SetFinish()
 
   s_finish_interrupt_pending |= true;
 
-  RaiseEvent();
+  // Frame pacing hangs off the finish interrupt, so don't defer it. If a
+  // deferred token event is already in flight, the finish rides along with it
+  // and is late by at most the remainder of the token window.
+  RaiseEvent(0);
 }
 
 UPEAlphaReadReg GetAlphaReadMode()
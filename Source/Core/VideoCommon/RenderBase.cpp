@@ -563,6 +563,9 @@ bool Renderer::IsHeadless() const
 
 void Renderer::ChangeSurface(void* new_surface_handle)
 {
+  // The swap mutex keeps the handle publication ordered against the present
+  // in progress: the caller may tear the old native window down as soon as we
+  // return, so we must not return mid-present.
   std::lock_guard<std::mutex> lock(m_swap_mutex);
   m_new_surface_handle = new_surface_handle;
   m_surface_changed.Set();
@@ -570,7 +573,9 @@ void Renderer::ChangeSurface(void* new_surface_handle)
 
 void Renderer::ResizeSurface()
 {
-  std::lock_guard<std::mutex> lock(m_swap_mutex);
+  // Just an atomic flag - the backend re-queries the actual size at its own
+  // checkpoint. Deliberately lock-free so the UI thread never waits out a
+  // present (up to a full vsync) for something as frequent as a resize event.
   m_surface_resized.Set();
 }
 
@@ -1216,6 +1221,21 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
       // with the loader, and it has not been unmapped yet. Force a pipeline flush to avoid this.
       g_vertex_manager->Flush();
 
+      // While running unthrottled, nobody can see hundreds of presents per second, so clamp
+      // presentation to a preview rate and skip the backbuffer work for the rest. Skipped
+      // frames still do all per-frame bookkeeping below, so emulation, frame counting and
+      // determinism are unaffected. Frame dumping presents every frame.
+      bool present_frame = true;
+      if (!IsFrameDumping() &&
+          (SConfig::GetInstance().m_EmulationSpeed <= 0.0f || Core::GetIsThrottlerTempDisabled()))
+      {
+        constexpr u64 PREVIEW_FRAME_INTERVAL_US = 1000000 / 30;
+        const u64 now = Common::Timer::GetTimeUs();
+        present_frame = now - m_last_present_time >= PREVIEW_FRAME_INTERVAL_US;
+      }
+      if (present_frame)
+        m_last_present_time = Common::Timer::GetTimeUs();
+
       // Render any UI elements to the draw list.
       {
         auto lock = GetImGuiLock();
@@ -1227,7 +1247,7 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
 
       // Render the XFB to the screen.
       BeginUtilityDrawing();
-      if (!IsHeadless())
+      if (!IsHeadless() && present_frame)
       {
         BindBackbuffer({{0.0f, 0.0f, 0.0f, 1.0f}});
         UpdateDrawRectangle();
@@ -1273,6 +1293,10 @@ void Renderer::Swap(u32 xfbAddr, u32 fbWidth, u32 fbStride, u32 fbHeight, const
       // rate and not waiting for vblank. Otherwise, we'd end up with a huge list of pending copies.
       g_texture_cache->FlushEFBCopies();
 
+      // Kick off readbacks for any peek cache tiles the game accessed this frame, so that the
+      // next frame's EFB accesses do not stall on the GPU.
+      g_framebuffer_manager->RefreshPeekCache();
+
       // Remove stale EFB/XFB copies.
       g_texture_cache->Cleanup(m_frame_count);
 
@@ -358,6 +358,10 @@ private:
   u32 m_last_xfb_width = MAX_XFB_WIDTH;
   u32 m_last_xfb_height = MAX_XFB_HEIGHT;
 
+  // Time of the last backbuffer present, used to clamp presentation to a
+  // preview rate while running unthrottled.
+  u64 m_last_present_time = 0;
+
   // NOTE: The methods below are called on the framedumping thread.
   bool StartFrameDumpToAVI(const FrameDumpConfig& config);
   void DumpFrameToAVI(const FrameDumpConfig& config);
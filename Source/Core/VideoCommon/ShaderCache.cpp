@@ -5,6 +5,7 @@
 #include "VideoCommon/ShaderCache.h"
 
 #include "Common/Assert.h"
+#include "Common/CommonPaths.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Core/ConfigManager.h"
@@ -67,6 +68,10 @@ void ShaderCache::InitializeShaderCache()
 
 void ShaderCache::Reload()
 {
+  // Any queued-but-not-started work items would produce pipelines for the old configuration,
+  // which are invalidated below anyway, so drop them instead of waiting for them to compile.
+  // The UIDs remain in the map, and are re-queued by CompileMissingPipelines().
+  m_async_shader_compiler->ClearPendingWorkItems();
   WaitForAsyncCompiler();
   ClosePipelineUIDCache();
   InvalidateCachedPipelines();
@@ -124,8 +129,21 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
       return it->second.first.get();
-    else
-      return {};
+
+    // Still on the uber fallback. The more draws come back asking for this
+    // specialization, the sooner it should leave the compile queue, so bump
+    // its work item ahead of colder on-demand compiles.
+    auto use_it = m_gx_pipeline_use_counts.find(uid);
+    if (use_it != m_gx_pipeline_use_counts.end())
+    {
+      PendingPipelineUse& use = use_it->second;
+      use.use_count++;
+      const u32 boosted = COMPILE_PRIORITY_ONDEMAND_PIPELINE -
+                          std::min<u32>(use.use_count, COMPILE_PRIORITY_ONDEMAND_PIPELINE - 1);
+      if (!m_async_shader_compiler->RaiseWorkItemPriority(use.work_item, boosted))
+        m_gx_pipeline_use_counts.erase(use_it);
+    }
+    return {};
   }
 
   AppendGXPipelineUID(uid);
@@ -292,6 +310,7 @@ void ShaderCache::InvalidateCachedPipelines()
 
 void ShaderCache::ClearPipelineCaches()
 {
+  m_gx_pipeline_use_counts.clear();
   m_gx_pipeline_cache.clear();
   m_gx_uber_pipeline_cache.clear();
 }
@@ -546,6 +565,8 @@ ShaderCache::GetGXUberPipelineConfig(const GXUberPipelineUid& config)
 const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& config,
                                                       std::unique_ptr<AbstractPipeline> pipeline)
 {
+  m_gx_pipeline_use_counts.erase(config);
+
   auto& entry = m_gx_pipeline_cache[config];
   entry.second = false;
   if (!entry.first && pipeline)
@@ -566,10 +587,61 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   return entry.first.get();
 }
 
+constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
+constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
+void ShaderCache::LoadPipelineUIDManifest()
+{
+  // A read-only UID manifest can be shipped for a title in the Sys directory, containing the
+  // pipeline set the title is known to use. It uses the same format as the per-user UID cache,
+  // so one can be produced by copying a user's UID cache after a playthrough. Seeding the
+  // pipeline map with it means that even with a fresh user directory, every known pipeline is
+  // precompiled at boot instead of hitching on first use.
+  const std::string filename = File::GetSysDirectory() + PIPELINE_UID_CACHES_DIR DIR_SEP +
+                               SConfig::GetInstance().GetGameID() + ".uidcache";
+  File::IOFile file(filename, "rb");
+  if (!file)
+    return;
+
+  u32 magic;
+  u32 version;
+  if (!file.ReadBytes(&magic, sizeof(magic)) || !file.ReadBytes(&version, sizeof(version)) ||
+      magic != CACHE_FILE_MAGIC || version != GX_PIPELINE_UID_VERSION)
+  {
+    return;
+  }
+
+  // As below, reject the manifest outright if it has been truncated.
+  const u64 file_size = file.GetSize();
+  const size_t uid_count =
+      static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
+  if (file_size != uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE)
+  {
+    WARN_LOG(VIDEO, "Pipeline UID manifest %s is corrupted, ignoring.", filename.c_str());
+    return;
+  }
+
+  for (size_t i = 0; i < uid_count; i++)
+  {
+    SerializedGXPipelineUid serialized_uid;
+    if (!file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
+      break;
+
+    // This just adds the pipeline to the map, it is compiled later.
+    AddSerializedGXPipelineUID(serialized_uid);
+  }
+
+  INFO_LOG(VIDEO, "Read %u pipeline UIDs from manifest %s", static_cast<unsigned>(uid_count),
+           filename.c_str());
+}
+
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+  // Seed the pipeline map from the shipped manifest first, if one exists for this title. Doing
+  // this before opening the user's cache means a newly-created cache file starts out containing
+  // the manifest's UIDs as well.
+  LoadPipelineUIDManifest();
+
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
@@ -856,6 +928,11 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
         // Re-queue for next frame.
         auto wi = shader_cache->m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(
             shader_cache, uid, priority);
+        // Keep the usage tracking pointed at the live work item so further
+        // draws still boost it.
+        auto use_it = shader_cache->m_gx_pipeline_use_counts.find(uid);
+        if (use_it != shader_cache->m_gx_pipeline_use_counts.end())
+          use_it->second.work_item = wi.get();
         shader_cache->m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
       }
     }
@@ -870,6 +947,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
+  m_gx_pipeline_use_counts[uid] = {wi.get(), 0};
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
   m_gx_pipeline_cache[uid].second = true;
 }
@@ -1149,6 +1227,13 @@ const AbstractPipeline* ShaderCache::GetPaletteConversionPipeline(TLUTFormat for
 const AbstractShader* ShaderCache::GetTextureDecodingShader(TextureFormat format,
                                                             TLUTFormat palette_format)
 {
+  // The TLUT format is only embedded in the shader for paletted formats; normalize it
+  // so that e.g. I4 is not compiled and cached once per TLUT format that happens to be
+  // left in the pipeline registers.
+  const auto* info = TextureConversionShaderTiled::GetDecodingShaderInfo(format);
+  if (info && info->palette_size == 0)
+    palette_format = TLUTFormat::IA8;
+
   const auto key = std::make_pair(static_cast<u32>(format), static_cast<u32>(palette_format));
   auto iter = m_texture_decoding_shaders.find(key);
   if (iter != m_texture_decoding_shaders.end())
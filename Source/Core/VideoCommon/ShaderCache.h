@@ -113,6 +113,7 @@ private:
   void WaitForAsyncCompiler();
   void LoadShaderCaches();
   void ClearShaderCaches();
+  void LoadPipelineUIDManifest();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
   void CompileMissingPipelines();
@@ -214,6 +215,17 @@ private:
       m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
 
+  // Usage tracking for specialized pipelines still compiling in the
+  // background. Pipelines whose uber fallback keeps getting drawn are moved
+  // ahead in the compile queue. Entries disappear once the pipeline lands in
+  // m_gx_pipeline_cache or its work item has started compiling.
+  struct PendingPipelineUse
+  {
+    AsyncShaderCompiler::WorkItem* work_item;
+    u32 use_count;
+  };
+  std::map<GXPipelineUid, PendingPipelineUse> m_gx_pipeline_use_counts;
+
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
       m_efb_copy_to_vram_pipelines;
@@ -3,11 +3,13 @@
 // Refer to the license.txt file included.
 
 #include <cstring>
+#include <fstream>
 #include <string>
 #include <utility>
 
 #include "imgui.h"
 
+#include "Common/FileUtil.h"
 #include "Common/StringUtil.h"
 #include "VideoCommon/Statistics.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -15,8 +17,35 @@
 
 Statistics stats;
 
+static std::ofstream s_frame_stats_file;
+
+// Writes the per-frame counters out as one CSV row, so benchmark runs can be
+// correlated frame-by-frame with render_time.txt.
+static void LogFrameStatsToFile()
+{
+  if (!s_frame_stats_file.is_open())
+  {
+    File::OpenFStream(s_frame_stats_file, File::GetUserPath(D_LOGS_IDX) + "frame_stats.csv",
+                      std::ios_base::out);
+    s_frame_stats_file << "prims,dl_prims,draw_calls,shader_changes,vertex_bytes,index_bytes,"
+                          "uniform_bytes,efb_peeks,efb_pokes"
+                       << std::endl;
+  }
+
+  s_frame_stats_file << stats.thisFrame.numPrims << ',' << stats.thisFrame.numDLPrims << ','
+                     << stats.thisFrame.numDrawCalls << ',' << stats.thisFrame.numShaderChanges
+                     << ',' << stats.thisFrame.bytesVertexStreamed << ','
+                     << stats.thisFrame.bytesIndexStreamed << ','
+                     << stats.thisFrame.bytesUniformStreamed << ','
+                     << stats.thisFrame.numEFBPeeks << ',' << stats.thisFrame.numEFBPokes
+                     << std::endl;
+}
+
 void Statistics::ResetFrame()
 {
+  if (g_ActiveConfig.bLogRenderTimeToFile)
+    LogFrameStatsToFile();
+
   memset(&thisFrame, 0, sizeof(ThisFrame));
 }
 
@@ -88,6 +117,13 @@ void Statistics::Display()
   DRAW_STAT("EFB peeks:", "%d", stats.thisFrame.numEFBPeeks);
   DRAW_STAT("EFB pokes:", "%d", stats.thisFrame.numEFBPokes);
 
+  if (g_ActiveConfig.iNullCutoffStage != NullCutoffStage::Disabled)
+  {
+    DRAW_STAT("Null drops (decode)", "%d", stats.thisFrame.numNullDropsOpcodeDecode);
+    DRAW_STAT("Null drops (vtx load)", "%d", stats.thisFrame.numNullDropsVertexLoad);
+    DRAW_STAT("Null drops (tex dec)", "%d", stats.thisFrame.numNullDropsTextureDecode);
+  }
+
 #undef DRAW_STAT
 
   ImGui::Columns(1);
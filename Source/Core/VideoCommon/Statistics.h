@@ -64,6 +64,11 @@ struct Statistics
 
     int numEFBPeeks;
     int numEFBPokes;
+
+    // Batches dropped by the Null backend's instrumented stage cutoffs.
+    int numNullDropsOpcodeDecode;
+    int numNullDropsVertexLoad;
+    int numNullDropsTextureDecode;
   };
   ThisFrame thisFrame;
   void ResetFrame();
@@ -16,6 +16,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/EventTracer.h"
 #include "Common/FileUtil.h"
 #include "Common/Hash.h"
 #include "Common/Logging/Log.h"
@@ -51,6 +52,11 @@ static const u64 TEXHASH_INVALID = 0;
 static const int TEXTURE_KILL_THRESHOLD = 64;
 static const int TEXTURE_POOL_KILL_THRESHOLD = 3;
 
+// Scene changes evict whole working sets into the pool on the same frame, which would
+// otherwise reach the backend destructors in a single Cleanup() call and hitch.
+// Cap the number of pool textures destroyed per frame to spread the cost out.
+static const int TEXTURE_POOL_MAX_KILLS_PER_FRAME = 32;
+
 std::unique_ptr<TextureCacheBase> g_texture_cache;
 
 std::bitset<8> TextureCacheBase::valid_bind_points;
@@ -131,6 +137,7 @@ void TextureCacheBase::Invalidate()
   }
   textures_by_address.clear();
   textures_by_hash.clear();
+  textures_by_range.clear();
 
   texture_pool.clear();
 }
@@ -207,15 +214,18 @@ void TextureCacheBase::Cleanup(int _frameCount)
 
   TexPool::iterator iter2 = texture_pool.begin();
   TexPool::iterator tcend2 = texture_pool.end();
+  int pool_kills = 0;
   while (iter2 != tcend2)
   {
     if (iter2->second.frameCount == FRAMECOUNT_INVALID)
     {
       iter2->second.frameCount = _frameCount;
     }
-    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount)
+    if (_frameCount > TEXTURE_POOL_KILL_THRESHOLD + iter2->second.frameCount &&
+        pool_kills < TEXTURE_POOL_MAX_KILLS_PER_FRAME)
     {
       iter2 = texture_pool.erase(iter2);
+      pool_kills++;
     }
     else
     {
@@ -271,6 +281,7 @@ TextureCacheBase::ApplyPaletteToEntry(TCacheEntry* entry, u8* palette, TLUTForma
 
   ConvertTexture(decoded_entry, entry, palette, tlutfmt);
   textures_by_address.emplace(entry->addr, decoded_entry);
+  AddRangeIndexEntry(decoded_entry);
 
   return decoded_entry;
 }
@@ -322,15 +333,21 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
   // on each EFB copy.
   if (!entry_to_update->may_have_overlapping_textures)
     return entry_to_update;
-  entry_to_update->may_have_overlapping_textures = false;
 
   const bool isPaletteTexture = IsColorIndexed(entry_to_update->format.texfmt);
 
-  // EFB copies are excluded from these updates, until there's an example where a game would
-  // benefit from updating. This would require more work to be done.
-  if (entry_to_update->IsCopy())
+  // EFB copies can be patched in place like any other texture as long as they
+  // are laid out linearly in memory. This keeps render-to-texture targets
+  // (e.g. minimaps) alive when newer copies land inside them, instead of
+  // invalidating and re-decoding the whole texture from RAM. Strided and
+  // palette-indexed copies still take the old invalidation path, so leave
+  // their flag set.
+  if (entry_to_update->IsCopy() &&
+      (isPaletteTexture || entry_to_update->memory_stride != entry_to_update->BytesPerRow()))
     return entry_to_update;
 
+  entry_to_update->may_have_overlapping_textures = false;
+
   u32 block_width = TexDecoder_GetBlockWidthInTexels(entry_to_update->format.texfmt);
   u32 block_height = TexDecoder_GetBlockHeightInTexels(entry_to_update->format.texfmt);
   u32 block_size = block_width * block_height *
@@ -338,10 +355,12 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
 
   u32 numBlocksX = (entry_to_update->native_width + block_width - 1) / block_width;
 
-  auto iter = FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes);
-  while (iter.first != iter.second)
+  bool updated_entry = false;
+
+  for (TCacheEntry* overlapping_entry :
+       FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes))
   {
-    TCacheEntry* entry = iter.first->second;
+    TCacheEntry* entry = overlapping_entry;
     if (entry != entry_to_update && entry->IsCopy() && !entry->tmem_only &&
         entry->references.count(entry_to_update) == 0 &&
         entry->OverlapsMemoryRange(entry_to_update->addr, entry_to_update->size_in_bytes) &&
@@ -363,7 +382,6 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
           }
           else
           {
-            ++iter.first;
             continue;
           }
         }
@@ -401,7 +419,6 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
             static_cast<u32>(dst_x) >= entry_to_update->native_width ||
             static_cast<u32>(dst_y) >= entry_to_update->native_height)
         {
-          ++iter.first;
           continue;
         }
 
@@ -446,12 +463,13 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
           entry_to_update->texture->CopyRectangleFromTexture(entry->texture.get(), srcrect, layer,
                                                              0, dstrect, layer, 0);
         }
+        updated_entry = true;
 
         if (isPaletteTexture)
         {
           // Remove the temporary converted texture, it won't be used anywhere else
           // TODO: It would be nice to convert and copy in one step, but this code path isn't common
-          iter.first = InvalidateTexture(iter.first);
+          InvalidateTexture(overlapping_entry);
           continue;
         }
         else
@@ -465,12 +483,21 @@ TextureCacheBase::DoPartialTextureUpdates(TCacheEntry* entry_to_update, u8* pale
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
+        InvalidateTexture(overlapping_entry);
         continue;
       }
     }
-    ++iter.first;
   }
+
+  // The patched region of an EFB copy now also reflects what the overlapping
+  // copies wrote to memory, so recompute the hash — otherwise the next lookup
+  // would see a mismatch and throw the whole copy away.
+  if (entry_to_update->IsCopy() && updated_entry)
+  {
+    const u64 new_hash = entry_to_update->CalculateHash();
+    entry_to_update->SetHashes(new_hash, new_hash);
+  }
+
   return entry_to_update;
 }
 
@@ -733,6 +760,8 @@ TextureCacheBase::TCacheEntry* TextureCacheBase::Load(const u32 stage)
     return bound_textures[stage];
   }
 
+  TRACE_EVENT_ZONE("TextureCache::Load");
+
   const FourTexUnits& tex = bpmem.tex[stage >> 2];
   const u32 id = stage & 3;
   const u32 address = (tex.texImage3[id].image_base /* & 0x1FFFFF*/) << 5;
@@ -910,6 +939,15 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
     // game freezes the image and fades it out to black on screen transitions, which fades
     // out a purple screen in XFB2Tex. Check for this here and convert them if necessary.
 
+    // An EFB copy which was partly overwritten by a newer copy can usually be
+    // patched on the GPU instead of being thrown away and re-decoded from RAM.
+    if (entry->IsEfbCopy() && entry->may_have_overlapping_textures &&
+        entry->native_width == nativeW && entry->native_height == nativeH &&
+        entry->memory_stride == entry->BytesPerRow())
+    {
+      entry = DoPartialTextureUpdates(iter->second, &texMem[tlutaddr], tlutfmt);
+    }
+
     // Do not load strided EFB copies, they are not meant to be used directly.
     // Also do not directly load EFB copies, which were partly overwritten.
     if (entry->IsEfbCopy() && entry->native_width == nativeW && entry->native_height == nativeH &&
@@ -1126,6 +1164,7 @@ TextureCacheBase::GetTexture(u32 address, u32 width, u32 height, const TextureFo
   entry->is_custom_tex = hires_tex != nullptr;
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
+  AddRangeIndexEntry(entry);
 
   std::string basename = "";
   if (g_ActiveConfig.bDumpTextures && !hires_tex)
@@ -1385,10 +1424,8 @@ TextureCacheBase::GetTextureFromOverlappingTextures(const TextureLookupInformati
   // instead, which would reduce the amount of copying work here.
   std::vector<TCacheEntry*> candidates;
 
-  auto iter = FindOverlappingTextures(tex_info.address, tex_info.total_bytes);
-  while (iter.first != iter.second)
+  for (TCacheEntry* entry : FindOverlappingTextures(tex_info.address, tex_info.total_bytes))
   {
-    TCacheEntry* entry = iter.first->second;
     if (entry->IsCopy() && !entry->tmem_only &&
         entry->OverlapsMemoryRange(tex_info.address, tex_info.total_bytes) &&
         entry->memory_stride == stitched_entry->memory_stride)
@@ -1400,11 +1437,9 @@ TextureCacheBase::GetTextureFromOverlappingTextures(const TextureLookupInformati
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
-        continue;
+        InvalidateTexture(entry);
       }
     }
-    ++iter.first;
   }
 
   std::sort(candidates.begin(), candidates.end(),
@@ -1563,6 +1598,7 @@ TextureCacheBase::CreateNormalTexture(const TextureLookupInformation& tex_info,
   entry->is_custom_tex = false;
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
+  AddRangeIndexEntry(entry);
 
   INCSTAT(stats.numTexturesUploaded);
   SETSTAT(stats.numTexturesAlive, textures_by_address.size());
@@ -1902,11 +1938,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   // as our efb copy are marked to check them for partial texture updates.
   // TODO: The logic to detect overlapping strided efb copies is not 100% accurate.
   bool strided_efb_copy = dstStride != bytes_per_row;
-  auto iter = FindOverlappingTextures(dstAddr, covered_range);
-  while (iter.first != iter.second)
+  for (TCacheEntry* overlapping_entry : FindOverlappingTextures(dstAddr, covered_range))
   {
-    TCacheEntry* overlapping_entry = iter.first->second;
-
     if (overlapping_entry->addr == dstAddr && overlapping_entry->is_xfb_copy)
     {
       for (auto& reference : overlapping_entry->references)
@@ -1927,7 +1960,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       {
         // Pending EFB copies which are completely covered by this new copy can simply be tossed,
         // instead of having to flush them later on, since this copy will write over everything.
-        iter.first = InvalidateTexture(iter.first, true);
+        InvalidateTexture(overlapping_entry, true);
         continue;
       }
       overlapping_entry->may_have_overlapping_textures = true;
@@ -1953,7 +1986,6 @@ void TextureCacheBase::CopyRenderTargetToTexture(
         overlapping_entry->textures_by_hash_iter = textures_by_hash.end();
       }
     }
-    ++iter.first;
   }
 
   if (g_bRecordFifoData)
@@ -1975,6 +2007,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
     textures_by_address.emplace(dstAddr, entry);
+    AddRangeIndexEntry(entry);
   }
 }
 
@@ -2022,10 +2055,8 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   if (entry->is_xfb_copy)
   {
     const u32 covered_range = entry->pending_efb_copy_height * entry->memory_stride;
-    auto range = FindOverlappingTextures(entry->addr, covered_range);
-    for (auto iter = range.first; iter != range.second; ++iter)
+    for (TCacheEntry* overlapping_entry : FindOverlappingTextures(entry->addr, covered_range))
     {
-      TCacheEntry* overlapping_entry = iter->second;
       if (overlapping_entry->may_have_overlapping_textures && overlapping_entry->is_xfb_copy &&
           overlapping_entry->OverlapsMemoryRange(entry->addr, covered_range))
       {
@@ -2181,21 +2212,51 @@ TextureCacheBase::GetTexCacheIter(TextureCacheBase::TCacheEntry* entry)
   return textures_by_address.end();
 }
 
-std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
-TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
+std::vector<TextureCacheBase::TCacheEntry*> TextureCacheBase::FindOverlappingTextures(u32 addr,
+                                                                                      u32 size_in_bytes)
+{
+  // Visit the page buckets the queried range touches. An entry spanning several pages
+  // appears in each of them, so the result has to be deduplicated.
+  std::vector<TCacheEntry*> candidates;
+  const u32 end_page = (addr + size_in_bytes) >> TEXTURE_PAGE_SHIFT;
+  for (u32 page = addr >> TEXTURE_PAGE_SHIFT; page <= end_page; page++)
+  {
+    auto bucket = textures_by_range.find(page);
+    if (bucket == textures_by_range.end())
+      continue;
+    candidates.insert(candidates.end(), bucket->second.begin(), bucket->second.end());
+  }
+
+  // Keep the address-sorted iteration order the old full-map walk provided; partial
+  // texture updates are applied in this order. Duplicates sort next to each other.
+  std::sort(candidates.begin(), candidates.end(), [](const TCacheEntry* a, const TCacheEntry* b) {
+    return a->addr != b->addr ? a->addr < b->addr : a->id < b->id;
+  });
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  return candidates;
+}
+
+void TextureCacheBase::AddRangeIndexEntry(TCacheEntry* entry)
+{
+  const u32 end_page = (entry->addr + entry->size_in_bytes) >> TEXTURE_PAGE_SHIFT;
+  for (u32 page = entry->addr >> TEXTURE_PAGE_SHIFT; page <= end_page; page++)
+    textures_by_range[page].push_back(entry);
+}
+
+void TextureCacheBase::RemoveRangeIndexEntry(TCacheEntry* entry)
 {
-  // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
-
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
-  auto begin = textures_by_address.lower_bound(lower_addr);
-  auto end = textures_by_address.upper_bound(addr + size_in_bytes);
-
-  return std::make_pair(begin, end);
+  const u32 end_page = (entry->addr + entry->size_in_bytes) >> TEXTURE_PAGE_SHIFT;
+  for (u32 page = entry->addr >> TEXTURE_PAGE_SHIFT; page <= end_page; page++)
+  {
+    auto bucket = textures_by_range.find(page);
+    if (bucket == textures_by_range.end())
+      continue;
+    auto& entries = bucket->second;
+    entries.erase(std::remove(entries.begin(), entries.end(), entry), entries.end());
+    if (entries.empty())
+      textures_by_range.erase(bucket);
+  }
 }
 
 TextureCacheBase::TexAddrCache::iterator
@@ -2224,6 +2285,8 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
     }
   }
 
+  RemoveRangeIndexEntry(entry);
+
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
   // downscale the framebuffer. Copy from EFB->Texture, draw texture to EFB, copy EFB->Texture,
@@ -2261,6 +2324,11 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   return textures_by_address.erase(iter);
 }
 
+void TextureCacheBase::InvalidateTexture(TCacheEntry* entry, bool discard_pending_efb_copy)
+{
+  InvalidateTexture(GetTexCacheIter(entry), discard_pending_efb_copy);
+}
+
 bool TextureCacheBase::CreateUtilityTextures()
 {
   constexpr TextureConfig encoding_texture_config(
@@ -318,6 +318,13 @@ private:
   using TexHashCache = std::multimap<u64, TCacheEntry*>;
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
+  // Page-bucketed index over the memory ranges of the live entries. Each bucket covers
+  // a 128KB page of guest memory, and an entry appears in every bucket its range touches,
+  // so overlap queries only have to visit the pages covered by the queried range instead
+  // of walking a fixed window of textures_by_address.
+  static constexpr u32 TEXTURE_PAGE_SHIFT = 17;
+  using TexRangeIndex = std::unordered_map<u32, std::vector<TCacheEntry*>>;
+
   bool CreateUtilityTextures();
 
   void SetBackupConfig(const VideoConfig& config);
@@ -335,14 +342,18 @@ private:
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
-  // Return all possible overlapping textures. As addr+size of the textures is not
-  // indexed, this may return false positives.
-  std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
-  FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+  // Return all possible overlapping textures, sorted by address. Sharing a page does
+  // not imply a byte overlap, so this may return false positives.
+  std::vector<TCacheEntry*> FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+
+  // Keep textures_by_range in sync with textures_by_address.
+  void AddRangeIndexEntry(TCacheEntry* entry);
+  void RemoveRangeIndexEntry(TCacheEntry* entry);
 
   // Removes and unlinks texture from texture cache and returns it to the pool
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter,
                                            bool discard_pending_efb_copy = false);
+  void InvalidateTexture(TCacheEntry* entry, bool discard_pending_efb_copy = false);
 
   void UninitializeXFBMemory(u8* dst, u32 stride, u32 bytes_per_row, u32 num_blocks_y);
 
@@ -365,6 +376,7 @@ private:
 
   TexAddrCache textures_by_address;
   TexHashCache textures_by_hash;
+  TexRangeIndex textures_by_range;
   TexPool texture_pool;
   u64 last_entry_id = 0;
 
@@ -6,9 +6,14 @@
 #include <cmath>
 
 #include "Common/CPUDetect.h"
+#include "Common/CPUDispatch.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureDecoder_Util.h"
@@ -142,7 +147,7 @@ static inline void DecodeBytes_RGBA8(u32* dst, const u16* src, const u16* src2)
 #endif
 }
 
-static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+static inline void DecodeDXTColors(const DXTBlock* src, int* colors)
 {
   // S3TC Decoder (Note: GCN decodes differently from PC so we can't use native support)
   // Needs more speed.
@@ -154,7 +159,6 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
   int green2 = Convert6To8((c2 >> 5) & 0x3F);
   int red1 = Convert5To8((c1 >> 11) & 0x1F);
   int red2 = Convert5To8((c2 >> 11) & 0x1F);
-  int colors[4];
   colors[0] = MakeRGBA(red1, green1, blue1, 255);
   colors[1] = MakeRGBA(red2, green2, blue2, 255);
   if (c1 > c2)
@@ -171,6 +175,12 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
     colors[2] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 255);
     colors[3] = MakeRGBA((red1 + red2) / 2, (green1 + green2) / 2, (blue1 + blue2) / 2, 0);
   }
+}
+
+static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
+{
+  int colors[4];
+  DecodeDXTColors(src, colors);
 
   for (int y = 0; y < 4; y++)
   {
@@ -184,6 +194,266 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
   }
 }
 
+static void TexDecoder_DecodeImpl_C8(u32* dst, const u8* src, int width, int height,
+                                     TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
+                                     int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+        DecodeBytes_C8(dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
+}
+
+static void TexDecoder_DecodeImpl_RGB5A3(u32* dst, const u8* src, int width, int height,
+                                         TextureFormat texformat, const u8* tlut,
+                                         TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Reference C implementation:
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0; x < width; x += 4)
+      for (int iy = 0; iy < 4; iy++, src += 8)
+        DecodeBytes_RGB5A3(dst + (y + iy) * width + x, (u16*)src);
+}
+
+static void TexDecoder_DecodeImpl_RGBA8(u32* dst, const u8* src, int width, int height,
+                                        TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
+                                        int Wsteps4, int Wsteps8)
+{
+  // Reference C implementation.
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0; x < width; x += 4)
+    {
+      for (int iy = 0; iy < 4; iy++)
+        DecodeBytes_RGBA8(dst + (y + iy) * width + x, (u16*)src + 4 * iy, (u16*)src + 4 * iy + 16);
+      src += 64;
+    }
+}
+
+static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int height,
+                                       TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt,
+                                       int Wsteps4, int Wsteps8)
+{
+  // The metroid games use this format almost exclusively.
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8)
+    {
+      DecodeDXTBlock(dst + y * width + x, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock(dst + y * width + x + 4, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock(dst + (y + 4) * width + x, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock(dst + (y + 4) * width + x + 4, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+    }
+  }
+}
+
+#ifdef _M_ARM_64
+// NEON kernels for the formats that dominate decode time. Each one decodes a
+// whole tile row (or two) per iteration and writes the output with 16-byte
+// stores, instead of assembling pixels one at a time like the reference code.
+
+// Converts eight native-endian RGB565 values into separate r/g/b/a byte lanes.
+static inline uint8x8x4_t DecodePixels_RGB565_NEON(uint16x8_t val)
+{
+  const uint16x8_t r5 = vshrq_n_u16(val, 11);
+  const uint16x8_t g6 = vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x3F));
+  const uint16x8_t b5 = vandq_u16(val, vdupq_n_u16(0x1F));
+
+  uint8x8x4_t result;
+  result.val[0] = vmovn_u16(vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2)));
+  result.val[1] = vmovn_u16(vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4)));
+  result.val[2] = vmovn_u16(vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2)));
+  result.val[3] = vdup_n_u8(0xFF);
+  return result;
+}
+
+// Converts eight native-endian RGB5A3 values into separate r/g/b/a byte
+// lanes. Both the opaque (RGB555) and the translucent (ARGB3444) form are
+// computed for all lanes and the right one is picked by the MSB.
+static inline uint8x8x4_t DecodePixels_RGB5A3_NEON(uint16x8_t val)
+{
+  const uint16x8_t r5 = vandq_u16(vshrq_n_u16(val, 10), vdupq_n_u16(0x1F));
+  const uint16x8_t g5 = vandq_u16(vshrq_n_u16(val, 5), vdupq_n_u16(0x1F));
+  const uint16x8_t b5 = vandq_u16(val, vdupq_n_u16(0x1F));
+  const uint16x8_t r_opaque = vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2));
+  const uint16x8_t g_opaque = vorrq_u16(vshlq_n_u16(g5, 3), vshrq_n_u16(g5, 2));
+  const uint16x8_t b_opaque = vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2));
+
+  const uint16x8_t a3 = vandq_u16(vshrq_n_u16(val, 12), vdupq_n_u16(0x7));
+  const uint16x8_t r4 = vandq_u16(vshrq_n_u16(val, 8), vdupq_n_u16(0xF));
+  const uint16x8_t g4 = vandq_u16(vshrq_n_u16(val, 4), vdupq_n_u16(0xF));
+  const uint16x8_t b4 = vandq_u16(val, vdupq_n_u16(0xF));
+  const uint16x8_t a_trans =
+      vorrq_u16(vorrq_u16(vshlq_n_u16(a3, 5), vshlq_n_u16(a3, 2)), vshrq_n_u16(a3, 1));
+  const uint16x8_t r_trans = vorrq_u16(vshlq_n_u16(r4, 4), r4);
+  const uint16x8_t g_trans = vorrq_u16(vshlq_n_u16(g4, 4), g4);
+  const uint16x8_t b_trans = vorrq_u16(vshlq_n_u16(b4, 4), b4);
+
+  // All ones in lanes whose MSB (the opaque flag) is set.
+  const uint16x8_t opaque = vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(val), 15));
+
+  uint8x8x4_t result;
+  result.val[0] = vmovn_u16(vbslq_u16(opaque, r_opaque, r_trans));
+  result.val[1] = vmovn_u16(vbslq_u16(opaque, g_opaque, g_trans));
+  result.val[2] = vmovn_u16(vbslq_u16(opaque, b_opaque, b_trans));
+  result.val[3] = vmovn_u16(vbslq_u16(opaque, vdupq_n_u16(0xFF), a_trans));
+  return result;
+}
+
+// Interleaves eight pixels' worth of r/g/b/a byte lanes and stores them as
+// two groups of four RGBA pixels.
+static inline void StorePixels_NEON(const uint8x8x4_t& px, u32* dst0, u32* dst1)
+{
+  const uint8x8x2_t rg = vzip_u8(px.val[0], px.val[1]);
+  const uint8x8x2_t ba = vzip_u8(px.val[2], px.val[3]);
+  const uint16x4x2_t lo = vzip_u16(vreinterpret_u16_u8(rg.val[0]), vreinterpret_u16_u8(ba.val[0]));
+  const uint16x4x2_t hi = vzip_u16(vreinterpret_u16_u8(rg.val[1]), vreinterpret_u16_u8(ba.val[1]));
+  vst1q_u32(dst0, vreinterpretq_u32_u16(vcombine_u16(lo.val[0], lo.val[1])));
+  vst1q_u32(dst1, vreinterpretq_u32_u16(vcombine_u16(hi.val[0], hi.val[1])));
+}
+
+static inline void DecodeBytes_C8_NEON(u32* dst, const u8* src, const u8* tlut_, TLUTFormat tlutfmt)
+{
+  // The palette lookups have to stay scalar (there are no gather loads), but
+  // the per-pixel format conversion of the looked-up entries vectorizes.
+  const u16* tlut = (const u16*)tlut_;
+  u16 entries[8];
+  for (int x = 0; x < 8; x++)
+    entries[x] = tlut[src[x]];
+  const uint16x8_t val = vld1q_u16(entries);
+
+  uint8x8x4_t px;
+  switch (tlutfmt)
+  {
+  case TLUTFormat::IA8:
+  {
+    // Matching DecodePixel_IA8, which reads the entry without a byte swap:
+    // low byte alpha, high byte intensity.
+    const uint8x8_t a = vmovn_u16(val);
+    const uint8x8_t i = vshrn_n_u16(val, 8);
+    px.val[0] = i;
+    px.val[1] = i;
+    px.val[2] = i;
+    px.val[3] = a;
+    break;
+  }
+  case TLUTFormat::RGB565:
+    px = DecodePixels_RGB565_NEON(
+        vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(val))));
+    break;
+  case TLUTFormat::RGB5A3:
+    px = DecodePixels_RGB5A3_NEON(
+        vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(val))));
+    break;
+  default:
+    memset(dst, 0, 8 * sizeof(u32));
+    return;
+  }
+
+  StorePixels_NEON(px, dst, dst + 4);
+}
+
+static void TexDecoder_DecodeImpl_C8_NEON(u32* dst, const u8* src, int width, int height,
+                                          TextureFormat texformat, const u8* tlut,
+                                          TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
+      for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
+        DecodeBytes_C8_NEON(dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
+}
+
+static void TexDecoder_DecodeImpl_RGB5A3_NEON(u32* dst, const u8* src, int width, int height,
+                                              TextureFormat texformat, const u8* tlut,
+                                              TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // Two tile rows (eight pixels) per iteration.
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0; x < width; x += 4)
+      for (int iy = 0; iy < 4; iy += 2, src += 16)
+      {
+        const uint16x8_t val = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(src)));
+        StorePixels_NEON(DecodePixels_RGB5A3_NEON(val), dst + (y + iy) * width + x,
+                         dst + (y + iy + 1) * width + x);
+      }
+}
+
+static void TexDecoder_DecodeImpl_RGBA8_NEON(u32* dst, const u8* src, int width, int height,
+                                             TextureFormat texformat, const u8* tlut,
+                                             TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  // One whole 4x4 tile per iteration: deinterleave the AR and GB halves,
+  // then zip the channels back together into four RGBA output rows.
+  for (int y = 0; y < height; y += 4)
+    for (int x = 0; x < width; x += 4, src += 64)
+    {
+      const uint8x16x2_t ar = vld2q_u8(src);
+      const uint8x16x2_t gb = vld2q_u8(src + 32);
+      const uint8x16x2_t rg = vzipq_u8(ar.val[1], gb.val[0]);
+      const uint8x16x2_t ba = vzipq_u8(gb.val[1], ar.val[0]);
+      const uint16x8x2_t px01 =
+          vzipq_u16(vreinterpretq_u16_u8(rg.val[0]), vreinterpretq_u16_u8(ba.val[0]));
+      const uint16x8x2_t px23 =
+          vzipq_u16(vreinterpretq_u16_u8(rg.val[1]), vreinterpretq_u16_u8(ba.val[1]));
+      vst1q_u32(dst + y * width + x, vreinterpretq_u32_u16(px01.val[0]));
+      vst1q_u32(dst + (y + 1) * width + x, vreinterpretq_u32_u16(px01.val[1]));
+      vst1q_u32(dst + (y + 2) * width + x, vreinterpretq_u32_u16(px23.val[0]));
+      vst1q_u32(dst + (y + 3) * width + x, vreinterpretq_u32_u16(px23.val[1]));
+    }
+}
+
+static void DecodeDXTBlock_NEON(u32* dst, const DXTBlock* src, int pitch)
+{
+  // The color endpoints are computed with the scalar math (it's four values),
+  // the sixteen 2-bit selector lookups become table lookups into the four
+  // decoded colors.
+  int colors[4];
+  DecodeDXTColors(src, colors);
+  const uint8x16_t color_table = vld1q_u8(reinterpret_cast<const u8*>(colors));
+
+  // Byte patterns for expanding a row's four selectors (MSB first) into
+  // sixteen byte indices into color_table.
+  const int8x8_t sel_shift = vcreate_s8(0x0000000000FEFCFAULL);  // >>6, >>4, >>2, >>0
+  const uint8x8_t dup_lo = vcreate_u8(0x0101010100000000ULL);    // 0,0,0,0,1,1,1,1
+  const uint8x8_t dup_hi = vcreate_u8(0x0303030302020202ULL);    // 2,2,2,2,3,3,3,3
+  const uint8x8_t byte_off = vcreate_u8(0x0302010003020100ULL);  // 0,1,2,3,0,1,2,3
+
+  for (int y = 0; y < 4; y++)
+  {
+    const uint8x8_t sel = vand_u8(vshl_u8(vdup_n_u8(src->lines[y]), sel_shift), vdup_n_u8(3));
+    const uint8x8_t sel4 = vshl_n_u8(sel, 2);
+    const uint8x8_t idx_lo = vadd_u8(vtbl1_u8(sel4, dup_lo), byte_off);
+    const uint8x8_t idx_hi = vadd_u8(vtbl1_u8(sel4, dup_hi), byte_off);
+    const uint8x16_t row = vqtbl1q_u8(color_table, vcombine_u8(idx_lo, idx_hi));
+    vst1q_u32(dst, vreinterpretq_u32_u8(row));
+    dst += pitch;
+  }
+}
+
+static void TexDecoder_DecodeImpl_CMPR_NEON(u32* dst, const u8* src, int width, int height,
+                                            TextureFormat texformat, const u8* tlut,
+                                            TLUTFormat tlutfmt, int Wsteps4, int Wsteps8)
+{
+  for (int y = 0; y < height; y += 8)
+  {
+    for (int x = 0; x < width; x += 8)
+    {
+      DecodeDXTBlock_NEON(dst + y * width + x, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock_NEON(dst + y * width + x + 4, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock_NEON(dst + (y + 4) * width + x, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+      DecodeDXTBlock_NEON(dst + (y + 4) * width + x + 4, (DXTBlock*)src, width);
+      src += sizeof(DXTBlock);
+    }
+  }
+}
+#endif  // _M_ARM_64
+
 // JSD 01/06/11:
 // TODO: we really should ensure BOTH the source and destination addresses are aligned to 16-byte
 // boundaries to
@@ -198,6 +468,40 @@ static void DecodeDXTBlock(u32* dst, const DXTBlock* src, int pitch)
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
+  // The formats with NEON variants resolve their kernel once through the
+  // multi-versioning helper; everywhere else the scalar reference code runs.
+  using DecodeKernel = void (*)(u32*, const u8*, int, int, TextureFormat, const u8*, TLUTFormat,
+                                int, int);
+  static const DecodeKernel c8_kernel =
+      Common::SelectVariant<DecodeKernel>({{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_C8}
+#ifdef _M_ARM_64
+                                           ,
+                                           {Common::DispatchLevel::NEON,
+                                            TexDecoder_DecodeImpl_C8_NEON}
+#endif
+      });
+  static const DecodeKernel rgb5a3_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_RGB5A3}
+#ifdef _M_ARM_64
+       ,
+       {Common::DispatchLevel::NEON, TexDecoder_DecodeImpl_RGB5A3_NEON}
+#endif
+      });
+  static const DecodeKernel rgba8_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_RGBA8}
+#ifdef _M_ARM_64
+       ,
+       {Common::DispatchLevel::NEON, TexDecoder_DecodeImpl_RGBA8_NEON}
+#endif
+      });
+  static const DecodeKernel cmpr_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_CMPR}
+#ifdef _M_ARM_64
+       ,
+       {Common::DispatchLevel::NEON, TexDecoder_DecodeImpl_CMPR_NEON}
+#endif
+      });
+
   const int Wsteps4 = (width + 3) / 4;
   const int Wsteps8 = (width + 7) / 8;
 
@@ -256,10 +560,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   }
   break;
   case TextureFormat::C8:
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0, yStep = (y / 4) * Wsteps8; x < width; x += 8, yStep++)
-        for (int iy = 0, xStep = 4 * yStep; iy < 4; iy++, xStep++)
-          DecodeBytes_C8((u32*)dst + (y + iy) * width + x, src + 8 * xStep, tlut, tlutfmt);
+    c8_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
   case TextureFormat::IA4:
   {
@@ -306,45 +607,13 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
   }
   break;
   case TextureFormat::RGB5A3:
-  {
-    // Reference C implementation:
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0; x < width; x += 4)
-        for (int iy = 0; iy < 4; iy++, src += 8)
-          DecodeBytes_RGB5A3(dst + (y + iy) * width + x, (u16*)src);
-  }
-  break;
+    rgb5a3_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    break;
   case TextureFormat::RGBA8:  // speed critical
-  {
-    // Reference C implementation.
-    for (int y = 0; y < height; y += 4)
-      for (int x = 0; x < width; x += 4)
-      {
-        for (int iy = 0; iy < 4; iy++)
-          DecodeBytes_RGBA8(dst + (y + iy) * width + x, (u16*)src + 4 * iy,
-                            (u16*)src + 4 * iy + 16);
-        src += 64;
-      }
-  }
-  break;
+    rgba8_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    break;
   case TextureFormat::CMPR:  // speed critical
-    // The metroid games use this format almost exclusively.
-    {
-      for (int y = 0; y < height; y += 8)
-      {
-        for (int x = 0; x < width; x += 8)
-        {
-          DecodeDXTBlock((u32*)dst + y * width + x, (DXTBlock*)src, width);
-          src += sizeof(DXTBlock);
-          DecodeDXTBlock((u32*)dst + y * width + x + 4, (DXTBlock*)src, width);
-          src += sizeof(DXTBlock);
-          DecodeDXTBlock((u32*)dst + (y + 4) * width + x, (DXTBlock*)src, width);
-          src += sizeof(DXTBlock);
-          DecodeDXTBlock((u32*)dst + (y + 4) * width + x + 4, (DXTBlock*)src, width);
-          src += sizeof(DXTBlock);
-        }
-      }
-      break;
-    }
+    cmpr_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    break;
   }
 }
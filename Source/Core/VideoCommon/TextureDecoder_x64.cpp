@@ -7,6 +7,7 @@
 #include <cstring>
 
 #include "Common/CPUDetect.h"
+#include "Common/CPUDispatch.h"
 #include "Common/CommonTypes.h"
 #include "Common/Intrinsics.h"
 #include "Common/MathUtil.h"
@@ -1413,6 +1414,26 @@ static void TexDecoder_DecodeImpl_CMPR(u32* dst, const u8* src, int width, int h
 void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, TextureFormat texformat,
                             const u8* tlut, TLUTFormat tlutfmt)
 {
+  // The formats with SSSE3 variants resolve their kernel once through the
+  // multi-versioning helper instead of testing cpu_info on every call.
+  using DecodeKernel = void (*)(u32*, const u8*, int, int, TextureFormat, const u8*, TLUTFormat,
+                                int, int);
+  static const DecodeKernel i4_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_I4},
+       {Common::DispatchLevel::SSSE3, TexDecoder_DecodeImpl_I4_SSSE3}});
+  static const DecodeKernel i8_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_I8},
+       {Common::DispatchLevel::SSSE3, TexDecoder_DecodeImpl_I8_SSSE3}});
+  static const DecodeKernel ia8_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_IA8},
+       {Common::DispatchLevel::SSSE3, TexDecoder_DecodeImpl_IA8_SSSE3}});
+  static const DecodeKernel rgb5a3_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_RGB5A3},
+       {Common::DispatchLevel::SSSE3, TexDecoder_DecodeImpl_RGB5A3_SSSE3}});
+  static const DecodeKernel rgba8_kernel = Common::SelectVariant<DecodeKernel>(
+      {{Common::DispatchLevel::Scalar, TexDecoder_DecodeImpl_RGBA8},
+       {Common::DispatchLevel::SSSE3, TexDecoder_DecodeImpl_RGBA8_SSSE3}});
+
   int Wsteps4 = (width + 3) / 4;
   int Wsteps8 = (width + 7) / 8;
 
@@ -1423,19 +1444,11 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::I4:
-    if (cpu_info.bSSSE3)
-      TexDecoder_DecodeImpl_I4_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                     Wsteps8);
-    else
-      TexDecoder_DecodeImpl_I4(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    i4_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::I8:
-    if (cpu_info.bSSSE3)
-      TexDecoder_DecodeImpl_I8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                     Wsteps8);
-    else
-      TexDecoder_DecodeImpl_I8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
+    i8_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::C8:
@@ -1447,12 +1460,7 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::IA8:
-    if (cpu_info.bSSSE3)
-      TexDecoder_DecodeImpl_IA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                      Wsteps8);
-    else
-      TexDecoder_DecodeImpl_IA8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                Wsteps8);
+    ia8_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::C14X2:
@@ -1466,21 +1474,11 @@ void _TexDecoder_DecodeImpl(u32* dst, const u8* src, int width, int height, Text
     break;
 
   case TextureFormat::RGB5A3:
-    if (cpu_info.bSSSE3)
-      TexDecoder_DecodeImpl_RGB5A3_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                         Wsteps8);
-    else
-      TexDecoder_DecodeImpl_RGB5A3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                   Wsteps8);
+    rgb5a3_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::RGBA8:
-    if (cpu_info.bSSSE3)
-      TexDecoder_DecodeImpl_RGBA8_SSSE3(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                        Wsteps8);
-    else
-      TexDecoder_DecodeImpl_RGBA8(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4,
-                                  Wsteps8);
+    rgba8_kernel(dst, src, width, height, texformat, tlut, tlutfmt, Wsteps4, Wsteps8);
     break;
 
   case TextureFormat::CMPR:
@@ -25,6 +25,7 @@
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VertexShaderManager.h"
+#include "VideoCommon/VideoConfig.h"
 
 namespace VertexLoaderManager
 {
@@ -261,6 +262,14 @@ int RunVertices(int vtx_attr_group, int primitive, int count, DataReader src, bo
   if (is_preprocess)
     return size;
 
+  // Instrumented Null mode: the primitives have been decoded and sized, drop
+  // them before vertex loading.
+  if (g_ActiveConfig.NullCutoffAt(NullCutoffStage::OpcodeDecode))
+  {
+    INCSTAT(stats.thisFrame.numNullDropsOpcodeDecode);
+    return size;
+  }
+
   // If the native vertex format changed, force a flush.
   if (loader->m_native_vertex_format != s_current_vtx_fmt ||
       loader->m_native_components != g_current_components)
@@ -313,40 +322,61 @@ void LoadCPReg(u32 sub_cmd, u32 value, bool is_preprocess)
       VertexShaderManager::SetTexMatrixChangedB(value);
     break;
 
+  // For the cases below, only mark state dirty if the register actually
+  // changed. Games commonly re-send their whole CP setup between draws, and a
+  // spurious dirty bit sends the next draw through the vertex loader hash-map
+  // lookup instead of the per-VAT loader cache.
   case 0x50:
-    state->vtx_desc.Hex &= ~0x1FFFF;  // keep the Upper bits
-    state->vtx_desc.Hex |= value;
+  {
+    const u64 new_hex = (state->vtx_desc.Hex & ~0x1FFFFull) | value;  // keep the Upper bits
+    if (state->vtx_desc.Hex == new_hex)
+      break;
+    state->vtx_desc.Hex = new_hex;
     state->attr_dirty = BitSet32::AllTrue(8);
     state->bases_dirty = true;
     break;
+  }
 
   case 0x60:
-    state->vtx_desc.Hex &= 0x1FFFF;  // keep the lower 17Bits
-    state->vtx_desc.Hex |= (u64)value << 17;
+  {
+    const u64 new_hex = (state->vtx_desc.Hex & 0x1FFFF) | ((u64)value << 17);  // keep the lower
+                                                                               // 17Bits
+    if (state->vtx_desc.Hex == new_hex)
+      break;
+    state->vtx_desc.Hex = new_hex;
     state->attr_dirty = BitSet32::AllTrue(8);
     state->bases_dirty = true;
     break;
+  }
 
   case 0x70:
     ASSERT((sub_cmd & 0x0F) < 8);
+    if (state->vtx_attr[sub_cmd & 7].g0.Hex == value)
+      break;
     state->vtx_attr[sub_cmd & 7].g0.Hex = value;
     state->attr_dirty[sub_cmd & 7] = true;
     break;
 
   case 0x80:
     ASSERT((sub_cmd & 0x0F) < 8);
+    if (state->vtx_attr[sub_cmd & 7].g1.Hex == value)
+      break;
     state->vtx_attr[sub_cmd & 7].g1.Hex = value;
     state->attr_dirty[sub_cmd & 7] = true;
     break;
 
   case 0x90:
     ASSERT((sub_cmd & 0x0F) < 8);
+    if (state->vtx_attr[sub_cmd & 7].g2.Hex == value)
+      break;
     state->vtx_attr[sub_cmd & 7].g2.Hex = value;
     state->attr_dirty[sub_cmd & 7] = true;
     break;
 
   // Pointers to vertex arrays in GC RAM
   case 0xA0:
+    if (state->array_bases[sub_cmd & 0xF] == value)
+      break;
     state->array_bases[sub_cmd & 0xF] = value;
     state->bases_dirty = true;
     break;
@@ -6,6 +6,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "Common/BitSet.h"
@@ -341,6 +342,14 @@ void VertexManagerBase::Flush()
   // loading a state will invalidate BP, so check for it
   g_video_backend->CheckInvalidState();
 
+  // Instrumented Null mode: the vertices have been loaded, drop the batch
+  // before constants, textures and pipeline setup.
+  if (g_ActiveConfig.NullCutoffAt(NullCutoffStage::VertexLoad))
+  {
+    INCSTAT(stats.thisFrame.numNullDropsVertexLoad);
+    return;
+  }
+
 #if defined(_DEBUG) || defined(DEBUGFAST)
   PRIM_LOG("frame%d:\n texgen=%u, numchan=%u, dualtex=%u, ztex=%u, cole=%u, alpe=%u, ze=%u",
            g_ActiveConfig.iSaveTargetId, xfmem.numTexGen.numTexGens, xfmem.numChan.numColorChans,
@@ -414,19 +423,42 @@ void VertexManagerBase::Flush()
 
   if (!m_cull_all)
   {
+    // Optionally reject the whole batch on the CPU if every vertex transforms to the
+    // outside of the same frustum plane. Done after SetConstants(), since the software
+    // transform uses the projection matrix calculated there.
+    const bool cpu_culled = g_ActiveConfig.bCPUCull &&
+                            (m_current_primitive_type == PrimitiveType::Triangles ||
+                             m_current_primitive_type == PrimitiveType::TriangleStrip) &&
+                            IsFlushCulledOnCPU(VertexLoaderManager::GetCurrentVertexFormat());
+
     // Now the vertices can be flushed to the GPU. Everything following the CommitBuffer() call
     // must be careful to not upload any utility vertices, as the binding will be lost otherwise.
+    // This is still done for CPU-culled batches, to keep the backend buffer state consistent.
     const u32 num_indices = IndexGenerator::GetIndexLen();
     u32 base_vertex, base_index;
     CommitBuffer(IndexGenerator::GetNumVerts(),
                  VertexLoaderManager::GetCurrentVertexFormat()->GetVertexStride(), num_indices,
                  &base_vertex, &base_index);
 
+    if (cpu_culled)
+    {
+      ADDSTAT(stats.thisFrame.numTrianglesCulled, num_indices / 3);
+      return;
+    }
+
     // Texture loading can cause palettes to be applied (-> uniforms -> draws).
     // Palette application does not use vertices, only a full-screen quad, so this is okay.
     // Same with GPU texture decoding, which uses compute shaders.
     LoadTextures();
 
+    // Instrumented Null mode: the textures have been decoded and bound, drop
+    // the batch before uniforms and pipeline setup.
+    if (g_ActiveConfig.NullCutoffAt(NullCutoffStage::TextureDecode))
+    {
+      INCSTAT(stats.thisFrame.numNullDropsTextureDecode);
+      return;
+    }
+
     // Now we can upload uniforms, as nothing else will override them.
     GeometryShaderManager::SetConstants();
     PixelShaderManager::SetConstants();
@@ -441,6 +473,11 @@ void VertexManagerBase::Flush()
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->EnableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
 
+      // Any draw while bounding box tracking is active can move the box, so the cached
+      // readback values are stale after this.
+      if (::BoundingBox::active && g_ActiveConfig.bBBoxEnable)
+        ::BoundingBox::Invalidate();
+
       DrawCurrentBatch(base_index, num_indices, base_vertex);
       INCSTAT(stats.thisFrame.numDrawCalls);
 
@@ -531,6 +568,62 @@ void VertexManagerBase::CalculateZSlope(NativeVertexFormat* format)
   m_zslope.dirty = true;
 }
 
+bool VertexManagerBase::IsFlushCulledOnCPU(NativeVertexFormat* format) const
+{
+  // Games can disable the clipper's trivial rejection, in which case geometry outside
+  // the frustum still rasterizes (scissored), so we can't drop it.
+  if ((xfmem.clipDisable & 3) != 0)
+    return false;
+
+  const PortableVertexDeclaration& vert_decl = format->GetVertexDeclaration();
+  if (vert_decl.position.type != VAR_FLOAT)
+    return false;
+
+  const u32 vertex_count = IndexGenerator::GetNumVerts();
+  if (vertex_count == 0)
+    return false;
+
+  // Global matrix ID, used when this vertex format has no per-vertex matrix indices.
+  u32 mtx_idx = g_main_cp_state.matrix_index_a.PosNormalMtxIdx;
+
+  // Transform every vertex in the batch to clip space, and track which frustum planes
+  // (+x, -x, +y, -y) all vertices so far are outside of. If one plane has every vertex
+  // on its outside, clipping would have rejected every triangle anyway. The half-space
+  // tests are linear in clip space, so this is valid regardless of the sign of w, and
+  // NaNs fail every comparison, which conservatively keeps the draw.
+  u32 outside_all = 0xf;
+  for (u32 i = 0; i < vertex_count; i++)
+  {
+    const u8* vertex_ptr = m_base_buffer_pointer + i * vert_decl.stride;
+
+    float pos[3] = {0.0f, 0.0f, 0.0f};
+    std::memcpy(pos, vertex_ptr + vert_decl.position.offset,
+                sizeof(float) * vert_decl.position.components);
+
+    if (vert_decl.posmtx.enable)
+      mtx_idx = vertex_ptr[vert_decl.posmtx.offset];
+
+    float out[4];
+    VertexShaderManager::TransformToClipSpace(pos, out, mtx_idx);
+
+    u32 outside = 0;
+    if (out[0] > out[3])
+      outside |= 1;
+    if (out[0] < -out[3])
+      outside |= 2;
+    if (out[1] > out[3])
+      outside |= 4;
+    if (out[1] < -out[3])
+      outside |= 8;
+
+    outside_all &= outside;
+    if (outside_all == 0)
+      return false;
+  }
+
+  return true;
+}
+
 void VertexManagerBase::UpdatePipelineConfig()
 {
   NativeVertexFormat* vertex_format = VertexLoaderManager::GetCurrentVertexFormat();
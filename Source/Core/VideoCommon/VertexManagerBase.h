@@ -137,6 +137,7 @@ protected:
   static u32 GetRemainingIndices(int primitive);
 
   void CalculateZSlope(NativeVertexFormat* format);
+  bool IsFlushCulledOnCPU(NativeVertexFormat* format) const;
   void LoadTextures();
 
   u8* m_cur_buffer_pointer = nullptr;
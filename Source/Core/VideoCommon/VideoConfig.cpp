@@ -66,7 +66,17 @@ void VideoConfig::Refresh()
     // invalid values. Instead, pause emulation first, which will flush the video thread,
     // update the config and correct it, then resume emulation, after which the video
     // thread will detect the config has changed and act accordingly.
-    Config::AddConfigChangedCallback([]() { Core::RunAsCPUThread([]() { g_Config.Refresh(); }); });
+    Config::AddConfigChangedCallback([]() {
+      // Pausing the core to refresh is expensive, so skip it entirely when
+      // nothing in the GFX system changed (e.g. controller or UI settings).
+      static u64 s_last_seen_gfx_version = 0;
+      const u64 gfx_version = Config::GetConfigVersion(Config::System::GFX);
+      if (gfx_version == s_last_seen_gfx_version)
+        return;
+      s_last_seen_gfx_version = gfx_version;
+
+      Core::RunAsCPUThread([]() { g_Config.Refresh(); });
+    });
     s_has_registered_callback = true;
   }
 
@@ -101,6 +111,7 @@ void VideoConfig::Refresh()
   bEnableGPUTextureDecoding = Config::Get(Config::GFX_ENABLE_GPU_TEXTURE_DECODING);
   bEnablePixelLighting = Config::Get(Config::GFX_ENABLE_PIXEL_LIGHTING);
   bFastDepthCalc = Config::Get(Config::GFX_FAST_DEPTH_CALC);
+  bCPUCull = Config::Get(Config::GFX_CPU_CULL);
   iMultisamples = Config::Get(Config::GFX_MSAA);
   bSSAA = Config::Get(Config::GFX_SSAA);
   iEFBScale = Config::Get(Config::GFX_EFB_SCALE);
@@ -113,6 +124,8 @@ void VideoConfig::Refresh()
   bBackendMultithreading = Config::Get(Config::GFX_BACKEND_MULTITHREADING);
   iCommandBufferExecuteInterval = Config::Get(Config::GFX_COMMAND_BUFFER_EXECUTE_INTERVAL);
   bShaderCache = Config::Get(Config::GFX_SHADER_CACHE);
+  sSharedShaderCachePath = Config::Get(Config::GFX_SHARED_SHADER_CACHE_PATH);
+  iNullCutoffStage = Config::Get(Config::GFX_NULL_CUTOFF_STAGE);
   bWaitForShadersBeforeStarting = Config::Get(Config::GFX_WAIT_FOR_SHADERS_BEFORE_STARTING);
   iShaderCompilationMode = Config::Get(Config::GFX_SHADER_COMPILATION_MODE);
   iShaderCompilerThreads = Config::Get(Config::GFX_SHADER_COMPILER_THREADS);
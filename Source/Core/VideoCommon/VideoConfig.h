@@ -50,6 +50,18 @@ enum class ShaderCompilationMode : int
   AsynchronousSkipRendering
 };
 
+// Pipeline stage cutoffs for the Null backend's instrumented mode. The
+// pipeline is cut after the named stage and the batch dropped, so frame time
+// can be attributed to a stage by bisecting over the levels. Only honoured by
+// the Null backend.
+enum class NullCutoffStage : int
+{
+  Disabled,
+  OpcodeDecode,   // drop primitives before vertex loading
+  VertexLoad,     // load vertices, drop before constants and texture decoding
+  TextureDecode,  // decode and bind textures, drop before pipeline setup
+};
+
 // NEVER inherit from this class.
 struct VideoConfig final
 {
@@ -65,6 +77,9 @@ struct VideoConfig final
   AspectMode suggested_aspect_mode;
   bool bCrop;  // Aspect ratio controls.
   bool bShaderCache;
+  // Directory holding a read-only cache tier shared between machines (e.g. a
+  // network mount). Empty disables the shared tier.
+  std::string sSharedShaderCachePath;
 
   // Enhancements
   u32 iMultisamples;
@@ -109,6 +124,7 @@ struct VideoConfig final
   bool bBorderlessFullscreen;
   bool bEnableGPUTextureDecoding;
   int iBitrateKbps;
+  NullCutoffStage iNullCutoffStage;
 
   // Hacks
   bool bEFBAccessEnable;
@@ -128,6 +144,7 @@ struct VideoConfig final
   float fAspectRatioHackW, fAspectRatioHackH;
   bool bEnablePixelLighting;
   bool bFastDepthCalc;
+  bool bCPUCull;
   bool bVertexRounding;
   int iEFBAccessTileSize;
   int iLog;           // CONF_ bits
@@ -232,6 +249,11 @@ struct VideoConfig final
     return backend_info.bSupportsGPUTextureDecoding && bEnableGPUTextureDecoding;
   }
   bool UseVertexRounding() const { return bVertexRounding && iEFBScale != 1; }
+  // True when the instrumented Null mode should drop the batch at this stage.
+  bool NullCutoffAt(NullCutoffStage stage) const
+  {
+    return backend_info.api_type == APIType::Nothing && iNullCutoffStage == stage;
+  }
   bool UsingUberShaders() const;
   u32 GetShaderCompilerThreads() const;
   u32 GetShaderPrecompilerThreads() const;
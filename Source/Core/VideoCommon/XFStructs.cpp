@@ -2,6 +2,8 @@
 // Licensed under GPLv2+
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Common/Swap.h"
@@ -23,6 +25,20 @@ static void XFMemWritten(u32 transferSize, u32 baseAddress)
   VertexShaderManager::InvalidateXFRange(baseAddress, baseAddress + transferSize);
 }
 
+// Games commonly re-send whole register blocks (viewport, projection, texgen
+// setup) unchanged between draws. Returns true when the next 'count' words of
+// the transfer match the values already in xfmem, in which case the block's
+// flush and dirty flagging can be skipped entirely.
+static bool XFRegistersUnchanged(u32 address, u32 count, u32 dataIndex, DataReader src)
+{
+  for (u32 i = 0; i < count; i++)
+  {
+    if (((u32*)&xfmem)[address + i] != src.Peek<u32>((dataIndex + i) * sizeof(u32)))
+      return false;
+  }
+  return true;
+}
+
 static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
 {
   u32 address = baseAddress;
@@ -111,12 +127,15 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetViewportChanged();
-      PixelShaderManager::SetViewportChanged();
-      GeometryShaderManager::SetViewportChanged();
-
       nextAddress = XFMEM_SETVIEWPORT + 6;
+      if (!XFRegistersUnchanged(address, std::min(nextAddress - address, (u32)transferSize),
+                                dataIndex, src))
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetViewportChanged();
+        PixelShaderManager::SetViewportChanged();
+        GeometryShaderManager::SetViewportChanged();
+      }
       break;
 
     case XFMEM_SETPROJECTION:
@@ -126,11 +145,14 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetProjectionChanged();
-      GeometryShaderManager::SetProjectionChanged();
-
       nextAddress = XFMEM_SETPROJECTION + 7;
+      if (!XFRegistersUnchanged(address, std::min(nextAddress - address, (u32)transferSize),
+                                dataIndex, src))
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetProjectionChanged();
+        GeometryShaderManager::SetProjectionChanged();
+      }
       break;
 
     case XFMEM_SETNUMTEXGENS:  // GXSetNumTexGens
@@ -146,10 +168,13 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
-
       nextAddress = XFMEM_SETTEXMTXINFO + 8;
+      if (!XFRegistersUnchanged(address, std::min(nextAddress - address, (u32)transferSize),
+                                dataIndex, src))
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
+      }
       break;
 
     case XFMEM_SETPOSMTXINFO:
@@ -160,10 +185,13 @@ static void XFRegWritten(int transferSize, u32 baseAddress, DataReader src)
     case XFMEM_SETPOSMTXINFO + 5:
     case XFMEM_SETPOSMTXINFO + 6:
     case XFMEM_SETPOSMTXINFO + 7:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETPOSMTXINFO);
-
       nextAddress = XFMEM_SETPOSMTXINFO + 8;
+      if (!XFRegistersUnchanged(address, std::min(nextAddress - address, (u32)transferSize),
+                                dataIndex, src))
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETPOSMTXINFO);
+      }
       break;
 
     // --------------
@@ -235,10 +263,29 @@ void LoadXFReg(u32 transferSize, u32 baseAddress, DataReader src)
       transferSize = 0;
     }
 
-    XFMemWritten(xfMemTransferSize, xfMemBase);
+    // As with indexed transfers, games commonly re-upload identical matrix data between draws.
+    // Skip the flush (and constant invalidation) when nothing actually changes.
+    bool changed = false;
     for (u32 i = 0; i < xfMemTransferSize; i++)
     {
-      ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      if (((u32*)&xfmem)[xfMemBase + i] != src.Peek<u32>(i * sizeof(u32)))
+      {
+        changed = true;
+        break;
+      }
+    }
+
+    if (changed)
+    {
+      XFMemWritten(xfMemTransferSize, xfMemBase);
+      for (u32 i = 0; i < xfMemTransferSize; i++)
+      {
+        ((u32*)&xfmem)[xfMemBase + i] = src.Read<u32>();
+      }
+    }
+    else
+    {
+      src.Skip(xfMemTransferSize * sizeof(u32));
     }
   }
 
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <thread>
 
 #include "Common/SPSCQueue.h"
@@ -69,3 +70,193 @@ TEST(SPSCQueue, MultiThreaded)
   popper_thread.join();
   inserter_thread.join();
 }
+
+TEST(SPSCQueue, BatchOperations)
+{
+  Common::SPSCQueue<u32> q;
+
+  // Batch operations on an empty queue.
+  u32 buffer[64];
+  q.PushMultiple(buffer, 0);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_EQ(0u, q.PopMultiple(buffer, 64));
+
+  // A batch push pops back in FIFO order, in one go or in parts.
+  u32 values[10];
+  for (u32 i = 0; i < 10; ++i)
+    values[i] = i;
+  q.PushMultiple(values, 10);
+  EXPECT_EQ(10u, q.Size());
+
+  EXPECT_EQ(4u, q.PopMultiple(buffer, 4));
+  for (u32 i = 0; i < 4; ++i)
+    EXPECT_EQ(i, buffer[i]);
+  EXPECT_EQ(6u, q.Size());
+
+  // Popping more than is queued only returns what's there.
+  EXPECT_EQ(6u, q.PopMultiple(buffer, 64));
+  for (u32 i = 0; i < 6; ++i)
+    EXPECT_EQ(i + 4, buffer[i]);
+  EXPECT_TRUE(q.Empty());
+
+  // Batch and single-element operations interleave.
+  q.Push(100);
+  q.PushMultiple(values, 2);
+  q.Push(101);
+  EXPECT_EQ(4u, q.Size());
+  EXPECT_EQ(4u, q.PopMultiple(buffer, 64));
+  EXPECT_EQ(100u, buffer[0]);
+  EXPECT_EQ(0u, buffer[1]);
+  EXPECT_EQ(1u, buffer[2]);
+  EXPECT_EQ(101u, buffer[3]);
+  EXPECT_TRUE(q.Empty());
+
+  // A batch of one behaves like Push.
+  q.PushMultiple(values, 1);
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(0u, v);
+}
+
+TEST(SPSCQueue, BatchMultiThreaded)
+{
+  Common::SPSCQueue<u32> q;
+
+  constexpr u32 NUM_VALUES = 100000;
+
+  auto inserter = [&q]() {
+    u32 batch[7];
+    u32 next = 0;
+    while (next < NUM_VALUES)
+    {
+      const u32 count = std::min(NUM_VALUES - next, 7u);
+      for (u32 i = 0; i < count; ++i)
+        batch[i] = next + i;
+      q.PushMultiple(batch, count);
+      next += count;
+    }
+  };
+
+  auto popper = [&q]() {
+    u32 batch[16];
+    u32 next = 0;
+    while (next < NUM_VALUES)
+    {
+      const u32 count = static_cast<u32>(q.PopMultiple(batch, 16));
+      for (u32 i = 0; i < count; ++i)
+        EXPECT_EQ(next + i, batch[i]);
+      next += count;
+    }
+    EXPECT_TRUE(q.Empty());
+  };
+
+  std::thread popper_thread(popper);
+  std::thread inserter_thread(inserter);
+
+  popper_thread.join();
+  inserter_thread.join();
+}
+
+TEST(SPSCRingQueue, Simple)
+{
+  Common::SPSCRingQueue<u32, 8> q;
+
+  EXPECT_EQ(0u, q.Size());
+  EXPECT_TRUE(q.Empty());
+
+  // Fill the ring to capacity; the next push has to fail.
+  for (u32 i = 0; i < 8; ++i)
+    EXPECT_TRUE(q.Push(i));
+  EXPECT_EQ(8u, q.Size());
+  EXPECT_FALSE(q.Push(1000));
+  EXPECT_EQ(8u, q.Size());
+
+  // A batch push into a partially full ring only copies what fits.
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(0u, v);
+  u32 values[4] = {100, 101, 102, 103};
+  EXPECT_EQ(1u, q.PushMultiple(values, 4));
+  EXPECT_EQ(8u, q.Size());
+
+  // Everything drains in FIFO order, and a partial pop is bounded by what's
+  // queued.
+  u32 buffer[16];
+  EXPECT_EQ(3u, q.PopMultiple(buffer, 3));
+  for (u32 i = 0; i < 3; ++i)
+    EXPECT_EQ(i + 1, buffer[i]);
+  EXPECT_EQ(5u, q.PopMultiple(buffer, 16));
+  for (u32 i = 0; i < 4; ++i)
+    EXPECT_EQ(i + 4, buffer[i]);
+  EXPECT_EQ(100u, buffer[4]);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_EQ(0u, q.PopMultiple(buffer, 16));
+
+  q.Push(1);
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(SPSCRingQueue, WrapAround)
+{
+  Common::SPSCRingQueue<u32, 8> q;
+
+  // Offset the indices so batches straddle the end of the storage, and check
+  // that the data comes back intact across many laps of the ring.
+  u32 scratch[5] = {};
+  q.PushMultiple(scratch, 3);
+  q.PopMultiple(scratch, 3);
+
+  u32 next_push = 0;
+  u32 next_pop = 0;
+  for (u32 iteration = 0; iteration < 100; ++iteration)
+  {
+    u32 batch[5];
+    for (u32 i = 0; i < 5; ++i)
+      batch[i] = next_push + i;
+    EXPECT_EQ(5u, q.PushMultiple(batch, 5));
+    next_push += 5;
+
+    EXPECT_EQ(5u, q.PopMultiple(batch, 5));
+    for (u32 i = 0; i < 5; ++i)
+      EXPECT_EQ(next_pop + i, batch[i]);
+    next_pop += 5;
+  }
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(SPSCRingQueue, MultiThreaded)
+{
+  Common::SPSCRingQueue<u32, 32> q;
+
+  constexpr u32 NUM_VALUES = 100000;
+
+  auto inserter = [&q]() {
+    for (u32 i = 0; i < NUM_VALUES; ++i)
+    {
+      while (!q.Push(i))
+        std::this_thread::yield();
+    }
+  };
+
+  auto popper = [&q]() {
+    u32 batch[16];
+    u32 next = 0;
+    while (next < NUM_VALUES)
+    {
+      const u32 count = static_cast<u32>(q.PopMultiple(batch, 16));
+      if (count == 0)
+        std::this_thread::yield();
+      for (u32 i = 0; i < count; ++i)
+        EXPECT_EQ(next + i, batch[i]);
+      next += count;
+    }
+    EXPECT_TRUE(q.Empty());
+  };
+
+  std::thread popper_thread(popper);
+  std::thread inserter_thread(inserter);
+
+  popper_thread.join();
+  inserter_thread.join();
+}